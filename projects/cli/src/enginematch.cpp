@@ -41,7 +41,8 @@ EngineMatch::EngineMatch(Tournament* tournament, QObject* parent)
 	  m_bookMode(OpeningBook::Ram),
 	  m_eloKfactor(32.0),
 	  m_pgnFormat(true),
-	  m_jsonFormat(true)
+	  m_jsonFormat(true),
+	  m_latencyReport(false)
 {
 	Q_ASSERT(tournament != nullptr);
 
@@ -118,6 +119,7 @@ void EngineMatch::setBookMode(OpeningBook::AccessMode mode)
 void EngineMatch::setTournamentFile(QString& tournamentFile)
 {
 	m_tournamentFile = tournamentFile;
+	m_tournament->setResumeCheckpoints(!tournamentFile.isEmpty());
 }
 
 void EngineMatch::setEloKfactor(qreal eloKfactor)
@@ -140,6 +142,11 @@ void EngineMatch::setDebugFile(const QString& debugFile)
 	}
 }
 
+void EngineMatch::setLatencyReport(bool enabled)
+{
+	m_latencyReport = enabled;
+}
+
 void EngineMatch::generateSchedule(QVariantMap& eMap)
 {
 	QVariantList pList = eMap["matchProgress"].toList();
@@ -945,6 +952,15 @@ void EngineMatch::generateCrossTable(QVariantMap& eMap)
 	}
 }
 
+void EngineMatch::insertCheckpoint(QVariantMap* tfMap) const
+{
+	const QVariantMap checkpoint(m_tournament->resumeCheckpoint());
+	if (checkpoint.isEmpty())
+		tfMap->remove("checkpoint");
+	else
+		tfMap->insert("checkpoint", checkpoint);
+}
+
 void EngineMatch::onGameStarted(ChessGame* game, int number)
 {
 	Q_ASSERT(game != nullptr);
@@ -1081,6 +1097,11 @@ void EngineMatch::onGameFinished(ChessGame* game, int number)
 				}
 				pMap.insert("finalFen", game->board()->fenString());
 
+				QVariantMap latencyMap;
+				latencyMap.insert("white", game->moveLatency(Chess::Side::White).toVariantMap());
+				latencyMap.insert("black", game->moveLatency(Chess::Side::Black).toVariantMap());
+				pMap.insert("moveLatency", latencyMap);
+
 				MoveEvaluation eval;
 				QString sScore;
 				const Chess::Side sides[] = { Chess::Side::White, Chess::Side::Black, Chess::Side::NoSide };
@@ -1119,6 +1140,15 @@ void EngineMatch::onGameFinished(ChessGame* game, int number)
 				tfMap.insert("matchProgress", pList);
 				tfMap.insert("strikes", stMap);
 
+				QVariantMap playerLatencyMap;
+				for (int ii = 0; ii < m_tournament->playerCount(); ii++) {
+					const TournamentPlayer& plr(m_tournament->playerAt(ii));
+					if (!plr.moveLatency().isEmpty())
+						playerLatencyMap.insert(plr.name(), plr.moveLatency().toVariantMap());
+				}
+				tfMap.insert("moveLatency", playerLatencyMap);
+				insertCheckpoint(&tfMap);
+
 				QFile output(m_tournamentFile);
 				if (!output.open(QIODevice::WriteOnly | QIODevice::Text)) {
 					qWarning("cannot open tournament configuration file: %s", qUtf8Printable(m_tournamentFile));
@@ -1202,6 +1232,7 @@ void EngineMatch::onGameSkipped(int number, int iWhite, int iBlack)
 		pMap.insert("terminationDetails", "Skipped");
 		pList.append(pMap);
 		tfMap.insert("matchProgress", pList);
+		insertCheckpoint(&tfMap);
 		{
 			QFile output(m_tournamentFile);
 			if (!output.open(QIODevice::WriteOnly | QIODevice::Text)) {
@@ -1288,4 +1319,8 @@ void EngineMatch::print(const QString& msg)
 void EngineMatch::printRanking()
 {
 	qInfo("%s", qUtf8Printable(m_tournament->results()));
+
+	if (m_latencyReport)
+		qInfo("Move latency (microseconds):\n%s",
+		      qUtf8Printable(m_tournament->moveLatencyReport()));
 }
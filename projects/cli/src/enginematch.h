@@ -48,6 +48,7 @@ class EngineMatch : public QObject
 		void setEloKfactor(qreal eloKfactor);
 		void setOutputFormats(bool pgnFormat, bool jsonFormat);
 		void setDebugFile(const QString& debugFile);
+		void setLatencyReport(bool enabled);
 
 		void start();
 		void stop();
@@ -66,6 +67,7 @@ class EngineMatch : public QObject
 		void printRanking();
 		void generateSchedule(QVariantMap& eMap);
 		void generateCrossTable(QVariantMap& eMap);
+		void insertCheckpoint(QVariantMap* tfMap) const;
 
 		Tournament* m_tournament;
 		bool m_debug;
@@ -77,6 +79,7 @@ class EngineMatch : public QObject
 		qreal m_eloKfactor;
 		bool m_pgnFormat;
 		bool m_jsonFormat;
+		bool m_latencyReport;
 		QFile m_debugFile;
 		QTextStream m_debugOut;
 };
@@ -29,6 +29,8 @@
 #include <mersenne.h>
 #include <enginemanager.h>
 #include <enginebuilder.h>
+#include <engineworker.h>
+#include <workerpool.h>
 #include <gamemanager.h>
 #include <tournament.h>
 #include <tournamentfactory.h>
@@ -43,6 +45,7 @@
 #include <jsonserializer.h>
 #include <econode.h>
 #include <pgnstream.h>
+#include <movelatency.h>
 
 #include "cutechesscoreapp.h"
 #include "matchparser.h"
@@ -372,6 +375,7 @@ EngineMatch* parseMatch(const QStringList& args, CuteChessCoreApplication& app)
 	parser.addOption("-each", QVariant::StringList, 1);
 	parser.addOption("-variant", QVariant::String, 1, 1);
 	parser.addOption("-concurrency", QVariant::Int, 1, 1);
+	parser.addOption("-lookahead", QVariant::Int, 1, 1);
 	parser.addOption("-draw", QVariant::StringList);
 	parser.addOption("-resign", QVariant::StringList);
 	parser.addOption("-maxmoves", QVariant::Int, 1, 1);
@@ -379,11 +383,15 @@ EngineMatch* parseMatch(const QStringList& args, CuteChessCoreApplication& app)
  	parser.addOption("-tbdrawonly", QVariant::Bool, 0, 0); 
 	parser.addOption("-tbpieces", QVariant::Int, 1, 1);
 	parser.addOption("-tbignore50", QVariant::Bool, 0, 0);
+	parser.addOption("-tbasync", QVariant::Bool, 0, 0);
+	parser.addOption("-tbwarm", QVariant::Int, 1, 1);
 	parser.addOption("-event", QVariant::String, 1, 1);
 	parser.addOption("-games", QVariant::Int, 1, 1);
 	parser.addOption("-rounds", QVariant::Int, 1, 1);
 	parser.addOption("-sprt", QVariant::StringList);
+	parser.addOption("-pairsprt", QVariant::Bool, 0, 0);
 	parser.addOption("-ratinginterval", QVariant::Int, 1, 1);
+	parser.addOption("-latency", QVariant::Bool, 0, 0);
 	parser.addOption("-debug", QVariant::String, 0, 1);
 	parser.addOption("-openings", QVariant::StringList);
 	parser.addOption("-bookmode", QVariant::String);
@@ -404,6 +412,8 @@ EngineMatch* parseMatch(const QStringList& args, CuteChessCoreApplication& app)
 	parser.addOption("-reloadconf", QVariant::Bool, 0, 0);
 	parser.addOption("-tcecadj", QVariant::Bool, 0, 0);
 	parser.addOption("-strikes", QVariant::Int, 1, 1);
+	parser.addOption("-workers", QVariant::StringList, 1, -1);
+	parser.addOption("-workersecret", QVariant::String, 1, 1);
 
 	if (!parser.parse())
 		return nullptr;
@@ -512,6 +522,33 @@ EngineMatch* parseMatch(const QStringList& args, CuteChessCoreApplication& app)
 	EngineMatch* match = new EngineMatch(tournament, &app);
 	if (!tournamentFile.isEmpty()) match->setTournamentFile(tournamentFile);
 
+	// Remote workers for the engines
+	WorkerPool* workerPool = nullptr;
+	const QStringList workers = parser.takeOption("-workers").toStringList();
+	const QString workerSecret = parser.takeOption("-workersecret").toString();
+	if (!workers.isEmpty())
+	{
+		if (workerSecret.isEmpty())
+		{
+			qWarning("Option -workers needs -workersecret");
+			delete match;
+			return nullptr;
+		}
+
+		workerPool = new WorkerPool(match);
+		workerPool->setSecret(workerSecret);
+		for (const QString& address : workers)
+		{
+			if (!workerPool->addWorker(address))
+			{
+				qWarning("Invalid worker address: %s",
+					 qUtf8Printable(address));
+				delete match;
+				return nullptr;
+			}
+		}
+	}
+
 	QList<EngineData> engines;
 	QStringList eachOptions;
 	GameAdjudicator adjudicator;
@@ -567,6 +604,8 @@ EngineMatch* parseMatch(const QStringList& args, CuteChessCoreApplication& app)
 			tournament->setOpeningRepetitions(tMap["openingRepetitions"].toInt());
 		if (tMap.contains("concurrency"))
 			gameManager->setConcurrency(tMap["concurrency"].toInt());
+		if (tMap.contains("lookahead"))
+			gameManager->setQueueWindow(tMap["lookahead"].toInt());
 		if (tMap.contains("drawAdjudication")) {
 			QVariantMap dMap = tMap["drawAdjudication"].toMap();
 			if (dMap.contains("movenumber") &&
@@ -613,6 +652,8 @@ EngineMatch* parseMatch(const QStringList& args, CuteChessCoreApplication& app)
 		if (tMap.contains("tbIgnore50"))
 			if (tMap["tbIgnore50"].toBool())
 				SyzygyTablebase::setNoRule50();
+		if (tMap.contains("tbAsync"))
+			adjudicator.setAsyncTablebaseProbes(tMap["tbAsync"].toBool());
 
 		if (tMap.contains("openings")) {
 			openingsOption.name = "-openings";
@@ -622,6 +663,18 @@ EngineMatch* parseMatch(const QStringList& args, CuteChessCoreApplication& app)
 			openingsOption.name = "-bookmode";
 			openingsOption.value = tMap["bookmode"];
 		}
+		if (tMap.contains("sprt")) {
+			QVariantMap sMap = tMap["sprt"].toMap();
+			const Sprt::Model model = sMap["model"].toString() == "pentanomial"
+				? Sprt::Pentanomial : Sprt::Trinomial;
+			tournament->sprt()->initialize(sMap["elo0"].toDouble(),
+						       sMap["elo1"].toDouble(),
+						       sMap["alpha"].toDouble(),
+						       sMap["beta"].toDouble(),
+						       model);
+		}
+		if (tMap.contains("pairSprt"))
+			tournament->setPairSprt(tMap["pairSprt"].toBool());
 		if (tMap.contains("bergerSchedule"))
 			tournament->setBergerSchedule(tMap["bergerSchedule"].toBool());
 		if (tMap.contains("reloadConfiguration"))
@@ -634,6 +687,7 @@ EngineMatch* parseMatch(const QStringList& args, CuteChessCoreApplication& app)
 		if (tfMap.contains("matchProgress")) {
 			if (!wantsResume) {
 				tfMap.remove("matchProgress");
+				tfMap.remove("checkpoint");
 			} else {
 				QVariantList pList;
 				int nextGame = 0;
@@ -644,7 +698,10 @@ EngineMatch* parseMatch(const QStringList& args, CuteChessCoreApplication& app)
 				for (p = pList.begin(); p != pList.end(); ++p) {
 					QVariantMap pMap = p->toMap();
 					addResumeScore(pMap["result"], pMap["white"], pMap["black"], &engineMap);
-					tournament->addResumeGameResult(nextGame++, pMap["result"].toString());
+					tournament->addResumeGameResult(nextGame++,
+									pMap["white"].toString(),
+									pMap["black"].toString(),
+									pMap["result"].toString());
 					matchNum = matchNum + 1;
 					if (pMap["result"] == "*") {
 						pList.erase(p, pList.end());
@@ -654,12 +711,23 @@ EngineMatch* parseMatch(const QStringList& args, CuteChessCoreApplication& app)
 					if (pMap["terminationDetails"] == "Skipped") {
 						qWarning() << "ARUN: Skipping Game:" << matchNum;
 					}
+
+					// The latency of the kept games goes back to the players' totals
+					const QVariantMap latencyMap = pMap["moveLatency"].toMap();
+					if (!latencyMap.isEmpty()) {
+						tournament->addResumeMoveLatency(pMap["white"].toString(),
+							MoveLatency::fromVariantMap(latencyMap["white"].toMap()));
+						tournament->addResumeMoveLatency(pMap["black"].toString(),
+							MoveLatency::fromVariantMap(latencyMap["black"].toMap()));
+					}
 				}
 				tfMap.insert("matchProgress", pList);
 				nextGame = pList.size();
 			   qWarning() << "ARUN: Skipping Game:" << nextGame;
-				if (nextGame > 0)
+				if (nextGame > 0) {
 					tournament->setResume(nextGame);
+					tournament->setResumeCheckpoint(tfMap["checkpoint"].toMap());
+				}
 			}
 		}
 		if (eMap.contains("engines")) {
@@ -721,6 +789,15 @@ EngineMatch* parseMatch(const QStringList& args, CuteChessCoreApplication& app)
 					tMap.insert("concurrency", value.toInt());
 				}
 			}
+			// Number of games queued ahead of the running games
+			else if (name == "-lookahead")
+			{
+				ok = value.toInt() >= 0;
+				if (ok) {
+					gameManager->setQueueWindow(value.toInt());
+					tMap.insert("lookahead", value.toInt());
+				}
+			}
 			// Threshold for draw adjudication
 			else if (name == "-draw")
 			{
@@ -808,6 +885,20 @@ EngineMatch* parseMatch(const QStringList& args, CuteChessCoreApplication& app)
 					SyzygyTablebase::setNoRule50();
 				tMap.insert("tbIgnore50", flag);
 			}
+			// Probe the tablebases in the background
+			else if (name == "-tbasync")
+			{
+				bool flag = value.toBool();
+				adjudicator.setAsyncTablebaseProbes(flag);
+				tMap.insert("tbAsync", flag);
+			}
+			// Read the tablebases into the page cache
+			else if (name == "-tbwarm")
+			{
+				ok = value.toInt() > 2;
+				if (ok)
+					tMap.insert("tbWarm", value.toInt());
+			}
 			// Event name
 			else if (name == "-event")
 			{
@@ -847,30 +938,58 @@ EngineMatch* parseMatch(const QStringList& args, CuteChessCoreApplication& app)
 			// SPRT-based stopping rule
 			else if (name == "-sprt")
 			{
-				QMap<QString, QString> params = option.toMap("elo0|elo1|alpha|beta");
+				QMap<QString, QString> params =
+					option.toMap("elo0|elo1|alpha|beta|model=trinomial");
 				bool sprtOk[4];
 				double elo0 = params["elo0"].toDouble(sprtOk);
 				double elo1 = params["elo1"].toDouble(sprtOk + 1);
 				double alpha = params["alpha"].toDouble(sprtOk + 2);
 				double beta = params["beta"].toDouble(sprtOk + 3);
 
-				ok = (sprtOk[0] && sprtOk[1] && sprtOk[2] && sprtOk[3]);
+				Sprt::Model model = Sprt::Trinomial;
+				bool modelOk = true;
+				if (params["model"] == "pentanomial")
+					model = Sprt::Pentanomial;
+				else if (params["model"] != "trinomial")
+					modelOk = false;
+
+				ok = (sprtOk[0] && sprtOk[1] && sprtOk[2] && sprtOk[3]
+				      && modelOk);
 				if (ok) {
-					tournament->sprt()->initialize(elo0, elo1, alpha, beta);
+					tournament->sprt()->initialize(elo0, elo1, alpha, beta, model);
 					QVariantMap sMap;
 					sMap.insert("elo0", elo0);
 					sMap.insert("elo1", elo1);
 					sMap.insert("alpha", alpha);
 					sMap.insert("beta", beta);
+					sMap.insert("model", params["model"]);
 					tMap.insert("sprt", sMap);
 				}
 			}
+			// Separate SPRT for every pair of a gauntlet
+			else if (name == "-pairsprt")
+			{
+				ok = tournament->type() == "gauntlet";
+				if (ok) {
+					tournament->setPairSprt(true);
+					tMap.insert("pairSprt", true);
+				}
+				else
+					qWarning("Per-pair SPRT is only supported in "
+						 "gauntlet tournaments");
+			}
 			// Interval for rating list updates
 			else if (name == "-ratinginterval")
 			{
 				match->setRatingInterval(value.toInt());
 				tMap.insert("ratingInterval", value.toInt());
 			}
+			// Print the move latency report with the ratings
+			else if (name == "-latency")
+			{
+				match->setLatencyReport(true);
+				tMap.insert("latencyReport", true);
+			}
 			// Use an opening suite
 			else if (name == "-openings")
 				openingsOption = option;
@@ -1084,6 +1203,9 @@ EngineMatch* parseMatch(const QStringList& args, CuteChessCoreApplication& app)
 	if (tMap.contains("eloKfactor"))
 		match->setEloKfactor(tMap["eloKfactor"].toDouble());
 
+	if (tMap.contains("latencyReport"))
+		match->setLatencyReport(tMap["latencyReport"].toBool());
+
 	if (!eachOptions.isEmpty())
 	{
 		QList<EngineData>::iterator it;
@@ -1119,7 +1241,9 @@ EngineMatch* parseMatch(const QStringList& args, CuteChessCoreApplication& app)
 			break;
 		}
 
-		tournament->addPlayer(new EngineBuilder(engine.config),
+		EngineBuilder* builder = new EngineBuilder(engine.config);
+		builder->setWorkerPool(workerPool);
+		tournament->addPlayer(builder,
 				      engine.tc,
 				      match->addOpeningBook(engine.book),
 				      engine.bookDepth);
@@ -1141,10 +1265,18 @@ EngineMatch* parseMatch(const QStringList& args, CuteChessCoreApplication& app)
 			match->setBookMode(OpeningBook::Ram);
 		else if (val == "disk")
 			match->setBookMode(OpeningBook::Disk);
+		else if (val == "mmap")
+			match->setBookMode(OpeningBook::Mapped);
 		else
 			ok = false;
 	}
 
+	if (tournament->usesPairSprt() && tournament->sprt()->isNull())
+	{
+		qWarning("Option \"-pairsprt\" needs the \"-sprt\" option");
+		ok = false;
+	}
+
 	if (engines.size() < 2)
 	{
 		qWarning("At least two engines are needed");
@@ -1180,11 +1312,55 @@ EngineMatch* parseMatch(const QStringList& args, CuteChessCoreApplication& app)
 		serializer.serialize(out);
 	}
 
+	// The tablebase paths may be given after -tbwarm
+	if (tMap.contains("tbWarm"))
+		SyzygyTablebase::warmCache(tMap["tbWarm"].toInt());
 	tournament->setAdjudicator(adjudicator);
 
 	return match;
 }
 
+int runWorker(const QStringList& args)
+{
+	MatchParser parser(args);
+	parser.addOption("-worker", QVariant::StringList, 0, 4);
+	if (!parser.parse())
+		return 1;
+
+	const MatchParser::Option option = parser.options().first();
+	const QMap<QString, QString> params =
+		option.toMap("port|secret|slots=0|address=127.0.0.1");
+	bool ok[2];
+	const int port = params["port"].toInt(ok);
+	const int slots = params["slots"].toInt(ok + 1);
+	const QHostAddress address(params["address"]);
+	if (params.isEmpty() || !ok[0] || !ok[1]
+	||  port <= 0 || port > 65535 || slots < 0
+	||  params["secret"].isEmpty() || address.isNull())
+	{
+		qWarning("Invalid worker options");
+		return 1;
+	}
+
+	// Only the engines configured on this computer can be started
+	auto app = CuteChessCoreApplication::instance();
+	EngineWorker worker;
+	worker.setSecret(params["secret"]);
+	worker.setEngines(app->engineManager()->engines());
+	worker.setSlotCount(slots);
+	if (!worker.listen(quint16(port), address))
+	{
+		qWarning("Cannot listen on %s port %d: %s",
+			 qUtf8Printable(address.toString()), port,
+			 qUtf8Printable(worker.errorString()));
+		return 1;
+	}
+
+	qInfo("Worker listening on %s port %d",
+	      qUtf8Printable(address.toString()), worker.port());
+	return QCoreApplication::exec();
+}
+
 } // anonymous namespace
 
 int main(int argc, char* argv[])
@@ -1236,6 +1412,9 @@ int main(int argc, char* argv[])
 		}
 	}
 
+	if (arguments.contains("-worker"))
+		return runWorker(arguments);
+
 	s_match = parseMatch(arguments, app);
 	if (s_match == nullptr)
 		return 1;
@@ -26,11 +26,14 @@
 #include <QFileDialog>
 #include <QInputDialog>
 #include <QClipboard>
+#include <QLabel>
+#include <algorithm>
 
 #include <pgnstream.h>
 #include <pgngame.h>
 #include <pgngameentry.h>
 #include <polyglotbook.h>
+#include <positionindex.h>
 
 #include "pgndatabasemodel.h"
 #include "pgngameentrymodel.h"
@@ -115,8 +118,8 @@ PgnGame PgnGameIterator::next(bool* ok, int depth)
 		return game;
 	}
 
-	const PgnGameEntry* entry = m_dlg->m_pgnGameEntryModel->entryAt(m_gameIndex++);
-	*ok = m_in.seek(entry->pos(), entry->lineNumber()) && game.read(m_in, depth);
+	const PgnGameEntry entry = m_dlg->m_pgnGameEntryModel->entryAt(m_gameIndex++);
+	*ok = m_in.seek(entry.pos(), entry.lineNumber()) && game.read(m_in, depth);
 
 	return game;
 }
@@ -257,6 +260,8 @@ GameDatabaseDialog::GameDatabaseDialog(GameDatabaseManager* dbManager, QWidget*
 	  m_dbManager(dbManager),
 	  m_pgnDatabaseModel(nullptr),
 	  m_pgnGameEntryModel(nullptr),
+	  m_positionSearch(false),
+	  m_positionStatsLabel(nullptr),
 	  ui(new Ui::GameDatabaseDialog)
 {
 	Q_ASSERT(dbManager != nullptr);
@@ -284,6 +289,12 @@ GameDatabaseDialog::GameDatabaseDialog(GameDatabaseManager* dbManager, QWidget*
 	m_gameViewer = new GameViewer(Qt::Horizontal);
 	ui->m_viewerLayout->insertWidget(0, m_gameViewer);
 
+	m_positionStatsLabel = new QLabel(this);
+	m_positionStatsLabel->setWordWrap(true);
+	m_positionStatsLabel->setTextInteractionFlags(Qt::TextSelectableByMouse);
+	m_positionStatsLabel->hide();
+	ui->m_viewerLayout->addWidget(m_positionStatsLabel);
+
 	ui->m_splitter->setSizes(QList<int>() << 100 << 500 << 300);
 
 	connect(ui->m_importBtn, &QPushButton::clicked, this, [=]()
@@ -318,6 +329,9 @@ GameDatabaseDialog::GameDatabaseDialog(GameDatabaseManager* dbManager, QWidget*
 		ui->m_copyFenBtn->setText(tr("Copy FEN"));
 	});
 
+	connect(ui->m_findPositionBtn, SIGNAL(clicked()),
+		this, SLOT(findPosition()));
+
 	connect(ui->m_databasesListView->selectionModel(),
 		SIGNAL(selectionChanged(const QItemSelection&, const QItemSelection&)),
 		this, SLOT(databaseSelectionChanged(const QItemSelection&, const QItemSelection&)));
@@ -360,18 +374,25 @@ void GameDatabaseDialog::databaseSelectionChanged(const QItemSelection& selected
 	for (const QModelIndex& index : selectedIndexes)
 		m_selectedDatabases[index.row()] = m_dbManager->databases().at(index.row());
 
+	// The game numbers of a position search are only valid for
+	// the databases that were searched
+	if (m_positionSearch)
+	{
+		clearPositionSearch();
+		ui->m_searchEdit->clear();
+		ui->m_searchEdit->setEnabled(true);
+		ui->m_clearBtn->setEnabled(false);
+		m_searchTerms.clear();
+		m_pgnGameEntryModel->setFilter(PgnGameFilter());
+	}
+
 	if (m_selectedDatabases.isEmpty())
 	{
-		m_pgnGameEntryModel->setEntries(QList<const PgnGameEntry*>());
+		m_pgnGameEntryModel->setDatabases(QList<PgnDatabase*>());
 		return;
 	}
 
-	QList<const PgnGameEntry*> entries;
-	QMap<int, PgnDatabase*>::const_iterator it;
-	for (it = m_selectedDatabases.constBegin(); it != m_selectedDatabases.constEnd(); ++it)
-		entries.append(it.value()->entries());
-
-	m_pgnGameEntryModel->setEntries(entries);
+	m_pgnGameEntryModel->setDatabases(m_selectedDatabases.values());
 	ui->m_advancedSearchBtn->setEnabled(true);
 }
 
@@ -390,7 +411,7 @@ void GameDatabaseDialog::gameSelectionChanged(const QModelIndex& current,
 	PgnDatabase* selectedDatabase = m_dbManager->databases().at(databaseIndex);
 
 	PgnDatabase::Status status;
-	const PgnGameEntry* entry = m_pgnGameEntryModel->entryAt(current.row());
+	const PgnGameEntry entry = m_pgnGameEntryModel->entryAt(current.row());
 
 	if ((status = selectedDatabase->game(entry, &m_game)) != PgnDatabase::Ok)
 	{
@@ -457,6 +478,12 @@ void GameDatabaseDialog::gameSelectionChanged(const QModelIndex& current,
 
 void GameDatabaseDialog::updateSearch(const QString& terms)
 {
+	if (m_positionSearch)
+	{
+		clearPositionSearch();
+		m_pgnGameEntryModel->clearIndexFilter();
+	}
+
 	ui->m_clearBtn->setEnabled(!terms.isEmpty());
 	m_searchTerms = terms;
 	m_searchTimer.start(500);
@@ -489,7 +516,7 @@ int GameDatabaseDialog::databaseIndexFromGame(int game) const
 	QMap<int, PgnDatabase*>::const_iterator it;
 	for (it = m_selectedDatabases.constBegin(); it != m_selectedDatabases.constEnd(); ++it)
 	{
-		game -= it.value()->entries().count();
+		game -= it.value()->entryCount();
 		if (game < 0)
 			return it.key();
 	}
@@ -572,6 +599,100 @@ void GameDatabaseDialog::copyFen()
 	ui->m_copyFenBtn->setText(tr("Copied"));
 }
 
+void GameDatabaseDialog::findPosition()
+{
+	Chess::Board* board = m_gameViewer->board();
+	if (m_game.isNull() || board == nullptr)
+		return;
+
+	const quint64 key = board->key();
+	QVector<int> games;
+	QVector<PositionIndex::MoveStats> stats;
+	int unindexed = 0;
+
+	// Game numbers are offset by the games of the previous
+	// databases, like in the game entry model
+	int offset = 0;
+	for (const PgnDatabase* db : qAsConst(m_selectedDatabases))
+	{
+		if (!db->hasPositionIndex())
+		{
+			offset += db->entryCount();
+			unindexed++;
+			continue;
+		}
+
+		const QVector<int> dbGames(db->positionGames(key));
+		for (int game : dbGames)
+			games.append(offset + game);
+		offset += db->entryCount();
+
+		const auto dbStats = db->positionMoveStats(key);
+		for (const PositionIndex::MoveStats& dbStat : dbStats)
+		{
+			auto it = std::find_if(stats.begin(), stats.end(),
+				[&](const PositionIndex::MoveStats& stat)
+			{
+				return stat.move == dbStat.move;
+			});
+			if (it == stats.end())
+			{
+				stats.append(dbStat);
+				continue;
+			}
+			it->games += dbStat.games;
+			it->whiteWins += dbStat.whiteWins;
+			it->blackWins += dbStat.blackWins;
+			it->draws += dbStat.draws;
+		}
+	}
+	std::stable_sort(stats.begin(), stats.end(),
+			 [](const PositionIndex::MoveStats& a,
+			    const PositionIndex::MoveStats& b)
+	{
+		return a.games > b.games;
+	});
+
+	QStringList lines;
+	for (const PositionIndex::MoveStats& stat : qAsConst(stats))
+	{
+		QString move(tr("End of game"));
+		if (!stat.move.isNull())
+		{
+			const Chess::Move m(board->moveFromGenericMove(stat.move));
+			move = board->moveString(m, Chess::Board::StandardAlgebraic);
+		}
+		lines << tr("%1: %2 games, +%3 -%4 =%5")
+			 .arg(move).arg(stat.games).arg(stat.whiteWins)
+			 .arg(stat.blackWins).arg(stat.draws);
+	}
+	if (lines.isEmpty())
+		lines << tr("No games reach this position.");
+	if (unindexed > 0)
+		lines << tr("%n database(s) without a position index "
+			    "were not searched.", nullptr, unindexed);
+
+	m_positionSearch = true;
+	m_positionStatsLabel->setText(lines.join('\n'));
+	m_positionStatsLabel->show();
+
+	m_searchTimer.stop();
+	m_searchTerms.clear();
+	ui->m_searchEdit->setText(tr("[Position search]"));
+	ui->m_searchEdit->setEnabled(false);
+	ui->m_clearBtn->setEnabled(true);
+
+	m_pgnGameEntryModel->setFilter(PgnGameFilter());
+	m_pgnGameEntryModel->setIndexFilter(games);
+}
+
+void GameDatabaseDialog::clearPositionSearch()
+{
+	m_positionSearch = false;
+	m_positionStatsLabel->hide();
+	m_positionStatsLabel->clear();
+}
+
 void GameDatabaseDialog::updateUi()
 {
 	bool enable = m_pgnGameEntryModel->rowCount() > 0;
@@ -579,6 +700,11 @@ void GameDatabaseDialog::updateUi()
 	ui->m_exportBtn->setEnabled(enable);
 	ui->m_copyGameBtn->setEnabled(enable);
 	ui->m_copyFenBtn->setEnabled(enable);
+
+	bool indexed = false;
+	for (const PgnDatabase* db : qAsConst(m_selectedDatabases))
+		indexed = indexed || db->hasPositionIndex();
+	ui->m_findPositionBtn->setEnabled(indexed && !m_game.isNull());
 }
 
 #include "gamedatabasedlg.moc"
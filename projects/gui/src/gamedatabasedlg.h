@@ -30,6 +30,7 @@ class PgnDatabaseModel;
 class PgnGameEntryModel;
 class PgnDatabase;
 class GameViewer;
+class QLabel;
 
 namespace Ui {
 	class GameDatabaseDialog;
@@ -63,11 +64,13 @@ class GameDatabaseDialog : public QDialog
 		void createOpeningBook();
 		void copyGame();
 		void copyFen();
+		void findPosition();
 		void updateUi();
 
 	private:
 		friend class PgnGameIterator;
 		int databaseIndexFromGame(int game) const;
+		void clearPositionSearch();
 
 		GameViewer* m_gameViewer;
 		PgnGame m_game;
@@ -80,6 +83,8 @@ class GameDatabaseDialog : public QDialog
 
 		QTimer m_searchTimer;
 		QString m_searchTerms;
+		bool m_positionSearch;
+		QLabel* m_positionStatsLabel;
 		Ui::GameDatabaseDialog* ui;
 };
 
@@ -25,12 +25,13 @@
 #include <pgngameentry.h>
 
 #include "pgndatabase.h"
+#include "pgndatabaseindex.h"
 #include "pgnimporter.h"
 #include "importprogressdlg.h"
 #include "cutechessapp.h"
 
 #define GAME_DATABASE_STATE_MAGIC   0xDEADD00D
-#define GAME_DATABASE_STATE_VERSION 1
+#define GAME_DATABASE_STATE_VERSION 2
 
 GameDatabaseManager::GameDatabaseManager(QObject* parent)
 	: QObject(parent),
@@ -65,17 +66,12 @@ bool GameDatabaseManager::writeState(const QString& fileName)
 	// Write the number of databases
 	out << (qint32)m_databases.count();
 
-	// Write the contents of the databases
+	// Write the databases. Their games are in the database indexes.
 	for (const PgnDatabase* db : qAsConst(m_databases))
 	{
 		out << db->fileName();
 		out << db->lastModified();
 		out << db->displayName();
-		out << (qint32)db->entries().count();
-
-		const auto entries = db->entries();
-		for (const PgnGameEntry* entry : entries)
-			entry->write(out);
 	}
 
 	m_modified = false;
@@ -107,10 +103,8 @@ bool GameDatabaseManager::readState(const QString& fileName)
 	quint32 version;
 	in >> version;
 
-	if (version < GAME_DATABASE_STATE_VERSION ||
-	    version > GAME_DATABASE_STATE_VERSION)
+	if (version < 1 || version > GAME_DATABASE_STATE_VERSION)
 	{
-		// TODO: Add backward compatibility
 		qWarning("GameDatabaseManager: state file version mismatch");
 		return false;
 	}
@@ -124,6 +118,9 @@ bool GameDatabaseManager::readState(const QString& fileName)
 	QDateTime dbLastModified;
 	QString dbDisplayName;
 	QList<PgnDatabase*> readDatabases;
+	// Set if the state file must be written again, eg. in
+	// the current version
+	bool modified = false;
 
 	for (int i = 0; i < dbCount; i++)
 	{
@@ -131,43 +128,77 @@ bool GameDatabaseManager::readState(const QString& fileName)
 		in >> dbLastModified;
 		in >> dbDisplayName;
 
+		// Version 1 state files have the entries of every database
+		QList<const PgnGameEntry*> entries;
+		if (version == 1)
+		{
+			qint32 dbEntryCount;
+			in >> dbEntryCount;
+
+			for (int j = 0; j < dbEntryCount; j++)
+			{
+				PgnGameEntry* entry = new PgnGameEntry;
+				entry->read(in);
+				entries << entry;
+			}
+		}
+
 		// Check if the database exists
 		QFileInfo fileInfo(dbFileName);
 		if (!fileInfo.exists())
 		{
-			m_modified = true;
+			qDeleteAll(entries);
+			modified = true;
 			continue;
 		}
 
 		// Check if the database has been modified
 		if (fileInfo.lastModified() > dbLastModified)
 		{
-			m_modified = true;
+			qDeleteAll(entries);
+			modified = true;
 			importPgnFile(dbFileName);
 			continue;
 		}
 
-		qint32 dbEntryCount;
-		in >> dbEntryCount;
-
-		// Read the entries
-		QList<const PgnGameEntry*> entries;
-		for (int j = 0; j < dbEntryCount; j++)
+		PgnDatabaseIndex* index = new PgnDatabaseIndex(dbFileName);
+		if (version == 1)
 		{
-			PgnGameEntry* entry = new PgnGameEntry;
-			entry->read(in);
-			entries << entry;
+			// Move the entries to an index
+			if (index->update(0, entries, fileInfo.size(),
+					  fileInfo.lastModified()))
+				qDeleteAll(entries);
+			else
+			{
+				delete index;
+				index = nullptr;
+			}
+			modified = true;
+		}
+		else if (!index->open()
+		     ||  index->pgnSize() != fileInfo.size()
+		     ||  index->pgnLastModified() != fileInfo.lastModified())
+		{
+			// The index is missing or out of date. If games
+			// were only appended, the importer extends it.
+			delete index;
+			modified = true;
+			importPgnFile(dbFileName);
+			continue;
 		}
 
 		PgnDatabase* db = new PgnDatabase(dbFileName);
-		db->setEntries(entries);
+		if (index != nullptr)
+			db->setIndex(index);
+		else
+			db->setEntries(entries);
 		db->setLastModified(dbLastModified);
 		db->setDisplayName(dbDisplayName);
 
 		readDatabases << db;
 	}
 
-	m_modified = false;
+	m_modified = modified;
 
 	m_databases = readDatabases;
 	emit databasesReset();
@@ -100,6 +100,7 @@ GameSettingsWidget::GameSettingsWidget(QWidget *parent)
 		ui->m_polyglotDepthSpin->setEnabled(!str.isEmpty());
 		ui->m_ramAccessRadio->setEnabled(!str.isEmpty());
 		ui->m_diskAccessRadio->setEnabled(!str.isEmpty());
+		ui->m_mappedAccessRadio->setEnabled(!str.isEmpty());
 	});
 
 	readSettings();
@@ -187,6 +188,8 @@ OpeningBook* GameSettingsWidget::openingBook() const
 	auto mode = OpeningBook::Ram;
 	if (ui->m_diskAccessRadio->isChecked())
 		mode = OpeningBook::Disk;
+	else if (ui->m_mappedAccessRadio->isChecked())
+		mode = OpeningBook::Mapped;
 	auto book = new PolyglotBook(mode);
 	if (!book->read(file))
 	{
@@ -241,6 +244,8 @@ void GameSettingsWidget::readSettings()
 	ui->m_polyglotDepthSpin->setValue(s.value("depth", 10).toInt());
 	if (s.value("disk_access").toBool())
 		ui->m_diskAccessRadio->setChecked(true);
+	else if (s.value("mapped_access").toBool())
+		ui->m_mappedAccessRadio->setChecked(true);
 	s.endGroup();
 
 	s.beginGroup("draw_adjudication");
@@ -318,6 +323,10 @@ void GameSettingsWidget::enableSettingsUpdates()
 	{
 		QSettings().setValue("games/opening_book/disk_access", checked);
 	});
+	connect(ui->m_mappedAccessRadio, &QRadioButton::toggled, [=](bool checked)
+	{
+		QSettings().setValue("games/opening_book/mapped_access", checked);
+	});
 
 	connect(ui->m_drawMoveNumberSpin, static_cast<void (QSpinBox::*)(int)>(&QSpinBox::valueChanged),
 		[=](int moveNumber)
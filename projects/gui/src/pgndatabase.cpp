@@ -19,9 +19,11 @@
 #include "pgndatabase.h"
 #include <pgnstream.h>
 #include <QFileInfo>
+#include "pgndatabaseindex.h"
 
 PgnDatabase::PgnDatabase(const QString& fileName, QObject* parent)
 	: QObject(parent),
+	  m_index(nullptr),
 	  m_fileName(fileName),
 	  m_displayName(QFileInfo(fileName).completeBaseName())
 {
@@ -30,6 +32,7 @@ PgnDatabase::PgnDatabase(const QString& fileName, QObject* parent)
 PgnDatabase::~PgnDatabase()
 {
 	qDeleteAll(m_entries);
+	delete m_index;
 }
 
 void PgnDatabase::setEntries(const QList<const PgnGameEntry*>& entries)
@@ -38,9 +41,55 @@ void PgnDatabase::setEntries(const QList<const PgnGameEntry*>& entries)
 	m_entries = entries;
 }
 
-QList<const PgnGameEntry*> PgnDatabase::entries() const
+void PgnDatabase::setIndex(PgnDatabaseIndex* index)
 {
-	return m_entries;
+	qDeleteAll(m_entries);
+	m_entries.clear();
+
+	delete m_index;
+	m_index = index;
+}
+
+int PgnDatabase::entryCount() const
+{
+	if (m_index != nullptr)
+		return m_index->count();
+	return m_entries.size();
+}
+
+PgnGameEntry PgnDatabase::entry(int index) const
+{
+	if (m_index != nullptr)
+		return m_index->entry(index);
+	return *m_entries.at(index);
+}
+
+bool PgnDatabase::matchEntry(int index, const PgnGameFilter& filter) const
+{
+	if (m_index != nullptr)
+		return m_index->match(index, filter);
+	return m_entries.at(index)->match(filter);
+}
+
+bool PgnDatabase::hasPositionIndex() const
+{
+	return m_index != nullptr
+	&&     m_index->count() > 0
+	&&     m_index->positionIndexCount() == m_index->count();
+}
+
+QVector<int> PgnDatabase::positionGames(quint64 key) const
+{
+	if (!hasPositionIndex())
+		return QVector<int>();
+	return PositionIndex::games(m_index->positionIndexes(), key);
+}
+
+QVector<PositionIndex::MoveStats> PgnDatabase::positionMoveStats(quint64 key) const
+{
+	if (!hasPositionIndex())
+		return QVector<PositionIndex::MoveStats>();
+	return PositionIndex::moveStats(m_index->positionIndexes(), key);
 }
 
 QString PgnDatabase::fileName() const
@@ -82,10 +131,9 @@ void PgnDatabase::setDisplayName(const QString& displayName)
 	m_displayName = displayName;
 }
 
-PgnDatabase::Status PgnDatabase::game(const PgnGameEntry* entry,
+PgnDatabase::Status PgnDatabase::game(const PgnGameEntry& entry,
 				      PgnGame* game)
 {
-	Q_ASSERT(entry != nullptr);
 	Q_ASSERT(game != nullptr);
 
 	Status status = this->status();
@@ -97,7 +145,7 @@ PgnDatabase::Status PgnDatabase::game(const PgnGameEntry* entry,
 		return Unreadable;
 
 	PgnStream in(&file);
-	if (!in.seek(entry->pos(), entry->lineNumber()) || !game->read(in))
+	if (!in.seek(entry.pos(), entry.lineNumber()) || !game->read(in))
 		return Corrupted;
 
 	return Ok;
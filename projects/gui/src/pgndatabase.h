@@ -23,9 +23,13 @@
 #include <QList>
 #include <QDateTime>
 #include <QFile>
+#include <QVector>
 #include <pgngame.h>
 #include <pgngameentry.h>
+#include <pgngamefilter.h>
+#include <positionindex.h>
 class PgnStream;
+class PgnDatabaseIndex;
 
 /*!
  * \brief PGN database
@@ -62,17 +66,59 @@ class PgnDatabase : public QObject
 		 *
 		 * The database takes ownership of the PgnGameEntry objects
 		 * in \a entries.
+		 *
+		 * \note Entries kept in memory are only used when the
+		 * database can't have an index.
 		 */
 		void setEntries(const QList<const PgnGameEntry*>& entries);
 		/*!
-		 * Returns the list of game entries in this database.
+		 * Sets the on-disk index of this database to \a index.
+		 *
+		 * The database takes ownership of \a index, and its entries
+		 * replace any entries in memory.
+		 */
+		void setIndex(PgnDatabaseIndex* index);
+		/*! Returns the number of game entries in this database. */
+		int entryCount() const;
+		/*!
+		 * Returns the game entry at \a index.
 		 *
 		 * Game entries are light-weight "pointers" to the database. The game()
 		 * method can be used to read the move information.
 		 *
+		 * This function is thread-safe.
+		 *
 		 * \sa game()
 		 */
-		QList<const PgnGameEntry*> entries() const;
+		PgnGameEntry entry(int index) const;
+		/*!
+		 * Returns true if the game entry at \a index matches
+		 * \a filter.
+		 *
+		 * This is faster than calling match() on entry(index).
+		 * This function is thread-safe.
+		 */
+		bool matchEntry(int index, const PgnGameFilter& filter) const;
+
+		/*!
+		 * Returns true if every game of this database is in
+		 * its position index.
+		 */
+		bool hasPositionIndex() const;
+		/*!
+		 * Returns the indexes of the game entries that reach the
+		 * position with Zobrist key \a key, in ascending order.
+		 *
+		 * \sa hasPositionIndex()
+		 */
+		QVector<int> positionGames(quint64 key) const;
+		/*!
+		 * Returns statistics of the moves played from the position
+		 * with Zobrist key \a key.
+		 *
+		 * \sa hasPositionIndex()
+		 */
+		QVector<PositionIndex::MoveStats> positionMoveStats(quint64 key) const;
 
 		/*! Returns the file name of this database. */
 		QString fileName() const;
@@ -119,10 +165,11 @@ class PgnDatabase : public QObject
 		 *
 		 * \note \a game must be allocated by the caller and must not be NULL.
 		 */
-		Status game(const PgnGameEntry* entry, PgnGame* game);
+		Status game(const PgnGameEntry& entry, PgnGame* game);
 
 	private:
 		QList<const PgnGameEntry*> m_entries;
+		PgnDatabaseIndex* m_index;
 		QDateTime m_lastModified;
 		QString m_fileName;
 		QString m_displayName;
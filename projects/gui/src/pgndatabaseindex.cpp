@@ -0,0 +1,504 @@
+/*
+    This file is part of Cute Chess.
+    Copyright (C) 2008-2018 Cute Chess authors
+
+    Cute Chess is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Cute Chess is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Cute Chess.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "pgndatabaseindex.h"
+
+#include <algorithm>
+#include <limits>
+#include <QCoreApplication>
+#include <QCryptographicHash>
+#include <QDir>
+#include <QFileInfo>
+#include <QSaveFile>
+#include <QtEndian>
+
+#include <positionindex.h>
+#include "cutechessapp.h"
+
+namespace {
+
+const quint32 s_magic = 0x49474343; // "CCGI"
+const quint32 s_version = 1;
+
+// Magic, version and six 64-bit fields
+const qint64 s_tableHeaderSize = 56;
+// Stream position, line number and tag offset
+const qint64 s_recordSize = 24;
+// Magic, version and generation
+const qint64 s_poolHeaderSize = 16;
+// Amount of PGN data before the indexed end that must stay unchanged
+const qint64 s_checksumSize = 4096;
+
+template <typename T>
+void put(QByteArray* data, T value)
+{
+	const T le = qToLittleEndian(value);
+	data->append(reinterpret_cast<const char*>(&le), sizeof(T));
+}
+
+template <typename T>
+T get(const uchar* data)
+{
+	return qFromLittleEndian<T>(data);
+}
+
+QString indexBaseName(const QString& pgnFileName)
+{
+	const QString dir = CuteChessApplication::instance()->configPath()
+			    + QLatin1String("/gamedb");
+	QDir().mkpath(dir);
+
+	const QByteArray path = QFileInfo(pgnFileName).absoluteFilePath().toUtf8();
+	const QByteArray hash = QCryptographicHash::hash(
+		path, QCryptographicHash::Sha1).toHex();
+
+	return dir + '/' + QString::fromLatin1(hash);
+}
+
+QByteArray headerData(quint64 generation,
+		      qint64 count,
+		      qint64 poolSize,
+		      qint64 pgnSize,
+		      qint64 pgnLastModified,
+		      quint64 pgnChecksum)
+{
+	QByteArray data;
+	put(&data, s_magic);
+	put(&data, s_version);
+	put(&data, generation);
+	put(&data, count);
+	put(&data, poolSize);
+	put(&data, pgnSize);
+	put(&data, pgnLastModified);
+	put(&data, pgnChecksum);
+
+	return data;
+}
+
+// Returns the first game of position index part \a fileName, or -1
+int positionIndexFirstGame(const QString& fileName)
+{
+	bool ok = false;
+	const int firstGame = QFileInfo(fileName).completeBaseName()
+		.section('.', 1).toInt(&ok);
+
+	return ok ? firstGame : -1;
+}
+
+} // anonymous namespace
+
+PgnDatabaseIndex::PgnDatabaseIndex(const QString& pgnFileName)
+	: m_pgnFileName(pgnFileName),
+	  m_baseName(indexBaseName(pgnFileName)),
+	  m_table(nullptr),
+	  m_pool(nullptr),
+	  m_header{0, 0, 0, 0, 0, 0},
+	  m_positionIndexCount(0)
+{
+	m_tableFile.setFileName(m_baseName + QLatin1String(".idx"));
+	m_poolFile.setFileName(m_baseName + QLatin1String(".tags"));
+}
+
+PgnDatabaseIndex::~PgnDatabaseIndex()
+{
+	close();
+}
+
+QString PgnDatabaseIndex::pgnFileName() const
+{
+	return m_pgnFileName;
+}
+
+bool PgnDatabaseIndex::open()
+{
+	close();
+
+	if (!m_tableFile.open(QIODevice::ReadOnly)
+	||  !m_poolFile.open(QIODevice::ReadOnly))
+	{
+		close();
+		return false;
+	}
+
+	const qint64 tableSize = m_tableFile.size();
+	const qint64 poolSize = m_poolFile.size();
+	if (tableSize < s_tableHeaderSize || poolSize < s_poolHeaderSize)
+	{
+		close();
+		return false;
+	}
+
+	m_table = m_tableFile.map(0, tableSize);
+	m_pool = m_poolFile.map(0, poolSize);
+	if (m_table == nullptr || m_pool == nullptr)
+	{
+		close();
+		return false;
+	}
+
+	Header header;
+	header.generation = get<quint64>(m_table + 8);
+	header.count = get<qint64>(m_table + 16);
+	header.poolSize = get<qint64>(m_table + 24);
+	header.pgnSize = get<qint64>(m_table + 32);
+	header.pgnLastModified = get<qint64>(m_table + 40);
+	header.pgnChecksum = get<quint64>(m_table + 48);
+
+	// A half-written update leaves the generations or sizes
+	// inconsistent, in which case the index is rebuilt
+	if (get<quint32>(m_table) != s_magic
+	||  get<quint32>(m_table + 4) != s_version
+	||  get<quint32>(m_pool) != s_magic
+	||  get<quint32>(m_pool + 4) != s_version
+	||  get<quint64>(m_pool + 8) != header.generation
+	||  header.count < 0 || header.count > std::numeric_limits<int>::max()
+	||  tableSize < s_tableHeaderSize + header.count * s_recordSize
+	||  header.poolSize < s_poolHeaderSize || header.poolSize > poolSize)
+	{
+		close();
+		return false;
+	}
+
+	m_header = header;
+	openPositionIndexes();
+
+	return true;
+}
+
+void PgnDatabaseIndex::close()
+{
+	if (m_table != nullptr)
+		m_tableFile.unmap(const_cast<uchar*>(m_table));
+	if (m_pool != nullptr)
+		m_poolFile.unmap(const_cast<uchar*>(m_pool));
+	m_tableFile.close();
+	m_poolFile.close();
+
+	m_table = nullptr;
+	m_pool = nullptr;
+	m_header = Header{0, 0, 0, 0, 0, 0};
+
+	qDeleteAll(m_positionIndexes);
+	m_positionIndexes.clear();
+	m_positionIndexCount = 0;
+}
+
+bool PgnDatabaseIndex::isOpen() const
+{
+	return m_table != nullptr;
+}
+
+int PgnDatabaseIndex::count() const
+{
+	return int(m_header.count);
+}
+
+PgnGameEntry PgnDatabaseIndex::entry(int index) const
+{
+	Q_ASSERT(index >= 0 && index < count());
+
+	const uchar* record = m_table + s_tableHeaderSize + index * s_recordSize;
+	const char* tags = nullptr;
+	int size = tagData(index, &tags);
+	if (size < 0)
+		return PgnGameEntry();
+
+	return PgnGameEntry(get<qint64>(record), get<qint64>(record + 8),
+			    QByteArray(tags, size));
+}
+
+bool PgnDatabaseIndex::match(int index, const PgnGameFilter& filter) const
+{
+	Q_ASSERT(index >= 0 && index < count());
+
+	const char* tags = nullptr;
+	int size = tagData(index, &tags);
+	if (size < 0)
+		return false;
+
+	// The entry only lives during the call, so it can refer to
+	// the mapped pool directly
+	return PgnGameEntry(0, 1, QByteArray::fromRawData(tags, size)).match(filter);
+}
+
+int PgnDatabaseIndex::tagData(int index, const char** tags) const
+{
+	const uchar* record = m_table + s_tableHeaderSize + index * s_recordSize;
+	const qint64 begin = get<qint64>(record + 16);
+	const qint64 end = (index + 1 < count())
+		? get<qint64>(record + s_recordSize + 16) : m_header.poolSize;
+
+	if (begin < s_poolHeaderSize || end < begin || end > m_header.poolSize)
+		return -1;
+
+	*tags = reinterpret_cast<const char*>(m_pool + begin);
+	return int(end - begin);
+}
+
+qint64 PgnDatabaseIndex::pgnSize() const
+{
+	return m_header.pgnSize;
+}
+
+QDateTime PgnDatabaseIndex::pgnLastModified() const
+{
+	return QDateTime::fromMSecsSinceEpoch(m_header.pgnLastModified);
+}
+
+bool PgnDatabaseIndex::isPrefixOfFile() const
+{
+	return isOpen()
+	&&     QFileInfo(m_pgnFileName).size() >= m_header.pgnSize
+	&&     pgnChecksum(m_header.pgnSize) == m_header.pgnChecksum;
+}
+
+quint64 PgnDatabaseIndex::pgnChecksum(qint64 size) const
+{
+	QFile file(m_pgnFileName);
+	if (!file.open(QIODevice::ReadOnly))
+		return 0;
+
+	const qint64 start = qMax(qint64(0), size - s_checksumSize);
+	if (!file.seek(start))
+		return 0;
+	const QByteArray data = file.read(size - start);
+	if (data.size() != size - start)
+		return 0;
+
+	QCryptographicHash hash(QCryptographicHash::Md5);
+	hash.addData(data);
+	return get<quint64>(reinterpret_cast<const uchar*>(
+		hash.result().constData()));
+}
+
+bool PgnDatabaseIndex::update(int keep,
+			      const QList<const PgnGameEntry*>& entries,
+			      qint64 pgnSize,
+			      const QDateTime& pgnLastModified)
+{
+	Header header;
+	header.count = keep + entries.size();
+	header.pgnSize = pgnSize;
+	header.pgnLastModified = pgnLastModified.toMSecsSinceEpoch();
+	header.pgnChecksum = pgnChecksum(pgnSize);
+
+	bool ok;
+	if (keep > 0 && keep <= count())
+	{
+		header.generation = m_header.generation;
+		removePositionIndexes(keep);
+		ok = append(keep, entries, header);
+	}
+	else
+	{
+		removePositionIndexes(0);
+		header.count = entries.size();
+		header.generation = quint64(QDateTime::currentMSecsSinceEpoch())
+			^ (quint64(QCoreApplication::applicationPid()) << 40);
+		ok = rewrite(entries, header);
+	}
+
+	return ok && open();
+}
+
+bool PgnDatabaseIndex::rewrite(const QList<const PgnGameEntry*>& entries,
+			       const Header& header)
+{
+	close();
+
+	// The pool is replaced first. Until the table is replaced too,
+	// their generations differ and the index is invalid.
+	QSaveFile pool(m_poolFile.fileName());
+	if (!pool.open(QIODevice::WriteOnly))
+		return false;
+
+	QByteArray data;
+	put(&data, s_magic);
+	put(&data, s_version);
+	put(&data, header.generation);
+	pool.write(data);
+
+	qint64 poolSize = s_poolHeaderSize;
+	for (const PgnGameEntry* entry : entries)
+	{
+		const QByteArray tags = entry->tagData();
+		pool.write(tags);
+		poolSize += tags.size();
+	}
+	if (!pool.commit())
+		return false;
+
+	QSaveFile table(m_tableFile.fileName());
+	if (!table.open(QIODevice::WriteOnly))
+		return false;
+
+	table.write(headerData(header.generation, header.count, poolSize,
+			       header.pgnSize, header.pgnLastModified,
+			       header.pgnChecksum));
+
+	qint64 offset = s_poolHeaderSize;
+	for (const PgnGameEntry* entry : entries)
+	{
+		data.clear();
+		put(&data, entry->pos());
+		put(&data, entry->lineNumber());
+		put(&data, offset);
+		table.write(data);
+		offset += entry->tagData().size();
+	}
+
+	return table.commit();
+}
+
+bool PgnDatabaseIndex::append(int keep,
+			      const QList<const PgnGameEntry*>& entries,
+			      const Header& header)
+{
+	// The tags of the replaced games are overwritten, so that the
+	// tags of game keep - 1 end where the new tags begin
+	qint64 tagsBegin = m_header.poolSize;
+	if (keep < count())
+		tagsBegin = get<qint64>(m_table + s_tableHeaderSize
+					+ keep * s_recordSize + 16);
+	if (tagsBegin < s_poolHeaderSize || tagsBegin > m_header.poolSize)
+		return false;
+	close();
+
+	// The new records replace the records after the first keep games.
+	// The table's magic number is cleared before anything else is
+	// written and restored with the new header last, so an interrupted
+	// append leaves an invalid index that is rebuilt when it's opened.
+	QFile table(m_tableFile.fileName());
+	if (!table.open(QIODevice::ReadWrite))
+		return false;
+
+	QByteArray data;
+	put(&data, quint32(0));
+	if (table.write(data) != data.size() || !table.flush()
+	||  !table.seek(s_tableHeaderSize + keep * s_recordSize))
+		return false;
+
+	QFile pool(m_poolFile.fileName());
+	if (!pool.open(QIODevice::ReadWrite) || !pool.seek(tagsBegin))
+		return false;
+
+	qint64 offset = tagsBegin;
+	for (const PgnGameEntry* entry : entries)
+	{
+		const QByteArray tags = entry->tagData();
+		if (pool.write(tags) != tags.size())
+			return false;
+
+		data.clear();
+		put(&data, entry->pos());
+		put(&data, entry->lineNumber());
+		put(&data, offset);
+		if (table.write(data) != data.size())
+			return false;
+
+		offset += tags.size();
+	}
+	if (!pool.flush() || !table.flush())
+		return false;
+
+	data = headerData(header.generation, header.count, offset,
+			  header.pgnSize, header.pgnLastModified,
+			  header.pgnChecksum);
+	return table.seek(0) && table.write(data) == data.size();
+}
+
+QString PgnDatabaseIndex::positionIndexFileName(int firstGame) const
+{
+	return QString("%1.%2.pos").arg(m_baseName).arg(firstGame);
+}
+
+QStringList PgnDatabaseIndex::positionIndexFileNames() const
+{
+	const QFileInfo info(m_baseName);
+	const QDir dir(info.absolutePath());
+
+	QList<QPair<int, QString>> parts;
+	const QStringList names(dir.entryList(
+		QStringList() << info.fileName() + QLatin1String(".*.pos"),
+		QDir::Files));
+	for (const QString& name : names)
+	{
+		const int firstGame = positionIndexFirstGame(name);
+		if (firstGame >= 0)
+			parts.append(qMakePair(firstGame, dir.filePath(name)));
+	}
+	std::sort(parts.begin(), parts.end());
+
+	QStringList fileNames;
+	for (const auto& part : qAsConst(parts))
+		fileNames.append(part.second);
+
+	return fileNames;
+}
+
+void PgnDatabaseIndex::openPositionIndexes()
+{
+	for (const QString& fileName : positionIndexFileNames())
+	{
+		PositionIndex* positionIndex = new PositionIndex;
+		if (!positionIndex->open(fileName)
+		||  positionIndex->firstGame() > m_positionIndexCount
+		||  positionIndex->firstGame() + positionIndex->gameCount() > count())
+		{
+			delete positionIndex;
+			break;
+		}
+
+		m_positionIndexes.append(positionIndex);
+		m_positionIndexCount = qMax(m_positionIndexCount,
+					    positionIndex->firstGame()
+					    + positionIndex->gameCount());
+	}
+}
+
+QList<const PositionIndex*> PgnDatabaseIndex::positionIndexes() const
+{
+	return m_positionIndexes;
+}
+
+int PgnDatabaseIndex::positionIndexCount() const
+{
+	return m_positionIndexCount;
+}
+
+void PgnDatabaseIndex::removePositionIndexes(int firstGame)
+{
+	for (int i = m_positionIndexes.size() - 1; i >= 0; i--)
+	{
+		if (m_positionIndexes.at(i)->firstGame() < firstGame)
+			break;
+		delete m_positionIndexes.takeAt(i);
+	}
+
+	m_positionIndexCount = 0;
+	for (const PositionIndex* positionIndex : qAsConst(m_positionIndexes))
+		m_positionIndexCount = qMax(m_positionIndexCount,
+					    positionIndex->firstGame()
+					    + positionIndex->gameCount());
+
+	for (const QString& fileName : positionIndexFileNames())
+	{
+		if (positionIndexFirstGame(fileName) >= firstGame)
+			QFile::remove(fileName);
+	}
+}
@@ -0,0 +1,168 @@
+/*
+    This file is part of Cute Chess.
+    Copyright (C) 2008-2018 Cute Chess authors
+
+    Cute Chess is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Cute Chess is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Cute Chess.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef PGN_DATABASE_INDEX_H
+#define PGN_DATABASE_INDEX_H
+
+#include <QString>
+#include <QStringList>
+#include <QList>
+#include <QDateTime>
+#include <QFile>
+#include <pgngameentry.h>
+#include <pgngamefilter.h>
+class PositionIndex;
+
+/*!
+ * \brief On-disk index of the games in a PGN database.
+ *
+ * The index is kept in two files in the configuration directory:
+ * a table of fixed-width records (stream position, line number and
+ * tag offset of each game) and a pool of the games' tags. Both files
+ * are memory-mapped, so an open index doesn't hold the games in memory.
+ *
+ * When games are appended to the PGN file the index is extended
+ * instead of being rebuilt.
+ *
+ * The optional position index of the database is stored next to the
+ * index in parts that cover consecutive ranges of games, so that
+ * appended games can be indexed separately.
+ *
+ * \sa PgnDatabase
+ * \sa PgnImporter
+ */
+class PgnDatabaseIndex
+{
+	public:
+		/*! Creates a new index for PGN file \a pgnFileName. */
+		explicit PgnDatabaseIndex(const QString& pgnFileName);
+		/*! Closes the index. */
+		~PgnDatabaseIndex();
+
+		/*! Returns the file name of the indexed PGN database. */
+		QString pgnFileName() const;
+
+		/*!
+		 * Opens an existing index.
+		 *
+		 * Returns false if the database has no valid index.
+		 */
+		bool open();
+		/*! Closes the index. */
+		void close();
+		/*! Returns true if the index is open. */
+		bool isOpen() const;
+
+		/*! Returns the number of games in the index. */
+		int count() const;
+		/*! Returns the entry of the game at \a index. */
+		PgnGameEntry entry(int index) const;
+		/*!
+		 * Returns true if the tags of the game at \a index
+		 * match \a filter.
+		 *
+		 * Unlike entry() this function doesn't copy the tags.
+		 */
+		bool match(int index, const PgnGameFilter& filter) const;
+
+		/*! Returns the size of the PGN file when it was indexed. */
+		qint64 pgnSize() const;
+		/*!
+		 * Returns the modification time of the PGN file when it
+		 * was indexed.
+		 */
+		QDateTime pgnLastModified() const;
+		/*!
+		 * Returns true if the indexed part of the PGN file is
+		 * unchanged, ie. the file is the same or games were only
+		 * appended to it.
+		 */
+		bool isPrefixOfFile() const;
+
+		/*!
+		 * Keeps the first \a keep games of the index, adds \a entries
+		 * after them and reopens the index.
+		 *
+		 * \a pgnSize and \a pgnLastModified describe the PGN file
+		 * at the time it was read. If \a keep is 0 the index is
+		 * written from scratch.
+		 *
+		 * Returns true if successful.
+		 */
+		bool update(int keep,
+			    const QList<const PgnGameEntry*>& entries,
+			    qint64 pgnSize,
+			    const QDateTime& pgnLastModified);
+
+		/*!
+		 * Returns the file name of the part of the position index
+		 * that begins at game \a firstGame.
+		 */
+		QString positionIndexFileName(int firstGame) const;
+		/*!
+		 * Returns the parts of the position index, ordered by
+		 * their first game.
+		 *
+		 * The parts are opened with the index. Only parts that
+		 * cover consecutive games from the first game are used.
+		 */
+		QList<const PositionIndex*> positionIndexes() const;
+		/*!
+		 * Returns the number of games, from the first game, that
+		 * are in the position index.
+		 */
+		int positionIndexCount() const;
+		/*!
+		 * Removes the parts of the position index that begin at or
+		 * after game \a firstGame.
+		 */
+		void removePositionIndexes(int firstGame);
+
+	private:
+		struct Header
+		{
+			quint64 generation;
+			qint64 count;
+			qint64 poolSize;
+			qint64 pgnSize;
+			qint64 pgnLastModified;
+			quint64 pgnChecksum;
+		};
+
+		quint64 pgnChecksum(qint64 size) const;
+		int tagData(int index, const char** tags) const;
+		QStringList positionIndexFileNames() const;
+		void openPositionIndexes();
+		bool rewrite(const QList<const PgnGameEntry*>& entries,
+			     const Header& header);
+		bool append(int keep,
+			    const QList<const PgnGameEntry*>& entries,
+			    const Header& header);
+
+		QString m_pgnFileName;
+		QString m_baseName;
+		QFile m_tableFile;
+		QFile m_poolFile;
+		const uchar* m_table;
+		const uchar* m_pool;
+		Header m_header;
+		QList<const PositionIndex*> m_positionIndexes;
+		int m_positionIndexCount;
+};
+
+#endif // PGN_DATABASE_INDEX_H
@@ -17,39 +17,61 @@
 */
 
 #include "pgngameentrymodel.h"
+#include <algorithm>
 #include <QtConcurrentFilter>
-#include <pgngameentry.h>
+#include "pgndatabase.h"
 
 
+static int sourceDatabase(const QVector<int>& offsets, int index)
+{
+	// Find the last database that begins at or before index
+	auto it = std::upper_bound(offsets.constBegin(), offsets.constEnd(), index);
+	return int(it - offsets.constBegin()) - 1;
+}
+
+static PgnGameEntry sourceEntry(const QList<PgnDatabase*>& databases,
+				const QVector<int>& offsets,
+				int index)
+{
+	const int db = sourceDatabase(offsets, index);
+	return databases.at(db)->entry(index - offsets.at(db));
+}
+
 struct EntryContains
 {
-	EntryContains(const QList<const PgnGameEntry*>& entries,
+	EntryContains(const QList<PgnDatabase*>& databases,
+		      const QVector<int>& offsets,
 		      const PgnGameFilter& filter)
-		: m_entries(entries), m_filter(filter) { }
+		: m_databases(databases), m_offsets(offsets), m_filter(filter) { }
 
 	typedef bool result_type;
 
 	inline bool operator()(int index)
 	{
-		return m_entries.at(index)->match(m_filter);
+		const int db = sourceDatabase(m_offsets, index);
+		return m_databases.at(db)->matchEntry(index - m_offsets.at(db),
+						      m_filter);
 	}
 
-	const QList<const PgnGameEntry*>& m_entries;
+	QList<PgnDatabase*> m_databases;
+	QVector<int> m_offsets;
 	PgnGameFilter m_filter;
 };
 
 
 PgnGameEntryModel::PgnGameEntryModel(QObject* parent)
 	: QAbstractItemModel(parent),
+	  m_sourceCount(0),
+	  m_hasIndexFilter(false),
 	  m_entryCount(0)
 {
 	connect(&m_watcher, SIGNAL(resultsReadyAt(int,int)),
 		this, SLOT(onResultsReady()));
 }
 
-const PgnGameEntry* PgnGameEntryModel::entryAt(int row) const
+PgnGameEntry PgnGameEntryModel::entryAt(int row) const
 {
-	return m_entries.at(m_filtered.resultAt(row));
+	return sourceEntry(m_databases, m_offsets, m_filtered.resultAt(row));
 }
 
 int PgnGameEntryModel::sourceIndex(int row) const
@@ -62,23 +84,55 @@ int PgnGameEntryModel::entryCount() const
 	return m_filtered.resultCount();
 }
 
-void PgnGameEntryModel::setEntries(const QList<const PgnGameEntry*>& entries)
+void PgnGameEntryModel::setDatabases(const QList<PgnDatabase*>& databases)
 {
 	m_watcher.cancel();
 	m_watcher.waitForFinished();
 
-	m_entries = entries;
+	m_databases = databases;
+	m_indexFilter.clear();
+	m_hasIndexFilter = false;
+	m_offsets.clear();
+	m_sourceCount = 0;
+	for (const PgnDatabase* db : databases)
+	{
+		m_offsets.append(m_sourceCount);
+		m_sourceCount += db->entryCount();
+	}
 
-	if (entries.size() > m_indexes.size())
+	if (m_sourceCount > m_indexes.size())
 	{
-		m_indexes.reserve(entries.size());
-		for (int i = m_indexes.size(); i < entries.size(); i++)
+		m_indexes.reserve(m_sourceCount);
+		for (int i = m_indexes.size(); i < m_sourceCount; i++)
 			m_indexes.append(i);
 	}
 
 	applyFilter(m_filter);
 }
 
+void PgnGameEntryModel::setIndexFilter(const QVector<int>& indexes)
+{
+	m_watcher.cancel();
+	m_watcher.waitForFinished();
+
+	m_indexFilter = indexes;
+	m_hasIndexFilter = true;
+	applyFilter(m_filter);
+}
+
+void PgnGameEntryModel::clearIndexFilter()
+{
+	if (!m_hasIndexFilter)
+		return;
+
+	m_watcher.cancel();
+	m_watcher.waitForFinished();
+
+	m_indexFilter.clear();
+	m_hasIndexFilter = false;
+	applyFilter(m_filter);
+}
+
 void PgnGameEntryModel::onResultsReady()
 {
 	if (m_entryCount < 1024)
@@ -90,9 +144,14 @@ void PgnGameEntryModel::applyFilter(const PgnGameFilter& filter)
 	beginResetModel();
 	m_entryCount = 0;
 
-	m_filtered = QtConcurrent::filtered(m_indexes.constBegin(),
-					    m_indexes.constBegin() + m_entries.size(),
-					    EntryContains(m_entries, filter));
+	if (m_hasIndexFilter)
+		m_filtered = QtConcurrent::filtered(m_indexFilter.constBegin(),
+						    m_indexFilter.constEnd(),
+						    EntryContains(m_databases, m_offsets, filter));
+	else
+		m_filtered = QtConcurrent::filtered(m_indexes.constBegin(),
+						    m_indexes.constBegin() + m_sourceCount,
+						    EntryContains(m_databases, m_offsets, filter));
 
 	m_watcher.setFuture(m_filtered);
 	endResetModel();
@@ -150,7 +209,7 @@ QVariant PgnGameEntryModel::data(const QModelIndex& index, int role) const
 	if (role == Qt::DisplayRole || role == Qt::EditRole)
 	{
 		PgnGameEntry::TagType tagType = PgnGameEntry::TagType(index.column());
-		return entryAt(index.row())->tagValue(tagType);
+		return entryAt(index.row()).tagValue(tagType);
 	}
 
 	return QVariant();
@@ -23,8 +23,10 @@
 #include <QList>
 #include <QFuture>
 #include <QFutureWatcher>
+#include <QVector>
 #include <pgngamefilter.h>
-class PgnGameEntry;
+#include <pgngameentry.h>
+class PgnDatabase;
 
 /*!
  * \brief Supplies PGN game entry information to views.
@@ -38,7 +40,7 @@ class PgnGameEntryModel : public QAbstractItemModel
 		PgnGameEntryModel(QObject* parent = nullptr);
 
 		/*! Returns the PGN entry at \a row. */
-		const PgnGameEntry* entryAt(int row) const;
+		PgnGameEntry entryAt(int row) const;
 		/*!
 		 * Returns the total number of PGN game entries matching the
 		 * current filter.
@@ -52,8 +54,24 @@ class PgnGameEntryModel : public QAbstractItemModel
 		 * \a row in the model.
 		 */
 		int sourceIndex(int row) const;
-		/*! Associates a list of PGN game entries with this model. */
-		void setEntries(const QList<const PgnGameEntry*>& entries);
+		/*!
+		 * Associates the game entries of \a databases with this model.
+		 *
+		 * The entries of each database follow the entries of the
+		 * previous one.
+		 */
+		void setDatabases(const QList<PgnDatabase*>& databases);
+		/*!
+		 * Limits the model to the entries at source indexes
+		 * \a indexes, which must be in ascending order.
+		 *
+		 * The filter set with setFilter() is applied to these
+		 * entries. The limit is removed by clearIndexFilter() and
+		 * when the databases change.
+		 */
+		void setIndexFilter(const QVector<int>& indexes);
+		/*! Removes the limit set by setIndexFilter(). */
+		void clearIndexFilter();
 
 		// Inherited from QAbstractItemModel
 		virtual QModelIndex index(int row, int column,
@@ -80,8 +98,12 @@ class PgnGameEntryModel : public QAbstractItemModel
 	private:
 		void applyFilter(const PgnGameFilter& filter);
 
-		QList<const PgnGameEntry*> m_entries;
+		QList<PgnDatabase*> m_databases;
+		QVector<int> m_offsets;
+		int m_sourceCount;
 		QVector<int> m_indexes;
+		QVector<int> m_indexFilter;
+		bool m_hasIndexFilter;
 		int m_entryCount;
 		QFuture<int> m_filtered;
 		QFutureWatcher<int> m_watcher;
@@ -18,12 +18,198 @@
 
 #include "pgnimporter.h"
 
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <QAtomicInteger>
 #include <QFile>
 #include <QFileInfo>
+#include <QSettings>
+#include <QThread>
+#include <QThreadPool>
+#include <QRunnable>
+#include <QVector>
 
 #include <pgnstream.h>
+#include <pgngame.h>
 #include <pgngameentry.h>
+#include <positionindex.h>
 #include "pgndatabase.h"
+#include "pgndatabaseindex.h"
+
+namespace {
+
+// Smallest part of a PGN file worth parsing on a separate thread
+const qint64 s_minChunkSize = 4 * 1024 * 1024;
+// Number of games between progress updates
+const int s_updateInterval = 1024;
+// Smallest number of games worth indexing on a separate thread
+const int s_minPositionGames = 1024;
+
+class ImportTask : public QRunnable
+{
+	public:
+		explicit ImportTask(const std::function<void()>& func)
+			: m_func(func)
+		{
+		}
+
+		virtual void run()
+		{
+			m_func();
+		}
+
+	private:
+		std::function<void()> m_func;
+};
+
+/*
+ * A part of the PGN file that is parsed independently.
+ *
+ * The games of a chunk are the games that begin at or after \a start
+ * and before \a end. After parsing, \a nextPos and \a nextLineNumber
+ * tell where the first game past the chunk begins, or \a nextPos is -1
+ * if the end of the file was reached.
+ */
+struct Chunk
+{
+	qint64 start;
+	qint64 end;
+	qint64 lineNumber;
+	qint64 nextPos;
+	qint64 nextLineNumber;
+	bool complete;
+	QList<const PgnGameEntry*> games;
+};
+
+struct Progress
+{
+	QAtomicInt games;
+	QAtomicInteger<qint64> bytes;
+	QAtomicInt cancel;
+};
+
+/*
+ * Returns the position of the first game that begins at or after
+ * \a from, or \a size if there isn't one.
+ *
+ * A game is assumed to begin with a tag at the start of a line that
+ * follows an empty line. The guess is verified when the chunks
+ * are merged.
+ */
+qint64 findGameStart(const char* data, qint64 size, qint64 from)
+{
+	const char* end = data + size;
+	const char* p = data + from;
+
+	while (p < end)
+	{
+		p = static_cast<const char*>(memchr(p, '[', end - p));
+		if (p == nullptr)
+			break;
+
+		const char* q = p;
+		if (q > data && *--q == '\n')
+		{
+			if (q > data && q[-1] == '\r')
+				q--;
+			if (q > data && q[-1] == '\n')
+				return p - data;
+		}
+		p++;
+	}
+
+	return size;
+}
+
+void readChunk(const QString& fileName, Chunk* chunk, Progress* progress)
+{
+	chunk->nextPos = -1;
+	chunk->nextLineNumber = -1;
+	chunk->complete = false;
+	qDeleteAll(chunk->games);
+	chunk->games.clear();
+
+	QFile file(fileName);
+	if (!file.open(QIODevice::ReadOnly | QIODevice::Text))
+		return;
+
+	PgnStream pgnStream(&file);
+	if (!pgnStream.seek(chunk->start, chunk->lineNumber))
+		return;
+
+	qint64 lastPos = chunk->start;
+	for (;;)
+	{
+		if (progress->cancel.load())
+			return;
+
+		PgnGameEntry* game = new PgnGameEntry;
+		if (!game->read(pgnStream))
+		{
+			delete game;
+			break;
+		}
+		if (game->pos() >= chunk->end)
+		{
+			chunk->nextPos = game->pos();
+			chunk->nextLineNumber = game->lineNumber();
+			delete game;
+			break;
+		}
+
+		chunk->games << game;
+		if (chunk->games.size() % s_updateInterval == 0)
+		{
+			progress->games.fetchAndAddRelaxed(s_updateInterval);
+			progress->bytes.fetchAndAddRelaxed(game->pos() - lastPos);
+			lastPos = game->pos();
+		}
+	}
+
+	chunk->complete = true;
+}
+
+void indexPositions(const QString& fileName,
+		    const PgnDatabaseIndex* index,
+		    int begin,
+		    int end,
+		    PositionIndexWriter* writer,
+		    Progress* progress)
+{
+	QFile file(fileName);
+	if (!file.open(QIODevice::ReadOnly | QIODevice::Text))
+	{
+		progress->cancel.store(1);
+		return;
+	}
+
+	PgnStream pgnStream(&file);
+	PgnGame game;
+	qint64 lastPos = index->entry(begin).pos();
+
+	for (int i = begin; i < end; i++)
+	{
+		if (progress->cancel.load())
+			return;
+
+		// Unreadable games are left out of the index
+		const PgnGameEntry entry(index->entry(i));
+		if (pgnStream.seek(entry.pos(), entry.lineNumber())
+		&&  game.read(pgnStream, INT_MAX - 1, false))
+			writer->addGame(i, game);
+
+		if ((i - begin + 1) % s_updateInterval == 0)
+		{
+			progress->games.fetchAndAddRelaxed(s_updateInterval);
+			progress->bytes.fetchAndAddRelaxed(entry.pos() - lastPos);
+			lastPos = entry.pos();
+		}
+	}
+}
+
+} // anonymous namespace
 
 PgnImporter::PgnImporter(const QString& fileName)
 	: Worker(QString("PGN import: %1").arg(fileName)),
@@ -40,8 +226,6 @@ void PgnImporter::work()
 {
 	QFile file(m_fileName);
 	QFileInfo fileInfo(m_fileName);
-	static const int updateInterval = 1024;
-	int numReadGames = 0;
 
 	if (!fileInfo.exists())
 	{
@@ -55,28 +239,233 @@ void PgnImporter::work()
 		return;
 	}
 
-	PgnStream pgnStream(&file);
-	QList<const PgnGameEntry*> games;
+	const qint64 size = file.size();
+	const QDateTime lastModified(fileInfo.lastModified());
 
-	for (;;)
+	// If games were only appended to the file since it was indexed,
+	// the import continues from the last indexed game. That game is
+	// read again in case it was still being written.
+	PgnDatabaseIndex* index = new PgnDatabaseIndex(m_fileName);
+	int keep = 0;
+	qint64 startPos = 0;
+	qint64 startLineNumber = 1;
+	if (index->open() && index->isPrefixOfFile())
 	{
-		PgnGameEntry* game = new PgnGameEntry;
-		if (cancelRequested() || !game->read(pgnStream))
+		if (index->pgnSize() == size
+		&&  index->pgnLastModified() == lastModified)
 		{
-			delete game;
-			break;
+			updatePositionIndex(index);
+
+			PgnDatabase* db = new PgnDatabase(m_fileName);
+			db->setIndex(index);
+			db->setLastModified(lastModified);
+
+			emit databaseRead(db);
+			return;
+		}
+		if (index->count() > 0)
+		{
+			keep = index->count() - 1;
+			const PgnGameEntry last(index->entry(keep));
+			startPos = last.pos();
+			startLineNumber = last.lineNumber();
+		}
+	}
+
+	// Split the file into chunks that start at game boundaries
+	const qint64 length = size - startPos;
+	const int threads = int(qBound(qint64(1), length / s_minChunkSize,
+				       qint64(QThread::idealThreadCount())));
+	uchar* map = (threads > 1) ? file.map(0, size) : nullptr;
+	const char* data = reinterpret_cast<const char*>(map);
+
+	QVector<Chunk> chunks;
+	chunks.append(Chunk{startPos, 0, startLineNumber, -1, -1, false, {}});
+	for (int i = 1; map != nullptr && i < threads; i++)
+	{
+		const qint64 pos = findGameStart(data, size,
+						 startPos + length / threads * i);
+		if (pos <= chunks.last().start || pos >= size)
+			continue;
+		chunks.last().end = pos;
+		chunks.append(Chunk{pos, 0, 1, -1, -1, false, {}});
+	}
+	chunks.last().end = std::numeric_limits<qint64>::max();
+
+	Progress progress;
+	progress.bytes.store(startPos);
+	QThreadPool pool;
+	pool.setMaxThreadCount(chunks.size());
+
+	// Count the lines before each chunk so that every chunk knows
+	// its first line number
+	if (chunks.size() > 1)
+	{
+		QVector<qint64> lines(chunks.size());
+		for (int i = 0; i < chunks.size() - 1; i++)
+		{
+			const char* begin = data + chunks.at(i).start;
+			const char* end = data + chunks.at(i).end;
+			qint64* count = &lines[i];
+			pool.start(new ImportTask([=]()
+			{
+				*count = std::count(begin, end, '\n');
+			}));
 		}
+		pool.waitForDone();
+
+		for (int i = 1; i < chunks.size(); i++)
+			chunks[i].lineNumber = chunks.at(i - 1).lineNumber
+					       + lines.at(i - 1);
+	}
+	if (map != nullptr)
+		file.unmap(map);
+	file.close();
+
+	for (Chunk& chunk : chunks)
+	{
+		Chunk* ptr = &chunk;
+		const QString fileName(m_fileName);
+		pool.start(new ImportTask([=, &progress]()
+		{
+			readChunk(fileName, ptr, &progress);
+		}));
+	}
 
-		games << game;
-		numReadGames++;
+	// Report progress while the chunks are parsed
+	int numReadGames = 0;
+	while (!pool.waitForDone(100))
+	{
+		if (cancelRequested())
+			progress.cancel.store(1);
 
-		if (numReadGames % updateInterval == 0)
+		const int games = progress.games.load();
+		if (games != numReadGames)
+		{
+			numReadGames = games;
 			emit databaseReadStatus(startTime(), numReadGames,
-			    pgnStream.pos());
+						progress.bytes.load());
+		}
+	}
+
+	// Merge the chunks in file order. If a guessed boundary was
+	// wrong, the chunk is parsed again from where the previous
+	// chunk's last game ended.
+	QList<const PgnGameEntry*> games;
+	bool complete = true;
+	for (int i = 0; i < chunks.size(); i++)
+	{
+		Chunk& chunk = chunks[i];
+		if (i > 0 && chunks.at(i - 1).nextPos != chunk.start)
+		{
+			const Chunk& prev = chunks.at(i - 1);
+			if (prev.nextPos == -1 || cancelRequested())
+			{
+				complete = false;
+				break;
+			}
+
+			chunk.start = prev.nextPos;
+			chunk.lineNumber = prev.nextLineNumber;
+			readChunk(m_fileName, &chunk, &progress);
+		}
+
+		games << chunk.games;
+		chunk.games.clear();
+		if (!chunk.complete)
+		{
+			complete = false;
+			break;
+		}
 	}
+	for (const Chunk& chunk : chunks)
+		qDeleteAll(chunk.games);
+
 	PgnDatabase* db = new PgnDatabase(m_fileName);
-	db->setEntries(games);
-	db->setLastModified(fileInfo.lastModified());
+	db->setLastModified(lastModified);
+
+	// A chunk can also stop early if the file can't be read. The
+	// index would then look complete and current without the rest
+	// of the games, so it's only saved if every chunk was read.
+	if (complete && !cancelRequested()
+	&&  index->update(keep, games, size, lastModified))
+	{
+		qDeleteAll(games);
+		updatePositionIndex(index);
+		db->setIndex(index);
+	}
+	else
+	{
+		// Without a complete index the entries are kept in memory
+		QList<const PgnGameEntry*> entries;
+		if (keep > 0 && (index->isOpen() || index->open()))
+		{
+			entries.reserve(keep + games.size());
+			for (int i = 0; i < keep; i++)
+				entries << new PgnGameEntry(index->entry(i));
+		}
+		entries << games;
+		delete index;
+
+		db->setEntries(entries);
+	}
 
 	emit databaseRead(db);
 }
+
+void PgnImporter::updatePositionIndex(PgnDatabaseIndex* index)
+{
+	if (!QSettings().value("games/position_index", false).toBool())
+		return;
+
+	// Only the games that aren't in the position index yet are
+	// read, and they go to a new part of the index
+	const int firstGame = index->positionIndexCount();
+	const int count = index->count();
+	if (firstGame >= count || cancelRequested())
+		return;
+	index->removePositionIndexes(firstGame);
+
+	PositionIndexWriter writer(index->positionIndexFileName(firstGame),
+				   firstGame, count - firstGame);
+
+	const int threads = qBound(1, (count - firstGame) / s_minPositionGames,
+				   QThread::idealThreadCount());
+	Progress progress;
+	progress.bytes.store(index->entry(firstGame).pos());
+	QThreadPool pool;
+	pool.setMaxThreadCount(threads);
+
+	for (int i = 0; i < threads; i++)
+	{
+		const int begin = firstGame
+			+ int(qint64(count - firstGame) * i / threads);
+		const int end = firstGame
+			+ int(qint64(count - firstGame) * (i + 1) / threads);
+		const QString fileName(m_fileName);
+		pool.start(new ImportTask([=, &writer, &progress]()
+		{
+			indexPositions(fileName, index, begin, end,
+				       &writer, &progress);
+		}));
+	}
+
+	int numReadGames = 0;
+	while (!pool.waitForDone(100))
+	{
+		if (cancelRequested())
+			progress.cancel.store(1);
+
+		const int games = progress.games.load();
+		if (games != numReadGames)
+		{
+			numReadGames = games;
+			emit databaseReadStatus(startTime(), numReadGames,
+						progress.bytes.load());
+		}
+	}
+
+	// The new part is opened with the index
+	if (!progress.cancel.load() && writer.finish())
+		index->open();
+}
@@ -22,6 +22,7 @@
 #include <worker.h>
 
 class PgnDatabase;
+class PgnDatabaseIndex;
 
 /*!
  * \brief Reads PGN database in a separate thread.
@@ -63,6 +64,8 @@ class PgnImporter : public Worker
 		void databaseReadStatus(const QTime& started, int numReadGames, qint64 numReadBytes);
 
 	private:
+		void updatePositionIndex(PgnDatabaseIndex* index);
+
 		QString m_fileName;
 
 };
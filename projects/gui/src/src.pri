@@ -13,6 +13,7 @@ HEADERS += $$PWD/chessclock.h \
     $$PWD/gamedatabasemanager.h \
     $$PWD/importprogressdlg.h \
     $$PWD/pgndatabase.h \
+    $$PWD/pgndatabaseindex.h \
     $$PWD/pgngameentrymodel.h \
     $$PWD/pgndatabasemodel.h \
     $$PWD/engineoptiondelegate.h \
@@ -56,6 +57,7 @@ SOURCES += $$PWD/main.cpp \
     $$PWD/gamedatabasemanager.cpp \
     $$PWD/importprogressdlg.cpp \
     $$PWD/pgndatabase.cpp \
+    $$PWD/pgndatabaseindex.cpp \
     $$PWD/pgngameentrymodel.cpp \
     $$PWD/pgndatabasemodel.cpp \
     $$PWD/engineoptiondelegate.cpp \
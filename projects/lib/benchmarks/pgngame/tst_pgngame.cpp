@@ -10,8 +10,29 @@ class tst_PgnGame: public QObject
 	private slots:
 		void parser_data() const;
 		void parser();
+		void fileParser_data() const;
+		void fileParser();
+		void fileTokenizer_data() const;
+		void fileTokenizer();
+
+	private:
+		bool writeFile(QTemporaryFile* file, const QByteArray& pgn) const;
 };
 
+// Number of copies of a game in the input files
+static const int s_fileGameCount = 2000;
+
+bool tst_PgnGame::writeFile(QTemporaryFile* file, const QByteArray& pgn) const
+{
+	if (!file->open())
+		return false;
+	for (int i = 0; i < s_fileGameCount; i++)
+		file->write(pgn + "\n");
+	file->close();
+
+	return file->open();
+}
+
 void tst_PgnGame::parser_data() const
 {
 	QTest::addColumn<QByteArray>("pgn");
@@ -99,5 +120,68 @@ void tst_PgnGame::parser()
 	}
 }
 
+void tst_PgnGame::fileParser_data() const
+{
+	parser_data();
+}
+
+void tst_PgnGame::fileParser()
+{
+	QFETCH(QByteArray, pgn);
+
+	QTemporaryFile tmp;
+	QVERIFY(writeFile(&tmp, pgn));
+	QFile file(tmp.fileName());
+	QVERIFY(file.open(QIODevice::ReadOnly | QIODevice::Text));
+
+	// Reports the parsing speed of a whole file in bytes per second
+	QElapsedTimer timer;
+	timer.start();
+
+	PgnStream stream(&file);
+	PgnGame game;
+	int count = 0;
+	while (game.read(stream))
+		count++;
+
+	const qint64 elapsed = qMax(qint64(1), timer.nsecsElapsed());
+	QCOMPARE(count, s_fileGameCount);
+	QTest::setBenchmarkResult(file.size() * 1.0e9 / elapsed,
+				  QTest::BytesPerSecond);
+}
+
+void tst_PgnGame::fileTokenizer_data() const
+{
+	parser_data();
+}
+
+void tst_PgnGame::fileTokenizer()
+{
+	QFETCH(QByteArray, pgn);
+
+	QTemporaryFile tmp;
+	QVERIFY(writeFile(&tmp, pgn));
+	QFile file(tmp.fileName());
+	QVERIFY(file.open(QIODevice::ReadOnly | QIODevice::Text));
+
+	// The speed of the stream without move validation
+	QElapsedTimer timer;
+	timer.start();
+
+	PgnStream stream(&file);
+	int count = 0;
+	while (stream.nextGame())
+	{
+		while (stream.readNext() != PgnStream::NoToken)
+			;
+		count++;
+	}
+
+	const qint64 elapsed = qMax(qint64(1), timer.nsecsElapsed());
+	QCOMPARE(count, s_fileGameCount);
+	QTest::setBenchmarkResult(file.size() * 1.0e9 / elapsed,
+				  QTest::BytesPerSecond);
+}
+
 QTEST_MAIN(tst_PgnGame)
 #include "tst_pgngame.moc"
@@ -1,2 +1,3 @@
 INCLUDEPATH += $$PWD/src $$PWD/components/json/src
 LIBS += -lcutechess -L$$PWD
+QT += network
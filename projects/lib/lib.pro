@@ -1,6 +1,6 @@
 TEMPLATE = lib
 TARGET = cutechess
-QT = core
+QT = core network
 DESTDIR = $$PWD
 
 !win32-msvc* {
@@ -11,8 +11,6 @@ include(libexport.pri)
 include(src/src.pri)
 include(components/json/src/json.pri)
 include(3rdparty/fathom/src/tb.pri)
-include(res/res.pri)
 
 OBJECTS_DIR = .obj
 MOC_DIR = .moc
-RCC_DIR = .rcc
@@ -1 +0,0 @@
-RESOURCES += $$PWD/eco/eco.qrc
@@ -17,6 +17,7 @@
 */
 
 #include "board.h"
+#include <algorithm>
 #include <QStringList>
 #include "zobrist.h"
 
@@ -60,6 +61,8 @@ Board::Board(Zobrist* zobrist)
 	  m_startingSide(Side::White),
 	  m_maxPieceSymbolLength(1),
 	  m_key(0),
+	  m_pieceCount(0),
+	  m_materialKey(0),
 	  m_zobrist(zobrist),
 	  m_sharedZobrist(zobrist)
 {
@@ -121,6 +124,9 @@ void Board::initialize()
 		m_squares.append(Piece::WallPiece);
 	vInitialize();
 
+	m_materialCount.resize(m_pieceData.size() * 2);
+	std::fill(m_materialCount.begin(), m_materialCount.end(), 0);
+
 	m_maxPieceSymbolLength = 1;
 	for (const PieceData& pd: m_pieceData)
 		if (pd.symbol.length() > m_maxPieceSymbolLength)
@@ -351,35 +357,45 @@ QString Board::moveString(const Move& move, MoveNotation notation)
 	return lanMoveString(move);
 }
 
-QString Board::sanStringForPv(const QString& pv, MoveNotation notation)
+QStringList Board::moveStrings(const QVector<Move>& moves,
+				MoveNotation notation)
 {
-	QString str;
-	int made = 0;
-	int i;
+	QStringList strings;
+	strings.reserve(moves.size());
+	for (const Move& move : moves)
+	{
+		strings << moveString(move, notation);
+		makeMove(move);
+	}
+	for (int i = 0; i < moves.size(); i++)
+		undoMove();
 
-	if (notation == StandardAlgebraic) {
-		QStringList strList = pv.split(' ');
-		if (strList.isEmpty())
-			return str;
+	return strings;
+}
 
-		for (i = 0; i < strList.length(); i++)
-		{
-			QString token = strList.at(i);
-			if (!token.length())
-				break;
-			Move move = moveFromString(token);
-			if (move.isNull())
-				break;
-			str += (made > 0) ? " " : "";
-			str += sanMoveString(move);
-			makeMove(move);
-			made++;
-		}
-		for (i = 0; i < made; i++) {
-			undoMove();
-		}
+QStringList Board::moveStrings(const QStringList& strings,
+				MoveNotation notation)
+{
+	QStringList converted;
+	converted.reserve(strings.size());
+	for (const QString& str : strings)
+	{
+		const Move move = moveFromString(str);
+		if (move.isNull())
+			break;
+		converted << moveString(move, notation);
+		makeMove(move);
 	}
-	return str;
+	for (int i = 0; i < converted.size(); i++)
+		undoMove();
+
+	return converted;
+}
+
+QString Board::sanStringForPv(const QString& pv, MoveNotation notation)
+{
+	return moveStrings(pv.split(' ', QString::SkipEmptyParts),
+			   notation).join(' ');
 }
 
 Move Board::moveFromLanString(const QString& istr)
@@ -554,6 +570,9 @@ bool Board::setFenString(const QString& fen)
 	for (int i = 0; i < m_squares.size(); i++)
 		m_squares[i] = Piece::WallPiece;
 	m_key = 0;
+	m_pieceCount = 0;
+	m_materialKey = 0;
+	std::fill(m_materialCount.begin(), m_materialCount.end(), 0);
 
 	// Get the board contents (squares)
 	int handPieceIndex = -1;
@@ -923,4 +942,9 @@ Result Board::tablebaseResult(unsigned int* dtm) const
 	return Result();
 }
 
+bool Board::tablebaseAvailable() const
+{
+	return false;
+}
+
 } // namespace Chess
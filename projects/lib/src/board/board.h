@@ -204,6 +204,27 @@ class LIB_EXPORT Board
 		Side startingSide() const;
 		/*! Returns the piece at \a square. */
 		Piece pieceAt(const Square& square) const;
+		/*!
+		 * Returns the number of pieces on the board, not counting
+		 * the pieces in reserve.
+		 */
+		int pieceCount() const;
+		/*!
+		 * Returns the number of \a side's pieces of type \a pieceType
+		 * on the board, not counting the pieces in reserve.
+		 *
+		 * The counts are kept up to date by setSquare(), so this
+		 * doesn't scan the board.
+		 */
+		int materialCount(Side side, int pieceType) const;
+		/*!
+		 * Returns the material signature of the position.
+		 *
+		 * The signature is a hash key of the number of pieces of
+		 * each type and side on the board. Unlike key(), it doesn't
+		 * depend on the squares of the pieces.
+		 */
+		quint64 materialKey() const;
 		/*! Returns the number of halfmoves (plies) played. */
 		int plyCount() const;
 		/*!
@@ -252,6 +273,34 @@ class LIB_EXPORT Board
 		 * \sa moveFromString()
 		 */
 		QString moveString(const Move& move, MoveNotation notation);
+		/*!
+		 * Converts \a moves into strings in \a notation.
+		 *
+		 * The moves are a sequence, eg. a game or a PV, that starts
+		 * from the current position. Each move is made on the board
+		 * once, and the board is returned to the current position
+		 * afterwards.
+		 *
+		 * \note All the moves must be legal.
+		 */
+		QStringList moveStrings(const QVector<Move>& moves,
+					MoveNotation notation);
+		/*!
+		 * Converts \a strings, a sequence of move strings in any
+		 * notation, into strings in \a notation.
+		 *
+		 * The conversion stops at the first string that isn't a legal
+		 * move, so the returned list can be shorter than \a strings.
+		 * \sa moveStrings(const QVector<Move>&, MoveNotation)
+		 */
+		QStringList moveStrings(const QStringList& strings,
+					MoveNotation notation);
+		/*!
+		 * Converts \a pv, a space-separated sequence of move strings,
+		 * into a space-separated sequence in \a notation.
+		 *
+		 * \sa moveStrings()
+		 */
 		QString sanStringForPv(const QString& pv, MoveNotation notation);
 		/*!
 		 * Converts a move string into a Move.
@@ -301,6 +350,14 @@ class LIB_EXPORT Board
 		 * The default implementation always returns a null result.
 		 */
 		virtual Result tablebaseResult(unsigned int* dtm = nullptr) const;
+		/*!
+		 * Returns true if the endgame tablebases have a table for
+		 * the material on the board; otherwise returns false.
+		 *
+		 * If this function returns false, tablebaseResult() can be
+		 * skipped. The default implementation always returns false.
+		 */
+		virtual bool tablebaseAvailable() const;
 
 	protected:
 		/*!
@@ -495,8 +552,9 @@ class LIB_EXPORT Board
 		/*!
 		 * Sets \a square to contain \a piece.
 		 *
-		 * This function also updates the zobrist position key, so
-		 * subclasses shouldn't mess with it directly.
+		 * This function also updates the zobrist position key and
+		 * the piece count, so subclasses shouldn't mess with them
+		 * directly.
 		 */
 		void setSquare(int square, Piece piece);
 		/*! Returns the last move made in the game. */
@@ -539,10 +597,13 @@ class LIB_EXPORT Board
 		QString m_startingFen;
 		int m_maxPieceSymbolLength;
 		quint64 m_key;
+		int m_pieceCount;
+		quint64 m_materialKey;
 		Zobrist* m_zobrist;
 		QSharedPointer<Zobrist> m_sharedZobrist;
 		QVarLengthArray<PieceData> m_pieceData;
 		QVarLengthArray<Piece> m_squares;
+		QVarLengthArray<int> m_materialCount;
 		QVector<MoveData> m_moveHistory;
 		QVector<int> m_reserve[2];
 };
@@ -585,13 +646,50 @@ inline Piece Board::pieceAt(int square) const
 	return m_squares[square];
 }
 
+inline int Board::pieceCount() const
+{
+	return m_pieceCount;
+}
+
+inline int Board::materialCount(Side side, int pieceType) const
+{
+	Q_ASSERT(!side.isNull());
+	Q_ASSERT(pieceType >= 0 && pieceType < m_pieceData.size());
+
+	return m_materialCount[side * m_pieceData.size() + pieceType];
+}
+
+inline quint64 Board::materialKey() const
+{
+	return m_materialKey;
+}
+
 inline void Board::setSquare(int square, Piece piece)
 {
+	// The material key has a zobrist key for every piece of the
+	// same type and side, indexed by the piece count instead of
+	// the square.
 	Piece& old = m_squares[square];
 	if (old.isValid())
+	{
 		xorKey(m_zobrist->piece(old, square));
+		m_pieceCount--;
+
+		int& count = m_materialCount[old.side() * m_pieceData.size()
+					     + old.type()];
+		count--;
+		m_materialKey ^= m_zobrist->piece(old, count);
+	}
 	if (piece.isValid())
+	{
 		xorKey(m_zobrist->piece(piece, square));
+		m_pieceCount++;
+
+		int& count = m_materialCount[piece.side() * m_pieceData.size()
+					     + piece.type()];
+		m_materialKey ^= m_zobrist->piece(piece, count);
+		count++;
+	}
 
 	old = piece;
 }
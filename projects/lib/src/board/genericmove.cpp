@@ -88,4 +88,30 @@ void GenericMove::setPromotion(int pieceType)
 	m_promotion = pieceType;
 }
 
+quint32 GenericMove::toBits() const
+{
+	if (isNull())
+		return 0;
+
+	// The coordinates are stored with an offset of one so that
+	// the null source squares of drop moves fit
+	return (1U << 31)
+	     | quint32(m_sourceSquare.file() + 1)
+	     | quint32(m_sourceSquare.rank() + 1) << 5
+	     | quint32(m_targetSquare.file() + 1) << 10
+	     | quint32(m_targetSquare.rank() + 1) << 15
+	     | quint32(m_promotion & 0xff) << 20;
+}
+
+GenericMove GenericMove::fromBits(quint32 bits)
+{
+	if (bits == 0)
+		return GenericMove();
+
+	const Square source(int(bits & 31) - 1, int((bits >> 5) & 31) - 1);
+	const Square target(int((bits >> 10) & 31) - 1, int((bits >> 15) & 31) - 1);
+
+	return GenericMove(source, target, int((bits >> 20) & 0xff));
+}
+
 } // namespace Chess
@@ -63,6 +63,19 @@ class LIB_EXPORT GenericMove
 		/*! Sets the promotion type to \a pieceType. */
 		void setPromotion(int pieceType);
 
+		/*!
+		 * Returns the move packed into 32 bits, or 0 if this
+		 * is a null move.
+		 *
+		 * Square coordinates up to 30 and promotion types up to
+		 * 255 can be packed.
+		 *
+		 * \sa fromBits()
+		 */
+		quint32 toBits() const;
+		/*! Returns the move packed into \a bits by toBits(). */
+		static GenericMove fromBits(quint32 bits);
+
 	private:
 		Square m_sourceSquare;
 		Square m_targetSquare;
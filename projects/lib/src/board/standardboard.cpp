@@ -1074,17 +1074,16 @@ QString StandardBoard::defaultFenString() const
 
 Result StandardBoard::tablebaseResult(unsigned int* dtz) const
 {
-	SyzygyTablebase::PieceList pieces;
+	if (!tablebaseAvailable())
+		return Result();
 
+	SyzygyTablebase::PieceList pieces;
+	pieces.reserve(pieceCount());
 	for (int i = 0; i < arraySize(); i++)
 	{
 		Piece piece(pieceAt(i));
 		if (piece.isValid())
-		{
-			if (pieces.size() > 6)
-				return Result();
 			pieces.append(qMakePair(chessSquare(i), piece));
-		}
 	}
 
 	SyzygyTablebase::Castling castling = 0;
@@ -1105,4 +1104,10 @@ Result StandardBoard::tablebaseResult(unsigned int* dtz) const
 					dtz);
 }
 
+bool StandardBoard::tablebaseAvailable() const
+{
+	return pieceCount() <= SyzygyTablebase::maxPieces()
+	    && SyzygyTablebase::hasTable(this);
+}
+
 } // namespace Chess
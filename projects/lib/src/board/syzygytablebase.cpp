@@ -18,8 +18,14 @@
 
 #include "syzygytablebase.h"
 #include <QDir>
+#include <QFile>
+#include <QFileInfo>
 #include <QMutex>
+#include <QRunnable>
+#include <QSet>
 #include <QStringList>
+#include <QThread>
+#include <QThreadPool>
 #include <tbprobe.h>
 #include "westernboard.h"
 
@@ -28,6 +34,50 @@ namespace {
 bool s_initialized = false, s_initOK = false, s_noRule50 = false;
 int s_pieces = INT_MAX;
 QMutex s_mutex;
+QString s_paths;
+QSet<quint64> s_tables;
+
+// A material signature has a 4-bit count for every Western piece
+// type and side, which is plenty for the tablebases
+int signatureShift(int side, int pieceType)
+{
+	return 4 * (side * 8 + pieceType);
+}
+
+quint64 tableSignature(const QString& white, const QString& black)
+{
+	static const QString symbols("PNBRQK");
+
+	quint64 signature = 0;
+	const QString* sides[] = { &white, &black };
+	for (int side = 0; side < 2; side++)
+	{
+		for (const QChar& c : *sides[side])
+		{
+			const int type = symbols.indexOf(c) + 1;
+			if (type <= 0)
+				return 0;
+			signature += quint64(1) << signatureShift(side, type);
+		}
+	}
+
+	return signature;
+}
+
+QFileInfoList wdlTableFiles()
+{
+	QFileInfoList files;
+	const QStringList dirs(s_paths.split(QDir::listSeparator(),
+					     QString::SkipEmptyParts));
+	for (const QString& dir : dirs)
+	{
+		files += QDir(dir).entryInfoList(
+			QStringList() << "*.rtbw", QDir::Files,
+			QDir::Size | QDir::Reversed);
+	}
+
+	return files;
+}
 
 int tbSquare(const Chess::Square& square)
 {
@@ -36,6 +86,56 @@ int tbSquare(const Chess::Square& square)
 	return square.rank() * 8 + square.file();
 }
 
+Chess::Side tbWinner(unsigned wdl, bool wtm)
+{
+	switch (wdl)
+	{
+	case TB_BLESSED_LOSS:
+		if (!s_noRule50)
+			break;
+		// Fallthrough
+	case TB_LOSS:
+		return wtm ? Chess::Side::Black : Chess::Side::White;
+	case TB_DRAW:
+		break;
+	case TB_CURSED_WIN:
+		if (!s_noRule50)
+			break;
+		// Fallthrough
+	case TB_WIN:
+		return wtm ? Chess::Side::White : Chess::Side::Black;
+	}
+
+	return Chess::Side::NoSide;
+}
+
+class WarmCacheTask : public QRunnable
+{
+	public:
+		WarmCacheTask(const QStringList& fileNames)
+			: m_fileNames(fileNames)
+		{
+		}
+
+		virtual void run()
+		{
+			// Reading the files is enough to get them into the
+			// page cache; the data itself isn't needed
+			QByteArray buffer(1024 * 1024, Qt::Uninitialized);
+			for (const QString& fileName : qAsConst(m_fileNames))
+			{
+				QFile file(fileName);
+				if (!file.open(QIODevice::ReadOnly))
+					continue;
+				while (file.read(buffer.data(), buffer.size()) > 0)
+					;
+			}
+		}
+
+	private:
+		QStringList m_fileNames;
+};
+
 } // anonymous namespace
 
 bool SyzygyTablebase::initialize(const QString& path)
@@ -46,8 +146,29 @@ bool SyzygyTablebase::initialize(const QString& path)
 
 	const auto nativePath = QDir::toNativeSeparators(path);
 	s_initOK = tb_init(nativePath.toStdString().c_str());
+	if (!s_initOK)
+		return false;
+	s_paths = path;
+
+	// Table names look like "KRPvKR". A table also covers the
+	// positions with the colors reversed. Bare kings are a draw
+	// without a table.
+	s_tables.insert(tableSignature("K", "K"));
+	const auto files = wdlTableFiles();
+	for (const QFileInfo& info : files)
+	{
+		const QStringList sides(info.completeBaseName().split('v'));
+		if (sides.size() != 2)
+			continue;
 
-	return s_initOK;
+		const quint64 signature = tableSignature(sides.at(0), sides.at(1));
+		if (signature == 0)
+			continue;
+		s_tables.insert(signature);
+		s_tables.insert(tableSignature(sides.at(1), sides.at(0)));
+	}
+
+	return true;
 }
 
 bool SyzygyTablebase::tbAvailable(int pieces)
@@ -55,6 +176,37 @@ bool SyzygyTablebase::tbAvailable(int pieces)
 	return s_initOK && ((unsigned)pieces <= TB_LARGEST);
 }
 
+int SyzygyTablebase::maxPieces()
+{
+	if (!s_initOK)
+		return 0;
+	return qMin(s_pieces, int(TB_LARGEST));
+}
+
+bool SyzygyTablebase::hasTable(const Chess::Board* board)
+{
+	if (!s_initOK)
+		return false;
+	// Without the file names every table may be available
+	if (s_tables.size() <= 1)
+		return true;
+
+	quint64 signature = 0;
+	for (int side = Chess::Side::White; side <= Chess::Side::Black; side++)
+	{
+		for (int type = Chess::WesternBoard::Pawn;
+		     type <= Chess::WesternBoard::King; type++)
+		{
+			const int count = board->materialCount(
+				Chess::Side::Type(side), type);
+			signature |= quint64(qMin(count, 15))
+				  << signatureShift(side, type);
+		}
+	}
+
+	return s_tables.contains(signature);
+}
+
 void SyzygyTablebase::setPieces(int pieces)
 {
 	if (pieces > 2)
@@ -66,6 +218,43 @@ void SyzygyTablebase::setNoRule50()
 	s_noRule50 = true;
 }
 
+QThreadPool* SyzygyTablebase::threadPool()
+{
+	static QThreadPool* pool = nullptr;
+	static QMutex mutex;
+
+	QMutexLocker locker(&mutex);
+	if (pool == nullptr)
+	{
+		// Probes of cold tables wait for the disk rather than the
+		// CPU, so use more threads than there are cores
+		pool = new QThreadPool;
+		pool->setMaxThreadCount(qMax(4, QThread::idealThreadCount() * 2));
+	}
+
+	return pool;
+}
+
+void SyzygyTablebase::warmCache(int pieces)
+{
+	if (!s_initOK)
+		return;
+
+	// Table names look like "KRPvKR", one letter per piece. The
+	// smallest tables are read first because they're the most likely
+	// to be probed.
+	QStringList fileNames;
+	const auto files = wdlTableFiles();
+	for (const QFileInfo& info : files)
+	{
+		if (info.completeBaseName().remove('v').size() <= pieces)
+			fileNames << info.absoluteFilePath();
+	}
+
+	if (!fileNames.isEmpty())
+		threadPool()->start(new WarmCacheTask(fileNames));
+}
+
 Chess::Result SyzygyTablebase::result(const Chess::Side& side,
 					   const Chess::Square& enpassantSq,
 					   Castling castling,
@@ -113,40 +302,43 @@ Chess::Result SyzygyTablebase::result(const Chess::Side& side,
 		}
 	}
 
+	// The WDL tables are probed first. WDL probes are thread-safe, so
+	// concurrent games don't wait for each other.
+	//
+	// The WDL value is for a position with a zero halfmove clock.
+	// It's also correct for other clocks, except that a win or loss
+	// can turn into a draw by the 50-move rule. Only in that case,
+	// or when the caller wants the DTZ, the DTZ tables are probed.
+	const unsigned wdl = tb_probe_wdl(white, black, kings, queens, rooks,
+		bishops, knights, pawns, 0, 0, ep, wtm);
+	if (wdl == TB_RESULT_FAILED)
+		return Chess::Result();
+
+	const bool needDtz = (dtz != nullptr && wdl != TB_DRAW)
+		|| (rule50 > 0 && !s_noRule50
+		    && (wdl == TB_WIN || wdl == TB_LOSS));
+	if (!needDtz)
+	{
+		if (dtz != nullptr)
+			*dtz = 0;
+		return Chess::Result(Chess::Result::Adjudication,
+				     tbWinner(wdl, wtm), "SyzygyTB");
+	}
+
+	// DTZ probes share a table cache and must not run concurrently
 	s_mutex.lock();
 	unsigned result = tb_probe_root(white, black, kings, queens, rooks,
 		bishops, knights, pawns, rule50, 0, ep, wtm, nullptr);
 	s_mutex.unlock();
 
-	Chess::Side winner(Chess::Side::NoSide); 
+	Chess::Side winner(Chess::Side::NoSide);
 	if (result == TB_RESULT_FAILED)
 		return Chess::Result();
 	if (result == TB_RESULT_CHECKMATE)
 		winner = (wtm? Chess::Side::Black: Chess::Side::White);
-	else if (result == TB_RESULT_STALEMATE)
-		winner = Chess::Side::NoSide;
-	else
-	{
-		switch (TB_GET_WDL(result))
-		{
-		case TB_BLESSED_LOSS:
-			if (!s_noRule50)
-				break;
-			// Fallthrough
-		case TB_LOSS:
-			winner = (wtm? Chess::Side::Black: Chess::Side::White);
-			break;
-		case TB_DRAW:
-			break;
-		case TB_CURSED_WIN:
-			if (!s_noRule50)
-				break;
-			// Fallthrough
-		case TB_WIN:
-			winner = (wtm? Chess::Side::White: Chess::Side::Black);
-			break;
-		}
-	}
+	else if (result != TB_RESULT_STALEMATE)
+		winner = tbWinner(TB_GET_WDL(result), wtm);
+
 	if (dtz != nullptr)
 		*dtz = TB_GET_DTZ(result);
 	return Chess::Result(Chess::Result::Adjudication, winner, "SyzygyTB");
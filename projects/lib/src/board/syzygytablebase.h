@@ -25,6 +25,8 @@
 #include "result.h"
 #include "square.h"
 #include "piece.h"
+class QThreadPool;
+namespace Chess { class Board; }
 
 /*!
  * \brief A wrapper for probing Syzygy endgame tablebases.
@@ -68,6 +70,24 @@ class LIB_EXPORT SyzygyTablebase
 		 * available; otherwise returns false.
 		 */
 		static bool tbAvailable(int pieces);
+		/*!
+		 * Returns the largest number of pieces in a position that
+		 * can be probed, or 0 if the tablebases aren't available.
+		 *
+		 * Positions with more pieces can be skipped without
+		 * calling result().
+		 */
+		static int maxPieces();
+		/*!
+		 * Returns true if the table for the material on \a board is
+		 * available; otherwise returns false.
+		 *
+		 * The material signatures of the tables are collected from
+		 * the file names by initialize(), so this is a fast lookup
+		 * that lets positions without a table skip the probe.
+		 * \a board must use the piece types of Chess::WesternBoard.
+		 */
+		static bool hasTable(const Chess::Board* board);
 		/*!
 		 * Set the maximum number of pieces to be used for tablebase
 		 * adjudication. Default is no limit.
@@ -77,6 +97,21 @@ class LIB_EXPORT SyzygyTablebase
 		 * Disable the 50 move rule from consideration.
 		 */
 		static void setNoRule50();
+		/*!
+		 * Returns the thread pool used for tablebase I/O, ie.
+		 * asynchronous probes and cache warming.
+		 */
+		static QThreadPool* threadPool();
+		/*!
+		 * Reads the WDL tables of positions with at most \a pieces
+		 * pieces on a background thread, so that they are in the
+		 * operating system's page cache before they are first
+		 * probed. This avoids slow disk reads in the middle of
+		 * games, especially with large 7-piece tables.
+		 *
+		 * Does nothing if the tablebases aren't initialized.
+		 */
+		static void warmCache(int pieces);
 		/*!
 		 * Returns the expected game result for the positions specified
 		 * by \a side, \a enpassantSq, \a castling and \a pieces.
@@ -88,6 +123,11 @@ class LIB_EXPORT SyzygyTablebase
 		 * If the position isn't found in the tablebases, a null result
 		 * is returned.
 		 *
+		 * This function is thread-safe. Usually only the WDL tables
+		 * are probed, without locking. The DTZ tables are probed
+		 * only if \a dtz is requested for a position that isn't a
+		 * plain draw, or if \a rule50 may turn a win into a draw.
+		 *
 		 * \sa Chess::Board::tablebaseResult()
 		 */
 		static Chess::Result result(const Chess::Side& side,
@@ -243,8 +243,13 @@ QString WesternBoard::sanMoveString(const Move& move)
 	if (piece.type() != Pawn)	// not pawn
 	{
 		str += pieceSymbol(piece).toUpper();
+
+		// The move can only be ambiguous if there are other pieces
+		// of the same type, which the material counts tell without
+		// generating any moves
 		QVarLengthArray<Move> moves;
-		generateMoves(moves, piece.type());
+		if (materialCount(side, piece.type()) > 1)
+			generateMoves(moves, piece.type());
 
 		for (int i = 0; i < moves.size(); i++)
 		{
@@ -1402,36 +1407,31 @@ Result WesternBoard::result()
 		}
 	}
 
-	// Insufficient mating material
-	int material = 0;
-	bool bishops[] = { false, false };
-	for (int i = 0; i < arraySize(); i++)
+	// Insufficient mating material. The material counts decide
+	// it, except when bishops are the only pieces besides kings:
+	// then it depends on the colors of their squares.
+	const int knights = materialCount(Side::White, Knight)
+			  + materialCount(Side::Black, Knight);
+	const int bishopCount = materialCount(Side::White, Bishop)
+			      + materialCount(Side::Black, Bishop);
+	const int others = pieceCount() - knights - bishopCount
+			 - materialCount(Side::White, King)
+			 - materialCount(Side::Black, King);
+	int material = others * 2 + knights + qMin(bishopCount, 1);
+	if (material == 1 && bishopCount > 1)
 	{
-		const Piece& piece = pieceAt(i);
-		if (!piece.isValid())
-			continue;
-
-		switch (piece.type())
-		{
-		case King:
-			break;
-		case Bishop:
+		bool bishops[] = { false, false };
+		for (int i = 0; i < arraySize(); i++)
 		{
+			if (pieceAt(i).type() != Bishop)
+				continue;
+
 			auto color = chessSquare(i).color();
-			if (color != Square::NoColor && !bishops[color])
-			{
-				material++;
+			if (color != Square::NoColor)
 				bishops[color] = true;
-			}
-			break;
 		}
-		case Knight:
+		if (bishops[Square::Light] && bishops[Square::Dark])
 			material++;
-			break;
-		default:
-			material += 2;
-			break;
-		}
 	}
 	if (material <= 1)
 	{
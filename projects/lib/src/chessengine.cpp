@@ -18,10 +18,10 @@
 
 #include "chessengine.h"
 #include <QIODevice>
-#include <QTimer>
 #include <QStringRef>
 #include <QtAlgorithms>
 #include "engineoption.h"
+#include "wheeltimer.h"
 
 
 int ChessEngine::s_count = 0;
@@ -76,27 +76,23 @@ ChessEngine::ChessEngine(QObject* parent)
 	  m_pinging(false),
 	  m_whiteEvalPov(false),
 	  m_pondering(false),
-	  m_pingTimer(new QTimer(this)),
-	  m_quitTimer(new QTimer(this)),
-	  m_idleTimer(new QTimer(this)),
-	  m_protocolStartTimer(new QTimer(this)),
+	  m_pingTimer(new WheelTimer(this)),
+	  m_quitTimer(new WheelTimer(this)),
+	  m_idleTimer(new WheelTimer(this)),
+	  m_protocolStartTimer(new WheelTimer(this)),
 	  m_ioDevice(nullptr),
 	  m_restartMode(EngineConfiguration::RestartAuto),
 	  m_cuteseal(false)
 {
-	m_pingTimer->setSingleShot(true);
 	m_pingTimer->setInterval(120000);
 	connect(m_pingTimer, SIGNAL(timeout()), this, SLOT(onPingTimeout()));
 
-	m_quitTimer->setSingleShot(true);
 	m_quitTimer->setInterval(10000);
 	connect(m_quitTimer, SIGNAL(timeout()), this, SLOT(onQuitTimeout()));
 
-	m_idleTimer->setSingleShot(true);
 	m_idleTimer->setInterval(120000);
 	connect(m_idleTimer, SIGNAL(timeout()), this, SLOT(onIdleTimeout()));
 
-	m_protocolStartTimer->setSingleShot(true);
 	m_protocolStartTimer->setInterval(125000);
 	connect(m_protocolStartTimer, SIGNAL(timeout()),
 		this, SLOT(onProtocolStartTimeout()));
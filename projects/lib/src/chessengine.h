@@ -283,10 +283,10 @@ class LIB_EXPORT ChessEngine : public ChessPlayer
 		bool m_pinging;
 		bool m_whiteEvalPov;
 		bool m_pondering;
-		QTimer* m_pingTimer;
-		QTimer* m_quitTimer;
-		QTimer* m_idleTimer;
-		QTimer* m_protocolStartTimer;
+		WheelTimer* m_pingTimer;
+		WheelTimer* m_quitTimer;
+		WheelTimer* m_idleTimer;
+		WheelTimer* m_protocolStartTimer;
 		QIODevice *m_ioDevice;
 		QStringList m_writeBuffer;
 		QStringList m_variants;
@@ -16,12 +16,16 @@
 */
 
 #include "chessgame.h"
+#include <QMutex>
+#include <QRunnable>
+#include <QScopedPointer>
 #include <QThread>
 #include <QTimer>
 #include <QtMath>
 #include <QRegularExpression>
 #include "board/board.h"
 #include "board/westernboard.h"
+#include "board/syzygytablebase.h"
 #include "chessplayer.h"
 #include "openingbook.h"
 #include "chessengine.h"
@@ -242,26 +246,14 @@ QString ChessGame::statusString(const Chess::Move& move, bool doMove)
 		m_board->makeMove(move);
 
 	// Material balance 'mb'
-	QMap<QString, int> pMap;
-	for (int file = 0; file < m_board->height(); file++)
-		for (int rank = 0; rank < m_board->width(); rank++)
-		{
-			const Chess::Square sq = Chess::Square(file, rank);
-			const Chess::Piece piece = m_board->pieceAt(sq);
-			if (!piece.isValid()) continue;
-			const QString sym(m_board->pieceSymbol(piece).toUpper());
-			if (!pMap.contains(sym))
-				pMap[sym] = 0;
-			if (piece.side() == Chess::Side::White)
-				++pMap[sym];
-			else
-				--pMap[sym];
-		}
-
 	QString str(", mb=");
 	for(const char* istr : {"P", "N", "B", "R", "Q"})
 	{
-		const int v(pMap[istr]);
+		const int type = m_board->pieceFromSymbol(istr).type();
+		int v = 0;
+		if (type != Chess::Piece::NoPiece)
+			v = m_board->materialCount(Chess::Side::White, type)
+			  - m_board->materialCount(Chess::Side::Black, type);
 		if (v >= 0)
 			str += '+';
 		str += QString::number(v);
@@ -284,6 +276,7 @@ ChessGame::ChessGame(Chess::Board* board, PgnGame* pgn, QObject* parent)
 	  m_pgnInitialized(false),
 	  m_bookOwnership(false),
 	  m_boardShouldBeFlipped(false),
+	  m_resultPending(false),
 	  m_pgn(pgn)
 {
 	Q_ASSERT(pgn != nullptr);
@@ -298,6 +291,13 @@ ChessGame::ChessGame(Chess::Board* board, PgnGame* pgn, QObject* parent)
 
 ChessGame::~ChessGame()
 {
+	// Drop the results of the probes that are still running
+	if (!m_tbProbeTarget.isNull())
+	{
+		QMutexLocker locker(&m_tbProbeTarget->mutex);
+		m_tbProbeTarget->game = nullptr;
+	}
+
 	delete m_board;
 	if (m_bookOwnership)
 	{
@@ -364,6 +364,17 @@ Chess::Result ChessGame::result() const
 	return m_result;
 }
 
+const GameAdjudicator& ChessGame::adjudicator() const
+{
+	return m_adjudicator;
+}
+
+const MoveLatency& ChessGame::moveLatency(Chess::Side side) const
+{
+	Q_ASSERT(!side.isNull());
+	return m_moveLatency[side];
+}
+
 ChessPlayer* ChessGame::playerToMove() const
 {
 	if (m_board->sideToMove().isNull())
@@ -472,13 +483,77 @@ void ChessGame::emitLastMove()
 	emit moveMade(md.move, md.moveString, md.comment);
 }
 
+/*
+ * The game that receives the results of tablebase probes. The game
+ * clears it when it's destroyed, so that late results are dropped.
+ */
+struct ChessGame::TablebaseProbeTarget
+{
+	QMutex mutex;
+	ChessGame* game = nullptr;
+};
+
+class ChessGame::TablebaseProbeTask : public QRunnable
+{
+	public:
+		TablebaseProbeTask(Chess::Board* board,
+				   const QSharedPointer<TablebaseProbeTarget>& target)
+			: m_board(board),
+			  m_target(target)
+		{
+		}
+
+		virtual void run()
+		{
+			const quint64 key = m_board->key();
+			const Chess::Result result(m_board->tablebaseResult());
+
+			QMutexLocker locker(&m_target->mutex);
+			if (m_target->game != nullptr)
+				QMetaObject::invokeMethod(m_target->game,
+							  "onTablebaseResult",
+							  Qt::QueuedConnection,
+							  Q_ARG(quint64, key),
+							  Q_ARG(Chess::Result, result));
+		}
+
+	private:
+		QScopedPointer<Chess::Board> m_board;
+		QSharedPointer<TablebaseProbeTarget> m_target;
+};
+
+void ChessGame::startTablebaseProbe()
+{
+	if (m_tbProbeTarget.isNull())
+	{
+		m_tbProbeTarget = QSharedPointer<TablebaseProbeTarget>::create();
+		m_tbProbeTarget->game = this;
+	}
+
+	// The probe gets its own copy of the position, so the game can
+	// go on while the tables are read from disk
+	SyzygyTablebase::threadPool()->start(
+		new TablebaseProbeTask(m_board->copy(), m_tbProbeTarget));
+}
+
+void ChessGame::onTablebaseResult(quint64 key, const Chess::Result& result)
+{
+	// The result is always cached, but the game is only adjudicated
+	// if the probed position is still the current one
+	const Chess::Result adjudication(
+		m_adjudicator.addTablebaseResult(key, result));
+	if (m_finished || key != m_board->key() || adjudication.isNone())
+		return;
+
+	onAdjudication(adjudication);
+}
+
 void ChessGame::onMoveMade(const Chess::Move& move)
 {
 	ChessPlayer* sender = qobject_cast<ChessPlayer*>(QObject::sender());
 	Q_ASSERT(sender != nullptr);
 
 	Q_ASSERT(m_gameInProgress);
-	Q_ASSERT(m_board->isLegalMove(move));
 	if (sender != playerToMove())
 	{
 		qWarning("%s tried to make a move on the opponent's turn",
@@ -486,29 +561,33 @@ void ChessGame::onMoveMade(const Chess::Move& move)
 		return;
 	}
 
+	// A move made right after the previous one, eg. a book move,
+	// is only accepted if the previous move didn't end the game
+	if (!applyPendingResult())
+		return;
+	Q_ASSERT(m_board->isLegalMove(move));
+
+	const Chess::Side side(m_board->sideToMove());
 	m_scores[m_moves.size()] = sender->evaluation().score();
 	m_moves.append(move);
 	addPgnMove(move, evalString(sender->evaluation(), move));
 
-	// Get the result before sending the move to the opponent
-	m_board->makeMove(move);
-	m_result = m_board->result();
-	if (m_result.isNone())
-	{
-		if (m_board->reversibleMoveCount() == 0)
-			m_adjudicator.resetDrawMoveCount();
-
-		m_adjudicator.addEval(m_board, sender->evaluation());
-		m_result = m_adjudicator.result();
-	}
-	m_board->undoMove();
-
 	ChessPlayer* player = playerToWait();
+	const qint64 validated = MoveLatency::timestamp();
 	player->makeMove(move);
+	const qint64 notified = MoveLatency::timestamp();
 	m_board->makeMove(move);
 
+	// The opponent is only told to think if the game didn't end by
+	// the rules. Adjudication is done while the opponent is thinking,
+	// and always before its reply is accepted.
+	m_result = m_board->result();
+	const qint64 rulesChecked = MoveLatency::timestamp();
 	if (m_result.isNone())
 	{
+		m_pendingEval = sender->evaluation();
+		m_resultPending = true;
+
 		emitLastMove();
 		startTurn();
 	}
@@ -518,7 +597,51 @@ void ChessGame::onMoveMade(const Chess::Move& move)
 		emitLastMove();
 	}
 
+	const qint64 goSent = player->goTimestamp();
+	const qint64 adjudicationStarted = MoveLatency::timestamp();
+	applyPendingResult();
+	const qint64 updateStarted = MoveLatency::timestamp();
 	updateLiveFiles();
+
+	// Book moves aren't measured, and neither are moves after
+	// which the opponent wasn't told to think right away
+	const qint64 received = sender->moveTimestamp();
+	if (received == 0)
+		return;
+
+	MoveLatency& latency = m_moveLatency[side];
+	latency.add(MoveLatency::Validate, validated - received);
+	latency.add(MoveLatency::Notify, notified - validated);
+	latency.add(MoveLatency::Result, (rulesChecked - notified)
+		    + (updateStarted - adjudicationStarted));
+	latency.add(MoveLatency::LiveUpdate,
+		    MoveLatency::timestamp() - updateStarted);
+	if (m_result.isNone() && goSent > notified)
+	{
+		latency.add(MoveLatency::Go, goSent - notified);
+		latency.add(MoveLatency::Total, goSent - received);
+	}
+}
+
+bool ChessGame::applyPendingResult()
+{
+	if (!m_resultPending)
+		return !m_finished;
+	m_resultPending = false;
+
+	// The rules were already checked in onMoveMade()
+	if (m_board->reversibleMoveCount() == 0)
+		m_adjudicator.resetDrawMoveCount();
+
+	m_adjudicator.addEval(m_board, m_pendingEval);
+	m_result = m_adjudicator.result();
+	if (m_result.isNone() && m_adjudicator.startTablebaseProbe(m_board))
+		startTablebaseProbe();
+	if (m_result.isNone())
+		return true;
+
+	stop(false);
+	return false;
 }
 
 void ChessGame::startTurn()
@@ -566,7 +689,7 @@ void ChessGame::onResignation(const Chess::Result& result)
 
 void ChessGame::onResultClaim(const Chess::Result& result)
 {
-	if (m_finished)
+	if (m_finished || !applyPendingResult())
 		return;
 
 	ChessPlayer* sender = qobject_cast<ChessPlayer*>(QObject::sender());
@@ -23,16 +23,18 @@
 #include <QStringList>
 #include <QMap>
 #include <QSemaphore>
+#include <QSharedPointer>
 #include "pgngame.h"
 #include "board/result.h"
 #include "board/move.h"
 #include "timecontrol.h"
 #include "gameadjudicator.h"
+#include "movelatency.h"
+#include "moveevaluation.h"
 
 namespace Chess { class Board; }
 class ChessPlayer;
 class OpeningBook;
-class MoveEvaluation;
 
 
 class LIB_EXPORT ChessGame : public QObject
@@ -57,6 +59,8 @@ class LIB_EXPORT ChessGame : public QObject
 		const QVector<Chess::Move>& moves() const;
 		const QMap<int,int>& scores() const;
 		Chess::Result result() const;
+		const GameAdjudicator& adjudicator() const;
+		const MoveLatency& moveLatency(Chess::Side side) const;
 
 		void setError(const QString& message);
 		void setPlayer(Chess::Side side, ChessPlayer* player);
@@ -117,13 +121,19 @@ class LIB_EXPORT ChessGame : public QObject
 		void onPlayerReady();
 		void syncPlayers();
 		void pauseThread();
+		void onTablebaseResult(quint64 key, const Chess::Result& result);
 
 	private:
+		struct TablebaseProbeTarget;
+		class TablebaseProbeTask;
+
 		Chess::Move bookMove(Chess::Side side);
 		bool resetBoard();
 		void initializePgn();
 		void addPgnMove(const Chess::Move& move, const QString& comment);
+		bool applyPendingResult();
 		void emitLastMove();
+		void startTablebaseProbe();
 
 		void updateLiveFiles() const;
 
@@ -142,6 +152,7 @@ class LIB_EXPORT ChessGame : public QObject
 		bool m_pgnInitialized;
 		bool m_bookOwnership;
 		bool m_boardShouldBeFlipped;
+		bool m_resultPending;
 		QString m_error;
 		QString m_startingFen;
 		Chess::Result m_result;
@@ -151,6 +162,9 @@ class LIB_EXPORT ChessGame : public QObject
 		QSemaphore m_pauseSem;
 		QSemaphore m_resumeSem;
 		GameAdjudicator m_adjudicator;
+		MoveEvaluation m_pendingEval;
+		MoveLatency m_moveLatency[2];
+		QSharedPointer<TablebaseProbeTarget> m_tbProbeTarget;
 
 		// live output support
 		QString m_livePgnOut;
@@ -17,14 +17,17 @@
 */
 
 #include "chessplayer.h"
-#include <QTimer>
+#include "wheeltimer.h"
+#include "movelatency.h"
 #include "board/board.h"
 
 
 ChessPlayer::ChessPlayer(QObject* parent)
 	: QObject(parent),
 	  m_state(NotStarted),
-	  m_timer(new QTimer(this)),
+	  m_timer(new WheelTimer(this)),
+	  m_moveTimestamp(0),
+	  m_goTimestamp(0),
 	  m_claimedResult(false),
 	  m_validateClaims(true),
 	  m_canPlayAfterTimeout(false),
@@ -32,7 +35,6 @@ ChessPlayer::ChessPlayer(QObject* parent)
 	  m_opponent(nullptr),
 	  m_rating(0)
 {
-	m_timer->setSingleShot(true);
 	connect(m_timer, SIGNAL(timeout()), this, SLOT(onTimeout()));
 }
 
@@ -103,6 +105,7 @@ void ChessPlayer::go()
 	
 	startClock();
 	startThinking();
+	m_goTimestamp = MoveLatency::timestamp();
 }
 
 void ChessPlayer::quit()
@@ -130,13 +133,17 @@ void ChessPlayer::startClock()
 
 	if (!m_timeControl.isInfinite())
 	{
-		int t = m_timeControl.timeLeft() + m_timeControl.expiryMargin() + getMaxNetLagMs();
-		m_timer->start(qMax(t, 0) + 200);
+		// Round the time left up to the next millisecond
+		qint64 t = m_timeControl.timeLeftNs()
+			 + qint64(m_timeControl.expiryMargin() + getMaxNetLagMs()) * 1000000;
+		t = (qMax(t, qint64(0)) + 999999) / 1000000;
+		m_timer->start(int(t) + 200);
 	}
 }
 
 void ChessPlayer::makeBookMove(const Chess::Move& move)
 {
+	m_moveTimestamp = 0;
 	m_timeControl.startTimer();
 	makeMove(move);
 	m_timeControl.update(false);
@@ -145,6 +152,16 @@ void ChessPlayer::makeBookMove(const Chess::Move& move)
 	emit moveMade(move);
 }
 
+qint64 ChessPlayer::moveTimestamp() const
+{
+	return m_moveTimestamp;
+}
+
+qint64 ChessPlayer::goTimestamp() const
+{
+	return m_goTimestamp;
+}
+
 const TimeControl* ChessPlayer::timeControl() const
 {
 	return &m_timeControl;
@@ -275,12 +292,13 @@ void ChessPlayer::forfeit(Chess::Result::Type type, const QString& description)
 	claimResult(Chess::Result(type, m_side.opposite(), description));
 }
 
-void ChessPlayer::emitMove(const Chess::Move& move, int64_t overrideMoveTimeMs)
+void ChessPlayer::emitMove(const Chess::Move& move, int64_t overrideMoveTimeNs)
 {
+	m_moveTimestamp = MoveLatency::timestamp();
 	if (m_state == Thinking)
 		setState(Observing);
 
-	m_timeControl.update(true, overrideMoveTimeMs);
+	m_timeControl.update(true, overrideMoveTimeNs);
 	m_eval.setTime(m_timeControl.lastMoveTime());
 
 	m_timer->stop();
@@ -26,7 +26,7 @@
 #include "board/move.h"
 #include "timecontrol.h"
 #include "moveevaluation.h"
-class QTimer;
+class WheelTimer;
 namespace Chess { class Board; }
 
 
@@ -105,6 +105,19 @@ class LIB_EXPORT ChessPlayer : public QObject
 		/*! Sets the time control for the player. */
 		void setTimeControl(const TimeControl& timeControl);
 
+		/*!
+		 * Returns the MoveLatency::timestamp() of the player's last
+		 * move, taken when the move was received from the player,
+		 * or 0 if the move was a book move.
+		 */
+		qint64 moveTimestamp() const;
+		/*!
+		 * Returns the MoveLatency::timestamp() of the last time the
+		 * player was told to start thinking, eg. when an engine was
+		 * sent the "go" command.
+		 */
+		qint64 goTimestamp() const;
+
 		/*! Returns the side of the player. */
 		Chess::Side side() const;
 
@@ -281,10 +294,10 @@ class LIB_EXPORT ChessPlayer : public QObject
 		 * Emits the player's move, and a timeout signal if the
 		 * move came too late.
 		 *
-		 * The move time is overridden by actual move times when
-		 * cuteseal is enabled.
+		 * The move time is overridden by actual move times in
+		 * nanoseconds when cuteseal is enabled.
 		 */
-		void emitMove(const Chess::Move& move, int64_t overrideMoveTimeMs = -1);
+		void emitMove(const Chess::Move& move, int64_t overrideMoveTimeNs = -1);
 		
 		/*! Returns the opposing player. */
 		const ChessPlayer* opponent() const;
@@ -319,7 +332,9 @@ class LIB_EXPORT ChessPlayer : public QObject
 		QString m_error;
 		State m_state;
 		TimeControl m_timeControl;
-		QTimer* m_timer;
+		WheelTimer* m_timer;
+		qint64 m_moveTimestamp;
+		qint64 m_goTimestamp;
 		bool m_claimedResult;
 		bool m_validateClaims;
 		bool m_canPlayAfterTimeout;
@@ -0,0 +1,5874 @@
+/*
+    This file is part of Cute Chess.
+    Copyright (C) 2008-2018 Cute Chess authors
+
+    Cute Chess is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Cute Chess is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Cute Chess.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// The internal ECO catalog, generated by EcoNode::write()
+
+#include "econode.h"
+
+const EcoNode::Entry EcoNode::s_builtinEntries[] =
+{
+	{ Q_UINT64_C(0xd9d2afa550eb0000), EcoNode(102, 2748, -1) },
+	{ Q_UINT64_C(0xad77a362c4549001), EcoNode(421, 2196, 31562) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xafe6924fafae4007), EcoNode(178, 106, 31902) },
+	{ Q_UINT64_C(0x82cae708ab313008), EcoNode(237, 1445, 25035) },
+	{ Q_UINT64_C(0x424759f7ab2e1009), EcoNode(239, 1445, 13241) },
+	{ Q_UINT64_C(0x094ca2f66f3ef00a), EcoNode(168, 106, 1938) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x8b99e2127468b00c), EcoNode(345, 200, 26405) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xcc530f2dd4c5b00e), EcoNode(409, 1496, 37138) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x0970f2d1cfb6e010), EcoNode(481, 353, 2069) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x18e419d2406bb012), EcoNode(423, 2196, 5236) },
+	{ Q_UINT64_C(0x4661809828e5d012), EcoNode(301, 13786, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x768c3ac4890df01b), EcoNode(252, 1912, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x6e6c2de2e639f01e), EcoNode(350, 0, 21321) },
+	{ Q_UINT64_C(0x3864a5faf1ce101f), EcoNode(462, 353, 2667) },
+	{ Q_UINT64_C(0xade14caae2bfb01f), EcoNode(238, 1445, 31592) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x49b9373df0e93023), EcoNode(59, 2654, 14445) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xbe690aa70e5bc025), EcoNode(257, 8273, 34555) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x3ca0cf572f6f4027), EcoNode(140, 106, 12361) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x8709e37463358029), EcoNode(210, 388, 928) },
+	{ Q_UINT64_C(0x276cfb47883a902a), EcoNode(408, 1496, 8354) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x48b5a37c9494402d), EcoNode(337, 0, 14298) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x20d8af45578c0031), EcoNode(477, 353, 6788) },
+	{ Q_UINT64_C(0xb2b2c3cd16ea3032), EcoNode(56, 24223, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x623c8000e6c51038), EcoNode(80, 19119, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x45c65b144307903f), EcoNode(202, 388, 10163) },
+	{ Q_UINT64_C(0xa3cc869fea87b040), EcoNode(398, 1131, 30164) },
+	{ Q_UINT64_C(0xf64dd621d0625040), EcoNode(497, 353, 43768) },
+	{ Q_UINT64_C(0xb80cf946e9d31042), EcoNode(197, 106, 33442) },
+	{ Q_UINT64_C(0xa838d6d85321c043), EcoNode(356, 0, 30766) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x1bf2bb7186495046), EcoNode(243, 1172, 5620) },
+	{ Q_UINT64_C(0x0c8bcddd6fde4047), EcoNode(298, 165, 2859) },
+	{ Q_UINT64_C(0x13137c574d88c047), EcoNode(212, 388, 4221) },
+	{ Q_UINT64_C(0x6303be6295c8a049), EcoNode(132, 106, 19407) },
+	{ Q_UINT64_C(0x68aeb9761c2ae049), EcoNode(248, 697, 6454) },
+	{ Q_UINT64_C(0x75fdf63f05fe2049), EcoNode(334, 0, 22774) },
+	{ Q_UINT64_C(0x94f0413c69fc0046), EcoNode(238, 7602, -1) },
+	{ Q_UINT64_C(0xbefa9380898c8048), EcoNode(244, 4022, -1) },
+	{ Q_UINT64_C(0xd8e08d47aaa29048), EcoNode(45, 743, -1) },
+	{ Q_UINT64_C(0x010bb5f9522be04f), EcoNode(344, 200, 214) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x2dec100a81e99055), EcoNode(441, 2196, 9407) },
+	{ Q_UINT64_C(0x8aca4a650ce1c056), EcoNode(12, 613, 3843) },
+	{ Q_UINT64_C(0x5b467095e4bee057), EcoNode(253, 3314, 17822) },
+	{ Q_UINT64_C(0x2a62054399b44058), EcoNode(2, 8887, -1) },
+	{ Q_UINT64_C(0x9c52f45a1071e058), EcoNode(325, 29017, -1) },
+	{ Q_UINT64_C(0x1fdc79becce5205a), EcoNode(239, 1445, 6509) },
+	{ Q_UINT64_C(0x51ce99c2fe6f405a), EcoNode(288, 165, 15847) },
+	{ Q_UINT64_C(0xc266e5237ffa5059), EcoNode(213, 388, 35204) },
+	{ Q_UINT64_C(0xd486b8437f78f058), EcoNode(233, 1445, 38432) },
+	{ Q_UINT64_C(0xf6e9af1ac6abd05b), EcoNode(241, 2688, 43900) },
+	{ Q_UINT64_C(0x9e9ad6c73cf2305f), EcoNode(348, 200, 29413) },
+	{ Q_UINT64_C(0x1703807427325060), EcoNode(453, 2196, 5032) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xa5ab7512e78a3063), EcoNode(308, 0, 4) },
+	{ Q_UINT64_C(0xd3bd7f7b03696064), EcoNode(252, 1912, 431) },
+	{ Q_UINT64_C(0xb7dd541901ba0065), EcoNode(185, 106, 33399) },
+	{ Q_UINT64_C(0x45eb8369a1ca8066), EcoNode(348, 200, 13700) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x450083134e4c306a), EcoNode(241, 2688, 13617) },
+	{ Q_UINT64_C(0xa1f4bf5c329f206a), EcoNode(1, 9311, 8251) },
+	{ Q_UINT64_C(0x48fea0d63e2de06c), EcoNode(239, 1445, 14380) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x0b343eff385eb075), EcoNode(249, 697, 2527) },
+	{ Q_UINT64_C(0x7edbac5ff6295075), EcoNode(12, 613, 24254) },
+	{ Q_UINT64_C(0xd0eca9d1b32b4077), EcoNode(260, 165, 37763) },
+	{ Q_UINT64_C(0x3dbd5b87f44b2078), EcoNode(28, 613, 12470) },
+	{ Q_UINT64_C(0x4f837c7daacc3079), EcoNode(210, 388, 15244) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x09301c77c0ffb07f), EcoNode(4, 1925, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x6f885037e86a9082), EcoNode(210, 388, 21512) },
+	{ Q_UINT64_C(0x33b7f39c2bb44083), EcoNode(120, 106, 10660) },
+	{ Q_UINT64_C(0xbf5cf670aa975084), EcoNode(454, 2196, 34719) },
+	{ Q_UINT64_C(0xfbe213122e14f085), EcoNode(42, 15406, 44530) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x31caa083f60c8087), EcoNode(352, 0, 10257) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x269d9733c24d208e), EcoNode(367, 0, 8109) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x1328ba7f31d73091), EcoNode(246, 697, 4273) },
+	{ Q_UINT64_C(0x85af1d7bc1f75091), EcoNode(350, 0, 25541) },
+	{ Q_UINT64_C(0x124157e491ec5093), EcoNode(82, 451, 4078) },
+	{ Q_UINT64_C(0x5edf6b3f6fc79093), EcoNode(237, 1445, 18493) },
+	{ Q_UINT64_C(0xb0053d3ad7d87091), EcoNode(420, 2196, 31946) },
+	{ Q_UINT64_C(0xb2cad11ec833e091), EcoNode(478, 353, 32563) },
+	{ Q_UINT64_C(0xe7d594c774e30096), EcoNode(103, 2748, 41595) },
+	{ Q_UINT64_C(0x844e56f9e4b83098), EcoNode(364, 0, 25318) },
+	{ Q_UINT64_C(0xd1bb971f5c747099), EcoNode(25, 613, 37943) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xa45ec9f15075a0a1), EcoNode(131, 106, 30268) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x93cb6e92b241f0a6), EcoNode(201, 388, 4774) },
+	{ Q_UINT64_C(0x76559684f673d0a7), EcoNode(334, 0, 22816) },
+	{ Q_UINT64_C(0x7f15a97b728630a8), EcoNode(499, 353, 24351) },
+	{ Q_UINT64_C(0xa7bd30f5c9bb40a8), EcoNode(202, 388, 30699) },
+	{ Q_UINT64_C(0x6a29b24456b6e0aa), EcoNode(344, 200, 20518) },
+	{ Q_UINT64_C(0xb7e73ef3899c80a9), EcoNode(446, 2196, 33433) },
+	{ Q_UINT64_C(0xcb5cd02b747dd0a7), EcoNode(280, 165, 37031) },
+	{ Q_UINT64_C(0xe82a9465d5ac20ab), EcoNode(462, 353, 41622) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xa8b2b82ccb2440af), EcoNode(44, 30834, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x77a02edaa29420b2), EcoNode(200, 388, 23194) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x985a0e5c7f58f0b6), EcoNode(230, 3677, 28417) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xad02810c3ba230b8), EcoNode(96, 451, 333) },
+	{ Q_UINT64_C(0xc921f7b3c8b450b8), EcoNode(123, 106, 28494) },
+	{ Q_UINT64_C(0xeccee3b4b02790b8), EcoNode(0, 42378, -1) },
+	{ Q_UINT64_C(0x596cd330663fc0bb), EcoNode(239, 1445, 17445) },
+	{ Q_UINT64_C(0x8edffe3dd59810bb), EcoNode(353, 0, 26901) },
+	{ Q_UINT64_C(0x5b94103464cd10bd), EcoNode(248, 697, 6983) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x9b405e5b59e0b0c1), EcoNode(183, 106, 28718) },
+	{ Q_UINT64_C(0xd2a23215fd3300c2), EcoNode(7, 821, 38082) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x8087d21deeb4c0c5), EcoNode(292, 165, 24738) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x894087ad298d60c8), EcoNode(158, 106, 25980) },
+	{ Q_UINT64_C(0x8af9eae9ae4610c8), EcoNode(424, 2196, 26235) },
+	{ Q_UINT64_C(0xf23ebdce4c7810c9), EcoNode(355, 0, 43261) },
+	{ Q_UINT64_C(0x8b937fd85904f0cb), EcoNode(225, 3287, 26361) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x20936171f90e60cf), EcoNode(123, 106, 6672) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xe848419ec14350d1), EcoNode(433, 2196, 41680) },
+	{ Q_UINT64_C(0xb0e21e47223e50d2), EcoNode(332, 0, 32105) },
+	{ Q_UINT64_C(0xe119c57d51ae70d3), EcoNode(200, 388, 26190) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xe4eeb764410570d5), EcoNode(400, 41070, -1) },
+	{ Q_UINT64_C(0xfcf3b5758569b0d6), EcoNode(57, 2654, 44858) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xcb067d00107c80db), EcoNode(421, 2196, 36948) },
+	{ Q_UINT64_C(0xbdf888a4064a50dc), EcoNode(244, 34442, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xb01371a9e8b430e0), EcoNode(7, 821, 31961) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xbc76a27430c370e4), EcoNode(29, 613, 34084) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x4c3be29eec5b90ea), EcoNode(269, 165, 14789) },
+	{ Q_UINT64_C(0x73b7f8c55f4990eb), EcoNode(106, 1518, 22259) },
+	{ Q_UINT64_C(0x6dd35f65567480ec), EcoNode(10, 613, 21165) },
+	{ Q_UINT64_C(0xce878eae595930ea), EcoNode(13, 5714, 37444) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xd83ca420d09570f1), EcoNode(316, 5393, 16685) },
+	{ Q_UINT64_C(0x8c17154664f190f2), EcoNode(162, 106, 26532) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x0cecdd5d11c5c0f4), EcoNode(332, 0, 2922) },
+	{ Q_UINT64_C(0x2fdf8e78663410f5), EcoNode(283, 165, 9816) },
+	{ Q_UINT64_C(0xebd16e1d483310f4), EcoNode(110, 3608, -1) },
+	{ Q_UINT64_C(0x560fb632bb4680f7), EcoNode(221, 9077, -1) },
+	{ Q_UINT64_C(0xa8c1abdd657c20f8), EcoNode(245, 4662, 13617) },
+	{ Q_UINT64_C(0x2f2f85978dd5b0f9), EcoNode(200, 3485, -1) },
+	{ Q_UINT64_C(0x3b119cb006d6b0fa), EcoNode(403, 1496, 11826) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x7ea89afc4f6f90fd), EcoNode(416, 2140, 24132) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x22b8252446cf1102), EcoNode(52, 919, 7217) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xd97eae1c28f3f104), EcoNode(262, 165, 39239) },
+	{ Q_UINT64_C(0xb70c6acdfb843105), EcoNode(111, 262, 33311) },
+	{ Q_UINT64_C(0x09557b7122b60106), EcoNode(30, 613, 1993) },
+	{ Q_UINT64_C(0x6cb1f82dc8e25107), EcoNode(363, 0, 20999) },
+	{ Q_UINT64_C(0x872c7e0358d5d108), EcoNode(102, 2748, 25685) },
+	{ Q_UINT64_C(0x578c1f9407062109), EcoNode(152, 106, 17143) },
+	{ Q_UINT64_C(0xc06f162853535106), EcoNode(251, 1912, 34869) },
+	{ Q_UINT64_C(0xc4c82aa9bec06109), EcoNode(389, 1131, 35541) },
+	{ Q_UINT64_C(0x33d240e0871d310c), EcoNode(164, 106, 10694) },
+	{ Q_UINT64_C(0xd13987351057a106), EcoNode(423, 2196, 37805) },
+	{ Q_UINT64_C(0xd366d2635250410a), EcoNode(82, 451, 3870) },
+	{ Q_UINT64_C(0x69d62f3b7e0c510f), EcoNode(31, 613, 20421) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xe096ac14bc046112), EcoNode(167, 106, 40277) },
+	{ Q_UINT64_C(0x4fcd657baa82e113), EcoNode(229, 2275, -1) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xbb2deb150f00c115), EcoNode(2, 12524, -1) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x4f58fc0d44d0b117), EcoNode(138, 106, 15200) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x24eb089a0e7d411a), EcoNode(263, 165, 7840) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xb42cdefd51a5111d), EcoNode(80, 32769, -1) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xef419ec63d63e11f), EcoNode(244, 4662, 42714) },
+	{ Q_UINT64_C(0x4b184dd6dfb16120), EcoNode(43, 14587, 14598) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xe74fcc2b84480124), EcoNode(233, 1445, 41501) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xac024bc70955c127), EcoNode(237, 1445, 31352) },
+	{ Q_UINT64_C(0xe258c88fa5742128), EcoNode(497, 353, 40610) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xc6f685086152a12a), EcoNode(334, 0, 36297) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x68ad55579f09812c), EcoNode(221, 20297, -1) },
+	{ Q_UINT64_C(0x98127bb2745a612d), EcoNode(305, 28378, -1) },
+	{ Q_UINT64_C(0xef3a15e49cfd412d), EcoNode(330, 0, 21998) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xb87997b80000c131), EcoNode(105, 2748, 33509) },
+	{ Q_UINT64_C(0x96884725f533f132), EcoNode(485, 353, 28107) },
+	{ Q_UINT64_C(0x8cec7a573ead6133), EcoNode(136, 106, 26663) },
+	{ Q_UINT64_C(0x90e4413301ac4134), EcoNode(233, 1445, 27282) },
+	{ Q_UINT64_C(0xb23e90bf88227132), EcoNode(237, 1445, 32353) },
+	{ Q_UINT64_C(0xfa4e22fb5a2a5135), EcoNode(426, 2196, 4883) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xb54de1c6dd5cf138), EcoNode(151, 106, 32913) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x9191fa7972f5713c), EcoNode(460, 353, 27408) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x787ae4204fe5d13e), EcoNode(446, 2196, 23384) },
+	{ Q_UINT64_C(0xd0852cd18aa5813f), EcoNode(343, 200, 37699) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xf7d5f38a3e857143), EcoNode(155, 106, 44080) },
+	{ Q_UINT64_C(0x06be03ac4f813144), EcoNode(212, 388, 1411) },
+	{ Q_UINT64_C(0x97a4747740071144), EcoNode(251, 28278, -1) },
+	{ Q_UINT64_C(0xfc6c4e59d4f36144), EcoNode(213, 388, 44747) },
+	{ Q_UINT64_C(0x52bb02f8bdea5147), EcoNode(316, 5393, 16026) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x50197b0107ccf149), EcoNode(112, 3608, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xefa92e906c77b14d), EcoNode(267, 165, 42832) },
+	{ Q_UINT64_C(0xd366d79649e2314e), EcoNode(230, 3677, 38276) },
+	{ Q_UINT64_C(0x6198cc334d75a14f), EcoNode(81, 451, 18949) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xd0b9e30ca64e3153), EcoNode(76, 3028, 37718) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xa5bf6cbef7e2c157), EcoNode(221, 6774, 30446) },
+	{ Q_UINT64_C(0xe3876b4271c5e158), EcoNode(103, 2748, 40820) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xcd9cdd3b90331160), EcoNode(351, 0, 37366) },
+	{ Q_UINT64_C(0x70c4b48ebe06c161), EcoNode(361, 0, 21647) },
+	{ Q_UINT64_C(0x743f10d24443c162), EcoNode(184, 106, 2798) },
+	{ Q_UINT64_C(0xbe52a85607992162), EcoNode(101, 20221, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xb402d0ee9c981166), EcoNode(20, 32717, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x6246182cd7c02169), EcoNode(312, 5393, 19145) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xbbc0a0be7b2b916c), EcoNode(241, 2688, 33992) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xe0508f1e90ee1171), EcoNode(437, 2196, 40247) },
+	{ Q_UINT64_C(0x7f84c01ce83e9172), EcoNode(254, 3314, 24407) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x507702d4439d5174), EcoNode(462, 353, 15547) },
+	{ Q_UINT64_C(0x038461b1c244f175), EcoNode(46, 743, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xee34e406d6aa517a), EcoNode(255, 42556, -1) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x9569ba5bf4a3717c), EcoNode(13, 613, 27980) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x1c4cbd7a250b517e), EcoNode(241, 2688, 5802) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x2cbcb085c52fb180), EcoNode(292, 165, 9255) },
+	{ Q_UINT64_C(0x574d21d2c7690181), EcoNode(173, 106, 17103) },
+	{ Q_UINT64_C(0xe57697cefee41181), EcoNode(0, 41135, -1) },
+	{ Q_UINT64_C(0x8def6f7853316183), EcoNode(301, 26823, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x2839b7dbeff5018a), EcoNode(414, 2140, 8518) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xf5794b831f7a418c), EcoNode(40, 2095, -1) },
+	{ Q_UINT64_C(0xd167679ae7f2018d), EcoNode(280, 165, 37858) },
+	{ Q_UINT64_C(0x49d5752b7f2a418e), EcoNode(233, 1445, 14459) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xb68977871000a190), EcoNode(258, 8273, 33143) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x6c83d205e17ae194), EcoNode(450, 2196, 20967) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x823c9b50fd114196), EcoNode(100, 24886, -1) },
+	{ Q_UINT64_C(0xcb50867ce6a31197), EcoNode(260, 165, 37014) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x22d5c43687ad01a2), EcoNode(241, 2688, 7326) },
+	{ Q_UINT64_C(0x707cc0f1dc2771a3), EcoNode(383, 1131, 21608) },
+	{ Q_UINT64_C(0x92d7dd30c1c2e1a3), EcoNode(120, 106, 27625) },
+	{ Q_UINT64_C(0xec4c364ab2fe31a2), EcoNode(254, 3314, -1) },
+	{ Q_UINT64_C(0x6d07d436929b61a6), EcoNode(43, 14587, 21064) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xe214274f42e601a9), EcoNode(340, 0, 40479) },
+	{ Q_UINT64_C(0xce9192e59abd31aa), EcoNode(186, 106, 37484) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x80e0af2909a601ad), EcoNode(254, 3314, 13454) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xae53da905d14c1b0), EcoNode(297, 165, 31625) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x608b8a53652f31b2), EcoNode(356, 0, 18691) },
+	{ Q_UINT64_C(0xc725570ed85bd1b2), EcoNode(115, 262, 36322) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x3542fa13ad7ed1b7), EcoNode(270, 165, 11054) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xb663577df5f241bb), EcoNode(250, 3314, -1) },
+	{ Q_UINT64_C(0xe249c99f81c0d1bb), EcoNode(437, 2196, 40567) },
+	{ Q_UINT64_C(0x223d1d8d51b671bd), EcoNode(430, 2196, 7070) },
+	{ Q_UINT64_C(0x621abab91f14e1bd), EcoNode(300, 19047, -1) },
+	{ Q_UINT64_C(0x6eab5a04e07ca1be), EcoNode(283, 165, 21396) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xf44b6961e533d1c4), EcoNode(200, 3485, -1) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xd810a781f46411c6), EcoNode(109, 5316, 38987) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x543fc291edd901cd), EcoNode(129, 106, 16313) },
+	{ Q_UINT64_C(0x3c02eefb51eed1ce), EcoNode(18, 613, 12135) },
+	{ Q_UINT64_C(0xf6a5320971ca41ce), EcoNode(252, 1912, 43874) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xd00437e738fad1d7), EcoNode(25, 613, 14033) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x0d92237fc14cd1d9), EcoNode(445, 2196, 2994) },
+	{ Q_UINT64_C(0x849f42eb68dd31da), EcoNode(248, 697, 25389) },
+	{ Q_UINT64_C(0x423a30f8bea1e1db), EcoNode(115, 262, 13223) },
+	{ Q_UINT64_C(0xa08f71815daca1db), EcoNode(384, 1131, 29755) },
+	{ Q_UINT64_C(0x1c3f48143790d1dd), EcoNode(83, 451, 5765) },
+	{ Q_UINT64_C(0x0ff2b0cbf10e41de), EcoNode(86, 451, 3517) },
+	{ Q_UINT64_C(0x830eb9b20758d1de), EcoNode(40, 2095, -1) },
+	{ Q_UINT64_C(0x1f38c1aaeacef1e0), EcoNode(465, 353, 6329) },
+	{ Q_UINT64_C(0x795456fe9cfc01e1), EcoNode(61, 3028, 23583) },
+	{ Q_UINT64_C(0x9e9da6b188ca61e2), EcoNode(475, 353, 29440) },
+	{ Q_UINT64_C(0xb1702410b44691db), EcoNode(105, 2748, 32211) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x106291f6789ae1e6), EcoNode(420, 3656, -1) },
+	{ Q_UINT64_C(0xa9f0f68fff9b51e6), EcoNode(351, 0, 31058) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x88bc27f9be1b01e9), EcoNode(121, 106, 25944) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x0b0b0d130d9411ed), EcoNode(207, 388, 2467) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x146d4888073671ef), EcoNode(211, 3485, -1) },
+	{ Q_UINT64_C(0x6ccea701fcc091ef), EcoNode(331, 0, 21047) },
+	{ Q_UINT64_C(0xc1f569de2fcb31ef), EcoNode(484, 353, 35102) },
+	{ Q_UINT64_C(0xea9ae98dd46a91f0), EcoNode(241, 9765, -1) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x295a5138249e71f4), EcoNode(353, 0, 8695) },
+	{ Q_UINT64_C(0x03f7a37ad42f31f5), EcoNode(410, 847, -1) },
+	{ Q_UINT64_C(0x4c0e1bc3c8a851f6), EcoNode(387, 1131, 14761) },
+	{ Q_UINT64_C(0xf93476b4f902e1f6), EcoNode(152, 106, 44187) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x77106d2054b6e1fa), EcoNode(269, 165, 22942) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x21aadc60c91291fc), EcoNode(307, 0, 6933) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x8033a5818fbe1201), EcoNode(457, 2196, 24526) },
+	{ Q_UINT64_C(0x309165a2d29e0202), EcoNode(411, 9970, -1) },
+	{ Q_UINT64_C(0x95fa8d363cfbc201), EcoNode(280, 165, 28062) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x1b7676b8fc4b6205), EcoNode(212, 388, 5529) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xa52270670805c207), EcoNode(394, 1131, 30353) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x1642c6063bf6120a), EcoNode(257, 4816, -1) },
+	{ Q_UINT64_C(0x64f91812753b320a), EcoNode(233, 1445, 19703) },
+	{ Q_UINT64_C(0xf4b45802546db20b), EcoNode(193, 106, 43583) },
+	{ Q_UINT64_C(0x702fe2281685e20d), EcoNode(264, 165, 21569) },
+	{ Q_UINT64_C(0x9b58a4fbe3e2520e), EcoNode(36, 613, 28749) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x93e8ba89cca10211), EcoNode(61, 3028, 2667) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x75e6a7016bfe7213), EcoNode(325, 22727, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xef9fe73d2bfd2216), EcoNode(397, 1131, 42807) },
+	{ Q_UINT64_C(0x26d4332e603fe217), EcoNode(259, 4816, -1) },
+	{ Q_UINT64_C(0x0e175f96c7f37218), EcoNode(244, 3154, -1) },
+	{ Q_UINT64_C(0xd133352638f7c218), EcoNode(288, 165, 37784) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x54cde9bf0274a21b), EcoNode(107, 5316, 16573) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xac1b72bcb4c1d220), EcoNode(17, 613, 31399) },
+	{ Q_UINT64_C(0xd4f446615945d221), EcoNode(157, 106, 38591) },
+	{ Q_UINT64_C(0x6d7984023bd57222), EcoNode(53, 11329, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xb66cad483bcdb228), EcoNode(146, 106, 3916) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x1d1c8a33eac3622b), EcoNode(4, 821, 5962) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x104676bf8ad1922d), EcoNode(110, 3608, -1) },
+	{ Q_UINT64_C(0xca0c1aacc125622d), EcoNode(278, 165, 36754) },
+	{ Q_UINT64_C(0xe1d06bfd9101922d), EcoNode(144, 40412, -1) },
+	{ Q_UINT64_C(0x4f8e418960bb2230), EcoNode(174, 106, 15284) },
+	{ Q_UINT64_C(0xbc35912d4a139231), EcoNode(241, 2688, 34044) },
+	{ Q_UINT64_C(0x2bfd4f8e85690232), EcoNode(344, 200, 9109) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x3c88af88dfc94235), EcoNode(270, 165, 12333) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x3c87360091440237), EcoNode(38, 613, 8251) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x1e0f50da334bf239), EcoNode(281, 165, 6227) },
+	{ Q_UINT64_C(0xfa40c44978543239), EcoNode(3, 12524, 44380) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x5b3e02eaa382623f), EcoNode(441, 2196, 17793) },
+	{ Q_UINT64_C(0xc6cbae7fba907240), EcoNode(89, 451, 36141) },
+	{ Q_UINT64_C(0x0391553073dce241), EcoNode(326, 25, 761) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xe0a88ffe388f7248), EcoNode(225, 3287, 40332) },
+	{ Q_UINT64_C(0xa71a29b71ce8e249), EcoNode(47, 2140, 30607) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x2462e29b8257024b), EcoNode(236, 1445, 7625) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xc5383098d7bc624e), EcoNode(314, 5393, 35763) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x1455f2aa3ebdd252), EcoNode(80, 4371, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xc9c6c2594c215257), EcoNode(115, 3608, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x02c62b7c7eab525b), EcoNode(267, 165, 584) },
+	{ Q_UINT64_C(0x028800075fd9e25c), EcoNode(334, 0, 540) },
+	{ Q_UINT64_C(0x0ab88bb80bdfd25c), EcoNode(141, 106, 2374) },
+	{ Q_UINT64_C(0x70b80c1ebb4dd25d), EcoNode(156, 106, -1) },
+	{ Q_UINT64_C(0x909f45c95fa3f25e), EcoNode(333, 0, 27151) },
+	{ Q_UINT64_C(0xc8205b5ce917525f), EcoNode(81, 36387, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x677b687e90a98264), EcoNode(460, 353, 20096) },
+	{ Q_UINT64_C(0x6bf3afeb31bc0265), EcoNode(277, 165, 20830) },
+	{ Q_UINT64_C(0x3143d79127866266), EcoNode(252, 1912, -1) },
+	{ Q_UINT64_C(0x51cc0ed1cd794266), EcoNode(185, 106, 15823) },
+	{ Q_UINT64_C(0x767badb06d935267), EcoNode(9, 821, 10163) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x0ad299981e20f26a), EcoNode(157, 106, 2414) },
+	{ Q_UINT64_C(0x252c24fcbb48226a), EcoNode(347, 200, 7914) },
+	{ Q_UINT64_C(0xd5423acfa460426b), EcoNode(289, 165, 38614) },
+	{ Q_UINT64_C(0x84d56e5b8d44526d), EcoNode(468, 353, 25436) },
+	{ Q_UINT64_C(0x360ed8786ba5b26e), EcoNode(230, 3677, 11228) },
+	{ Q_UINT64_C(0x4535360eea72926f), EcoNode(244, 4022, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xa6e050cf2a640274), EcoNode(220, 6728, 30535) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x0fb67a1d34a70278), EcoNode(286, 165, 3452) },
+	{ Q_UINT64_C(0xc8d4778bde03d279), EcoNode(219, 388, 36514) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x6a66ae741f9ff27b), EcoNode(144, 20581, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x30cbc889b69f527e), EcoNode(280, 165, 10020) },
+	{ Q_UINT64_C(0xde9443b04de8727f), EcoNode(346, 200, 40058) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x07988e8673570286), EcoNode(233, 1445, 1630) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x2eef1e7ab0027288), EcoNode(267, 165, 9654) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x6ff8f483e7ec128a), EcoNode(481, 353, 21532) },
+	{ Q_UINT64_C(0x46d97ed4c188e28b), EcoNode(308, 0, 13906) },
+	{ Q_UINT64_C(0x5fdf054eb8bc428c), EcoNode(260, 165, 18560) },
+	{ Q_UINT64_C(0x7c389edb972e428c), EcoNode(289, 165, 23974) },
+	{ Q_UINT64_C(0xa5ab0a09d39fb28e), EcoNode(16, 613, 30422) },
+	{ Q_UINT64_C(0x237acc9eb8e9c28f), EcoNode(251, 1912, -1) },
+	{ Q_UINT64_C(0xc982bea1436da28e), EcoNode(348, 200, 36671) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x7ee52381c039b294), EcoNode(229, 24278, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xd2eedd53d6976297), EcoNode(239, 1445, 38162) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x1735d9356be9d299), EcoNode(246, 5068, 5082) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xbc0dee035458229c), EcoNode(36, 613, 34016) },
+	{ Q_UINT64_C(0x466a9a880be8429d), EcoNode(242, 1172, 10947) },
+	{ Q_UINT64_C(0xeb99c67d7a6df29c), EcoNode(326, 25, 42279) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xb41464df682eb2a0), EcoNode(200, 3485, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x55968f7f5baf82a6), EcoNode(223, 791, 16666) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xb01bbda1178222a9), EcoNode(40, 2095, 32031) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xf2b92a62635a82b2), EcoNode(317, 5393, 43307) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xdcb14d2c35bad2b5), EcoNode(280, 165, 39844) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x74f9630bd09892bb), EcoNode(296, 165, 22599) },
+	{ Q_UINT64_C(0x86933069b8c862bb), EcoNode(150, 106, -1) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x0edd5a1b6279c2be), EcoNode(466, 353, 3390) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xc7bc387f2e4ce2c0), EcoNode(234, 7602, -1) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x170020d45917a2c2), EcoNode(13, 613, 5014) },
+	{ Q_UINT64_C(0x7842b23696e172c2), EcoNode(113, 262, 23282) },
+	{ Q_UINT64_C(0x8d8196d2149302c2), EcoNode(17, 613, 26767) },
+	{ Q_UINT64_C(0xeacd6c599529a2c5), EcoNode(92, 1881, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x93ad04944ec0e2cd), EcoNode(100, 6728, 27658) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x48abf1bfe28192d3), EcoNode(120, 106, 13454) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xc8e3a304faecd2d6), EcoNode(270, 165, 33872) },
+	{ Q_UINT64_C(0x84db040ce13ba2d7), EcoNode(226, 3287, 25474) },
+	{ Q_UINT64_C(0xff9841abf83f42d8), EcoNode(223, 791, 45255) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xe2ea9f51b01c42da), EcoNode(447, 2196, 40693) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x604a2f597b5d72dc), EcoNode(333, 0, 18617) },
+	{ Q_UINT64_C(0x8da7a73e5fdd72dc), EcoNode(0, 26803, -1) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x0a02e9b5bd59e2df), EcoNode(423, 2196, 2209) },
+	{ Q_UINT64_C(0x84ced8537b7812e0), EcoNode(317, 5393, 25422) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x8a05581806fe12e3), EcoNode(107, 1518, 26058) },
+	{ Q_UINT64_C(0xc6d0cc766887b2e3), EcoNode(290, 165, 36176) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x5e62b4ba99b122e9), EcoNode(253, 3314, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xb112b1e78132d2ec), EcoNode(424, 2196, 4883) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x3e600bbc3663b2f1), EcoNode(19, 613, 12585) },
+	{ Q_UINT64_C(0xc26396ee700c22f2), EcoNode(300, 35188, -1) },
+	{ Q_UINT64_C(0x5794bd5eeddee2f3), EcoNode(119, 262, 17174) },
+	{ Q_UINT64_C(0x161a7b2a9aea82f4), EcoNode(250, 3314, 4793) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x677d42dd16da72f7), EcoNode(268, 165, 20110) },
+	{ Q_UINT64_C(0x6c6a8b940b9d82f8), EcoNode(185, 106, 20927) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x22e739c96f9e52fc), EcoNode(487, 353, 7368) },
+	{ Q_UINT64_C(0x2b27fd577e4932fc), EcoNode(410, 8972, -1) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x5eb1f110bec6c2ff), EcoNode(233, 1445, 18450) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x4c4d592c0ab6c301), EcoNode(134, 106, 14818) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x7eb40e5bc7e74303), EcoNode(0, 21086, 24149) },
+	{ Q_UINT64_C(0x50f5a393997da304), EcoNode(36, 613, 8251) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xc37a9235fad06306), EcoNode(133, 106, 35271) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x213a29d9651bc308), EcoNode(106, 1518, 6889) },
+	{ Q_UINT64_C(0x3e34dae094841308), EcoNode(28, 613, 12489) },
+	{ Q_UINT64_C(0x0574c1ff70bb430a), EcoNode(352, 0, 1085) },
+	{ Q_UINT64_C(0x6dde57fb8d90d30a), EcoNode(128, 106, 21181) },
+	{ Q_UINT64_C(0xe5f35083dc24f30b), EcoNode(264, 165, 41232) },
+	{ Q_UINT64_C(0xde0cb3da7222430d), EcoNode(200, 388, 40030) },
+	{ Q_UINT64_C(0x814ca588eccd530e), EcoNode(399, 20014, 24801) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x33e7bcae4a191314), EcoNode(224, 791, 10747) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x2df4a887b7d80317), EcoNode(225, 3287, 9455) },
+	{ Q_UINT64_C(0xd4f3844ae6e0a317), EcoNode(257, 8273, 32669) },
+	{ Q_UINT64_C(0x4b5cd6ca913d9319), EcoNode(241, 2688, 14660) },
+	{ Q_UINT64_C(0x30e16e80c6e1f31a), EcoNode(0, 10061, -1) },
+	{ Q_UINT64_C(0xcd0f6ecaf2dc1319), EcoNode(224, 791, 31592) },
+	{ Q_UINT64_C(0xef2c72ca0e9b4318), EcoNode(0, 42699, -1) },
+	{ Q_UINT64_C(0x0fdc71c327d1531d), EcoNode(200, 3485, -1) },
+	{ Q_UINT64_C(0xefcdf4926d881318), EcoNode(16, 613, 42865) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x13c0de9acd5e9320), EcoNode(208, 388, 4347) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xd996569f3c14e324), EcoNode(214, 388, 39300) },
+	{ Q_UINT64_C(0x0e525b1311587325), EcoNode(400, 3244, -1) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xc282719b8a6dd327), EcoNode(444, 2196, 35234) },
+	{ Q_UINT64_C(0xfe14441b1d746328), EcoNode(107, 5316, 44939) },
+	{ Q_UINT64_C(0x57e6fb0d7c16b329), EcoNode(101, 4050, 17245) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x74ac080c2224d32e), EcoNode(174, 106, 22563) },
+	{ Q_UINT64_C(0xd5a0668a35eaf32e), EcoNode(105, 2748, 38657) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x72028b3c2682e334), EcoNode(139, 106, 21876) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xae305deb6fb09337), EcoNode(222, 9077, 31605) },
+	{ Q_UINT64_C(0x9d0b7cf0ac4eb338), EcoNode(225, 3287, 29186) },
+	{ Q_UINT64_C(0xf83c4b3d30b77337), EcoNode(274, 165, 44111) },
+	{ Q_UINT64_C(0xccd7cae2adda933a), EcoNode(308, 0, 37189) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xdd2ed6a7ec2d733d), EcoNode(144, 39895, -1) },
+	{ Q_UINT64_C(0xea3032eab9cb633e), EcoNode(48, 353, 41945) },
+	{ Q_UINT64_C(0xf3109cff454a933e), EcoNode(177, 106, 43388) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x33a5bdfdfc58e342), EcoNode(172, 106, 10621) },
+	{ Q_UINT64_C(0x25a99e6fdada2343), EcoNode(296, 165, 7994) },
+	{ Q_UINT64_C(0xa2daf0145d6bd344), EcoNode(137, 106, 29976) },
+	{ Q_UINT64_C(0x53c5414494586345), EcoNode(0, 16117, -1) },
+	{ Q_UINT64_C(0x2df54c975eb48346), EcoNode(0, 9486, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x7248c7b142baa34a), EcoNode(350, 0, 21937) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xc10f12ad0c91a34d), EcoNode(248, 697, 8916) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x77c6714cdda3b34f), EcoNode(113, 262, 4774) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x5cfd63412e99e351), EcoNode(13, 613, 18016) },
+	{ Q_UINT64_C(0x41dd464bfbc3d352), EcoNode(0, 13146, -1) },
+	{ Q_UINT64_C(0x199bd71b94b57353), EcoNode(408, 1496, 5359) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x9c520c8a83b6a356), EcoNode(234, 1445, 29000) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x161772a00d8df359), EcoNode(310, 4757, 4774) },
+	{ Q_UINT64_C(0xf04c2aeabcf6135a), EcoNode(243, 1172, 43061) },
+	{ Q_UINT64_C(0x7acc2e3292f2a35b), EcoNode(346, 200, 6933) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xaf4f4fce735a935f), EcoNode(215, 388, 31794) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x431bd37be20c9365), EcoNode(78, 3028, 13421) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x2fb0ef7b5ef6336c), EcoNode(249, 697, 4709) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x471a6253ae12236e), EcoNode(26, 613, 14033) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x1c0b524cdedc2371), EcoNode(315, 5393, 5654) },
+	{ Q_UINT64_C(0xafd3c26e4620d372), EcoNode(132, 106, 31853) },
+	{ Q_UINT64_C(0xc67627e4d3bbb372), EcoNode(219, 388, 36074) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xd1eda6f64269a376), EcoNode(59, 2654, 38017) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xb96238a330463378), EcoNode(239, 1445, 33601) },
+	{ Q_UINT64_C(0xdebb1a297a48c379), EcoNode(51, 40084, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xf429026527b5537e), EcoNode(283, 165, 43494) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xfa188ff4783dd380), EcoNode(58, 2654, 44337) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x60ff8bddfef58386), EcoNode(255, 14617, 18795) },
+	{ Q_UINT64_C(0x183558fae2a3d387), EcoNode(6, 5192, -1) },
+	{ Q_UINT64_C(0xd33f7739a5c9d388), EcoNode(267, 165, 38208) },
+	{ Q_UINT64_C(0x210df8f72c186389), EcoNode(233, 1445, 6855) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xdc7d8cf58ad1938c), EcoNode(289, 165, 39809) },
+	{ Q_UINT64_C(0x9c48bf34f304138d), EcoNode(33, 613, 28970) },
+	{ Q_UINT64_C(0x55f96b636a09338e), EcoNode(244, 422, 16717) },
+	{ Q_UINT64_C(0x31a2eebc2ece638f), EcoNode(253, 3314, 10243) },
+	{ Q_UINT64_C(0xab8e63a3c52e7390), EcoNode(115, 3608, -1) },
+	{ Q_UINT64_C(0xba5beebe8255638e), EcoNode(318, 5393, 33729) },
+	{ Q_UINT64_C(0xc826e3f1daabb392), EcoNode(251, 36423, -1) },
+	{ Q_UINT64_C(0x1d81a4f369529393), EcoNode(247, 697, 6117) },
+	{ Q_UINT64_C(0xda81cd39b4e79390), EcoNode(213, 388, 39482) },
+	{ Q_UINT64_C(0x6abaeae97cd74395), EcoNode(40, 15406, -1) },
+	{ Q_UINT64_C(0xb2153eb93d72b396), EcoNode(174, 106, 32308) },
+	{ Q_UINT64_C(0x14595c9ce04b0397), EcoNode(125, 106, 4395) },
+	{ Q_UINT64_C(0xd1f151406ae8a397), EcoNode(132, 4423, -1) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x777ea85603afa39a), EcoNode(328, 25, 23108) },
+	{ Q_UINT64_C(0xbd82186550aa539a), EcoNode(244, 4022, 34358) },
+	{ Q_UINT64_C(0x4160e92a3eb6b39c), EcoNode(211, 388, 13047) },
+	{ Q_UINT64_C(0xeaf77b15a6f3b39b), EcoNode(495, 353, 42118) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x676902f53cbe43a1), EcoNode(37, 613, 8251) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x16971ee27034b3a3), EcoNode(428, 2196, 4883) },
+	{ Q_UINT64_C(0x2411c1fff69893a4), EcoNode(434, 2196, 7529) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xaaca08fca77853a6), EcoNode(106, 31202, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x954c0a7bdebd33ab), EcoNode(176, 106, 27947) },
+	{ Q_UINT64_C(0xea91997b885bf3ab), EcoNode(245, 4662, 42062) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xd98a231e1053c3ae), EcoNode(103, 2748, 39282) },
+	{ Q_UINT64_C(0x41c354aec8a063af), EcoNode(184, 106, 13110) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x7a9bdf85d02f43b1), EcoNode(289, 165, 23750) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x5b83dbc2acb8c3b3), EcoNode(103, 2748, 17838) },
+	{ Q_UINT64_C(0x3697b0f7962f33b4), EcoNode(41, 11329, -1) },
+	{ Q_UINT64_C(0x4057b81cb9c913b5), EcoNode(241, 2688, 12816) },
+	{ Q_UINT64_C(0xccbdc56bd768b3b6), EcoNode(359, 0, 8394) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x99fc00c5cf9063b9), EcoNode(251, 28567, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xde197162285263be), EcoNode(67, 3028, 3916) },
+	{ Q_UINT64_C(0xe3742881f38c73bf), EcoNode(245, 4662, 10947) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xdf7c1038cc9fc3c3), EcoNode(263, 165, 40195) },
+	{ Q_UINT64_C(0xf6f1ebdfadd0a3c3), EcoNode(242, 1172, 43941) },
+	{ Q_UINT64_C(0x138b5ea72b0213c5), EcoNode(12, 613, 4324) },
+	{ Q_UINT64_C(0x52ffde87170803c5), EcoNode(253, 3314, 16061) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x0caa575a53e6f3c9), EcoNode(436, 2196, 2886) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xff2049361eeb13cb), EcoNode(300, 2095, 45122) },
+	{ Q_UINT64_C(0x4718599f407d73cc), EcoNode(133, 106, 14009) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x17d007511d13e3ce), EcoNode(250, 3314, 5115) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xfe667a706977a3d0), EcoNode(242, 1172, 45051) },
+	{ Q_UINT64_C(0x7cbb66a19a3753d1), EcoNode(102, 2748, -1) },
+	{ Q_UINT64_C(0xf52c3c6dfa8403d2), EcoNode(224, 791, 43690) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x55f15101c70ff3d7), EcoNode(252, 1912, 16703) },
+	{ Q_UINT64_C(0x7272ff629ee2b3d7), EcoNode(0, 21979, -1) },
+	{ Q_UINT64_C(0xc59b8f738d5963d9), EcoNode(257, 8273, 35806) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x6b88c80b869ed3dd), EcoNode(106, 6157, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xfdebca5ed1f133e0), EcoNode(125, 106, 44894) },
+	{ Q_UINT64_C(0xb1d315d13a7e33e1), EcoNode(240, 664, 32235) },
+	{ Q_UINT64_C(0x503554f1fc06a3e2), EcoNode(254, 3314, 15456) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x24fcad5d90d923e5), EcoNode(240, 7877, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x2d9c3fb7708893ec), EcoNode(255, 62, 9353) },
+	{ Q_UINT64_C(0x288a7029b65b13ed), EcoNode(0, 8576, -1) },
+	{ Q_UINT64_C(0xa4dfd79b62f693ec), EcoNode(315, 5393, 30317) },
+	{ Q_UINT64_C(0xd2d8498da19313ef), EcoNode(461, 353, 38130) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xa5282e57a416a3f3), EcoNode(225, 2275, -1) },
+	{ Q_UINT64_C(0x510786a94711a3f4), EcoNode(351, 0, 15646) },
+	{ Q_UINT64_C(0x929a2f9b37a683f5), EcoNode(127, 106, 27591) },
+	{ Q_UINT64_C(0x08c24cc14dccc3f6), EcoNode(273, 165, 1819) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x1edb02fb4788d3f9), EcoNode(244, 4022, 6292) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x592574922ea6f3fb), EcoNode(412, 2140, 17428) },
+	{ Q_UINT64_C(0xe0d90d1afa17a3fb), EcoNode(251, 1912, 40373) },
+	{ Q_UINT64_C(0x1cd8d48946aa83fd), EcoNode(233, 5881, -1) },
+	{ Q_UINT64_C(0x51d220b5057b43fd), EcoNode(322, 25, 15860) },
+	{ Q_UINT64_C(0x526341290d7773ff), EcoNode(335, 0, 4774) },
+	{ Q_UINT64_C(0x7e8877758ba72400), EcoNode(253, 3314, 24063) },
+	{ Q_UINT64_C(0x354f6f003a705401), EcoNode(202, 388, 11069) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x7aaa9ee3ccc6940c), EcoNode(190, 106, 23813) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xacca2b69f557c40e), EcoNode(255, 62, 31447) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x3411a8daaed59411), EcoNode(7, 821, 10778) },
+	{ Q_UINT64_C(0x7b2cf8abc5c4b411), EcoNode(154, 106, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xb98f8008e554c418), EcoNode(195, 106, 33666) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xea5a110715d0c41e), EcoNode(90, 42013, -1) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x5862e4d3225e8420), EcoNode(11, 613, 3843) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x355ab9e5c021c425), EcoNode(223, 791, 11093) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xf552ee1777658429), EcoNode(230, 43706, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xdb9741ae2a17442c), EcoNode(242, 1172, 39602) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xa96f3f27da54242e), EcoNode(239, 1445, 31002) },
+	{ Q_UINT64_C(0xaeb05bf25b93f42f), EcoNode(92, 31659, -1) },
+	{ Q_UINT64_C(0xc03ecc902b064430), EcoNode(300, 34829, -1) },
+	{ Q_UINT64_C(0xd78e9152e02a8430), EcoNode(202, 388, 38924) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x8a03830f4abc9434), EcoNode(252, 1912, -1) },
+	{ Q_UINT64_C(0xb2645625d0db2434), EcoNode(3, 32451, -1) },
+	{ Q_UINT64_C(0xdb5c548b11c76434), EcoNode(239, 7602, -1) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x1967a904e0a25438), EcoNode(109, 5316, 5321) },
+	{ Q_UINT64_C(0x3b87646a59072438), EcoNode(81, 1881, -1) },
+	{ Q_UINT64_C(0x584a41d5444d2438), EcoNode(231, 3677, 17367) },
+	{ Q_UINT64_C(0x680cd2d062e94438), EcoNode(217, 388, 20242) },
+	{ Q_UINT64_C(0xeb16d4aa32ce7438), EcoNode(0, 42215, -1) },
+	{ Q_UINT64_C(0xbdbaf5b55f2a543d), EcoNode(233, 1445, 3082) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x448752a04860f43f), EcoNode(215, 388, 13556) },
+	{ Q_UINT64_C(0xd483e34a37d34440), EcoNode(393, 38407, -1) },
+	{ Q_UINT64_C(0x28378bdedb4a2441), EcoNode(227, 8473, 8498) },
+	{ Q_UINT64_C(0xeb3fd6d2e6f2e441), EcoNode(241, 2688, 13454) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x0042e447f3e98444), EcoNode(320, 25, 29) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x3b3b6c5895c79448), EcoNode(85, 11919, -1) },
+	{ Q_UINT64_C(0x4dfb64b3ba21b449), EcoNode(243, 1172, 15064) },
+	{ Q_UINT64_C(0x842cd817d571144a), EcoNode(214, 388, 25287) },
+	{ Q_UINT64_C(0x4db5041bdf39d44b), EcoNode(254, 3314, 15023) },
+	{ Q_UINT64_C(0xcff87239fd76544a), EcoNode(194, 106, 37678) },
+	{ Q_UINT64_C(0xfc3a257853bd644d), EcoNode(255, 62, 44654) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x4a7f91e189a6644f), EcoNode(245, 4662, 14516) },
+	{ Q_UINT64_C(0xd769c6167135a44f), EcoNode(333, 0, 38870) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xc0ace482e9300454), EcoNode(259, 8273, 13454) },
+	{ Q_UINT64_C(0x49d9b32dd49f9455), EcoNode(65, 3028, 14474) },
+	{ Q_UINT64_C(0x96a875acdac8e456), EcoNode(270, 165, 28173) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x046152fb17d18458), EcoNode(52, 919, 949) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xe389b73813da045a), EcoNode(200, 40837, -1) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x2ff2ce65a5dd545c), EcoNode(280, 165, 9839) },
+	{ Q_UINT64_C(0x5679502a1627e45c), EcoNode(245, 4662, 16838) },
+	{ Q_UINT64_C(0x1ce078d546dfb45e), EcoNode(220, 5904, -1) },
+	{ Q_UINT64_C(0x6aca47d271dba45f), EcoNode(271, 165, 20688) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x7a0f6045f8554461), EcoNode(212, 388, 23647) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x564cd70e15bf3469), EcoNode(233, 1445, 16803) },
+	{ Q_UINT64_C(0x7002b20485d4946a), EcoNode(244, 4022, 21550) },
+	{ Q_UINT64_C(0xb967933177d7a46b), EcoNode(369, 0, 33631) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xd9e92f7d78030473), EcoNode(211, 388, 39393) },
+	{ Q_UINT64_C(0xf2e78b894de6c473), EcoNode(210, 388, 43345) },
+	{ Q_UINT64_C(0xad4120093dde2475), EcoNode(291, 165, 31549) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x4b3f2a8f664fc47c), EcoNode(231, 3677, 14630) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xf4fd690d5152a480), EcoNode(95, 451, 43629) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x1c16d75a22a40486), EcoNode(17, 5714, -1) },
+	{ Q_UINT64_C(0xd259fa8b0d585486), EcoNode(267, 165, 38022) },
+	{ Q_UINT64_C(0x0aa0db59fdb0e488), EcoNode(282, 165, 2343) },
+	{ Q_UINT64_C(0x2f260f2eb8b39489), EcoNode(108, 5316, 9694) },
+	{ Q_UINT64_C(0xb2e460c74aefc488), EcoNode(104, 2748, 32599) },
+	{ Q_UINT64_C(0x73f5c297a292448b), EcoNode(110, 262, 22362) },
+	{ Q_UINT64_C(0xc4974a887727d489), EcoNode(273, 165, 35499) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x2cd1b3d278eb848e), EcoNode(462, 353, 9288) },
+	{ Q_UINT64_C(0x9efcf762d76a748f), EcoNode(180, 106, 29567) },
+	{ Q_UINT64_C(0xd92ead1f9394b490), EcoNode(489, 353, 39184) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x1ba11324c4e59492), EcoNode(241, 2688, 5569) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x29d143b2ec80e495), EcoNode(100, 6728, 8832) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xb81bf60326b4f49a), EcoNode(493, 353, 33475) },
+	{ Q_UINT64_C(0x40b41493ee1a649b), EcoNode(303, 12861, -1) },
+	{ Q_UINT64_C(0x653ef537229f749c), EcoNode(101, 19773, -1) },
+	{ Q_UINT64_C(0x6e883960a31e749b), EcoNode(265, 165, 21374) },
+	{ Q_UINT64_C(0x1fc7836547bab49e), EcoNode(492, 353, 6475) },
+	{ Q_UINT64_C(0xe60e32fab825049e), EcoNode(264, 165, 41269) },
+	{ Q_UINT64_C(0xf219a9198b76049d), EcoNode(210, 388, 43236) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x58244eda693164a2), EcoNode(230, 3677, 17287) },
+	{ Q_UINT64_C(0x622c9a2feecbe4a3), EcoNode(61, 3028, 19070) },
+	{ Q_UINT64_C(0x6add2d59f64624a4), EcoNode(0, 12060, -1) },
+	{ Q_UINT64_C(0x2b3e717189bc54a5), EcoNode(251, 8997, -1) },
+	{ Q_UINT64_C(0x6e08fdf8ef3f14a4), EcoNode(391, 1131, 21226) },
+	{ Q_UINT64_C(0x9241fd1bdb6214a2), EcoNode(12, 613, 27521) },
+	{ Q_UINT64_C(0x97e4b1099111d4a4), EcoNode(103, 2748, 28339) },
+	{ Q_UINT64_C(0x657c4a078b2c94a9), EcoNode(188, 106, 19793) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x318f29aeb68e14ab), EcoNode(352, 0, 10195) },
+	{ Q_UINT64_C(0x249d9710676844ac), EcoNode(196, 106, 7708) },
+	{ Q_UINT64_C(0xfc30f6b3c0a1a4ad), EcoNode(330, 44630, -1) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x63a18e6b48a0f4af), EcoNode(226, 3287, 19541) },
+	{ Q_UINT64_C(0xb56619216d1624af), EcoNode(187, 106, 32965) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x56dca7dc3c45f4b3), EcoNode(249, 697, 16999) },
+	{ Q_UINT64_C(0xea5072edc976c4b3), EcoNode(284, 165, 41965) },
+	{ Q_UINT64_C(0xee8b01ccbc8784b3), EcoNode(100, 42624, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x9ce30a8a273a24b8), EcoNode(251, 1912, 29149) },
+	{ Q_UINT64_C(0x5d3b68f4e54884b9), EcoNode(351, 0, 18033) },
+	{ Q_UINT64_C(0xa5aa4c432ba994b9), EcoNode(300, 2095, 30405) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x377e5d972a3774bd), EcoNode(107, 11396, -1) },
+	{ Q_UINT64_C(0x5c85da956b2a74be), EcoNode(284, 165, 17933) },
+	{ Q_UINT64_C(0x6f1ec4c377b6f4bf), EcoNode(222, 9077, 13617) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x8357117ffecd14c3), EcoNode(25, 613, 25143) },
+	{ Q_UINT64_C(0xd56d72226c3094c4), EcoNode(202, 388, 10163) },
+	{ Q_UINT64_C(0xd964be73338f64c3), EcoNode(432, 2196, 39213) },
+	{ Q_UINT64_C(0x18ee9778a4f204c6), EcoNode(390, 1131, 5264) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xa4e5ec8fac0fd4cc), EcoNode(4, 5192, -1) },
+	{ Q_UINT64_C(0x24855454c31314cd), EcoNode(233, 1445, 7662) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xcce8244c943ed4d1), EcoNode(73, 3028, 37228) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x6a61256b3a8694d4), EcoNode(16, 5714, -1) },
+	{ Q_UINT64_C(0x14ef70feaeef44d5), EcoNode(332, 0, 4492) },
+	{ Q_UINT64_C(0xbefae9991bd5b4d4), EcoNode(488, 353, 34648) },
+	{ Q_UINT64_C(0xb936992906fb64d7), EcoNode(127, 106, 33581) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xccff966049b4b4da), EcoNode(22, 613, 37245) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x28e3615016c974dd), EcoNode(40, 2095, 8593) },
+	{ Q_UINT64_C(0x73e8c171ddc104de), EcoNode(274, 165, 22320) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xa91226c83d5674f0), EcoNode(258, 8273, 30869) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xc1583e2d2a5144f6), EcoNode(114, 262, 35005) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xff5c9b72dcc104f8), EcoNode(88, 451, 45198) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x130bb836930e04fb), EcoNode(157, 106, 4197) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x8a470482d88334ff), EcoNode(306, 26104, -1) },
+	{ Q_UINT64_C(0x50558eea366e5500), EcoNode(198, 106, 15515) },
+	{ Q_UINT64_C(0x3a6e0d982e03c501), EcoNode(244, 422, 11668) },
+	{ Q_UINT64_C(0xf0432397fc9ce4ff), EcoNode(243, 1172, 43036) },
+	{ Q_UINT64_C(0xf4eef6d70a2c1501), EcoNode(43, 14587, 43613) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x59c7428202363505), EcoNode(266, 165, 17499) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x18d131ff31f2b509), EcoNode(124, 106, 5223) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x73064c4fc6d5250f), EcoNode(392, 1131, 22131) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x5b1454467133d511), EcoNode(237, 1445, 17776) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x512e65b8eca3b513), EcoNode(379, 15664, -1) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x32e187a7d153e515), EcoNode(170, 106, 10505) },
+	{ Q_UINT64_C(0x2ca9776ff2908516), EcoNode(271, 165, 9239) },
+	{ Q_UINT64_C(0xd499fbdd778f6516), EcoNode(349, 200, 38495) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x14ed72effc5f751a), EcoNode(237, 1445, 4476) },
+	{ Q_UINT64_C(0x629b63e06a2c451a), EcoNode(363, 0, 19273) },
+	{ Q_UINT64_C(0x6a8d68bc73e0a51c), EcoNode(345, 200, 20649) },
+	{ Q_UINT64_C(0x97c6f83ffd3fc51a), EcoNode(225, 2275, -1) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x3f94070643b5f51f), EcoNode(414, 2140, 11156) },
+	{ Q_UINT64_C(0xc5cd62e2d7eed520), EcoNode(103, 2748, 35953) },
+	{ Q_UINT64_C(0x7a22a6f64cd9c521), EcoNode(192, 106, 23678) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x59296343be070524), EcoNode(21, 5714, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x265a5f7e3cd2c527), EcoNode(394, 1131, 8054) },
+	{ Q_UINT64_C(0x921956aea37f0528), EcoNode(100, 6728, 27481) },
+	{ Q_UINT64_C(0x34f0f036da4cb529), EcoNode(222, 9077, 10947) },
+	{ Q_UINT64_C(0x56c19e75a78c252a), EcoNode(354, 0, 16971) },
+	{ Q_UINT64_C(0x9ce15d00236e052b), EcoNode(251, 1912, 29135) },
+	{ Q_UINT64_C(0x9e5bd43e769ee52b), EcoNode(267, 165, 29377) },
+	{ Q_UINT64_C(0xd08513f3fa99752d), EcoNode(490, 353, 37693) },
+	{ Q_UINT64_C(0xea452ddbb7ecb52a), EcoNode(92, 451, 23263) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x5dbaa524c7f05530), EcoNode(302, 18159, -1) },
+	{ Q_UINT64_C(0x012015697a230531), EcoNode(172, 106, 223) },
+	{ Q_UINT64_C(0x0bdcaf525a573532), EcoNode(58, 2654, 2667) },
+	{ Q_UINT64_C(0x677f81e570f37532), EcoNode(260, 165, 20141) },
+	{ Q_UINT64_C(0xc1e8f0c769ba2532), EcoNode(249, 697, 8251) },
+	{ Q_UINT64_C(0x1e01da176c103535), EcoNode(106, 6157, -1) },
+	{ Q_UINT64_C(0x632029cca8bd4536), EcoNode(315, 5393, 19442) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xee2b83f65296353c), EcoNode(202, 388, 10163) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x01cad2281a62d542), EcoNode(217, 388, 395) },
+	{ Q_UINT64_C(0x474f1975b89af543), EcoNode(240, 14082, -1) },
+	{ Q_UINT64_C(0x5da00ec3c1f3f543), EcoNode(494, 353, 18098) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xa6faafba6ad7d546), EcoNode(233, 1445, 30550) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xddbc5e080e44a548), EcoNode(295, 165, 39960) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x4cb0e3232678354d), EcoNode(107, 5316, 14880) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xfc1481f7286a3550), EcoNode(171, 106, 44563) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x604c7e36d075e552), EcoNode(265, 165, 18644) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x72b670d24f6ee556), EcoNode(21, 22040, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xf0b0f99b32570559), EcoNode(330, 5393, 43132) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x7f6b60a16ee9555b), EcoNode(233, 1445, 24391) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x067559c2c5f4255d), EcoNode(173, 106, 1337) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x90e340019b8de55f), EcoNode(207, 388, 27252) },
+	{ Q_UINT64_C(0x0c6e332580f49560), EcoNode(460, 2095, 2842) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x31e9700ff81d5562), EcoNode(255, 62, 10305) },
+	{ Q_UINT64_C(0xf3376ad4b750e562), EcoNode(330, 0, 8916) },
+	{ Q_UINT64_C(0x1557dbfdb09fd564), EcoNode(343, 200, -1) },
+	{ Q_UINT64_C(0xdf05be0d7f37e565), EcoNode(52, 40140, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x05fa8d4aab738568), EcoNode(270, 165, 1254) },
+	{ Q_UINT64_C(0xd1a9307775797569), EcoNode(306, 0, 37926) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x3ecf958145a4756c), EcoNode(116, 262, 12662) },
+	{ Q_UINT64_C(0x1297b266d226456d), EcoNode(122, 106, 4140) },
+	{ Q_UINT64_C(0x8d7c86d0b048f56d), EcoNode(278, 165, 26761) },
+	{ Q_UINT64_C(0xaec84ba6d432356e), EcoNode(0, 31701, -1) },
+	{ Q_UINT64_C(0x222b33f056f8e570), EcoNode(249, 697, 7053) },
+	{ Q_UINT64_C(0xfb2de157c006c56c), EcoNode(28, 613, 44459) },
+	{ Q_UINT64_C(0x0b2b1512a969a572), EcoNode(264, 165, 2492) },
+	{ Q_UINT64_C(0x0c5554c754fb5573), EcoNode(184, 106, 2798) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xc64c837439e4c575), EcoNode(238, 1445, 36039) },
+	{ Q_UINT64_C(0x52e1356c0d15f576), EcoNode(240, 664, 11668) },
+	{ Q_UINT64_C(0x0c05fbabfc464577), EcoNode(241, 2688, 2697) },
+	{ Q_UINT64_C(0x97854b06a6846578), EcoNode(288, 165, 28250) },
+	{ Q_UINT64_C(0xda776be08658c576), EcoNode(233, 1445, 6855) },
+	{ Q_UINT64_C(0x3ec85a7ac061e57a), EcoNode(401, 1496, 5223) },
+	{ Q_UINT64_C(0x56a13ddd2fe5d57a), EcoNode(345, 200, 16918) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x0fe70fbc5f35257d), EcoNode(383, 1131, 3500) },
+	{ Q_UINT64_C(0xe1e9b22bf99e157e), EcoNode(330, 0, 40459) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x225127ef4f644580), EcoNode(2, 7094, 7099) },
+	{ Q_UINT64_C(0x22931307c1950580), EcoNode(241, 2688, 7129) },
+	{ Q_UINT64_C(0xec1ab16142d11580), EcoNode(108, 5316, 17985) },
+	{ Q_UINT64_C(0xa9157a831899c583), EcoNode(0, 30889, -1) },
+	{ Q_UINT64_C(0x80653c971ecf0584), EcoNode(205, 388, 24593) },
+	{ Q_UINT64_C(0xbe5ffef5873da583), EcoNode(415, 2140, 34550) },
+	{ Q_UINT64_C(0x500fcbf03f855586), EcoNode(42, 15406, 15421) },
+	{ Q_UINT64_C(0xc6ea63698c858585), EcoNode(223, 791, 36223) },
+	{ Q_UINT64_C(0x8073272645a02588), EcoNode(371, 24649, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x14f60958a8da458c), EcoNode(212, 388, 4526) },
+	{ Q_UINT64_C(0x16a2aa9c201f458c), EcoNode(84, 4927, -1) },
+	{ Q_UINT64_C(0xd4c5b462704c058d), EcoNode(232, 3677, 38565) },
+	{ Q_UINT64_C(0x725855238662d58f), EcoNode(387, 1131, 21951) },
+	{ Q_UINT64_C(0xb5b739e688f17590), EcoNode(350, 0, 32992) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xe6cdbd2eb3410593), EcoNode(43, 18575, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xc937dbe9d2e2c597), EcoNode(51, 919, 36575) },
+	{ Q_UINT64_C(0x6e2e1ec493eb6598), EcoNode(229, 21271, -1) },
+	{ Q_UINT64_C(0xd5cd3a379fb30599), EcoNode(240, 38684, 38702) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xdd307d2702ec759b), EcoNode(300, 39930, -1) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xbfc0e4a5b660659d), EcoNode(215, 388, 34769) },
+	{ Q_UINT64_C(0xc0eb36fbcbbac59d), EcoNode(359, 0, 34913) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x755cca1cc99e65a0), EcoNode(260, 165, 22688) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x7ffcf0da484895a5), EcoNode(254, 3314, 24510) },
+	{ Q_UINT64_C(0x542b1c4ff754a5a6), EcoNode(244, 16287, -1) },
+	{ Q_UINT64_C(0x5ea4e9c706fcd5a6), EcoNode(335, 0, 18421) },
+	{ Q_UINT64_C(0x9266feb4c910f5a5), EcoNode(215, 388, 27556) },
+	{ Q_UINT64_C(0x5dad3e31882b95a9), EcoNode(277, 165, 18117) },
+	{ Q_UINT64_C(0xf2b5af44846685a8), EcoNode(100, 6728, 8832) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x4d68a119763145af), EcoNode(233, 1445, 14987) },
+	{ Q_UINT64_C(0x86e0bc11baeff5af), EcoNode(281, 165, 25616) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x58d942918fe935b4), EcoNode(103, 2748, 17391) },
+	{ Q_UINT64_C(0x66a6d1224590c5b4), EcoNode(202, 388, 19924) },
+	{ Q_UINT64_C(0x68b291e35c7905b5), EcoNode(248, 697, 20332) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x3b71a6fe0c2df5b8), EcoNode(302, 12007, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xaebcdae2da9fc5bf), EcoNode(230, 3677, 31693) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xaa3e4df9c48e55c2), EcoNode(493, 353, 31113) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x3b053218f098d5c5), EcoNode(328, 25, 11809) },
+	{ Q_UINT64_C(0x2b6a0affff2565c6), EcoNode(294, 165, 9038) },
+	{ Q_UINT64_C(0x626ee37e7ea705c6), EcoNode(305, 19184, -1) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x34d834ae81c675c9), EcoNode(232, 3677, 10932) },
+	{ Q_UINT64_C(0x504dce408b48c5c9), EcoNode(244, 4022, 15473) },
+	{ Q_UINT64_C(0x5aaf9ff1aab1c5ca), EcoNode(142, 106, 17674) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x95dd03fe7583f5cf), EcoNode(331, 0, 28052) },
+	{ Q_UINT64_C(0x23ac5a672e11c5d0), EcoNode(10, 5714, -1) },
+	{ Q_UINT64_C(0xbf852e8a9f7865cf), EcoNode(9, 13721, 34753) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x7783b322f16685d3), EcoNode(0, 23135, -1) },
+	{ Q_UINT64_C(0x94d169d8686ce5d3), EcoNode(235, 1445, 27849) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x08b952845b6d65d6), EcoNode(305, 743, -1) },
+	{ Q_UINT64_C(0x5497147d3b9415d6), EcoNode(28, 613, 16458) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x8c87f2e3dccfe5d9), EcoNode(333, 0, 26563) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x50ddce1b3c3a35dd), EcoNode(492, 353, 15621) },
+	{ Q_UINT64_C(0x2d401dd965fe75de), EcoNode(214, 388, 333) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xd1869dd70edaa5e0), EcoNode(417, 2140, 37884) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xda980a31bdae85e2), EcoNode(0, 39513, -1) },
+	{ Q_UINT64_C(0xfb24652b99eb55e3), EcoNode(360, 0, 44424) },
+	{ Q_UINT64_C(0x014aa73087e475e4), EcoNode(285, 165, 290) },
+	{ Q_UINT64_C(0x19faf010438e15e5), EcoNode(353, 0, 5376) },
+	{ Q_UINT64_C(0x71fb67b33815e5e5), EcoNode(59, 2654, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x035a8fa093b675eb), EcoNode(249, 697, 710) },
+	{ Q_UINT64_C(0x08c4d0aa2682b5eb), EcoNode(200, 1862, -1) },
+	{ Q_UINT64_C(0x7b83e1f9186385ed), EcoNode(431, 2196, 23936) },
+	{ Q_UINT64_C(0x942fa0b7423635ec), EcoNode(242, 1172, 27717) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x5c890603273035f0), EcoNode(331, 0, 17955) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x276022607366d5f2), EcoNode(388, 1131, 8309) },
+	{ Q_UINT64_C(0x530a3525918585f2), EcoNode(249, 697, 16085) },
+	{ Q_UINT64_C(0x52a55578345da5f4), EcoNode(479, 353, 15997) },
+	{ Q_UINT64_C(0x6284639ab0a605f5), EcoNode(147, 106, 19242) },
+	{ Q_UINT64_C(0x889541213ec615f2), EcoNode(113, 262, 8625) },
+	{ Q_UINT64_C(0xe6166d08e8be95f2), EcoNode(141, 106, 41296) },
+	{ Q_UINT64_C(0xff9202957b7335f2), EcoNode(80, 45232, -1) },
+	{ Q_UINT64_C(0x650f72c682ff75f9), EcoNode(277, 165, 19749) },
+	{ Q_UINT64_C(0x73a4a15e9365b5f9), EcoNode(133, 106, 22212) },
+	{ Q_UINT64_C(0xc38a7b8ecc1465fb), EcoNode(380, 20014, -1) },
+	{ Q_UINT64_C(0xd9239b64d31835f9), EcoNode(317, 5393, 39165) },
+	{ Q_UINT64_C(0xe52cecebbed3b5fd), EcoNode(83, 451, 41099) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x1d31bf80389aa602), EcoNode(159, 106, 5980) },
+	{ Q_UINT64_C(0x24929594a5d4a602), EcoNode(348, 200, 7702) },
+	{ Q_UINT64_C(0x7c3beaf510240604), EcoNode(161, 106, 24001) },
+	{ Q_UINT64_C(0x9d25962c4ad44604), EcoNode(364, 0, 29198) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x91f63dc9f864160d), EcoNode(15, 27441, -1) },
+	{ Q_UINT64_C(0xe955d2400392f60d), EcoNode(100, 41818, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x8d17a0c2b38a2613), EcoNode(496, 353, 26700) },
+	{ Q_UINT64_C(0xa03e02ff1818f613), EcoNode(233, 1445, 29674) },
+	{ Q_UINT64_C(0xb016a6c1a7a5f614), EcoNode(120, 106, 32014) },
+	{ Q_UINT64_C(0x276dd2be9896e616), EcoNode(257, 8273, 8377) },
+	{ Q_UINT64_C(0xc4fda96053200616), EcoNode(267, 165, 35635) },
+	{ Q_UINT64_C(0xd1bda168b3fd5613), EcoNode(462, 353, 37970) },
+	{ Q_UINT64_C(0xdf124cf601f19614), EcoNode(233, 1445, 40157) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xe2d062eb24c2061c), EcoNode(101, 4050, 40652) },
+	{ Q_UINT64_C(0x3adf67184e7c161d), EcoNode(239, 1445, 11738) },
+	{ Q_UINT64_C(0xe321bb5379f6061c), EcoNode(321, 25, 40767) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x7e9e6b82be84b626), EcoNode(220, 6728, 24088) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x633729db6a3fc628), EcoNode(125, 106, 5223) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xb835b2cf3d94e62a), EcoNode(70, 3028, 32520) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x34826bc17e14a62e), EcoNode(243, 1172, 10835) },
+	{ Q_UINT64_C(0xd71c1e1bb8da762f), EcoNode(244, 4662, 15532) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x64dc3b9ab0d28634), EcoNode(28, 613, 19650) },
+	{ Q_UINT64_C(0x0bc088c40a0af635), EcoNode(265, 165, 2622) },
+	{ Q_UINT64_C(0x2366fc513012c635), EcoNode(405, 1496, 7419) },
+	{ Q_UINT64_C(0x2dbc8cedfb46a637), EcoNode(288, 165, 5223) },
+	{ Q_UINT64_C(0x29c7254bd3554638), EcoNode(276, 165, 8774) },
+	{ Q_UINT64_C(0x1bad8322a4f5f639), EcoNode(232, 3677, 5595) },
+	{ Q_UINT64_C(0xedf0982492ada63a), EcoNode(183, 106, 42478) },
+	{ Q_UINT64_C(0xfed32760ad7fa63b), EcoNode(282, 165, 45088) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x7ecd72af97ee363d), EcoNode(60, 24223, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x9a3e66dbf801f641), EcoNode(44, 18575, -1) },
+	{ Q_UINT64_C(0x74d8e81b5d504642), EcoNode(225, 3287, 15244) },
+	{ Q_UINT64_C(0x5dd9d9aa2b716643), EcoNode(140, 106, 18225) },
+	{ Q_UINT64_C(0x03e3a60148d59644), EcoNode(5, 821, 826) },
+	{ Q_UINT64_C(0xe867f0a2f9db6645), EcoNode(40, 2095, 41746) },
+	{ Q_UINT64_C(0x77560104c9136646), EcoNode(83, 451, 23039) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xa0baf239e3cae648), EcoNode(218, 388, 395) },
+	{ Q_UINT64_C(0x102f6cd9bc6c5649), EcoNode(266, 165, 3556) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x2fca5d5384ec764e), EcoNode(374, 9784, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x6c11943c9af91659), EcoNode(132, 106, 6636) },
+	{ Q_UINT64_C(0x8cbeb63049d8d659), EcoNode(66, 3028, 26602) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x67741228e5d8a661), EcoNode(251, 1912, 20082) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x4610feecf3929663), EcoNode(9, 13721, -1) },
+	{ Q_UINT64_C(0x9cfb0812ba897664), EcoNode(322, 25, 29166) },
+	{ Q_UINT64_C(0xa9ad7dbd2ee5d665), EcoNode(491, 353, 31031) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x9173c2b961e6d667), EcoNode(1, 9311, 27391) },
+	{ Q_UINT64_C(0xe88de696d25c4667), EcoNode(163, 106, 41788) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xa706b08a8892d66a), EcoNode(340, 0, 30564) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xe151f8b18f5f4670), EcoNode(190, 106, 40390) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x37d486f047968673), EcoNode(0, 11465, -1) },
+	{ Q_UINT64_C(0x07a7ee1102432674), EcoNode(331, 0, 1679) },
+	{ Q_UINT64_C(0xee089a0e8c16d674), EcoNode(101, 4050, 42518) },
+	{ Q_UINT64_C(0x73e8bd5e4a224676), EcoNode(397, 1131, 22280) },
+	{ Q_UINT64_C(0x67a6a6abb40fe677), EcoNode(349, 200, 20193) },
+	{ Q_UINT64_C(0xf5abc5b5d41f3674), EcoNode(310, 43720, -1) },
+	{ Q_UINT64_C(0xc359059bc7a58679), EcoNode(311, 5393, 25137) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xdadfba6dd24e067e), EcoNode(0, 39541, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x2fcd1ef7e23d8682), EcoNode(90, 1881, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x915d5f70b3392686), EcoNode(271, 165, 1029) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x5dfd6f7d5033168a), EcoNode(233, 1445, 6398) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xb5c10e8342aec68d), EcoNode(459, 2196, 33017) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x2e94d8355db74690), EcoNode(176, 106, 9553) },
+	{ Q_UINT64_C(0x254bc53b323b2691), EcoNode(24, 613, 7969) },
+	{ Q_UINT64_C(0x783fc034c02c6691), EcoNode(95, 451, 23263) },
+	{ Q_UINT64_C(0x3b1ad7a209521693), EcoNode(483, 353, 11851) },
+	{ Q_UINT64_C(0xc0ac74fa57251691), EcoNode(84, 1881, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x4359544283aa9697), EcoNode(395, 1131, 13473) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xf4ee382a548cd699), EcoNode(244, 43597, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x5b0c28139958269c), EcoNode(28, 613, 17745) },
+	{ Q_UINT64_C(0x7ff44cc959fc769d), EcoNode(326, 25, 24483) },
+	{ Q_UINT64_C(0x7eb5607c4937e69e), EcoNode(477, 353, 24168) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x6b5678c06ad736a0), EcoNode(222, 9077, 20779) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xba611b8d78a8d6a6), EcoNode(102, 2748, 33753) },
+	{ Q_UINT64_C(0xe770bb08e46506a7), EcoNode(411, 41531, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x91276beba4a9e6ae), EcoNode(426, 2196, 27363) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xb795f21962f4b6b0), EcoNode(335, 0, 33350) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xc1bdc3626bcc06b2), EcoNode(423, 2196, 35070) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xc6fb6c517d1706b6), EcoNode(213, 388, 654) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x1612fc1fb86ad6ba), EcoNode(241, 2688, 4728) },
+	{ Q_UINT64_C(0x564a5df89ac696bb), EcoNode(240, 16767, -1) },
+	{ Q_UINT64_C(0x2ea27c15df0bd6bc), EcoNode(212, 388, 9595) },
+	{ Q_UINT64_C(0x004ed2f49a5bf6bd), EcoNode(356, 0, 47) },
+	{ Q_UINT64_C(0x28ec6d7651ded6bd), EcoNode(113, 262, 8625) },
+	{ Q_UINT64_C(0x5a95801dbb6966bc), EcoNode(453, 2196, 17647) },
+	{ Q_UINT64_C(0xbd56a15b88c956ba), EcoNode(383, 1131, 34298) },
+	{ Q_UINT64_C(0xe59f3fa102fd66c1), EcoNode(237, 1445, 41149) },
+	{ Q_UINT64_C(0xf79ca0a5d98a46c0), EcoNode(258, 8273, 44019) },
+	{ Q_UINT64_C(0x5b50339c316056c3), EcoNode(104, 2748, 12956) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x352ea6739b8806c5), EcoNode(395, 11030, -1) },
+	{ Q_UINT64_C(0x04bbacfbd6dd26c6), EcoNode(264, 165, 1015) },
+	{ Q_UINT64_C(0x7627916466b956c6), EcoNode(222, 9077, 22801) },
+	{ Q_UINT64_C(0xb6831a52f9e546c6), EcoNode(312, 5393, 33134) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xceb83f52a4e026cf), EcoNode(120, 106, 37595) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x66f5752bce3e56d1), EcoNode(220, 6728, 19970) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xc172e1804aeee6d6), EcoNode(245, 4662, 33251) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x87e2492eccc9c6d8), EcoNode(43, 25727, -1) },
+	{ Q_UINT64_C(0x1d01c537cbf326d9), EcoNode(267, 165, 5921) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x281732e022e316db), EcoNode(330, 0, 8446) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xf741e7a6828956de), EcoNode(282, 165, 43978) },
+	{ Q_UINT64_C(0x3e5fc9fd6483b6df), EcoNode(368, 0, 12539) },
+	{ Q_UINT64_C(0x75211db6110316df), EcoNode(315, 5393, 22656) },
+	{ Q_UINT64_C(0x872d3612c75f06df), EcoNode(337, 0, 25701) },
+	{ Q_UINT64_C(0xed118d4e192986e0), EcoNode(233, 1445, 42404) },
+	{ Q_UINT64_C(0x42624d23dfb8b6e3), EcoNode(248, 697, 13266) },
+	{ Q_UINT64_C(0xa41b35ffd3ba36e3), EcoNode(0, 3467, 30255) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x8f1175bf814886e6), EcoNode(250, 26940, -1) },
+	{ Q_UINT64_C(0x4112df7bd300d6e7), EcoNode(245, 12973, -1) },
+	{ Q_UINT64_C(0x048f9a2fae4366e8), EcoNode(25, 613, 992) },
+	{ Q_UINT64_C(0x4aca71d93c3636e8), EcoNode(239, 1445, 14531) },
+	{ Q_UINT64_C(0x4e699d19c7fa56e9), EcoNode(100, 15089, -1) },
+	{ Q_UINT64_C(0x529f673cbc5c26eb), EcoNode(425, 2196, 15971) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x68ed28a13cc746ee), EcoNode(47, 20375, -1) },
+	{ Q_UINT64_C(0x5e9b9f4749fc46ef), EcoNode(114, 262, 18390) },
+	{ Q_UINT64_C(0xdfc12ba3297d16ef), EcoNode(498, 353, 40214) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xf8cd054ab063c6f4), EcoNode(254, 3314, 44155) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xdeca0ecc51b8e6f6), EcoNode(107, 11396, -1) },
+	{ Q_UINT64_C(0x48dfa09cc72e76f7), EcoNode(240, 14326, -1) },
+	{ Q_UINT64_C(0xcfdae32cb63326f8), EcoNode(494, 353, 37607) },
+	{ Q_UINT64_C(0xda083d53d00c26f7), EcoNode(367, 0, 39447) },
+	{ Q_UINT64_C(0xb536da19561976fa), EcoNode(243, 1172, 32899) },
+	{ Q_UINT64_C(0xc8cbbdb43361c6fa), EcoNode(268, 165, 4774) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x470a3245950bd6ff), EcoNode(438, 2196, 13991) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x9b42400ffadf5707), EcoNode(84, 1881, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x416c6cb28590970a), EcoNode(331, 0, 13063) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x190fcb8f550a770c), EcoNode(110, 262, 5288) },
+	{ Q_UINT64_C(0xad2226cdb2fee70c), EcoNode(180, 106, 31526) },
+	{ Q_UINT64_C(0x1c77a9729f4a470e), EcoNode(490, 353, 5819) },
+	{ Q_UINT64_C(0xd632aa344e31870d), EcoNode(322, 25, 38754) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xff110fe306495712), EcoNode(12, 613, 45099) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x70e9a1312a7d4715), EcoNode(120, 106, 21686) },
+	{ Q_UINT64_C(0x9c4630f8613d6716), EcoNode(320, 25, 28965) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xbd865c9362c9071a), EcoNode(251, 34382, -1) },
+	{ Q_UINT64_C(0xfa85fdcdb945771b), EcoNode(349, 200, 44396) },
+	{ Q_UINT64_C(0x40e1ad65f1dd171c), EcoNode(205, 388, 12929) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x6349ea8eb429571e), EcoNode(209, 388, 19489) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x7b090c80c7f66723), EcoNode(70, 3028, 23861) },
+	{ Q_UINT64_C(0x209800d3150d8724), EcoNode(267, 165, 6692) },
+	{ Q_UINT64_C(0x884e5029c24e8723), EcoNode(336, 0, 25880) },
+	{ Q_UINT64_C(0x0e33e36a45114726), EcoNode(213, 388, 3193) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x1a83398fccdf7729), EcoNode(330, 5393, -1) },
+	{ Q_UINT64_C(0x770561615908f729), EcoNode(75, 3028, 22908) },
+	{ Q_UINT64_C(0x1d8175aa2a5c172b), EcoNode(143, 106, 6106) },
+	{ Q_UINT64_C(0x62312bf5000a672c), EcoNode(4, 821, 19106) },
+	{ Q_UINT64_C(0x31606dfc03d2d72d), EcoNode(112, 262, 10163) },
+	{ Q_UINT64_C(0x7368ef0d8cc2172b), EcoNode(298, 165, 22163) },
+	{ Q_UINT64_C(0x8e803fe06d8a772e), EcoNode(415, 2140, 26865) },
+	{ Q_UINT64_C(0x3c02029c8753a730), EcoNode(188, 106, 12110) },
+	{ Q_UINT64_C(0x4a92d13f90827730), EcoNode(15, 5714, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x2410e95d12322734), EcoNode(198, 106, 7503) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x9ca6f37f02f36736), EcoNode(386, 1131, 29078) },
+	{ Q_UINT64_C(0x2bb979cd98e56737), EcoNode(280, 165, 9089) },
+	{ Q_UINT64_C(0x387de61fc215f737), EcoNode(4, 821, 11503) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x94b57e88b07fb73a), EcoNode(211, 388, 27760) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xc5f6ff7900b2073c), EcoNode(355, 0, 35980) },
+	{ Q_UINT64_C(0x0b4d24f716a6373d), EcoNode(244, 2551, -1) },
+	{ Q_UINT64_C(0xddc6d3b4ecc2f73e), EcoNode(240, 664, 39996) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x0def66008c3b7741), EcoNode(71, 3028, 3117) },
+	{ Q_UINT64_C(0x80533915e338a742), EcoNode(463, 353, 24565) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x183de96daf43e744), EcoNode(310, 4757, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x1aa48034cde1e748), EcoNode(235, 1445, 5402) },
+	{ Q_UINT64_C(0x0ea5ab7fbcb4b749), EcoNode(225, 3287, 3294) },
+	{ Q_UINT64_C(0x15585389a7a5d74a), EcoNode(244, 4662, 4669) },
+	{ Q_UINT64_C(0x356c76f8e4f0b749), EcoNode(101, 4050, 11114) },
+	{ Q_UINT64_C(0xa92545a8aefa8748), EcoNode(490, 353, 11773) },
+	{ Q_UINT64_C(0xe89f55cd52014748), EcoNode(0, 19317, -1) },
+	{ Q_UINT64_C(0x201dffa38c8f474e), EcoNode(267, 165, 6600) },
+	{ Q_UINT64_C(0x3b89e5e55b19174e), EcoNode(0, 12043, -1) },
+	{ Q_UINT64_C(0x7915ba244c5b374e), EcoNode(203, 388, 23522) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x476e9621daf72752), EcoNode(242, 1172, 14105) },
+	{ Q_UINT64_C(0x5e86dd01e2585752), EcoNode(213, 388, 18351) },
+	{ Q_UINT64_C(0x7ec069fa27e6f754), EcoNode(389, 1131, 24186) },
+	{ Q_UINT64_C(0xed35b23ee2fdc755), EcoNode(84, 1881, -1) },
+	{ Q_UINT64_C(0x8596c4a76746f756), EcoNode(245, 4662, 25523) },
+	{ Q_UINT64_C(0x7c625c7ce074b757), EcoNode(350, 0, 24041) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xdb55d4fcaadc775e), EcoNode(156, 106, -1) },
+	{ Q_UINT64_C(0x4b71fde35131775f), EcoNode(367, 0, 14687) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x5e857b8f3e746761), EcoNode(23, 613, 18320) },
+	{ Q_UINT64_C(0x995b37f31bc77762), EcoNode(121, 106, 28494) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x63030917fa43f764), EcoNode(41, 4698, 19379) },
+	{ Q_UINT64_C(0x67e323c96d0a0764), EcoNode(101, 20221, -1) },
+	{ Q_UINT64_C(0x57881034010e2766), EcoNode(417, 2140, 17128) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xaab3a2525030c769), EcoNode(245, 12973, -1) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x2ec139b74c5f976b), EcoNode(229, 2275, 9637) },
+	{ Q_UINT64_C(0x82e3e06781c3c76c), EcoNode(411, 25079, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x2c8004766c15676f), EcoNode(487, 353, 9214) },
+	{ Q_UINT64_C(0x72a9e0c0a06fa770), EcoNode(262, 165, 22019) },
+	{ Q_UINT64_C(0x1afceb8e7efa9771), EcoNode(245, 4662, 5469) },
+	{ Q_UINT64_C(0x152f83f64ef34772), EcoNode(435, 2196, 4628) },
+	{ Q_UINT64_C(0xba9dac8cf9a97772), EcoNode(230, 3677, 33790) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x8133eae94d7d3775), EcoNode(101, 4050, 24784) },
+	{ Q_UINT64_C(0x53fa4a9e9968a776), EcoNode(296, 165, 16211) },
+	{ Q_UINT64_C(0xa3e83e85655b8777), EcoNode(290, 165, 30191) },
+	{ Q_UINT64_C(0xb3f976e26e428777), EcoNode(268, 165, 32688) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x714fac11cc1ca77d), EcoNode(415, 2140, 21744) },
+	{ Q_UINT64_C(0x1dda726f5582677e), EcoNode(282, 165, 6134) },
+	{ Q_UINT64_C(0x6047e0c7441e877f), EcoNode(301, 18594, -1) },
+	{ Q_UINT64_C(0x8a947a97d332d77d), EcoNode(390, 1131, 26190) },
+	{ Q_UINT64_C(0xb31bccaad13e5781), EcoNode(142, 106, 32628) },
+	{ Q_UINT64_C(0xef6489096a66177e), EcoNode(132, 106, 23845) },
+	{ Q_UINT64_C(0x8b4bb3593eb61783), EcoNode(237, 1445, 26340) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x2059725d6b6e9785), EcoNode(240, 664, 6636) },
+	{ Q_UINT64_C(0x86ffae71ad298786), EcoNode(247, 697, 25652) },
+	{ Q_UINT64_C(0x229500ab92419787), EcoNode(329, 25, 7157) },
+	{ Q_UINT64_C(0xefed90774bab7787), EcoNode(344, 200, 42909) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x92ab09766a8e678a), EcoNode(396, 1131, 27607) },
+	{ Q_UINT64_C(0x75145e750328578b), EcoNode(211, 388, 13454) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x9085db202354178d), EcoNode(242, 1172, 27097) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xa0f64f8425164791), EcoNode(34, 613, 8251) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x806ee4d7d6b08795), EcoNode(269, 165, 24623) },
+	{ Q_UINT64_C(0x59f6079c20f57796), EcoNode(317, 5393, 17542) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x2f8ac932db40579a), EcoNode(279, 165, 9718) },
+	{ Q_UINT64_C(0xca18093c559e579b), EcoNode(10, 5714, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x95327f9ce12df7a0), EcoNode(200, 388, 27931) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x5db4f32662eda7a5), EcoNode(305, 743, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xd8dcc0ac97fda7a8), EcoNode(462, 353, 39078) },
+	{ Q_UINT64_C(0x0fb260c9f56b07a9), EcoNode(250, 3434, -1) },
+	{ Q_UINT64_C(0xa1786554139f67a9), EcoNode(121, 106, 25944) },
+	{ Q_UINT64_C(0x2ba72533ef1397ab), EcoNode(241, 2688, 9061) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x784dbc7b5c7eb7ad), EcoNode(214, 388, 23314) },
+	{ Q_UINT64_C(0xaa348851dbbe87ad), EcoNode(299, 165, 31085) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x07d99f95590407b0), EcoNode(249, 697, 1685) },
+	{ Q_UINT64_C(0x22ad7779c1e197b0), EcoNode(22, 613, 7203) },
+	{ Q_UINT64_C(0x488ea981bb2c57b0), EcoNode(152, 106, 14258) },
+	{ Q_UINT64_C(0xbd4ac1be0e0657b3), EcoNode(215, 388, 34258) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xcff2031795fd57b8), EcoNode(237, 1445, 37634) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x25449e4ead2b57ba), EcoNode(191, 106, 7930) },
+	{ Q_UINT64_C(0x516f64d39a4ca7ba), EcoNode(251, 15783, -1) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x8dcf3594653507bd), EcoNode(251, 1912, 15244) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xa24c26a1eacd97bf), EcoNode(198, 106, 29853) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xe8343774195c77c3), EcoNode(277, 165, 41648) },
+	{ Q_UINT64_C(0xf26a73d0128cc7c4), EcoNode(230, 3677, 43267) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x057fe87c7bea47c8), EcoNode(394, 1131, 1141) },
+	{ Q_UINT64_C(0x61a6a0172ab6a7c9), EcoNode(270, 165, 18974) },
+	{ Q_UINT64_C(0x16eeb90c7a2c97ca), EcoNode(254, 3314, 4988) },
+	{ Q_UINT64_C(0x53dae535c32cd7ca), EcoNode(69, 3028, 16182) },
+	{ Q_UINT64_C(0x5414e11a976477cc), EcoNode(257, 8273, 16237) },
+	{ Q_UINT64_C(0x75fd83ead38937ca), EcoNode(173, 106, 22737) },
+	{ Q_UINT64_C(0x8b1107784cefb7c9), EcoNode(219, 388, 26265) },
+	{ Q_UINT64_C(0xbc6ffb0d4dbcc7c9), EcoNode(13, 5714, -1) },
+	{ Q_UINT64_C(0xd13b881d095a27c8), EcoNode(80, 37835, -1) },
+	{ Q_UINT64_C(0x46771eadd73dc7d1), EcoNode(248, 697, 13851) },
+	{ Q_UINT64_C(0xd2b02748784217d2), EcoNode(225, 3287, 38116) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x49eda335fe8a97d8), EcoNode(412, 2140, 14479) },
+	{ Q_UINT64_C(0xb45551697b3517d8), EcoNode(108, 5316, 32791) },
+	{ Q_UINT64_C(0xc3d8403b2b2047da), EcoNode(410, 11588, -1) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xad1415bcca6297dc), EcoNode(97, 451, 31482) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xeec36cc8c45017df), EcoNode(357, 0, 42642) },
+	{ Q_UINT64_C(0xc3d8a23c27b837e0), EcoNode(220, 6728, 35401) },
+	{ Q_UINT64_C(0xb65e28bd2b2ef7e1), EcoNode(407, 1496, 33117) },
+	{ Q_UINT64_C(0x5c49dae4afb967e2), EcoNode(335, 0, 17925) },
+	{ Q_UINT64_C(0xeabd0898671b37e0), EcoNode(104, 2748, 42079) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x8f999943f1a2a7e6), EcoNode(410, 26994, -1) },
+	{ Q_UINT64_C(0xf29fa014eb7047e6), EcoNode(13, 613, 43286) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xbb9cb7e73bf0f7e9), EcoNode(202, 388, 33968) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x364e9256c5d337ec), EcoNode(8, 821, 11261) },
+	{ Q_UINT64_C(0x52e217d309ce67ed), EcoNode(474, 353, 16044) },
+	{ Q_UINT64_C(0x73a11080fec097ec), EcoNode(330, 0, 22195) },
+	{ Q_UINT64_C(0x85a5087983f3c7ec), EcoNode(255, 4816, -1) },
+	{ Q_UINT64_C(0xe596c2b5aef2b7ec), EcoNode(106, 1518, -1) },
+	{ Q_UINT64_C(0xca9df64ccc1c97f1), EcoNode(1, 9311, -1) },
+	{ Q_UINT64_C(0xe3458dadf90f67f2), EcoNode(102, 2748, 40785) },
+	{ Q_UINT64_C(0x11d23579750e37f3), EcoNode(92, 451, 4002) },
+	{ Q_UINT64_C(0x4f44077f94e107f4), EcoNode(258, 8273, 15178) },
+	{ Q_UINT64_C(0x7fd4713c314e37f4), EcoNode(407, 1496, 24455) },
+	{ Q_UINT64_C(0xec0f9b42173467ef), EcoNode(295, 165, 42307) },
+	{ Q_UINT64_C(0x2bc301177acf37f7), EcoNode(304, 743, -1) },
+	{ Q_UINT64_C(0xcb4f3c2a8ea437f8), EcoNode(219, 388, 36972) },
+	{ Q_UINT64_C(0x11aa864aac3b47f9), EcoNode(267, 165, 3935) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x8034df6a598637fe), EcoNode(103, 2748, -1) },
+	{ Q_UINT64_C(0x564475192bd8a7ff), EcoNode(254, 3314, 16741) },
+	{ Q_UINT64_C(0x78e1fb2003db57ff), EcoNode(231, 3677, 23449) },
+	{ Q_UINT64_C(0x8bb4c010275177ff), EcoNode(248, 697, 26446) },
+	{ Q_UINT64_C(0xb01615dc6521a800), EcoNode(57, 2654, 31999) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x828922df9722e806), EcoNode(366, 0, 24906) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x5e1bece02c4ae808), EcoNode(230, 3677, 18265) },
+	{ Q_UINT64_C(0x57e7c64e31de8809), EcoNode(231, 3677, 17263) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xb3217a83bbe1680c), EcoNode(206, 388, 32639) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x99dd36a42426b80e), EcoNode(492, 353, 17428) },
+	{ Q_UINT64_C(0xc50204575909880f), EcoNode(40, 2095, 35671) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x275003abe432c811), EcoNode(256, 8273, 8293) },
+	{ Q_UINT64_C(0x220a19c780fee812), EcoNode(295, 165, 7018) },
+	{ Q_UINT64_C(0x793145936182b813), EcoNode(366, 0, 16624) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x994a45ca6e9a1815), EcoNode(288, 165, 9239) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xba75b786524ad819), EcoNode(221, 6774, 33771) },
+	{ Q_UINT64_C(0x3b297c9743d8a81a), EcoNode(0, 11877, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xb7d0f2ff476eb81f), EcoNode(253, 3314, 33380) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x332c1093e8e73824), EcoNode(113, 262, 10548) },
+	{ Q_UINT64_C(0xac0db539421c8825), EcoNode(256, 8273, 31382) },
+	{ Q_UINT64_C(0x48e3db07d7da9826), EcoNode(102, 2748, 14343) },
+	{ Q_UINT64_C(0xfe5c5e0a38274824), EcoNode(469, 353, 45019) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x5983f9ae76e55829), EcoNode(105, 2748, 17473) },
+	{ Q_UINT64_C(0x9c0c49f5af52f829), EcoNode(62, 3028, 2667) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x9f0c44191e0fc82d), EcoNode(144, 4423, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x94be0d268ef97832), EcoNode(189, 106, 27792) },
+	{ Q_UINT64_C(0x30dc3abcf7a80833), EcoNode(258, 8273, 10044) },
+	{ Q_UINT64_C(0x9fda525cc0b4c832), EcoNode(123, 106, 5223) },
+	{ Q_UINT64_C(0xfc48b7d60eda0833), EcoNode(0, 44728, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x6613adcefac4c839), EcoNode(460, 19855, -1) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xa57ce153f116483b), EcoNode(212, 388, 30373) },
+	{ Q_UINT64_C(0xfe15bdcf4cdec83b), EcoNode(109, 5316, 44950) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xc3d84fc1259d283e), EcoNode(296, 165, 35384) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x3b3871a419bdc840), EcoNode(239, 1445, 11890) },
+	{ Q_UINT64_C(0xc7ac015a02afc841), EcoNode(255, 14617, 36338) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x61753373802e184a), EcoNode(104, 2748, 18924) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x9eb1c566eb2c084f), EcoNode(165, 106, 29484) },
+	{ Q_UINT64_C(0xccc717e690827850), EcoNode(259, 8273, 37172) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x772a330d4e187852), EcoNode(233, 1445, 22976) },
+	{ Q_UINT64_C(0x56ac851dae3c0853), EcoNode(370, 16949, -1) },
+	{ Q_UINT64_C(0xb6919b2fa6336853), EcoNode(6, 821, 33164) },
+	{ Q_UINT64_C(0xa4e04ae20fa23855), EcoNode(221, 6774, 30337) },
+	{ Q_UINT64_C(0x63c46580a6095856), EcoNode(213, 388, 19581) },
+	{ Q_UINT64_C(0xd05660d47c6f4857), EcoNode(214, 388, 6825) },
+	{ Q_UINT64_C(0xc460ad69810d7858), EcoNode(42, 15406, 35459) },
+	{ Q_UINT64_C(0x8869b3903cc79859), EcoNode(179, 106, 25913) },
+	{ Q_UINT64_C(0xe3bf8d51bf599856), EcoNode(34, 613, 40906) },
+	{ Q_UINT64_C(0x86c2157be13bf85b), EcoNode(215, 388, 25586) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x3c11e09ee0085865), EcoNode(251, 12184, -1) },
+	{ Q_UINT64_C(0x1f6f0ab4f544e866), EcoNode(233, 1445, 6398) },
+	{ Q_UINT64_C(0xeadc440280280867), EcoNode(82, 451, 42103) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xd499373af89a0869), EcoNode(110, 262, 38465) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x235cfd118d43786e), EcoNode(324, 7408, -1) },
+	{ Q_UINT64_C(0x1b02b34594b7586f), EcoNode(52, 919, 5487) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x0683690b51d20872), EcoNode(472, 353, 1371) },
+	{ Q_UINT64_C(0x673d7426138a5873), EcoNode(399, 20014, 20032) },
+	{ Q_UINT64_C(0x880a67c600624874), EcoNode(145, 106, 25805) },
+	{ Q_UINT64_C(0x312ee11760d25875), EcoNode(103, 2748, 10111) },
+	{ Q_UINT64_C(0x66dac9dd3aeea876), EcoNode(100, 6728, 19953) },
+	{ Q_UINT64_C(0x101ac13615088877), EcoNode(25, 613, 3538) },
+	{ Q_UINT64_C(0x3241fd22a34e6878), EcoNode(439, 2196, 10458) },
+	{ Q_UINT64_C(0x8ade5bab08eed879), EcoNode(233, 1445, 26211) },
+	{ Q_UINT64_C(0xbb073f7150d86877), EcoNode(246, 697, 33854) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x9ea6c0133df3387d), EcoNode(239, 1445, 29460) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x9416c7dea1ac7880), EcoNode(9, 5192, -1) },
+	{ Q_UINT64_C(0x0a963b097bdd7881), EcoNode(433, 2196, 2324) },
+	{ Q_UINT64_C(0xf0c7fc282d56d881), EcoNode(282, 165, 43152) },
+	{ Q_UINT64_C(0x10cbd0366ac50883), EcoNode(100, 3790, -1) },
+	{ Q_UINT64_C(0xee5f2555eeec4884), EcoNode(295, 165, 42602) },
+	{ Q_UINT64_C(0x109114d098daa885), EcoNode(213, 388, 3741) },
+	{ Q_UINT64_C(0xeb040638d0617885), EcoNode(233, 1445, 42144) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x722ff596d204b888), EcoNode(41, 1518, 21917) },
+	{ Q_UINT64_C(0xbb5f825df1c4f889), EcoNode(257, 8273, 33911) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x65a7d81aa25da88b), EcoNode(251, 1912, -1) },
+	{ Q_UINT64_C(0x9408c6b8d405e88c), EcoNode(41, 15406, -1) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x0342c555ddecf88e), EcoNode(240, 664, 672) },
+	{ Q_UINT64_C(0x3d6b84fe8dcc588e), EcoNode(357, 0, 12434) },
+	{ Q_UINT64_C(0x6e43759e215b188f), EcoNode(494, 353, 21302) },
+	{ Q_UINT64_C(0x907eb4dd9c27e890), EcoNode(233, 1445, 27083) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xe6385b99ed0b5896), EcoNode(237, 1445, 41310) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x2b2385c9b74b089b), EcoNode(223, 791, 8959) },
+	{ Q_UINT64_C(0xcff7faaac8c2d89c), EcoNode(171, 106, 37650) },
+	{ Q_UINT64_C(0x1edd0807484d289d), EcoNode(413, 2140, 6312) },
+	{ Q_UINT64_C(0xd3207fec0612d89d), EcoNode(240, 38186, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x4b3b394e399828a1), EcoNode(255, 14617, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xb4d1cca501d8a8a7), EcoNode(241, 2688, 4774) },
+	{ Q_UINT64_C(0x64534b53efb678a8), EcoNode(103, 2748, 4774) },
+	{ Q_UINT64_C(0x570fe20e382018a9), EcoNode(107, 5316, 17020) },
+	{ Q_UINT64_C(0x7b13d091c61af8a8), EcoNode(312, 5393, 23887) },
+	{ Q_UINT64_C(0xb24068b0cb3b08a9), EcoNode(462, 353, 32409) },
+	{ Q_UINT64_C(0x754f7dd6a24a08ac), EcoNode(183, 106, 22668) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x8f0d23cbd60b18af), EcoNode(456, 2196, 26911) },
+	{ Q_UINT64_C(0x60f205d5bca708b0), EcoNode(162, 106, 18763) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xbab42fd3d52098b3), EcoNode(41, 33841, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x67521168b0ded8bb), EcoNode(8, 821, 826) },
+	{ Q_UINT64_C(0x984d6924b54548bb), EcoNode(290, 165, 28391) },
+	{ Q_UINT64_C(0x10cefbda2701e8bd), EcoNode(349, 200, 3805) },
+	{ Q_UINT64_C(0xe317a71a758108bc), EcoNode(106, 1518, 40748) },
+	{ Q_UINT64_C(0xf01d06f540ba38bc), EcoNode(102, 2748, 42968) },
+	{ Q_UINT64_C(0x34c6a4e59cfce8c0), EcoNode(225, 3287, 10871) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x3af1c2a36b66a8c2), EcoNode(241, 2688, 11773) },
+	{ Q_UINT64_C(0x54c4ed4f52da08c2), EcoNode(103, 2748, 16533) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x51da0eb69e0348c5), EcoNode(331, 0, 15899) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x03df4cc39d4ca8c7), EcoNode(223, 791, 808) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x0a6f58fc8f9f08cc), EcoNode(323, 25, 2305) },
+	{ Q_UINT64_C(0x1c9694ea6ad208cd), EcoNode(54, 4698, 5861) },
+	{ Q_UINT64_C(0x976dca2683dd88cc), EcoNode(252, 1912, 28196) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xe26135efb98ee8d2), EcoNode(13, 5714, 37444) },
+	{ Q_UINT64_C(0x46ea005db768f8d3), EcoNode(247, 697, 13975) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x4cff815c706bc8d5), EcoNode(202, 388, 14932) },
+	{ Q_UINT64_C(0x8bafd4a1295348d6), EcoNode(231, 3677, 26413) },
+	{ Q_UINT64_C(0xf098f985d938f8d6), EcoNode(102, 2748, -1) },
+	{ Q_UINT64_C(0xf160c563622c28d6), EcoNode(406, 1496, 43222) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x90901935d014a8dc), EcoNode(28, 613, 27131) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x47c120745f40e8de), EcoNode(109, 5316, 14140) },
+	{ Q_UINT64_C(0x847e67e8643de8df), EcoNode(278, 165, 25375) },
+	{ Q_UINT64_C(0x89015987ff8fd8e0), EcoNode(140, 106, 6983) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x0b8c91402d8998e2), EcoNode(332, 0, 2570) },
+	{ Q_UINT64_C(0xd1f9164e821838e3), EcoNode(319, 5393, 18506) },
+	{ Q_UINT64_C(0xd9a0c345451898e2), EcoNode(121, 106, 39328) },
+	{ Q_UINT64_C(0xb11ca36550aa08e5), EcoNode(363, 0, 32158) },
+	{ Q_UINT64_C(0x60c77a58246188e6), EcoNode(380, 1131, 18727) },
+	{ Q_UINT64_C(0x83805bd8dff3b8e6), EcoNode(253, 3314, 18117) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x60ae79cf3b7b08e9), EcoNode(255, 4816, -1) },
+	{ Q_UINT64_C(0x949338ae382eb8ea), EcoNode(6, 821, 9311) },
+	{ Q_UINT64_C(0x3c0ba18cf07978eb), EcoNode(68, 3028, 12166) },
+	{ Q_UINT64_C(0xcafccc37777628ea), EcoNode(201, 388, 36918) },
+	{ Q_UINT64_C(0xc2c1fc8a117dd8ed), EcoNode(278, 165, 35259) },
+	{ Q_UINT64_C(0xfb58fdd1bf4048ed), EcoNode(134, 106, 44489) },
+	{ Q_UINT64_C(0xa9d79a24497738ef), EcoNode(64, 3028, 31037) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xc9fdfd111a1de8f4), EcoNode(277, 165, 36718) },
+	{ Q_UINT64_C(0x55a516de1bf0f8f5), EcoNode(102, 2748, 16685) },
+	{ Q_UINT64_C(0x2c6a65dc0941b8f6), EcoNode(48, 353, 9177) },
+	{ Q_UINT64_C(0xa09f96af64c498f7), EcoNode(222, 9077, 29781) },
+	{ Q_UINT64_C(0x5b01580d6b3568f8), EcoNode(328, 25, 17727) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x31eb5ec8cae7a8fb), EcoNode(341, 0, 10377) },
+	{ Q_UINT64_C(0xab2dcfdba75868fc), EcoNode(335, 0, 31250) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x03388fe7ba6898fe), EcoNode(158, 106, 654) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x2a9b324e4da14900), EcoNode(422, 2196, 8916) },
+	{ Q_UINT64_C(0xe787a7e863492900), EcoNode(274, 165, 1029) },
+	{ Q_UINT64_C(0x610fb232e064c902), EcoNode(153, 18813, -1) },
+	{ Q_UINT64_C(0x12c7704e8235e903), EcoNode(225, 3287, 4166) },
+	{ Q_UINT64_C(0xbd7741389222a904), EcoNode(460, 34336, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x88ce4b19abe8990b), EcoNode(242, 25963, -1) },
+	{ Q_UINT64_C(0x513c827ebcaff90c), EcoNode(223, 791, 15738) },
+	{ Q_UINT64_C(0x01499489a184b90d), EcoNode(115, 262, 272) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xd7cfd3680cbe5915), EcoNode(363, 0, 38948) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x215e35d5234b091b), EcoNode(325, 6912, -1) },
+	{ Q_UINT64_C(0xa2b4512936c1291b), EcoNode(368, 0, 29929) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xb8beb8ffde7a3920), EcoNode(250, 5205, 33533) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x3155e35f9ce53923), EcoNode(2, 7094, 10151) },
+	{ Q_UINT64_C(0x6a11912765bf5924), EcoNode(190, 106, 20492) },
+	{ Q_UINT64_C(0x714e8db1b84c5925), EcoNode(483, 353, 21718) },
+	{ Q_UINT64_C(0xbf488ab5b5359923), EcoNode(492, 353, 34699) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x9c65e99bc9de392a), EcoNode(110, 262, 29040) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xc71cdf33e914a92e), EcoNode(200, 388, 21047) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x79c0d1bb4378c930), EcoNode(292, 165, 23601) },
+	{ Q_UINT64_C(0x054659bab913f931), EcoNode(275, 165, 1029) },
+	{ Q_UINT64_C(0x8a539f4fa8f7b932), EcoNode(5, 821, 26119) },
+	{ Q_UINT64_C(0xca7605bd53810931), EcoNode(397, 1131, 36820) },
+	{ Q_UINT64_C(0xca68209a33a64934), EcoNode(109, 5316, 31220) },
+	{ Q_UINT64_C(0xccb30dac45725930), EcoNode(118, 262, 23108) },
+	{ Q_UINT64_C(0x30160e09091c3936), EcoNode(55, 4698, 9863) },
+	{ Q_UINT64_C(0x68740fa32c170937), EcoNode(290, 165, 20277) },
+	{ Q_UINT64_C(0x0853dd15c2c37938), EcoNode(238, 1445, 1749) },
+	{ Q_UINT64_C(0xa205c8bb0d1cf936), EcoNode(250, 29826, -1) },
+	{ Q_UINT64_C(0x958cc684a1f2d93a), EcoNode(244, 422, 13454) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xcd4894bdca70993e), EcoNode(270, 165, 37287) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xd041e05484a90940), EcoNode(229, 2275, -1) },
+	{ Q_UINT64_C(0x6b40830dcd631941), EcoNode(266, 165, 20737) },
+	{ Q_UINT64_C(0x04ddb43ddbc4d942), EcoNode(351, 0, -1) },
+	{ Q_UINT64_C(0xbd4fd3445cc56942), EcoNode(440, 2196, 11156) },
+	{ Q_UINT64_C(0xe980cea0b162e941), EcoNode(255, 62, 41831) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xa6a5cd188f81a949), EcoNode(218, 388, 30479) },
+	{ Q_UINT64_C(0x50cb6aa31a31b94a), EcoNode(100, 15594, -1) },
+	{ Q_UINT64_C(0x6063d387383e094a), EcoNode(228, 18679, -1) },
+	{ Q_UINT64_C(0xcb7e2dc07deee94a), EcoNode(27, 613, 37054) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xc2038c2294fdd94f), EcoNode(237, 1445, 35128) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x2df2e8f47b022952), EcoNode(0, 9429, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xdb3d08a9d1d6c95a), EcoNode(237, 1445, 39584) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x0c0da4d93611495d), EcoNode(140, 106, 2727) },
+	{ Q_UINT64_C(0x1f69f5d5c955895e), EcoNode(232, 3677, 6371) },
+	{ Q_UINT64_C(0x077096d4f3ea595f), EcoNode(0, 1595, -1) },
+	{ Q_UINT64_C(0x3164d46b20ab895d), EcoNode(48, 353, 10181) },
+	{ Q_UINT64_C(0x6f585770478fc95e), EcoNode(233, 1445, 21439) },
+	{ Q_UINT64_C(0x874670e848fcf962), EcoNode(260, 165, 25707) },
+	{ Q_UINT64_C(0xeb2dcb4d615ed961), EcoNode(235, 1445, 42236) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x89973b6384108965), EcoNode(225, 3287, 26042) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xbccda23ddf5e9968), EcoNode(7, 821, 34148) },
+	{ Q_UINT64_C(0xc96f6c5ab974b969), EcoNode(340, 0, 36605) },
+	{ Q_UINT64_C(0xff40cd9d87a66969), EcoNode(386, 1131, 45161) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x80817becbaba796f), EcoNode(255, 62, 24699) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x746846d1ef1d9973), EcoNode(239, 1445, 22535) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x15f7f52e4ed2f976), EcoNode(53, 4698, 4709) },
+	{ Q_UINT64_C(0x659014dc3b530976), EcoNode(225, 3287, 19820) },
+	{ Q_UINT64_C(0xa40b2789a2b24977), EcoNode(262, 165, 30216) },
+	{ Q_UINT64_C(0x0977c3639d315979), EcoNode(112, 262, 2134) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xcc4b2843d7b9497c), EcoNode(230, 3677, 37122) },
+	{ Q_UINT64_C(0xab94c5ae8dfbf97d), EcoNode(239, 1445, 31307) },
+	{ Q_UINT64_C(0xf9f384c295c5697d), EcoNode(234, 1445, 44275) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xd8ded132fe39e983), EcoNode(46, 2095, 39116) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xe862b2f38cf1198b), EcoNode(300, 34800, 41723) },
+	{ Q_UINT64_C(0xd811da12c924b98c), EcoNode(18, 613, 39010) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x4499fd05fcc5f991), EcoNode(196, 106, 13603) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xc4d25731ef533994), EcoNode(334, 0, 35570) },
+	{ Q_UINT64_C(0xb6e25b280bc70995), EcoNode(160, 106, 33236) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xf6f782088bee2999), EcoNode(476, 353, 24168) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x2503be1f99f0f99d), EcoNode(244, 4662, 7899) },
+	{ Q_UINT64_C(0x569df553113fb99d), EcoNode(127, 106, 16898) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x0844931a6ef4b9a0), EcoNode(220, 1732, -1) },
+	{ Q_UINT64_C(0x6c1f16c52a33e9a1), EcoNode(223, 791, 20884) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x37bfbccaa375b9a3), EcoNode(101, 4050, 11421) },
+	{ Q_UINT64_C(0x5423a57ad19dd9a4), EcoNode(160, 106, 16254) },
+	{ Q_UINT64_C(0x3058e32b7c7af9a5), EcoNode(244, 422, 9955) },
+	{ Q_UINT64_C(0xd1e04c73292d09a6), EcoNode(246, 5068, 26190) },
+	{ Q_UINT64_C(0xbcd49c7757fae9a7), EcoNode(102, 2748, 8916) },
+	{ Q_UINT64_C(0xd859657d7f3c59a4), EcoNode(280, 165, 39034) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x1514081d7ec439ac), EcoNode(252, 1912, 4590) },
+	{ Q_UINT64_C(0x9d2cc469891409ac), EcoNode(288, 165, 29245) },
+	{ Q_UINT64_C(0x6479b5379b73c9ae), EcoNode(103, 2748, 19612) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xe370af0e597ad9b1), EcoNode(100, 40802, -1) },
+	{ Q_UINT64_C(0xc8ce0894aaa3b9b2), EcoNode(213, 388, 36463) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x4c501d8620d409b7), EcoNode(211, 388, 13454) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x02db8e9b444f79ba), EcoNode(25, 613, 621) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x8809dff87d0fa9bd), EcoNode(280, 165, 25791) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x6f767c719ad619bf), EcoNode(341, 0, 21492) },
+	{ Q_UINT64_C(0xb0492b9d541d99bf), EcoNode(215, 388, 32080) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x75d6ab531e8df9c3), EcoNode(74, 3028, 22702) },
+	{ Q_UINT64_C(0x9688b0c40225e9c3), EcoNode(265, 165, 28136) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xc095a91913e599c7), EcoNode(162, 106, 34890) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x1270997b796089d0), EcoNode(293, 165, 4116) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xbce99f8cbd25b9d4), EcoNode(113, 262, 34185) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x4ff7d45850c8d9d7), EcoNode(1, 9311, 333) },
+	{ Q_UINT64_C(0xece46c18fd49c9d7), EcoNode(100, 6728, 8832) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xbe4609de2fc2a9db), EcoNode(363, 0, 34492) },
+	{ Q_UINT64_C(0x60c9f6a8dbac59dc), EcoNode(355, 0, 18740) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x3c842ab7984d39de), EcoNode(420, 2196, 12296) },
+	{ Q_UINT64_C(0xd0e87db6456ff9df), EcoNode(332, 0, 37737) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x3e6ade075261f9e2), EcoNode(402, 1496, 12619) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x0976b1f894bd29e8), EcoNode(40, 2095, 2108) },
+	{ Q_UINT64_C(0x22c4b53d4c4359e8), EcoNode(185, 106, 7251) },
+	{ Q_UINT64_C(0xb29582ddabd719e9), EcoNode(133, 4423, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x1f4514caba5419ee), EcoNode(470, 353, 6357) },
+	{ Q_UINT64_C(0x72e5b324258329ef), EcoNode(230, 3677, 22103) },
+	{ Q_UINT64_C(0xba3e0b1a697259f0), EcoNode(367, 0, 33682) },
+	{ Q_UINT64_C(0x0eda5dcb5fc9c9f1), EcoNode(101, 3351, -1) },
+	{ Q_UINT64_C(0xc7f2781c023469f0), EcoNode(54, 4698, 36360) },
+	{ Q_UINT64_C(0x43dadba72cd8b9f3), EcoNode(34, 613, 13493) },
+	{ Q_UINT64_C(0x782ea9f4c034f9f3), EcoNode(51, 919, 23242) },
+	{ Q_UINT64_C(0xdd67b0e079fb99f4), EcoNode(7, 821, 826) },
+	{ Q_UINT64_C(0x81194027fbd5e9f6), EcoNode(237, 1445, 24751) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x745f98cf8f7d69f8), EcoNode(241, 2688, 22495) },
+	{ Q_UINT64_C(0x9c2877f959b789f9), EcoNode(113, 262, 28929) },
+	{ Q_UINT64_C(0xa6cd47abf8db09fa), EcoNode(280, 165, 30508) },
+	{ Q_UINT64_C(0xbee2b56ace4129f9), EcoNode(110, 262, 34622) },
+	{ Q_UINT64_C(0x99b0f53f7ae359fc), EcoNode(284, 165, 28552) },
+	{ Q_UINT64_C(0xc5c23bf25e9969fd), EcoNode(158, 106, 35924) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x6678b6aa2946b9ff), EcoNode(395, 1131, 19906) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x7ea0f4327c6a6a03), EcoNode(25, 613, 24102) },
+	{ Q_UINT64_C(0xb0309bf15cf58a03), EcoNode(223, 791, 32061) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x5b3ed61ff6794a0d), EcoNode(133, 106, 17801) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x7038cc03ebb1ca0f), EcoNode(231, 3677, 17263) },
+	{ Q_UINT64_C(0x5aefaab4a1a36a10), EcoNode(200, 388, 826) },
+	{ Q_UINT64_C(0x0e6f271b5a8b0a11), EcoNode(181, 106, 3260) },
+	{ Q_UINT64_C(0x4cdd1fb6438c9a12), EcoNode(288, 165, 14905) },
+	{ Q_UINT64_C(0x3b016d1828962a13), EcoNode(91, 1881, -1) },
+	{ Q_UINT64_C(0x9cbfd63a4f5b7a11), EcoNode(331, 0, 29105) },
+	{ Q_UINT64_C(0xb406f880db856a11), EcoNode(394, 1131, 32753) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x4f7b0081a28b4a17), EcoNode(59, 2654, 9863) },
+	{ Q_UINT64_C(0x0ecfb671f56f0a18), EcoNode(415, 2140, 3342) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x58413db08abdda1c), EcoNode(320, 17343, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xf9d00ca49969ca20), EcoNode(410, 743, -1) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x9b9482aafd139a22), EcoNode(352, 0, 28881) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x3b0348655ed27a29), EcoNode(15, 11790, -1) },
+	{ Q_UINT64_C(0xbf0e01c82c76da29), EcoNode(61, 24223, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xd638c6c0c8103a2e), EcoNode(430, 2196, 1281) },
+	{ Q_UINT64_C(0x5ef290d57294ba2f), EcoNode(1, 9311, 18506) },
+	{ Q_UINT64_C(0x9b7d13db560d2a2f), EcoNode(308, 0, 28813) },
+	{ Q_UINT64_C(0xe6ab677c709bfa31), EcoNode(2, 7094, 41399) },
+	{ Q_UINT64_C(0x69ffddc04863aa32), EcoNode(411, 20451, -1) },
+	{ Q_UINT64_C(0x450ef56bce0d9a33), EcoNode(245, 4662, 13634) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x4f89b23939190a37), EcoNode(453, 2196, 15262) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xc5adf44c64a5ea3d), EcoNode(410, 35898, -1) },
+	{ Q_UINT64_C(0xd89ab24c1b5dca3e), EcoNode(103, 2748, 12166) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x624de643ab778a40), EcoNode(200, 388, 19165) },
+	{ Q_UINT64_C(0x9fe4e7cc0be4da40), EcoNode(175, 106, 29650) },
+	{ Q_UINT64_C(0xe4c792fdc74a6a40), EcoNode(129, 106, 41039) },
+	{ Q_UINT64_C(0x727efc0af3751a43), EcoNode(416, 2140, 21998) },
+	{ Q_UINT64_C(0xf34b78b676710a44), EcoNode(162, 106, 43429) },
+	{ Q_UINT64_C(0x5e776fa5eb167a45), EcoNode(10, 613, 18300) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xab181c6d755e0a48), EcoNode(109, 5316, 31220) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x94b0207f6d904a4b), EcoNode(352, 0, 27734) },
+	{ Q_UINT64_C(0x5078897876dcda4c), EcoNode(250, 5205, 15577) },
+	{ Q_UINT64_C(0x8c745f08a1855a4d), EcoNode(244, 4022, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x23d614cdc1510a50), EcoNode(341, 0, 7472) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xe40e5dbf22ffba53), EcoNode(21, 40937, -1) },
+	{ Q_UINT64_C(0xe8dc0d90606c4a54), EcoNode(241, 2688, 6636) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x665a3353c3c20a59), EcoNode(127, 106, 19876) },
+	{ Q_UINT64_C(0xd78d18a3baadda5a), EcoNode(452, 2196, 38897) },
+	{ Q_UINT64_C(0x822c972d588f7a5b), EcoNode(237, 1445, 24855) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x17d52ab6061fba5d), EcoNode(346, 200, 5149) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x2932bf76097d7a5f), EcoNode(84, 451, 8670) },
+	{ Q_UINT64_C(0x2c3ce43158027a60), EcoNode(363, 0, 9139) },
+	{ Q_UINT64_C(0x6765f364860c6a61), EcoNode(211, 388, 20060) },
+	{ Q_UINT64_C(0x30460d457d427a62), EcoNode(249, 697, 9926) },
+	{ Q_UINT64_C(0xa916d3adee63fa60), EcoNode(5, 821, 30901) },
+	{ Q_UINT64_C(0xb658ae2d98b72a5f), EcoNode(375, 33076, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xad5da9ca479e6a67), EcoNode(227, 8473, -1) },
+	{ Q_UINT64_C(0x2e931e018f783a68), EcoNode(258, 8273, 9537) },
+	{ Q_UINT64_C(0x7aa30bf1f3d85a68), EcoNode(28, 613, 23789) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xd41239924339ea6b), EcoNode(319, 5393, 38321) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x18c794a8b162fa6f), EcoNode(250, 5205, -1) },
+	{ Q_UINT64_C(0x41ae97c7b9f29a70), EcoNode(119, 262, 13091) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xc3d088f251311a75), EcoNode(174, 106, 35345) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x1abd80b77e451a77), EcoNode(211, 388, 5433) },
+	{ Q_UINT64_C(0xaa8d97bf911d9a77), EcoNode(242, 1172, 31168) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xbcb1f375dc07da7a), EcoNode(81, 451, 34118) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xedda4aa5950d1a7c), EcoNode(314, 5393, 42448) },
+	{ Q_UINT64_C(0x00f25f4a581f4a7d), EcoNode(297, 165, 175) },
+	{ Q_UINT64_C(0x05585256a447aa7e), EcoNode(214, 388, 1053) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xaf847c7c4eafea81), EcoNode(227, 18679, -1) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x807b48a0ed95fa83), EcoNode(233, 1445, 24669) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x50345bc0ab6fda85), EcoNode(182, 106, 15437) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xb23eda7330824a87), EcoNode(239, 1445, 32380) },
+	{ Q_UINT64_C(0x1d463b3c42a16a88), EcoNode(241, 2688, 6009) },
+	{ Q_UINT64_C(0xd34591f810e93a89), EcoNode(241, 2688, 4774) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x4d5774db19058a8c), EcoNode(319, 5393, 14960) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xed7adcbdf2d31a90), EcoNode(203, 388, 42439) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x3c5047e1c5eaaa99), EcoNode(137, 106, 12250) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xaf92ea3b7a5b2a9f), EcoNode(291, 165, 31824) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x657f681cf81fdaa3), EcoNode(43, 18575, -1) },
+	{ Q_UINT64_C(0x37aa8fbefab96aa4), EcoNode(404, 1496, 11409) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xaa1c6329ce33eaa6), EcoNode(10, 613, 31069) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x78ed09353fbebaa9), EcoNode(200, 388, 23466) },
+	{ Q_UINT64_C(0xea1f548f67d40aaa), EcoNode(283, 165, 41921) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x6d5c58049cbcbaac), EcoNode(56, 21131, 21144) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x409027d3923aeaae), EcoNode(255, 4816, -1) },
+	{ Q_UINT64_C(0x787ea30d0825faae), EcoNode(245, 4662, 23402) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x7f471e2544980ab2), EcoNode(245, 4662, 16061) },
+	{ Q_UINT64_C(0xe71152b568e66ab2), EcoNode(194, 106, 41459) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x272b3a620aeb3ab5), EcoNode(32, 613, 8251) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xd8cbe5b34fa1fab7), EcoNode(323, 17343, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x8f46bbe076558abb), EcoNode(368, 0, 26956) },
+	{ Q_UINT64_C(0xdec07b0cfff56abb), EcoNode(212, 388, 40110) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x7868f645a63c7ac3), EcoNode(200, 23350, -1) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x41f8fc120f3aaac5), EcoNode(365, 0, 13176) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x007adfbc0a6fbac7), EcoNode(255, 62, 74) },
+	{ Q_UINT64_C(0x08295661dfb54ac8), EcoNode(320, 25, 1715) },
+	{ Q_UINT64_C(0x805579149e46cac9), EcoNode(222, 9077, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xaa999c5957b12acc), EcoNode(1, 9311, 31185) },
+	{ Q_UINT64_C(0xb09c096a2b0dfacd), EcoNode(241, 2688, 10947) },
+	{ Q_UINT64_C(0xe4affea96dc72acd), EcoNode(153, 106, 40962) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x1fc0f97e29f3dad0), EcoNode(229, 2275, 6454) },
+	{ Q_UINT64_C(0x8fdfec465f928ad1), EcoNode(477, 353, 27044) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x47e1e86b90e31ad7), EcoNode(417, 2140, 8054) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x4b810d7ea7c32ad9), EcoNode(57, 14734, -1) },
+	{ Q_UINT64_C(0x69aa6b7439623ada), EcoNode(254, 3314, -1) },
+	{ Q_UINT64_C(0xe72dd62da81a4ad9), EcoNode(491, 353, 41484) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x1064a577a17f2ade), EcoNode(230, 3677, 3681) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x31ea8dc9a0823ae4), EcoNode(100, 6728, 10342) },
+	{ Q_UINT64_C(0x136b9dfec8e88ae5), EcoNode(331, 0, 4292) },
+	{ Q_UINT64_C(0x296042d22c779ae5), EcoNode(330, 5393, -1) },
+	{ Q_UINT64_C(0x433a0b42babf9ae5), EcoNode(211, 388, 13454) },
+	{ Q_UINT64_C(0x47338897286d5ae4), EcoNode(255, 62, 14047) },
+	{ Q_UINT64_C(0x8a2582f584573ae7), EcoNode(386, 1131, 26074) },
+	{ Q_UINT64_C(0xbfca678c5151bae4), EcoNode(300, 34800, 34816) },
+	{ Q_UINT64_C(0x644d4afe02564aeb), EcoNode(120, 4423, -1) },
+	{ Q_UINT64_C(0x08ed9412f9302aec), EcoNode(84, 1881, 1895) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xa83dbf4d01ec7aef), EcoNode(226, 3287, 30800) },
+	{ Q_UINT64_C(0x614dba9e963d2af0), EcoNode(464, 353, 18874) },
+	{ Q_UINT64_C(0xb3a9c4b66aecbaef), EcoNode(46, 2095, 9177) },
+	{ Q_UINT64_C(0xb703655562635af0), EcoNode(251, 1912, 33251) },
+	{ Q_UINT64_C(0xef0b077fa652daf2), EcoNode(16, 613, 30422) },
+	{ Q_UINT64_C(0x649b5cbbdced4af4), EcoNode(145, 106, 3916) },
+	{ Q_UINT64_C(0x8a892602c4b5eaf5), EcoNode(347, 200, 26161) },
+	{ Q_UINT64_C(0x4e732a6fc8f41af6), EcoNode(154, 106, 15122) },
+	{ Q_UINT64_C(0x27f6a29775892af7), EcoNode(16, 613, 8415) },
+	{ Q_UINT64_C(0xfc41957918f7eaf6), EcoNode(163, 106, 44689) },
+	{ Q_UINT64_C(0x96a759d2ac040af9), EcoNode(351, 0, 28166) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x4995b474d560fafc), EcoNode(22, 613, 14405) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x22c943e3388a0b02), EcoNode(252, 1912, 7308) },
+	{ Q_UINT64_C(0xb4237848f7ebab02), EcoNode(258, 4816, -1) },
+	{ Q_UINT64_C(0xa9f2add3558b3b04), EcoNode(210, 388, 6983) },
+	{ Q_UINT64_C(0xca56e30e532e5b02), EcoNode(217, 388, 36775) },
+	{ Q_UINT64_C(0xb694e8485f295b06), EcoNode(205, 388, 12929) },
+	{ Q_UINT64_C(0xbbba5c50546b3b07), EcoNode(427, 2196, 4883) },
+	{ Q_UINT64_C(0xc6d689ab591cbb06), EcoNode(49, 353, 36201) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x08f941f0f5fe2b0b), EcoNode(252, 1912, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xf4b067f3611d2b0e), EcoNode(246, 5068, 43553) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xe5b8602ea97e8b17), EcoNode(280, 165, 41170) },
+	{ Q_UINT64_C(0x90d4ca6268550b18), EcoNode(264, 165, 27228) },
+	{ Q_UINT64_C(0xb2105b3eed55ab18), EcoNode(169, 106, 32253) },
+	{ Q_UINT64_C(0x90cc803e1acf7b1a), EcoNode(355, 0, 27211) },
+	{ Q_UINT64_C(0xe6fe63567c7e8b18), EcoNode(38, 613, 41428) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x22b4e052f18fab1d), EcoNode(400, 743, -1) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x88aba50dbd137b1f), EcoNode(241, 2688, 4774) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x8325d146e25bbb21), EcoNode(321, 25, 25137) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x297ebae1fafa9b23), EcoNode(211, 388, 8715) },
+	{ Q_UINT64_C(0x2417348d80bd5b24), EcoNode(213, 388, 7554) },
+	{ Q_UINT64_C(0xd912199feaf73b25), EcoNode(225, 3287, 39142) },
+	{ Q_UINT64_C(0xe4bd6091dff85b26), EcoNode(248, 697, 40991) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x6e80eda1632d6b29), EcoNode(280, 165, 21353) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x8b3af1bb09219b2e), EcoNode(242, 1172, 26322) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x9d4fc327f03edb30), EcoNode(436, 2196, 29270) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xab5c20f58357ab32), EcoNode(231, 3677, 31276) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xeb05e1aa3830db34), EcoNode(253, 3314, 42191) },
+	{ Q_UINT64_C(0xc6f001a502d40b35), EcoNode(425, 2196, 36243) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xa3553dce297deb37), EcoNode(342, 0, 30114) },
+	{ Q_UINT64_C(0x1b7e13263fc0ab38), EcoNode(250, 1732, -1) },
+	{ Q_UINT64_C(0xaee58587d80f3b38), EcoNode(223, 791, 31769) },
+	{ Q_UINT64_C(0x236e7c997a5d9b3a), EcoNode(120, 106, 7440) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x36830aa43c8f5b3c), EcoNode(241, 2688, 11300) },
+	{ Q_UINT64_C(0x7c1318d279aa7b3c), EcoNode(35, 613, 8251) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xc1b6c7e36ff0fb40), EcoNode(261, 165, 35036) },
+	{ Q_UINT64_C(0xbec49d2665c56b41), EcoNode(251, 34579, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x39572234d098bb47), EcoNode(335, 0, 11554) },
+	{ Q_UINT64_C(0x3a469e6b28127b47), EcoNode(355, 0, 11638) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xf03bb643963a3b4d), EcoNode(239, 1445, 42986) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x505c7abe12414b4f), EcoNode(244, 4662, 15532) },
+	{ Q_UINT64_C(0x54c31263e9ad3b4f), EcoNode(50, 743, -1) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x68beea8b14611b52), EcoNode(57, 2654, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xea853a08150fdb56), EcoNode(238, 1445, 42046) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x7639453c2f780b5a), EcoNode(227, 18679, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x4809e32eee442b5d), EcoNode(255, 14219, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x49b5a1bde9c1eb60), EcoNode(254, 3314, 14428) },
+	{ Q_UINT64_C(0x6550193432b5fb61), EcoNode(480, 353, 4883) },
+	{ Q_UINT64_C(0x1fdec940960c0b62), EcoNode(242, 1172, 6563) },
+	{ Q_UINT64_C(0x5a6baa2e14c61b63), EcoNode(118, 262, 17621) },
+	{ Q_UINT64_C(0x6def61933e09fb62), EcoNode(14, 613, 21199) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xd4c4c0137eb7fb68), EcoNode(253, 3314, 38546) },
+	{ Q_UINT64_C(0x220349a1f9e52b69), EcoNode(244, 7002, -1) },
+	{ Q_UINT64_C(0x39b3e62fe28c4b6a), EcoNode(348, 200, 11624) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xea0934f6dc640b6d), EcoNode(232, 3677, 41892) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x27bcd3eeeb04db70), EcoNode(250, 3434, 8394) },
+	{ Q_UINT64_C(0xd418e22b63fb9b70), EcoNode(240, 38347, -1) },
+	{ Q_UINT64_C(0xfa2846501c830b70), EcoNode(216, 388, 44351) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xf3d38bb8ac163b79), EcoNode(225, 18679, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xf053b46e12561b7c), EcoNode(83, 451, 43098) },
+	{ Q_UINT64_C(0xfa0142b5f23d1b7d), EcoNode(233, 1445, 44303) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x1ebada711a284b80), EcoNode(45, 6247, -1) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x17f246fa401a2b82), EcoNode(241, 2688, 5165) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xc95e54397292bb84), EcoNode(140, 4423, -1) },
+	{ Q_UINT64_C(0x07475aa039f8cb85), EcoNode(408, 1496, 1504) },
+	{ Q_UINT64_C(0x24be6dd52f33bb85), EcoNode(287, 165, 7781) },
+	{ Q_UINT64_C(0x475e79a8bc88ab85), EcoNode(250, 5205, 8293) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x614ebc9393c68b89), EcoNode(227, 3287, 5487) },
+	{ Q_UINT64_C(0x1b2a6f7e9fd8bb8a), EcoNode(251, 1912, 5506) },
+	{ Q_UINT64_C(0x35028f47dea98b8a), EcoNode(269, 165, 10962) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xc6cac3d6d34f5b8f), EcoNode(327, 25, 1053) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x7ef7a45eff575b93), EcoNode(251, 24312, -1) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x32b2cc013d852b95), EcoNode(56, 10489, -1) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x5d7b9d7bb6813b97), EcoNode(66, 3028, 18077) },
+	{ Q_UINT64_C(0xed110abfaf5bbb97), EcoNode(37, 613, 28749) },
+	{ Q_UINT64_C(0xfc99c0d1bcb65b97), EcoNode(35, 613, 44792) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x82a3f5c7e6bcab9e), EcoNode(102, 2748, 24955) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x57e3b574edd26ba0), EcoNode(30, 613, 17203) },
+	{ Q_UINT64_C(0x9e2154d673aefba1), EcoNode(125, 106, 29364) },
+	{ Q_UINT64_C(0xc4fcc0d7e2635ba1), EcoNode(38, 613, 35604) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x2e7d03da2fa32ba5), EcoNode(458, 2196, 9507) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x0af2944fbc931ba9), EcoNode(397, 1131, 2432) },
+	{ Q_UINT64_C(0x856920a559b2bbaa), EcoNode(239, 1445, 25499) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x9f7bef421f63cbad), EcoNode(244, 4022, 29600) },
+	{ Q_UINT64_C(0xfe06ae1efc34abad), EcoNode(234, 1445, 44923) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x0deb43b6cccfbbb1), EcoNode(233, 1445, 3082) },
+	{ Q_UINT64_C(0xc59d2ba1461e5bb2), EcoNode(231, 3677, 35840) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x1c0d67a1d8b4abb8), EcoNode(98, 451, 5680) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x34d3e3bb02740bbf), EcoNode(7, 821, 10895) },
+	{ Q_UINT64_C(0x73a52408ff286bc0), EcoNode(244, 4662, 22243) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x71c569b85e392bc2), EcoNode(355, 0, 21828) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x4dc3b524c4e26bc4), EcoNode(352, 0, -1) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x76edafb2e2fb5bc6), EcoNode(302, 22870, -1) },
+	{ Q_UINT64_C(0xc45657b95a41fbc6), EcoNode(257, 8273, 35421) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xd43f40c9a601bbcd), EcoNode(292, 165, 38361) },
+	{ Q_UINT64_C(0x5bfaa971f9820bce), EcoNode(21, 17900, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x2aa7cdb0269b7bd1), EcoNode(244, 8936, -1) },
+	{ Q_UINT64_C(0x735953bb690a1bd2), EcoNode(242, 22137, -1) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x77766c70147bbbd4), EcoNode(102, 2748, 23090) },
+	{ Q_UINT64_C(0x554b7319b998abd5), EcoNode(234, 1445, 16651) },
+	{ Q_UINT64_C(0x5a3031106e1cfbd6), EcoNode(339, 0, 17595) },
+	{ Q_UINT64_C(0xb12610fefa83abd5), EcoNode(315, 32193, -1) },
+	{ Q_UINT64_C(0xbf29a6086ab02bd6), EcoNode(127, 4423, -1) },
+	{ Q_UINT64_C(0xc1548d227d400bd7), EcoNode(112, 262, 34980) },
+	{ Q_UINT64_C(0x4adfabd7fbc45bda), EcoNode(118, 262, 333) },
+	{ Q_UINT64_C(0xce62188d855afbd5), EcoNode(241, 2688, 37414) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x46e0599a50c02bdd), EcoNode(461, 13946, -1) },
+	{ Q_UINT64_C(0x5f56087370489bde), EcoNode(160, 106, 18522) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xc5a36f46d7c55be0), EcoNode(227, 3287, 35865) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xc546907aa15b2be3), EcoNode(280, 165, 35794) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x9b5f1c25aaf85be5), EcoNode(241, 2688, 28788) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x66f77fa2dc851be7), EcoNode(246, 697, 19990) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x95963fa8aa955be9), EcoNode(244, 27992, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x244c7c8a92bbcbec), EcoNode(237, 1445, 7602) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x3fc45c6f68b47bf1), EcoNode(386, 1131, 12750) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xf2cdfcd87be9bbf3), EcoNode(223, 791, 43327) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x14db4274384d0bf6), EcoNode(242, 1172, 4440) },
+	{ Q_UINT64_C(0x61ed25f7d0eb4bf7), EcoNode(352, 0, 19000) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x4329a05d1c98bbf9), EcoNode(250, 5205, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xdbeeadaa193eebfd), EcoNode(244, 4022, 39693) },
+	{ Q_UINT64_C(0x24c5235d155ddbfe), EcoNode(180, 106, 7808) },
+	{ Q_UINT64_C(0xa72ddab3f89dcbfe), EcoNode(364, 0, 30624) },
+	{ Q_UINT64_C(0x1761df2bb9d0fc00), EcoNode(80, 451, -1) },
+	{ Q_UINT64_C(0xb3808929debc8c00), EcoNode(251, 1912, 32669) },
+	{ Q_UINT64_C(0x907648b47ec9dc02), EcoNode(45, 27069, -1) },
+	{ Q_UINT64_C(0xb4c610b16230bc00), EcoNode(279, 165, 32832) },
+	{ Q_UINT64_C(0x46765f911f851c04), EcoNode(0, 3467, 13828) },
+	{ Q_UINT64_C(0xb0fbaa7cd799ac04), EcoNode(149, 106, 3916) },
+	{ Q_UINT64_C(0x51d2bf21d3e37c06), EcoNode(200, 388, 15877) },
+	{ Q_UINT64_C(0x953255cd63ac4c07), EcoNode(106, 1518, 27900) },
+	{ Q_UINT64_C(0xb71d978d7747ac07), EcoNode(483, 353, 33332) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x495b878732817c0c), EcoNode(258, 4816, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x2daa354a42c67c14), EcoNode(79, 3028, 9390) },
+	{ Q_UINT64_C(0xf73c442a7d3c8c15), EcoNode(45, 19047, -1) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x1e045c54df2b4c17), EcoNode(260, 165, 6183) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x7b6787fc16500c20), EcoNode(101, 20221, -1) },
+	{ Q_UINT64_C(0xe1e0c4aad071bc20), EcoNode(258, 8273, -1) },
+	{ Q_UINT64_C(0x9a296ff4031cbc22), EcoNode(264, 165, 28594) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x2707444472a8cc28), EcoNode(472, 8165, -1) },
+	{ Q_UINT64_C(0x5464fe41b0cbfc29), EcoNode(417, 2140, 16361) },
+	{ Q_UINT64_C(0x9a138dd21f33bc2a), EcoNode(350, 0, 28588) },
+	{ Q_UINT64_C(0xd64538f5474bec2b), EcoNode(231, 3677, 38793) },
+	{ Q_UINT64_C(0xca610a9071402c2c), EcoNode(109, 5316, 36798) },
+	{ Q_UINT64_C(0x5bd45f5877fe1c2d), EcoNode(347, 200, 17878) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x8cc671a898349c30), EcoNode(349, 200, 3805) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x1181f688e04dac32), EcoNode(266, 165, 3886) },
+	{ Q_UINT64_C(0xe39b2731c3db1c32), EcoNode(242, 1172, 40890) },
+	{ Q_UINT64_C(0x046e07a6c33e3c34), EcoNode(52, 919, 965) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xa03eaa15fb90ac36), EcoNode(410, 29708, -1) },
+	{ Q_UINT64_C(0xc6b14e1bd38ddc37), EcoNode(5, 5192, -1) },
+	{ Q_UINT64_C(0xfbd062917a039c38), EcoNode(242, 1172, 37634) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x21bcd21bb87c3c3e), EcoNode(101, 4050, 6983) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x16a20ba64d54cc41), EcoNode(440, 2196, 4902) },
+	{ Q_UINT64_C(0xa945fba8bdfeec41), EcoNode(121, 106, 30966) },
+	{ Q_UINT64_C(0xb4df106d89d2cc41), EcoNode(467, 353, 32876) },
+	{ Q_UINT64_C(0xf591821e8dd02c41), EcoNode(3, 12524, 5376) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x5db5448e016c8c47), EcoNode(341, 0, 18137) },
+	{ Q_UINT64_C(0x1653fdc943996c48), EcoNode(100, 4865, -1) },
+	{ Q_UINT64_C(0xcb8e0b6529afac49), EcoNode(226, 18679, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x095d146cfca2ec4d), EcoNode(200, 388, 2022) },
+	{ Q_UINT64_C(0xd440ef1894339c4d), EcoNode(127, 106, 38387) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x5adaa46997336c50), EcoNode(394, 17702, -1) },
+	{ Q_UINT64_C(0x634739a29c5bcc50), EcoNode(196, 106, 19448) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x5ffdf34ca4256c55), EcoNode(43, 18575, -1) },
+	{ Q_UINT64_C(0xa2a725fa09987c56), EcoNode(260, 165, 29893) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x568c1f717710cc58), EcoNode(249, 697, 16864) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x47cd36fcffadbc5a), EcoNode(136, 106, 14174) },
+	{ Q_UINT64_C(0x5dbbce98ac6c3c5b), EcoNode(239, 1445, 18179) },
+	{ Q_UINT64_C(0xbd4962cbaa8d1c5b), EcoNode(172, 106, 34218) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xf85266a6bbc26c5f), EcoNode(249, 697, 7053) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x370b9c31a3fddc61), EcoNode(164, 106, 11348) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x78bfb076459d8c64), EcoNode(408, 1496, 23419) },
+	{ Q_UINT64_C(0xec0f9b2019323c64), EcoNode(245, 12973, -1) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xf509fbd2dcc79c67), EcoNode(232, 3677, 43660) },
+	{ Q_UINT64_C(0x3a80900f66be8c68), EcoNode(345, 200, 11721) },
+	{ Q_UINT64_C(0x0f44908a2e5b7c69), EcoNode(477, 353, 3417) },
+	{ Q_UINT64_C(0xcde18a9bff720c68), EcoNode(258, 8273, 23090) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x7b4211b450303c6f), EcoNode(476, 353, 23904) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x1e28a6dac36bfc72), EcoNode(210, 388, 928) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xe5f30ad53b2c9c74), EcoNode(242, 1172, 41195) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x5518f3e073767c77), EcoNode(367, 0, 16624) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x5b4bdd9dc26f0c7c), EcoNode(229, 2275, 10947) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x1b98e6d6cae0ac85), EcoNode(107, 5316, 5551) },
+	{ Q_UINT64_C(0x317e46cbf4fafc86), EcoNode(200, 3485, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xffaa63cd99980c89), EcoNode(296, 165, 45280) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xab2bd54487e93c8b), EcoNode(252, 1912, 47) },
+	{ Q_UINT64_C(0x2cec27e2335b9c8c), EcoNode(1, 9311, 9335) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x398c2d2e700d7c8f), EcoNode(46, 11588, -1) },
+	{ Q_UINT64_C(0x73fc02f0d8b51c8f), EcoNode(18, 613, 22379) },
+	{ Q_UINT64_C(0xb493c67df6896c90), EcoNode(473, 353, 15421) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x3894a69845743c98), EcoNode(124, 106, 11528) },
+	{ Q_UINT64_C(0x91df18507e2b0c98), EcoNode(46, 2095, 27413) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x9d74552daf835c9e), EcoNode(93, 451, 29301) },
+	{ Q_UINT64_C(0x03cd62a60f450c9f), EcoNode(280, 165, 768) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xe395cdae6951aca1), EcoNode(233, 1445, 40856) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x089ee5460e59aca4), EcoNode(277, 165, 1785) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x7432ce4693770ca6), EcoNode(120, 106, 22411) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x0db51a9bac1d2cb1), EcoNode(115, 262, 3062) },
+	{ Q_UINT64_C(0x21b275e810effcb1), EcoNode(99, 451, 6950) },
+	{ Q_UINT64_C(0x2fafc627c5a3bcb2), EcoNode(241, 9765, -1) },
+	{ Q_UINT64_C(0x2c74513cee07acb4), EcoNode(378, 9190, -1) },
+	{ Q_UINT64_C(0x70fb084546e22cb3), EcoNode(251, 1912, 21710) },
+	{ Q_UINT64_C(0x8bec103fa9325cb4), EcoNode(101, 26490, -1) },
+	{ Q_UINT64_C(0xf9be3737ce90ecb1), EcoNode(242, 1172, 44253) },
+	{ Q_UINT64_C(0x53ce633b674d4cb8), EcoNode(282, 165, 16134) },
+	{ Q_UINT64_C(0x6f0fa80ea2642cb8), EcoNode(140, 106, 18117) },
+	{ Q_UINT64_C(0x524e9a0ed13f6cba), EcoNode(385, 1131, 4774) },
+	{ Q_UINT64_C(0xec68caf876584cba), EcoNode(198, 106, 42360) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xf98dcadd3177bcbd), EcoNode(223, 791, 44229) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x4482632e4ad4dcc0), EcoNode(245, 4662, 13454) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x2689ba28c4f60cc5), EcoNode(212, 388, 8075) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xbb570568d344acc7), EcoNode(241, 2688, 33887) },
+	{ Q_UINT64_C(0x29a01b374dca3cc8), EcoNode(97, 451, 8741) },
+	{ Q_UINT64_C(0x003f0cc84b66ccc9), EcoNode(308, 0, 4) },
+	{ Q_UINT64_C(0x11b7c6a6588b2cc9), EcoNode(460, 353, 3972) },
+	{ Q_UINT64_C(0x4591a27230a50cc8), EcoNode(219, 388, 13661) },
+	{ Q_UINT64_C(0x68e17ff17b6a8cca), EcoNode(107, 5316, 20349) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x4df3cd0a16f41cd0), EcoNode(56, 15043, -1) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x8371af7b4c41bcd2), EcoNode(267, 165, 25228) },
+	{ Q_UINT64_C(0xb0fa20b77f873cd2), EcoNode(252, 1912, 32140) },
+	{ Q_UINT64_C(0x3faa5b73172e8cd4), EcoNode(50, 12723, -1) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x01c12aa7c739acd6), EcoNode(473, 353, 367) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x9b7fabd02125bcda), EcoNode(122, 106, 28854) },
+	{ Q_UINT64_C(0xb2923fa1e0a56cdb), EcoNode(425, 2196, 4883) },
+	{ Q_UINT64_C(0x512fd77bd691ccdc), EcoNode(358, 0, 15696) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x0a1194ae6d2e0ce0), EcoNode(229, 2275, 2289) },
+	{ Q_UINT64_C(0xc11c7bc0c4440ce1), EcoNode(242, 1172, 34966) },
+	{ Q_UINT64_C(0x05fe9ce0cc7d5ce2), EcoNode(86, 451, 1281) },
+	{ Q_UINT64_C(0xc247c4898c01ece3), EcoNode(112, 35168, -1) },
+	{ Q_UINT64_C(0xe0192d21a9636ce2), EcoNode(22, 5714, -1) },
+	{ Q_UINT64_C(0xe30ad3a79cf56ce3), EcoNode(40, 40709, -1) },
+	{ Q_UINT64_C(0x2c69d892aad95ce6), EcoNode(30, 613, 8251) },
+	{ Q_UINT64_C(0x42d61a6bb298ace6), EcoNode(236, 1445, 13315) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x62f30d195cad1ceb), EcoNode(156, 106, 19332) },
+	{ Q_UINT64_C(0xf49d70a9f48beceb), EcoNode(28, 613, 43533) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xb1fedf5895e33cee), EcoNode(165, 106, 29484) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x05beff6602437cf8), EcoNode(22, 613, 1211) },
+	{ Q_UINT64_C(0x0c17404e1a899cf9), EcoNode(103, 2748, -1) },
+	{ Q_UINT64_C(0x77356d332c7b7cf9), EcoNode(325, 23008, -1) },
+	{ Q_UINT64_C(0xafe00f50106dbcf8), EcoNode(244, 4662, 15473) },
+	{ Q_UINT64_C(0x6780bd452cc80cfc), EcoNode(448, 2196, 20174) },
+	{ Q_UINT64_C(0xd35f110631289cfb), EcoNode(307, 0, 38239) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x8968d9df39841cff), EcoNode(239, 1445, 26026) },
+	{ Q_UINT64_C(0x0651d25c9ca91d00), EcoNode(376, 1301, -1) },
+	{ Q_UINT64_C(0xa72f95130eddccff), EcoNode(102, 2748, 30676) },
+	{ Q_UINT64_C(0x1e0688f11b0cbd02), EcoNode(142, 106, 6199) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xc1ddc693acd0fd05), EcoNode(360, 0, 9139) },
+	{ Q_UINT64_C(0x04262e919e8d4d06), EcoNode(100, 900, -1) },
+	{ Q_UINT64_C(0xe4f4a8fa26c75d06), EcoNode(245, 4662, 5448) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xd6cc2d06ef538d09), EcoNode(265, 165, 38808) },
+	{ Q_UINT64_C(0xe1d63fbffd042d09), EcoNode(332, 0, 2570) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x6aeeecf7aeee6d0c), EcoNode(246, 5068, 13454) },
+	{ Q_UINT64_C(0xf00b41b6aa8c1d0d), EcoNode(280, 165, 42927) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x12339db7a2f65d10), EcoNode(40, 2095, 4036) },
+	{ Q_UINT64_C(0x3365a142dac26d11), EcoNode(397, 1131, 10582) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x7af617819f8b3d17), EcoNode(390, 1131, 23845) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xf973d836f92fcd1d), EcoNode(381, 1131, 27607) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xbe091857d87ddd1f), EcoNode(13, 613, 34457) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xfdf38304596e1d21), EcoNode(300, 2095, 19165) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x7441f2d26859fd24), EcoNode(241, 2688, 22443) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xcaadd975eacfbd26), EcoNode(142, 106, 36849) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x9d8a3633cb40ad28), EcoNode(213, 388, 29332) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xccbc30c07beedd2a), EcoNode(100, 37156, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xe9e11b7fdd364d2d), EcoNode(415, 2140, 928) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x115894956c871d2f), EcoNode(12, 613, 3843) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x34378abed1256d31), EcoNode(123, 106, 10819) },
+	{ Q_UINT64_C(0xbb7acb577b72fd31), EcoNode(451, 2196, 33944) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x39a691df7150ed3e), EcoNode(58, 11602, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xc50cb8b1b9ab5d45), EcoNode(344, 200, 35686) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x8cbf8d2d4a3fbd48), EcoNode(455, 2196, 26620) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x572815926ce63d50), EcoNode(308, 0, 17038) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xeb6a5af61d0f2d52), EcoNode(248, 697, 42261) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x7bad8c9142d77d55), EcoNode(45, 2095, 23957) },
+	{ Q_UINT64_C(0x271aaf451eb51d56), EcoNode(130, 106, 8208) },
+	{ Q_UINT64_C(0xa343d53ca1b78d57), EcoNode(446, 2196, 30094) },
+	{ Q_UINT64_C(0x22a016b116cc4d58), EcoNode(309, 0, 7176) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xc68b054d93913d5f), EcoNode(334, 0, 36110) },
+	{ Q_UINT64_C(0x775fd85ec93ced60), EcoNode(344, 200, 23072) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x84991fbaccc30d68), EcoNode(43, 18575, -1) },
+	{ Q_UINT64_C(0xd286ed2a947e5d69), EcoNode(239, 1445, 38053) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x7751fa22d9981d6f), EcoNode(33, 613, 8251) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x095e6d0c6f663d72), EcoNode(306, 0, 2046) },
+	{ Q_UINT64_C(0x0241ce7619a38d73), EcoNode(83, 451, 457) },
+	{ Q_UINT64_C(0xbbf719d404992d74), EcoNode(21, 5714, -1) },
+	{ Q_UINT64_C(0xcd37113f2b7f0d75), EcoNode(4, 821, 37266) },
+	{ Q_UINT64_C(0x35cc5b3c2be56d76), EcoNode(394, 1131, 11214) },
+	{ Q_UINT64_C(0xb70673e716926d77), EcoNode(80, 33265, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x32f2da2bc4f28d7c), EcoNode(385, 1131, 10522) },
+	{ Q_UINT64_C(0x325b696440075d7d), EcoNode(470, 353, 10484) },
+	{ Q_UINT64_C(0xab19cb3fa2d7bd7e), EcoNode(221, 31236, -1) },
+	{ Q_UINT64_C(0xe69df64ecf695d7d), EcoNode(283, 165, 41379) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x1d7ec054f0368d81), EcoNode(271, 165, 6057) },
+	{ Q_UINT64_C(0x871d3c6536d98d81), EcoNode(335, 0, 25669) },
+	{ Q_UINT64_C(0xa17be3eb6a4cdd82), EcoNode(432, 2196, 333) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x745c615e8eb08d86), EcoNode(315, 5393, 22474) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x018137fd250fad8d), EcoNode(326, 25, 333) },
+	{ Q_UINT64_C(0x72cbbc9329253d8d), EcoNode(104, 2748, 22078) },
+	{ Q_UINT64_C(0x8d6f8f2929271d8e), EcoNode(39, 613, 26730) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xcac927bbeca72d91), EcoNode(403, 1496, 36872) },
+	{ Q_UINT64_C(0x71f3ccd9b3d55d92), EcoNode(249, 697, 21848) },
+	{ Q_UINT64_C(0x75e8a3d25c128d93), EcoNode(251, 1912, 13454) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xe23afe58229c0d96), EcoNode(239, 1445, 40516) },
+	{ Q_UINT64_C(0xef282444cfcafd96), EcoNode(272, 165, 42668) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x0e3352aa01b5ad99), EcoNode(17, 613, 3171) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x78cda70e17837d9e), EcoNode(244, 1732, -1) },
+	{ Q_UINT64_C(0x1c9622d153442d9f), EcoNode(251, 5839, -1) },
+	{ Q_UINT64_C(0x41539a4a1acefda0), EcoNode(270, 165, 13019) },
+	{ Q_UINT64_C(0x9d5f7aee7e779da1), EcoNode(4, 5192, -1) },
+	{ Q_UINT64_C(0x615ce7bc38180da2), EcoNode(340, 0, 18902) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x103f9237eb05dda6), EcoNode(126, 106, 3594) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xef5ee7944e699da9), EcoNode(398, 1131, 42751) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x69d2f985fe449dab), EcoNode(310, 5393, 20398) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x3bc1c9e50d45bdaf), EcoNode(0, 12060, 12076) },
+	{ Q_UINT64_C(0xdea2a534b3dbadaf), EcoNode(183, 106, 40064) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xdcffc39723ecadb4), EcoNode(244, 39855, -1) },
+	{ Q_UINT64_C(0xdc58a8ad9af3ddb5), EcoNode(499, 353, 39772) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x304e367439a3ddb8), EcoNode(312, 5393, 4774) },
+	{ Q_UINT64_C(0x35ac01aa81e33db8), EcoNode(324, 11188, -1) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x92b945b467ea7dbb), EcoNode(412, 20375, -1) },
+	{ Q_UINT64_C(0x164e942a016e2dbc), EcoNode(239, 1445, 4836) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xbe5934bc0d347dbf), EcoNode(308, 0, 34516) },
+	{ Q_UINT64_C(0xb87a994f94c05dc0), EcoNode(345, 200, 1141) },
+	{ Q_UINT64_C(0x25f6f04ab333adc1), EcoNode(45, 8011, -1) },
+	{ Q_UINT64_C(0x6d427c500aa5fdc1), EcoNode(0, 21086, 21093) },
+	{ Q_UINT64_C(0xf0ded8d3fc104dc0), EcoNode(212, 388, 43177) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x30c31c4876ac4dcc), EcoNode(265, 165, 9990) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xf3a9cff7c80fddcf), EcoNode(282, 165, 43474) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xdde9137e02887dd7), EcoNode(416, 2140, 40014) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xf6a169b6a8e8edda), EcoNode(249, 697, 43848) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xe31222bb50dcdde2), EcoNode(471, 353, 40724) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xef8df0d9bfd41de4), EcoNode(436, 2196, 42776) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x611114d566e78de9), EcoNode(201, 388, 18843) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x3c173617a34b6df3), EcoNode(248, 697, 12224) },
+	{ Q_UINT64_C(0xcad32a50306d4df4), EcoNode(373, 36897, -1) },
+	{ Q_UINT64_C(0x9ef54e8458436df5), EcoNode(219, 388, 29541) },
+	{ Q_UINT64_C(0x0c368da9b1327df6), EcoNode(113, 262, 2767) },
+	{ Q_UINT64_C(0x5732af0171663df6), EcoNode(266, 165, 17077) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x977feffd761d1dfb), EcoNode(421, 2196, 28216) },
+	{ Q_UINT64_C(0x7a37501ff2299dfc), EcoNode(244, 23708, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xd28637e416b87dff), EcoNode(245, 4662, 8394) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x989ffeede38fde01), EcoNode(362, 0, 28448) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xdbd66edd12312e0c), EcoNode(87, 451, 39667) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x08871e46c5930e14), EcoNode(237, 1445, 1765) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xc3957d3b692c9e18), EcoNode(265, 165, 35309) },
+	{ Q_UINT64_C(0xbf157b8c88365e19), EcoNode(245, 4662, 34676) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xdaef6e1297107e1b), EcoNode(316, 32193, 21047) },
+	{ Q_UINT64_C(0x027f6b8d69a5be1c), EcoNode(100, 493, -1) },
+	{ Q_UINT64_C(0x4b1376a17217ee1d), EcoNode(260, 14559, -1) },
+	{ Q_UINT64_C(0x44fede6e2b123e1e), EcoNode(107, 11396, -1) },
+	{ Q_UINT64_C(0x3d965402f9b8ce1f), EcoNode(253, 3314, -1) },
+	{ Q_UINT64_C(0xb60e32a6b341be1c), EcoNode(232, 3677, 33033) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x263f3012dd129e22), EcoNode(182, 106, 8026) },
+	{ Q_UINT64_C(0x06dd0cef4e508e23), EcoNode(239, 1445, 1449) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xb6919cd2ef647e28), EcoNode(102, 2748, 33182) },
+	{ Q_UINT64_C(0x0d54b90dc4170e29), EcoNode(278, 165, 2956) },
+	{ Q_UINT64_C(0x5ca68cd7b996de2a), EcoNode(108, 5316, 17985) },
+	{ Q_UINT64_C(0xfced72369a1c6e29), EcoNode(344, 200, 44825) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x71712b146a7a6e32), EcoNode(255, 21789, -1) },
+	{ Q_UINT64_C(0x05d02cb87c9ebe33), EcoNode(380, 1131, 1234) },
+	{ Q_UINT64_C(0x794b4eae9e4efe32), EcoNode(372, 23552, -1) },
+	{ Q_UINT64_C(0xa935889305059e33), EcoNode(245, 4662, 30946) },
+	{ Q_UINT64_C(0xee2cbbb8d3612e34), EcoNode(257, 8273, 42543) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x3ea89d30a7061e38), EcoNode(112, 262, 12631) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x4633aad6b4890e3d), EcoNode(105, 2748, 13735) },
+	{ Q_UINT64_C(0xa67d9243a753ae3e), EcoNode(43, 30464, -1) },
+	{ Q_UINT64_C(0xc0b9afe525824e3d), EcoNode(253, 3314, -1) },
+	{ Q_UINT64_C(0xd7fec030683bde3f), EcoNode(34, 613, 8251) },
+	{ Q_UINT64_C(0xad03bd3abedc8e41), EcoNode(327, 25, 31464) },
+	{ Q_UINT64_C(0xe7bb0386e525de3f), EcoNode(216, 388, 395) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xbdac8ebad4737e45), EcoNode(0, 11465, -1) },
+	{ Q_UINT64_C(0x2847889d8803be46), EcoNode(217, 388, 8537) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xe5ed05ea68fbde48), EcoNode(313, 5393, 4774) },
+	{ Q_UINT64_C(0xac989c238f32ee49), EcoNode(316, 5393, 31423) },
+	{ Q_UINT64_C(0xb46963f301561e49), EcoNode(42, 32812, -1) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xad1d698452931e4c), EcoNode(94, 451, 31507) },
+	{ Q_UINT64_C(0xff2eca81f83c9e4c), EcoNode(50, 45135, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x6d555766fc715e51), EcoNode(245, 4662, 21113) },
+	{ Q_UINT64_C(0xd3704b90e4e74e51), EcoNode(235, 1445, 38302) },
+	{ Q_UINT64_C(0x23d575f7bd002e53), EcoNode(492, 353, 333) },
+	{ Q_UINT64_C(0xd590f8db845cce51), EcoNode(227, 3287, 38643) },
+	{ Q_UINT64_C(0xd96b1da0a67a3e55), EcoNode(249, 697, -1) },
+	{ Q_UINT64_C(0x9a9abbb2cf5e5e56), EcoNode(352, 0, 28657) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x64f51687b15a6e58), EcoNode(233, 1445, 19685) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xf7c70eacda0a9e5a), EcoNode(281, 165, 44040) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x058c874168a1de5c), EcoNode(268, 165, 1146) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x523cfba827708e61), EcoNode(289, 165, 15941) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x90ee4d599a12fe63), EcoNode(279, 165, 27315) },
+	{ Q_UINT64_C(0x831d6f1b45929e64), EcoNode(26, 613, 25120) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x24e9fade0b3d5e6a), EcoNode(351, 0, 5487) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xb7425fdf9ac00e74), EcoNode(102, 2748, 24238) },
+	{ Q_UINT64_C(0xbb183e9f41431e74), EcoNode(244, 422, 33872) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xa2ea2b4915eafe79), EcoNode(409, 1496, 30018) },
+	{ Q_UINT64_C(0x583e535abd879e7a), EcoNode(225, 17312, -1) },
+	{ Q_UINT64_C(0x118cd876319c1e7b), EcoNode(148, 106, 3916) },
+	{ Q_UINT64_C(0xd4a4bbd662bb0e7c), EcoNode(289, 165, 38522) },
+	{ Q_UINT64_C(0xf309fde4ccbb2e7d), EcoNode(277, 165, 43373) },
+	{ Q_UINT64_C(0x40213938a495ce7e), EcoNode(123, 106, 12789) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xdc2c54d47c8afe81), EcoNode(106, 6157, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x4a2091fd0f16de84), EcoNode(14, 613, 14495) },
+	{ Q_UINT64_C(0xe8784f7afb91fe84), EcoNode(202, 388, 41762) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x6a83390e86bbfe87), EcoNode(247, 697, 20624) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x1adb2c790d58de89), EcoNode(244, 422, 5448) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x638a82bec3095e8b), EcoNode(257, 8273, 19525) },
+	{ Q_UINT64_C(0x2a0114b4b36b3e8c), EcoNode(233, 1445, 8850) },
+	{ Q_UINT64_C(0xdc3255b209236e8d), EcoNode(6, 39735, -1) },
+	{ Q_UINT64_C(0x63bec3cf71fd2e8e), EcoNode(252, 1912, 19561) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x301913c7eb4d2e90), EcoNode(224, 791, 3828) },
+	{ Q_UINT64_C(0x9b04ed80ae9dce90), EcoNode(20, 28689, -1) },
+	{ Q_UINT64_C(0xcd5a4325af512e90), EcoNode(101, 4050, 37345) },
+	{ Q_UINT64_C(0xb98e490b8bfe7e93), EcoNode(103, 2748, -1) },
+	{ Q_UINT64_C(0xaed80f488f356e94), EcoNode(229, 2275, 31750) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xd6023f8abfd1ee96), EcoNode(223, 791, 38717) },
+	{ Q_UINT64_C(0x7ed377c7d8500e97), EcoNode(420, 2196, 24238) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x41e93c4b5069fe9b), EcoNode(172, 106, 13162) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x2c6645c51e7e0e9f), EcoNode(150, 106, 9156) },
+	{ Q_UINT64_C(0x3b6e1bc89bb43e9f), EcoNode(2, 7094, 11994) },
+	{ Q_UINT64_C(0x7799067f9855be9f), EcoNode(482, 353, 23156) },
+	{ Q_UINT64_C(0xc994f44803272ea0), EcoNode(174, 106, 36693) },
+	{ Q_UINT64_C(0xe68c77f1a9ca4ea0), EcoNode(90, 1881, 41342) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x20b16a51c7a2dea8), EcoNode(100, 6728, 6731) },
+	{ Q_UINT64_C(0xd5501fe2e563dea8), EcoNode(331, 0, 4709) },
+	{ Q_UINT64_C(0x584faa4cbd576eaa), EcoNode(230, 3677, 333) },
+	{ Q_UINT64_C(0xa11f4cadad02beaa), EcoNode(397, 1131, 29800) },
+	{ Q_UINT64_C(0x82a41cf53a8e7eac), EcoNode(113, 262, 24989) },
+	{ Q_UINT64_C(0xcb8a09b65e83cead), EcoNode(115, 262, 37075) },
+	{ Q_UINT64_C(0xb6c5d90e56d4ceae), EcoNode(103, 2748, 33211) },
+	{ Q_UINT64_C(0xec4acfbbb7f2cea9), EcoNode(86, 42341, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x78617cfc935a5eb3), EcoNode(473, 353, 23344) },
+	{ Q_UINT64_C(0x9614dd8ada0f0eb4), EcoNode(233, 1445, 28076) },
+	{ Q_UINT64_C(0xdbb5492bf313deb5), EcoNode(237, 1445, 39636) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x0fc75c0c3a0d3eb8), EcoNode(0, 3467, 3472) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x3a7a1765357cbebb), EcoNode(166, 106, 11683) },
+	{ Q_UINT64_C(0x881980574b64cebc), EcoNode(12, 613, 25831) },
+	{ Q_UINT64_C(0x9c6e1a40cc53aebc), EcoNode(261, 165, 29063) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x1218d67f6ec2debf), EcoNode(244, 4022, -1) },
+	{ Q_UINT64_C(0xd9edfb235763aebf), EcoNode(233, 1445, 39419) },
+	{ Q_UINT64_C(0x11757a6516817ec1), EcoNode(82, 451, 3870) },
+	{ Q_UINT64_C(0xcc0f2d4a7e80cec2), EcoNode(280, 165, 37101) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xdd007750f36afec5), EcoNode(302, 743, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x5a25e99e6ca15eca), EcoNode(252, 1912, 17556) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x9f9d15b4b2bceecd), EcoNode(266, 165, 29615) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xd8b48b59789bbed1), EcoNode(246, 39060, -1) },
+	{ Q_UINT64_C(0x20b968c21961ced2), EcoNode(418, 2140, 6753) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x14c47eea7b218ed5), EcoNode(130, 4423, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x4fd267dfadf4bed8), EcoNode(364, 0, 15350) },
+	{ Q_UINT64_C(0xd6269a54a246ded9), EcoNode(443, 2196, 38736) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x3b41ac89fdab7ee6), EcoNode(300, 11939, -1) },
+	{ Q_UINT64_C(0x3cffd46ade243ee6), EcoNode(327, 25, 12406) },
+	{ Q_UINT64_C(0x4124dc1cd560dee6), EcoNode(233, 1445, 12985) },
+	{ Q_UINT64_C(0xd9b50f9596ba7ee8), EcoNode(248, 697, 39347) },
+	{ Q_UINT64_C(0x1c2f6f557c52aeea), EcoNode(242, 1172, 5730) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x24a329006babfeee), EcoNode(454, 2196, 7740) },
+	{ Q_UINT64_C(0x8fa1a468832a6eef), EcoNode(237, 1445, 27029) },
+	{ Q_UINT64_C(0xaff3e6e372297ef0), EcoNode(417, 2140, 31936) },
+	{ Q_UINT64_C(0xca58305f8743deee), EcoNode(346, 200, 33143) },
+	{ Q_UINT64_C(0xe7a6f486c5d2aeee), EcoNode(199, 106, 41568) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x6a35f22cabb13ef5), EcoNode(141, 106, 20546) },
+	{ Q_UINT64_C(0xceb22f5214ea3ef6), EcoNode(266, 165, 37552) },
+	{ Q_UINT64_C(0x95d52dfdeefbfef7), EcoNode(321, 25, 28007) },
+	{ Q_UINT64_C(0xd19a499c3309cef5), EcoNode(63, 3028, 37905) },
+	{ Q_UINT64_C(0x8e9d6de036e2fef9), EcoNode(112, 26883, -1) },
+	{ Q_UINT64_C(0xc520b44faefb3ef9), EcoNode(237, 1445, 35716) },
+	{ Q_UINT64_C(0xfd92cfc448b92ef5), EcoNode(237, 1445, 44880) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x4e6c5f148ca8cefd), EcoNode(338, 0, 15104) },
+	{ Q_UINT64_C(0x51f945e120d93efe), EcoNode(244, 4022, 15926) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x5375c1a61eafff00), EcoNode(140, 4423, -1) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x310016ff5db4ef02), EcoNode(56, 10079, -1) },
+	{ Q_UINT64_C(0xa7ed29d3c0aa7f02), EcoNode(206, 388, 30728) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x6b677f97a1205f05), EcoNode(233, 1445, 20800) },
+	{ Q_UINT64_C(0x0451588ce6570f06), EcoNode(52, 919, 928) },
+	{ Q_UINT64_C(0x6bf7273246b76f06), EcoNode(223, 791, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x87e8c5d15711cf0b), EcoNode(239, 1445, 25750) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x54e4913402f25f0d), EcoNode(162, 106, 16587) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xbe0ebcd399c77f0f), EcoNode(377, 34471, -1) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xfc1cc55d56425f11), EcoNode(212, 388, 44598) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x16b70669ec159f15), EcoNode(252, 1912, 4963) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x14fbd86dee213f1a), EcoNode(370, 4559, -1) },
+	{ Q_UINT64_C(0xb266e8294289ef1b), EcoNode(220, 6728, 32468) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xceaefc1e653a8f1d), EcoNode(131, 106, 37497) },
+	{ Q_UINT64_C(0x53d35ee690c4cf1e), EcoNode(234, 1445, 16158) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x0bb0c842a88c6f24), EcoNode(101, 2587, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x1674f1eb0a168f27), EcoNode(189, 106, 4870) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x10771565b5a96f29), EcoNode(289, 165, 3708) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x505005b43a5b7f2c), EcoNode(349, 200, 15492) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x84270f7bcc30ef32), EcoNode(259, 8273, 25269) },
+	{ Q_UINT64_C(0x17d4558597f29f33), EcoNode(249, 697, 5129) },
+	{ Q_UINT64_C(0x3e47c90193d48f33), EcoNode(3, 12524, -1) },
+	{ Q_UINT64_C(0x4e9e58552287cf34), EcoNode(231, 3677, 15147) },
+	{ Q_UINT64_C(0x81c49d8c52293f34), EcoNode(180, 106, 24820) },
+	{ Q_UINT64_C(0xf4db452e04aaff32), EcoNode(318, 5393, 18506) },
+	{ Q_UINT64_C(0xc61ddc5c265e9f38), EcoNode(204, 388, 36011) },
+	{ Q_UINT64_C(0xb6516b760a687f39), EcoNode(45, 33060, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xa849703c42999f3c), EcoNode(220, 6728, 30819) },
+	{ Q_UINT64_C(0xf5fee723a7567f3c), EcoNode(280, 165, 43757) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xa3395074886ecf42), EcoNode(279, 165, 30045) },
+	{ Q_UINT64_C(0x0a0dcd23d58dcf43), EcoNode(243, 1172, 2239) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x835abfacd561ff47), EcoNode(246, 25157, -1) },
+	{ Q_UINT64_C(0x997d38b50af92f47), EcoNode(239, 1445, 28512) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x7f9aa5f0df052f4a), EcoNode(270, 165, 24431) },
+	{ Q_UINT64_C(0x359a73dc4e004f4b), EcoNode(311, 5393, 11156) },
+	{ Q_UINT64_C(0x35a6e0f3e7f3bf4c), EcoNode(286, 165, 11161) },
+	{ Q_UINT64_C(0x83660352368e2f4b), EcoNode(197, 106, 25211) },
+	{ Q_UINT64_C(0xbab1a9d0d1fb9f4e), EcoNode(265, 165, 33806) },
+	{ Q_UINT64_C(0x5470a086cc858f4f), EcoNode(217, 388, 16388) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x86ee43a55e90bf53), EcoNode(302, 743, -1) },
+	{ Q_UINT64_C(0x13233fb988228f54), EcoNode(230, 3677, 4259) },
+	{ Q_UINT64_C(0x54984881b4234f54), EcoNode(333, 0, 16492) },
+	{ Q_UINT64_C(0xd2df086ca0908f56), EcoNode(380, 1131, 38145) },
+	{ Q_UINT64_C(0x45284ee920e59f57), EcoNode(347, 200, 13655) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x05a7c9cb80175f59), EcoNode(242, 1172, 1179) },
+	{ Q_UINT64_C(0x077f026b0b043f59), EcoNode(460, 353, 1615) },
+	{ Q_UINT64_C(0x20eaf6fc24081f5b), EcoNode(326, 25, 6825) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x30179a999ce66f5e), EcoNode(292, 165, 9873) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x692e5d16a508ff62), EcoNode(412, 2140, 19442) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xf8ecc7ce17088f64), EcoNode(12, 613, 44172) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x40d2631366c4ef67), EcoNode(467, 353, 12897) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xa852aace5fb5cf6c), EcoNode(390, 1131, 5264) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xd57359159b18bf6f), EcoNode(112, 3608, -1) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x20d54eaa6b368f71), EcoNode(221, 6774, -1) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x35098e0ef8441f73), EcoNode(123, 106, 10992) },
+	{ Q_UINT64_C(0x93f09f89067b8f73), EcoNode(241, 2688, 27692) },
+	{ Q_UINT64_C(0xf1240aa19abdaf75), EcoNode(107, 5316, 43206) },
+	{ Q_UINT64_C(0x3ee724d3c50daf76), EcoNode(236, 1445, 12689) },
+	{ Q_UINT64_C(0x10564105aad82f77), EcoNode(486, 353, 3626) },
+	{ Q_UINT64_C(0x94d0673195503f76), EcoNode(360, 0, 27811) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x62e75d87c1e4bf7e), EcoNode(0, 19317, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x09a2250f4dfc8f82), EcoNode(190, 106, 2188) },
+	{ Q_UINT64_C(0x12360b30d1336f82), EcoNode(101, 4050, 4063) },
+	{ Q_UINT64_C(0x6c36d52c27c43f82), EcoNode(306, 0, 20896) },
+	{ Q_UINT64_C(0x6e0dfabeddda6f85), EcoNode(305, 21232, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x10fd4254dfedaf8b), EcoNode(265, 165, 3828) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x82d58204aa0b7f92), EcoNode(172, 106, 25054) },
+	{ Q_UINT64_C(0x4697045fe342bf93), EcoNode(203, 388, 13878) },
+	{ Q_UINT64_C(0x3bde4b0aa6685f94), EcoNode(118, 262, 12094) },
+	{ Q_UINT64_C(0xbc68d000781a9f93), EcoNode(237, 1445, 34070) },
+	{ Q_UINT64_C(0x780ae34bbfd89f96), EcoNode(36, 613, 23212) },
+	{ Q_UINT64_C(0x431012eba1813f97), EcoNode(345, 200, 13403) },
+	{ Q_UINT64_C(0x18de9d0f55748f98), EcoNode(382, 1131, 5230) },
+	{ Q_UINT64_C(0x950068aa22adef99), EcoNode(241, 2688, 27875) },
+	{ Q_UINT64_C(0x3cd1d91b41f66f9a), EcoNode(21, 12381, -1) },
+	{ Q_UINT64_C(0x43ecd897e1480f9b), EcoNode(232, 3677, 13527) },
+	{ Q_UINT64_C(0x3c2d20b9c29f2f9c), EcoNode(81, 1881, -1) },
+	{ Q_UINT64_C(0x465a47b04af79f9d), EcoNode(412, 2140, 13759) },
+	{ Q_UINT64_C(0x6f47e12854312f9e), EcoNode(100, 21418, -1) },
+	{ Q_UINT64_C(0x97cbd76cfc8c4f9f), EcoNode(177, 106, 28306) },
+	{ Q_UINT64_C(0xf8b2b6a157a13f9c), EcoNode(245, 4662, 44137) },
+	{ Q_UINT64_C(0xfa25b904ac89bf9b), EcoNode(117, 262, 13454) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xb2c02d564415bfa3), EcoNode(6, 32544, -1) },
+	{ Q_UINT64_C(0xce883d34577a8fa3), EcoNode(112, 262, 37464) },
+	{ Q_UINT64_C(0xf4396febf86edfa3), EcoNode(251, 1912, 43518) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x896011af2276bfaa), EcoNode(288, 165, 26002) },
+	{ Q_UINT64_C(0x0eb77821d5621fab), EcoNode(254, 3314, 3327) },
+	{ Q_UINT64_C(0x62fa20a189c76fab), EcoNode(115, 262, 19346) },
+	{ Q_UINT64_C(0x40600176c67bafad), EcoNode(20, 5714, -1) },
+	{ Q_UINT64_C(0x0e06b60ca762dfae), EcoNode(429, 2196, 3134) },
+	{ Q_UINT64_C(0x750a293e26d69fae), EcoNode(177, 106, 22625) },
+	{ Q_UINT64_C(0x0756b94461c50fb0), EcoNode(101, 1557, -1) },
+	{ Q_UINT64_C(0x9b579b1088780fab), EcoNode(253, 3314, -1) },
+	{ Q_UINT64_C(0xe9e9f0117daeafb2), EcoNode(451, 2196, 41870) },
+	{ Q_UINT64_C(0xeb7dff3183ab4fad), EcoNode(242, 1172, 33854) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x09901b621682cfb5), EcoNode(47, 2140, 2155) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xa39b3e13f7a4dfb9), EcoNode(329, 25, 30135) },
+	{ Q_UINT64_C(0x1d6c4d958ee7efba), EcoNode(331, 0, 6030) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x0748b822146c9fbc), EcoNode(106, 1518, 1535) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x4f9ae9258ba96fc1), EcoNode(442, 2196, 15322) },
+	{ Q_UINT64_C(0xb29d5f78e8cd0fc1), EcoNode(72, 3028, 32520) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x2910a3204606afc5), EcoNode(419, 2140, 8648) },
+	{ Q_UINT64_C(0x9a78390f797b5fc6), EcoNode(244, 28633, -1) },
+	{ Q_UINT64_C(0x40e5fe065ff96fc7), EcoNode(1, 9311, 12956) },
+	{ Q_UINT64_C(0xb8d220433b2dffc8), EcoNode(253, 3314, 33564) },
+	{ Q_UINT64_C(0x5496542d25732fc9), EcoNode(211, 388, 16424) },
+	{ Q_UINT64_C(0x06b49b25e0d21fca), EcoNode(286, 165, 1384) },
+	{ Q_UINT64_C(0x2bb8a1f68fd76fca), EcoNode(221, 9077, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xbae07986b5375fce), EcoNode(330, 0, -1) },
+	{ Q_UINT64_C(0xfe3ccaad13535fce), EcoNode(275, 165, 44973) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xc97ab689e00bafd1), EcoNode(429, 2196, 36640) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x0237f43836e38fd3), EcoNode(244, 422, 431) },
+	{ Q_UINT64_C(0x78fa6f77b3192fd3), EcoNode(214, 388, 23493) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xd7550ca797a5afd6), EcoNode(54, 4698, 38844) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xcdbba83322f5cfd8), EcoNode(470, 353, 37386) },
+	{ Q_UINT64_C(0x0d9b78eb64f30fd9), EcoNode(77, 3028, 3035) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x2714615a2e1f4fdc), EcoNode(288, 165, 8192) },
+	{ Q_UINT64_C(0x76b5e13adec0afdd), EcoNode(40, 22852, -1) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xc1d9890cf0a26fdf), EcoNode(311, 5393, 9637) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x1f7579a53cf9cfe2), EcoNode(240, 6436, -1) },
+	{ Q_UINT64_C(0x87b8157c4ceebfe2), EcoNode(200, 388, 20884) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x322c945fb949ffea), EcoNode(375, 10416, -1) },
+	{ Q_UINT64_C(0xa8e7c91161416feb), EcoNode(270, 165, -1) },
+	{ Q_UINT64_C(0xbd9348443bf1dfeb), EcoNode(223, 791, 34426) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x2061c28b7a7a1fee), EcoNode(278, 165, 6656) },
+	{ Q_UINT64_C(0xb27743e09c3f2fef), EcoNode(212, 388, 32487) },
+	{ Q_UINT64_C(0xaa8657728d200ff0), EcoNode(230, 3677, 31141) },
+	{ Q_UINT64_C(0xb5dfa0ffbc013fef), EcoNode(110, 262, 1535) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0xc6f09d54d5603ff6), EcoNode(449, 2196, 36274) },
+	{ 0, EcoNode() },
+	{ Q_UINT64_C(0x06649ba69b8c9ff8), EcoNode(300, 743, -1) },
+	{ Q_UINT64_C(0x00b1fb5640840ff9), EcoNode(135, 106, 115) },
+	{ Q_UINT64_C(0x835cb356d9b78ffa), EcoNode(174, 106, 25176) },
+	{ Q_UINT64_C(0x42fc0368f6494ffb), EcoNode(16, 613, 13370) },
+	{ Q_UINT64_C(0x4c59d439fa364ffc), EcoNode(252, 1912, 14861) },
+	{ Q_UINT64_C(0xdd1937963dacaffa), EcoNode(256, 4816, -1) },
+	{ 0, EcoNode() },
+	{ 0, EcoNode() },
+};
+
+const char EcoNode::s_builtinStrings[] =
+	"QGD\0"
+	"Albin counter-gambit\0"
+	"QGA\0"
+	"Linares variation\0"
+	"Lasker defence\0"
+	"two knights\0"
+	"Max Lange attack, Loman defence\0"
+	"Sicilian\0"
+	"accelerated fianchetto, modern variation with Bc4\0"
+	"Ruy Lopez\0"
+	"closed, Chigorin defence\0"
+	"QGD semi-Slav\0"
+	"5.Bg5 dc\0"
+	"dragon, classical, Amsterdam variation\0"
+	"Caro-Kann\0"
+	"Forgacs variation\0"
+	"Exchange variation doubly deferred (DERLD)\0"
+	"classical variation\0"
+	"King's Indian\0"
+	"Semi-Averbakh system\0"
+	"French\0"
+	"Winawer, advance variation\0"
+	"Ponziani\0"
+	"Leonhardt variation\0"
+	"Dutch\0"
+	"Staunton gambit, Alekhine variation\0"
+	"Reversed Grob (Borg/Basman defence/macho Grob)\0"
+	"Tarrasch, Prague variation, Normal position\0"
+	"open Berlin defence, 5...Be7\0"
+	"English\0"
+	"closed, 5.Rb1 Taimanov variation\0"
+	"classical\0"
+	"Latvian\0"
+	"corkscrew counter-gambit\0"
+	"Four knights\0"
+	"symmetrical, Pillsbury variation\0"
+	"Queen's pawn game\0"
+	"4...e6\0"
+	"open, Berger variation\0"
+	"Bishop's opening\0"
+	"Lewis gambit\0"
+	"Reti\0"
+	"King's Indian attack\0"
+	"Blumenfeld counter-gambit, Dus-Chotimursky variation\0"
+	"Corn stalk defence\0"
+	"Budapest\0"
+	"Rubinstein variation\0"
+	"Adler variation\0"
+	"Alekhine, Abonyi variation\0"
+	"closed, Hort variation\0"
+	"Cordel gambit\0"
+	"modern Steinitz defence\0"
+	"classical, Rubinstein variation\0"
+	"Cambridge Springs defence, Yugoslav variation\0"
+	"Gruenfeld\0"
+	"5.e3\0"
+	"exchange, Keres variation\0"
+	"Petrov\0"
+	"classical attack, Marshall trap\0"
+	"Bremen, Smyslov system\0"
+	"Stockholm variation\0"
+	"Classical defence deferred\0"
+	"Leningrad variation\0"
+	"Neo-Gruenfeld, 6.cd Nxd5, 7.O-O Nb6\0"
+	"dragon, classical, Zollner gambit\0"
+	"Pomar system\0"
+	"Worrall attack, solid line\0"
+	"MacCutcheon, Tartakower variation\0"
+	"KGA\0"
+	"Kieseritsky, Berlin defence, Riviere variation\0"
+	"Catalan\0"
+	"closed, 7.Qc2\0"
+	"Robatsch defence\0"
+	"two knights variation\0"
+	"Scandinavian (centre counter) defence\0"
+	"Novosibirsk opening\0"
+	"Anti-Gruenfeld\0"
+	"bishop's gambit, classical defence, Cozio attack\0"
+	"3.Nc3\0"
+	"Nimzovich (Paulsen) variation\0"
+	"Schwartz defence\0"
+	"King's pawn game\0"
+	"Philidor gambit\0"
+	"double Muzio gambit\0"
+	"four knights (Tarrasch) variation\0"
+	"modern Steinitz defence, Richter variation\0"
+	"Lengfellner system\0"
+	"Dutch defence\0"
+	"Bladel variation\0"
+	"Evans gambit\0"
+	"Reti v Dutch\0"
+	"Richter-Rauzer, Rauzer attack, 7...a6 defence, 9...Be7\0"
+	"symmetrical, hedgehog system\0"
+	"Labourdonnais variation\0"
+	"Grau (Sahovic) defence\0"
+	"Saemisch, Byrne variation\0"
+	"Queen's pawn\0"
+	"Charlick (Englund) gambit\0"
+	"3.Nd2\0"
+	"Queen's Indian\0"
+	"Marienbad system, Berg variation\0"
+	"Najdorf\0"
+	"Nimzo-Indian\0"
+	"Spielmann, San Remo variation\0"
+	"modern attack, Trifunovic variation\0"
+	"Vienna gambit\0"
+	"Heyde variation\0"
+	"Mannheim variation\0"
+	"classical, 4...Nc6\0"
+	"open, St. Petersburg variation\0"
+	"Kan, Maroczy bind - Bronstein variation\0"
+	"Magnus Smith trap\0"
+	"Russian, Byrne (Simagin) variation\0"
+	"Tarrasch, open variation\0"
+	"classical defence, Boden variation\0"
+	"Gunsberg counter-attack\0"
+	"Inverted Hungarian\0"
+	"Tarrasch defence\0"
+	"Scandinavian, Mieses-Kotrvc gambit\0"
+	"Berlin defence, Duras variation\0"
+	"Benko gambit\0"
+	"fianchetto variation\0"
+	"Philidor\0"
+	"Nimzovich, Sokolsky variation\0"
+	"Pin, Jaffe variation\0"
+	"Alekhine's defence\0"
+	"exchange, Rubinstein variation\0"
+	"Scheveningen (Paulsen), classical variation\0"
+	"Mengarini attack\0"
+	"closed, Chigorin, 12...Nc6\0"
+	"classical, Noa variation, main line\0"
+	"Tarrasch defence, Tarrasch gambit\0"
+	"Archangelsk (counterthrust) variation\0"
+	"4.e3, Bronstein (Byrne) variation\0"
+	"Benoni\0"
+	"classical, 9...Re8, 10.Nd2\0"
+	"Rasa-Studier gambit\0"
+	"bishop's gambit, classical defence\0"
+	"classical, 8.Bg5\0"
+	"Saemisch, main line\0"
+	"Ponziani opening\0"
+	"Nimzo-English opening\0"
+	"Albin-Alekhine-Chatard attack, Teichmann variation\0"
+	"Catalan opening\0"
+	"Scheveningen, Keres attack\0"
+	"Vienna\0"
+	"Hamppe-Muzio gambit\0"
+	"Giuoco Piano\0"
+	"Greco's attack\0"
+	"4.g3 Bb7\0"
+	"Scandinavian defence, Lasker variation\0"
+	"fianchetto, Yugoslav Panno\0"
+	"Six pawns attack\0"
+	"Hungarian defence\0"
+	"Worrall attack\0"
+	"Grob\0"
+	"spike attack\0"
+	"French defence\0"
+	"Gruenfeld gambit\0"
+	"Hort-Antoshin system\0"
+	"Sicilian reversed\0"
+	"closed Berlin defence, Wolf variation\0"
+	"closed, 6.Be3\0"
+	"Caro-Kann defence\0"
+	"Saemisch, orthodox, 7.Nge2 c6\0"
+	"Nimzo-Indian defence\0"
+	"KGD\0"
+	"classical, Heath variation\0"
+	"Marshall counter-attack, 11...c6\0"
+	"Albin-Alekhine-Chatard attack, Maroczy variation\0"
+	"Carr's defence\0"
+	"Meran, Sozin variation\0"
+	"Berlin defence\0"
+	"Caro-Kann defensive system\0"
+	"Staunton gambit\0"
+	"Berlin defence, Tarrasch trap\0"
+	"Taimanov variation\0"
+	"Berlin defence, Trifunovic variation\0"
+	"3.g3, counterthrust variation\0"
+	"stonewall variation\0"
+	"Scotch gambit\0"
+	"Keres defence\0"
+	"Scandinavian\0"
+	"Kiel variation\0"
+	"Staunton gambit, Tartakower variation\0"
+	"closed, Smyslov defence\0"
+	"Alapin's variation (2.c3)\0"
+	"Pierce gambit, Rushmere attack\0"
+	"Sozin, not Scheveningen\0"
+	"MacCutcheon, Lasker variation, 8...g6\0"
+	"Mafia defence\0"
+	"Gunsberg variation\0"
+	"Charousek (Petrosian) variation\0"
+	"Capablanca's variation\0"
+	"Tarrasch, open, 4.ed ed\0"
+	"Dutch, Spielmann gambit\0"
+	"closed, 6.f4 e5 (Botvinnik)\0"
+	"Sicilian defence\0"
+	"classical attack, Maroczy variation\0"
+	"Herzfeld gambit\0"
+	"Tarrasch defence, Marshall gambit\0"
+	"MacCutcheon, Grigoriev variation\0"
+	"Neo-Gruenfeld (Kemeri) defence\0"
+	"compromised defence, Potter variation\0"
+	"classical, Noa variation, 5.cd ed\0"
+	"Scotch\0"
+	"Relfsson gambit ('MacLopez')\0"
+	"Old Indian\0"
+	"Janowski variation\0"
+	"Hanham, Schlechter variation\0"
+	"QGD Slav defence\0"
+	"exchange variation\0"
+	"four knights variation\0"
+	"Two knights defence\0"
+	"Kieseritsky, Polerio defence\0"
+	"Fred\0"
+	"Sozin, 7.Be3\0"
+	"Saemisch variation\0"
+	"4.e3, Taimanov variation\0"
+	"Dutch defence, Rubinstein variation\0"
+	"Sanders-Alapin variation\0"
+	"Therkatz-Herzog variation\0"
+	"Romanishin gambit\0"
+	"4.e3, Gligoric system with 7...Nbd7\0"
+	"Three knights\0"
+	"Winawer defence (Gothic defence)\0"
+	"Jerome gambit\0"
+	"Svenonius variation\0"
+	"Romih variation\0"
+	"Nimzovich, Klein variation\0"
+	"Reti opening\0"
+	"Giuoco Pianissimo\0"
+	"closed\0"
+	"4.Bf4\0"
+	"Spielmann, 4...c5, 5.dc Nc6\0"
+	"Three knights variation\0"
+	"anti-anti-Caro-Kann defence\0"
+	"Pirc\0"
+	"Austrian attack, Ljubojevic variation\0"
+	"closed, Qc2 & b3\0"
+	"Lasker variation\0"
+	"QGD Slav\0"
+	"Cunningham, three pawns gambit\0"
+	"Burn variation\0"
+	"Romanishin variation\0"
+	"Schmidt variation\0"
+	"Alekhine variation\0"
+	"Fraser-Mortimer attack\0"
+	"MacCutcheon variation\0"
+	"Sveshnikov system\0"
+	"Hanham, Steiner variation\0"
+	"Falkbeer, Reti variation\0"
+	"modern attack, Steinitz variation\0"
+	"5.e3 (Alekhine variation)\0"
+	"Ilyin-Genevsky variation with Qc2\0"
+	"English opening\0"
+	"classical attack, Krause variation\0"
+	"Staunton gambit, Nimzovich variation\0"
+	"Hanham variation\0"
+	"Zinnowitz variation\0"
+	"Evans gambit declined\0"
+	"Ukrainian variation\0"
+	"King's gambit accepted\0"
+	"Alapin's opening\0"
+	"Berlin defence, Rio de Janeiro variation\0"
+	"Herrstroem gambit\0"
+	"Boleslavsky variation, 7.Nb3\0"
+	"Lopez counter-gambit\0"
+	"semi-Slav, Junge variation\0"
+	"modern Steinitz defence, Duras (Keres) variation\0"
+	"Kan, 5.Nc3\0"
+	"Scotch variation\0"
+	"open, Berlin variation\0"
+	"Robatsch (modern) defence\0"
+	"Pollock defence\0"
+	"Kan, Polugaievsky variation\0"
+	"open, Howell attack\0"
+	"Trompovsky attack (Ruth, Opovcensky opening)\0"
+	"Dubois-Reti defence\0"
+	"4.Nc3, main line\0"
+	"fianchetto, Yugoslav, 7.O-O\0"
+	"Kramer system\0"
+	"Falkbeer, Charousek gambit\0"
+	"bishop's gambit, Bryan counter-gambit\0"
+	"Damiano's defence\0"
+	"Bardeleben variation\0"
+	"Petrosian system, Stein variation\0"
+	"Kieseritsky, long whip (Stockwhip, classical) defence\0"
+	"classical attack, Marshall variation\0"
+	"Berlin defence, Zukertort variation\0"
+	"Nimzovich variation\0"
+	"Moeller defence\0"
+	"chameleon variation\0"
+	"Berlin defence, Pillsbury variation\0"
+	"KP\0"
+	"Neo-Mongoloid defence\0"
+	"old main line, 7.Nc3\0"
+	"Danish gambit\0"
+	"Four pawns attack, Florentine gambit\0"
+	"classical, Steinitz variation\0"
+	"bishop's gambit, McDonnell attack\0"
+	"Pseudo-Austrian attack\0"
+	"QGA, Flohr variation\0"
+	"Chigorin defence\0"
+	"Ilyin-Genevsky variation with b3\0"
+	"Marshall variation\0"
+	"Inverted Hanham\0"
+	"closed, Breyer, Gligoric variation\0"
+	"double Ruy Lopez\0"
+	"Leningrad, ...b5 gambit\0"
+	"Bird\0"
+	"From gambit, Lasker variation\0"
+	"Nimzovich, Locock variation\0"
+	"classical, 8...Bb7\0"
+	"Albin counter-gambit, 5.g3\0"
+	"Bellon gambit\0"
+	"Alekhine variation, Balogh gambit\0"
+	"Scheveningen, classical variation with ...Qc7 and ...Nc6\0"
+	"Richardson attack\0"
+	"Philidor counter-gambit, Berger variation\0"
+	"Saemisch, orthodox, Bronstein variation\0"
+	"QGA, 4.Nc3\0"
+	"open, classical line\0"
+	"wing gambit, Carlsbad variation\0"
+	"Semi-Tarrasch, Kmoch variation\0"
+	"Najdorf, Browne variation\0"
+	"classical, Noa variation\0"
+	"Albin-Alekhine-Chatard attack, Breyer variation\0"
+	"King's knight's gambit\0"
+	"Abbazia defence, Botvinnik variation\0"
+	"bishop's gambit, Cozio (Morphy) defence\0"
+	"Meran\0"
+	"Najdorf, Polugayevsky variation\0"
+	"4.e3, Gligoric system, Smyslov variation\0"
+	"closed, Averbach variation\0"
+	"Scheveningen, English variation\0"
+	"Schliemann defence, Berger variation\0"
+	"Latvian gambit, 3.Bc4\0"
+	"Sea-cadet mate\0"
+	"Meran variation\0"
+	"Najdorf, Zagreb (fianchetto) variation\0"
+	"Bremen system with ...g6\0"
+	"closed (8...Na5)\0"
+	"Canard opening\0"
+	"Scheveningen, Tal variation\0"
+	"Opovcensky variation\0"
+	"MacCutcheon, Bogolyubov variation\0"
+	"Orthodox defence, Bd3 line, Capablanca freeing manoevre\0"
+	"King's Indian with e4 & g3\0"
+	"closed, 7...O-O\0"
+	"Nimzovich-Rossolimo attack (without ...d6)\0"
+	"symmetrical variation\0"
+	"two knights defence\0"
+	"Canal variation\0"
+	"Spassky variation, main line, 10...cd, 11.cd\0"
+	"closed, Spassky gambit\0"
+	"Pincus variation\0"
+	"Tartakower variation\0"
+	"Anglo-Gruenfeld, Czech defense\0"
+	"Capablanca-Duras variation\0"
+	"Boden-Kieseritsky gambit\0"
+	"Lichtenhein defence\0"
+	"Averbakh variation\0"
+	"Winawer, advance, Bogolyubov variation\0"
+	"Gedult's opening\0"
+	"Lundin (Kevitz-Mikenas) defence\0"
+	"Panov-Botvinnik attack\0"
+	"old main line, 9.Qxc3\0"
+	"Staunton gambit deferred\0"
+	"4.Bg5 Be7, 5.e3 O-O\0"
+	"Steinitz, Bradford attack\0"
+	"Ilyin-Genevsky, Winter variation\0"
+	"modern Steinitz defence, fianchetto (Bronstein) variation\0"
+	"Nimzovich defence\0"
+	"bishop's gambit, Anderssen variation\0"
+	"Bird's opening, Swiss gambit\0"
+	"Spielmann variation\0"
+	"Irish (Chicago) gambit\0"
+	"Lopez gambit\0"
+	"Dzindzikhashvili defence\0"
+	"Evans gambit declined, Vasquez variation\0"
+	"closed, Breyer defence\0"
+	"Boden variation\0"
+	"Centre game\0"
+	"open, Friess attack\0"
+	"anti-Meran, Alatortsev system\0"
+	"Orthodox defence\0"
+	"wing gambit deferred\0"
+	"Torre attack\0"
+	"Neo-Gruenfeld, 6.O-O c6\0"
+	"Saemisch, orthodox, 7.d5\0"
+	"Noah's ark trap\0"
+	"closed, Keres (9...a5) variation\0"
+	"fianchetto with ...Nc6\0"
+	"Nimzovich-Larsen attack\0"
+	"English variation\0"
+	"Max Lange attack, Marshall variation\0"
+	"classical, 11.f3\0"
+	"e3, Huebner variation\0"
+	"Ware (Meadow Hay) opening\0"
+	"Hamppe-Muzio, Dubois variation\0"
+	"Amar (Paris) opening\0"
+	"4.e3, main line with 8...Bxc3\0"
+	"Paoli variation\0"
+	"dragon, Yugoslav attack, Rauser variation\0"
+	"MacCutcheon, Dr. Olland (Dutch) variation\0"
+	"Breyer variation\0"
+	"open Berlin defence, l'Hermet variation\0"
+	"classical system, 5.Be2\0"
+	"Steinitz defence deferred, Lipnitsky variation\0"
+	"Philidor's defence\0"
+	"Neo-Gruenfeld, 6.cd Nxd5, 7.O-O\0"
+	"open, Malkin variation\0"
+	"open, Richter variation\0"
+	"main line\0"
+	"closed, Flohr-Zaitsev system (Lenzerheide variation)\0"
+	"symmetrical, Blake variation\0"
+	"Reti variation\0"
+	"Bogo-Indian defence\0"
+	"Berlin defence, Nyholm attack\0"
+	"open (Tarrasch) defence\0"
+	"Colman variation\0"
+	"Saragossa opening\0"
+	"Benoni defence, Hromodka system\0"
+	"four pawns attack, fianchetto variation\0"
+	"From gambit\0"
+	"advance variation\0"
+	"London system\0"
+	"Cambridge Springs defence, Capablanca variation\0"
+	"Bird's attack\0"
+	"Cambridge Springs defence, Bogoljubow variation\0"
+	"Max Lange attack, Steinitz variation\0"
+	"Nimzovich defence, Marshall gambit\0"
+	"Semi-Tarrasch, San Sebastian variation\0"
+	"Neo-Gruenfeld, 6.cd Nxd5, 7.O-O c5, 8.Nc3\0"
+	"classical, Pirc variation\0"
+	"4.e4\0"
+	"Vulture defence\0"
+	"dragon variation\0"
+	"modern exchange variation\0"
+	"Panov-Botvinnik, normal variation\0"
+	"Russian, Szabo (Boleslavsky) variation\0"
+	"dragon, classical, Grigoriev variation\0"
+	"wing gambit, Santasiere variation\0"
+	"Richter-Rauzer, Rauzer attack, 7...Be7 defence, 9.f4\0"
+	"Urusov gambit, Panov variation\0"
+	"King's Indian attack, Yugoslav variation\0"
+	"closed, 2...Nc6\0"
+	"modern attack, Bardeleben variation\0"
+	"Zhuravlev countergambit\0"
+	"King's Indian attack (Barcza system)\0"
+	"Falkbeer, 5.de\0"
+	"Paulsen attack\0"
+	"exchange, Bronstein variation\0"
+	"Grand Prix attack, Schofman variation\0"
+	"Gruenfeld with e3 & Qb3\0"
+	"Graz variation\0"
+	"advance, Paulsen attack\0"
+	"Lewis counter-gambit\0"
+	"Anderssen counter-attack, Goteborg system\0"
+	"4.e3\0"
+	"Worrall attack, sharp line\0"
+	"QGA, Bogolyubov variation\0"
+	"Flohr defence\0"
+	"classical, Soldatenkov variation\0"
+	"King's Indian attack, French variation\0"
+	"Nimzovich, Larobok variation\0"
+	"Old Indian defence\0"
+	"Richter-Rauzer, Rauzer attack, Geller variation\0"
+	"Pirc defence\0"
+	"open, 5.Nf3\0"
+	"Anderssen counter-attack, Collijn variation\0"
+	"Dunst (Sleipner, Heinrichsen) opening\0"
+	"Lisitsin gambit deferred\0"
+	"closed, Smyslov variation\0"
+	"exchange, positional line, 5...c6\0"
+	"Doery defence\0"
+	"Benko gambit accepted\0"
+	"Meran, 8...a6\0"
+	"Neo-orthodox variation, 7.Bh4\0"
+	"Fraser defence\0"
+	"Richter-Rauzer, Rauzer attack, 7...a6\0"
+	"Stoltz variation\0"
+	"Kieseritsky, Berlin defence, 6.Bc4\0"
+	"Larsen variation\0"
+	"English orang-utan\0"
+	"classical, 7.Qe2\0"
+	"open, Alekhine variation\0"
+	"Saemisch, Ruban variation\0"
+	"Crab opening\0"
+	"Kieseritsky, Kolisch defence\0"
+	"Dutch with c4 & Nc3\0"
+	"Queen's pawn, Mason variation, Steinitz counter-gambit\0"
+	"Hobbs gambit\0"
+	"Queen's pawn game, Krause variation\0"
+	"Valencia opening\0"
+	"Benko's opening\0"
+	"reversed Alekhine\0"
+	"classical, 6.h4\0"
+	"Sozin, Fischer variation\0"
+	"Mikenas-Carls, Flohr variation\0"
+	"four pawns attack\0"
+	"Evans gambit declined, Cordel variation\0"
+	"Rubinstein counter-gambit\0"
+	"accelerated fianchetto, Maroczy bind, 5...Bg7\0"
+	"Romanishin-Kasparov (Steiner) system\0"
+	"Schliemann defence deferred\0"
+	"Pin, Koch variation\0"
+	"English, Keres variation\0"
+	"classical, Geller variation\0"
+	"Lasker defence, Bernstein variation\0"
+	"four knights, 4.e3\0"
+	"four knights, Capablanca variation\0"
+	"Bird's opening\0"
+	"Orthodox defence, classical, 13.d1c2 (Vidmar)\0"
+	"Mikenas-Carls, Sicilian variation\0"
+	"open, 5.Qa4\0"
+	"Tartakower (fantasy) variation\0"
+	"Bronstein-Larsen variation\0"
+	"Abbazia defence, modern variation\0"
+	"Queen's Indian accelerated\0"
+	"exchange, Simagin's improved variation\0"
+	"closed, Korchnoi variation\0"
+	"Philidor counter-gambit, Zukertort variation\0"
+	"Torre attack (Tartakower variation)\0"
+	"fianchetto, classical variation\0"
+	"Tarrasch, closed variation\0"
+	"modern variation\0"
+	"Scotch game\0"
+	"bishop's gambit, Steinitz defence\0"
+	"fianchetto defence deferred\0"
+	"Swiss variation\0"
+	"semi-Slav, Koomen variation\0"
+	"classical, 7...Nd7\0"
+	"Scheveningen, classical, Nd7 system\0"
+	"Durkin's attack\0"
+	"dragon, 6.Be3\0"
+	"Orthodox defence, Rubinstein attack, main line\0"
+	"Gurgenidze system\0"
+	"Kieseritsky, Rice gambit\0"
+	"Rubinstein counter-gambit, Henneberger variation\0"
+	"Abbazia defence (classical defence, modern defence[!])\0"
+	"Anglo-Gruenfeld, Smyslov defense\0"
+	"stonewall defence\0"
+	"classical with ...Re8 and ...Na6\0"
+	"Steinitz variation\0"
+	"Botvinnik variation\0"
+	"symmetrical, three knights system\0"
+	"Falkbeer, Tarrasch variation\0"
+	"Winawer, Alekhine gambit, Alatortsev variation\0"
+	"Najdorf, 7.f4\0"
+	"Berger variation\0"
+	"Gottschall variation\0"
+	"7.Bc4\0"
+	"Winawer, advance, positional main line\0"
+	"Meran, old main line\0"
+	"Reti accepted\0"
+	"modern, Vitolins attack\0"
+	"4.Nc3, Botvinnik variation\0"
+	"Richter-Veresov attack, Veresov variation\0"
+	"Romford counter-gambit\0"
+	"Spanish, classical defence\0"
+	"Tarrasch, Guimard variation\0"
+	"Albin counter-gambit, Krenosz variation\0"
+	"King's Indian defence, 3.Nc3\0"
+	"Belgrade gambit\0"
+	"classical, 4...c5\0"
+	"Pelikan, Bird variation\0"
+	"closed system\0"
+	"Max Lange attack, Krause variation\0"
+	"Latvian counter-gambit\0"
+	"classical attack, Berger variation\0"
+	"Austrian attack, dragon formation\0"
+	"accelerated fianchetto, Gurgenidze variation\0"
+	"Two knights defence, Perreux variation\0"
+	"Canal-Sokolsky attack, Bronstein gambit\0"
+	"classical variation (5.Bf4)\0"
+	"Gunderam defence\0"
+	"two pawns' attack, Mikenas variation\0"
+	"Allgaier, Cook variation\0"
+	"Bremen, reverse dragon\0"
+	"Cracow variation\0"
+	"Ne2 variation\0"
+	"Schurig gambit\0"
+	"6.e4\0"
+	"Miles variation\0"
+	"Neo-Catalan declined\0"
+	"Horwitz attack\0"
+	"Allgaier, Blackburne gambit\0"
+	"Ruy Lopez (Spanish opening)\0"
+	"Old Benoni\0"
+	"Mujannah formation\0"
+	"Giuoco piano\0"
+	"Falkbeer, Nimzovich variation\0"
+	"Nimzovich, Sozin variation\0"
+	"Orthodox defence, Bd3 line, Alekhine variation\0"
+	"Benko gambit half accepted\0"
+	"exchange, Seville variation\0"
+	"exchange, Gligoric variation\0"
+	"accelerated fianchetto, exchange variation\0"
+	"Sokolsky variation\0"
+	"Ufimtsev-Pytel variation\0"
+	"closed, anti-Marshall 8.a4\0"
+	"advance, Steinitz variation\0"
+	"Dutch variation, main line\0"
+	"bishop's gambit, Jaenisch variation\0"
+	"Bernstein variation\0"
+	"Czech Benoni defence\0"
+	"modern (Steinitz) attack\0"
+	"Barnes defence\0"
+	"Ragozin variation\0"
+	"Prins (Moscow) variation\0"
+	"Falkbeer, Rubinstein variation\0"
+	"Kieseritsky variation\0"
+	"accelerated fianchetto, Maroczy bind, 6.Be3\0"
+	"Paulsen variation\0"
+	"4.e3, Keres variation\0"
+	"dragon, classical, Alekhine variation\0"
+	"4.e3 c5, 5.Ne2 (Rubinstein)\0"
+	"Orthodox defence, Rubinstein attack, Karlsbad variation\0"
+	"Modern defence\0"
+	"Averbakh system\0"
+	"Scheveningen, 6.f4\0"
+	"Aitken variation\0"
+	"Cochrane variation\0"
+	"Meran, Rellstab attack\0"
+	"Najdorf, 7...Be7\0"
+	"Goering gambit\0"
+	"fianchetto, Simagin variation\0"
+	"Dubois variation\0"
+	"St. George (Baker) defence\0"
+	"Gligoric-Taimanov system\0"
+	"Rochlin variation\0"
+	"Neo-Gruenfeld, 6.O-O, main line\0"
+	"Tartakower (Makagonov-Bondarevsky) system\0"
+	"Calabrese counter-gambit, Jaenisch variation\0"
+	"Evans gambit declined, Pavlov variation\0"
+	"Scheveningen, classical\0"
+	"closed, 8.c3\0"
+	"Alekhine defence\0"
+	"Two knights variation\0"
+	"semi-Slav, Marshall gambit\0"
+	"Benima defence\0"
+	"Marshall, main line, 14...Qh3\0"
+	"Saemisch, Keres variation\0"
+	"Four pawns attack, main line\0"
+	"Smyslov variation\0"
+	"Averbakh, 6...c5\0"
+	"Ghulam Kassim variation\0"
+	"symmetrical, Tarrasch variation\0"
+	"Amsterdam attack\0"
+	"open, Italian variation\0"
+	"Gianutio counter-gambit\0"
+	"four pawns attack, main line\0"
+	"closed, Borisenko defence\0"
+	"Fegatello attack\0"
+	"Richter-Rauzer, Larsen variation\0"
+	"Konstantinopolsky opening\0"
+	"Nimzovich-Rubinstein; Rubinstein counter-gambit\0"
+	"anti-Queen's Indian system\0"
+	"Winawer, advance, Russian variation\0"
+	"Steinitz, Brodsky-Jones variation\0"
+	"four knights, Nimzovich variation\0"
+	"Tarrasch, Folkestone (Swedish) variation\0"
+	"four pawns attack, Tartakower variation\0"
+	"Holmov system\0"
+	"Richter-Rauzer, Podvebrady variation\0"
+	"Orthodox defence, Bd3 line\0"
+	"Becker defence\0"
+	"Lisitsyn variation\0"
+	"Steiner variation\0"
+	"Waller attack\0"
+	"Jaenisch counter-attack\0"
+	"Moeller (Therkatz) attack\0"
+	"QP counter-gambit (elephant gambit)\0"
+	"bishop's gambit, Gifford variation\0"
+	"Paulsen, Gunsberg defence\0"
+	"symmetrical, Capablanca variation\0"
+	"Hungarian variation\0"
+	"Rubinstein (anti-Meran) system\0"
+	"Neo-Gruenfeld defence\0"
+	"Anti-neo-orthodox variation\0"
+	"Alatortsev variation\0"
+	"Chinese variation\0"
+	"Albin counter-gambit, Alapin variation\0"
+	"Berlin defence, 4.O-O, d6\0"
+	"dragon, classical, 8.O-O\0"
+	"Euwe variation\0"
+	"Canal-Sokolsky attack, 3...Bd7\0"
+	"classical, Spassky variation\0"
+	"symmetrical, hedgehog, flexible formation\0"
+	"Richter variation\0"
+	"Falkbeer counter-gambit\0"
+	"classical counter-gambit\0"
+	"Vienna game, Max Lange defence\0"
+	"Queen's gambit accepted\0"
+	"Falkbeer, Morphy gambit\0"
+	"four pawns attack, Planinc variation\0"
+	"Petrosian system\0"
+	"Kieseritsky, Berlin defence\0"
+	"modern variation, 4...Bg4\0"
+	"closed Berlin defence, Bernstein variation\0"
+	"Czech defence\0"
+	"compromised defence, Paulsen variation\0"
+	"Ragozin, Vienna variation\0"
+	"classical, Maroczy attack\0"
+	"4.e3, main line with ...c5\0"
+	"Kan, Swiss cheese variation\0"
+	"Gruenfeld with e3    Bd3\0"
+	"classical, 7...b5\0"
+	"four knights, Marini variation\0"
+	"Soerensen gambit\0"
+	"4.e3 c5\0"
+	"Sveshnikov variation\0"
+	"close variation\0"
+	"four pawns attack, Trifunovic variation\0"
+	"Meran, Wade variation\0"
+	"English, Smyslov defence\0"
+	"3...Nf6\0"
+	"closed, centre attack\0"
+	"semi-Slav, Abrahams variation\0"
+	"classical (two knights) system\0"
+	"Kurajica defence\0"
+	"Capablanca anti-Cambridge Springs variation\0"
+	"pawn storm variation\0"
+	"orthodox variation\0"
+	"Anderssen variation\0"
+	"Semi-Tarrasch with e3\0"
+	"Queen's bishop game\0"
+	"Kieseritsky, Brentano defence, Caro variation\0"
+	"Pin variation (Sicilian counter-attack)\0"
+	"Norwalde variation, Buecker gambit\0"
+	"Anglo-Dutch defense\0"
+	"Bremen system, Keres variation\0"
+	"classical, Anderssen-Richter variation\0"
+	"Panov-Botvinnik attack, 5...e6\0"
+	"exchange, Saemisch variation\0"
+	"bishop's gambit, Boren-Svenonius variation\0"
+	"Muzio gambit\0"
+	"Dutch variation\0"
+	"Richter-Rauzer, Bondarevsky variation\0"
+	"Lucena defence\0"
+	"Old Benoni defence\0"
+	"Richter-Veresov attack\0"
+	"Tarrasch, Wagner variation\0"
+	"Berlin defence, Kaufmann variation\0"
+	"Vienna game\0"
+	"Lasker defence, Teichmann variation\0"
+	"Spike gambit\0"
+	"Neo-orthodox variation\0"
+	"Richter-Rauzer, Keres variation\0"
+	"Holzhausen attack\0"
+	"Sicilian, Chekhover variation\0"
+	"exchange, Bogolyubov variation\0"
+	"fianchetto, Yugoslav system\0"
+	"Semi-Tarrasch defence\0"
+	"modern, Larsen variation\0"
+	"Leningrad, Basman system\0"
+	"Alapin's defence deferred\0"
+	"Cambridge Springs defence, Argentine variation\0"
+	"Blackmar-Diemer gambit\0"
+	"Nimzovich (knight's tour) variation\0"
+	"Wade defence\0"
+	"Dutch, Von Pretzel gambit\0"
+	"Amsterdam variation\0"
+	"Chigorin variation\0"
+	"Queen's pawn game, Rubinstein (Colle-Zukertort) variation\0"
+	"Taimanov (Bastrikov) variation\0"
+	"Orthodox defence, Swiss, Karlsbad variation\0"
+	"Mieses opening\0"
+	"Venice attack\0"
+	"Tartakower (Nimzovich) variation\0"
+	"Tartakower (Wade) variation\0"
+	"Labourdonnais-Loewenthal variation\0"
+	"4.Nc3\0"
+	"Najdorf, Polugayevsky, Simagin variation\0"
+	"Tarrasch, open variation, main line\0"
+	"Fritz variation\0"
+	"Mengarini variation\0"
+	"Levenfish variation\0"
+	"classical, Anderssen variation\0"
+	"four pawns attack, Korchnoi variation\0"
+	"four knights, Romanishin variation\0"
+	"Tumbleweed gambit\0"
+	"Lopez-Gianutio counter-gambit, Hein variation\0"
+	"Wormald (Alapin) attack\0"
+	"Scandinavian gambit\0"
+	"Sozin, Leonhardt variation\0"
+	"Steinitz gambit, Zukertort defence\0"
+	"King's Indian, 3.Nf3\0"
+	"Stiletto (Althouse) variation\0"
+	"Pachman variation\0"
+	"advance, Nimzovich variation\0"
+	"Colorado counter\0"
+	"King's head opening\0"
+	"Schultze-Mueller gambit\0"
+	"Gruenfeld defence\0"
+	"Smyslov, Yugoslav variation\0"
+	"Henneberger variation\0"
+	"Morphy attack\0"
+	"Danube gambit\0"
+	"exchange, Romanovsky variation\0"
+	"Cozio defence, Paulsen variation\0"
+	"4.e3 O-O, 5.Bd3 d5\0"
+	"Meran, Rabinovich variation\0"
+	"Scandinavian defence\0"
+	"Winawer, advance, Rauzer variation\0"
+	"closed (with ...d6)\0"
+	"Centre game, Kieseritsky variation\0"
+	"Ranken variation\0"
+	"bayonet (Mariotti) attack\0"
+	"Queen's Indian defence\0"
+	"Winawer counter-gambit\0"
+	"symmetrical, Benoni formation\0"
+	"Bogo-Indian defence, Gruenfeld variation\0"
+	"Najdorf, Lipnitzky attack\0"
+	"anti-Meran, Szabo variation\0"
+	"Kan, Maroczy bind (Reti variation)\0"
+	"Sicilian, Szen (`anti-Taimanov') variation\0"
+	"Scotch, Krause variation\0"
+	"accelerated Meran (Alekhine variation)\0"
+	"modern Steinitz defence, Three knights variation\0"
+	"closed Berlin defence, Chigorin variation\0"
+	"Kupreichik variation\0"
+	"bishop's gambit, Grimm attack\0"
+	"Treybal (Bayreuth) variation (exchange var. deferred)\0"
+	"Wing gambit\0"
+	"symmetrical (Austrian) defence\0"
+	"Scheveningen, classical, Maroczy system\0"
+	"4.e3 e8g8, 5.Nf3, without ...d5\0"
+	"Orthodox defence, Swiss (Henneberger) variation\0"
+	"Alapin variation\0"
+	"Franco-Benoni defence\0"
+	"Polish\0"
+	"Tuebingen variation\0"
+	"Blumenfeld attack\0"
+	"Czech Benoni\0"
+	"King's Indian system\0"
+	"Adorjan defence\0"
+	"O'Kelly variation\0"
+	"Symmetrical, Keres defence\0"
+	"5.Bg5\0"
+	"Queen's pawn game, Zukertort variation\0"
+	"Vienna gambit, Wurzburger trap\0"
+	"orthodox, 7...Nbd7\0"
+	"Semi-Tarrasch, Krause variation\0"
+	"open, Riga variation\0"
+	"Berlin defence, 4.O-O\0"
+	"open, 9...Be7, 10.Re1\0"
+	"Hippopotamus defence\0"
+	"Lesser bishop's (Petroff-Jaenisch-Tartakower) gambit\0"
+	"Semi-Tarrasch, 5.cd\0"
+	"Fort Knox variation\0"
+	"Saemisch, 5...O-O\0"
+	"Hanneken variation\0"
+	"classical defence, Charousek variation\0"
+	"Gruenfeld gambit, Capablanca variation\0"
+	"Orthodox defence, Rubinstein variation\0"
+	"Keres variation (2.Ne2)\0"
+	"5...Be7\0"
+	"Saemisch, Panno formation\0"
+	"Nimzovich variation (exaggerated fianchetto)\0"
+	"Two knights defence, Keidanz variation\0"
+	"Petrosian variation\0"
+	"symmetrical, Maroczy system\0"
+	"accelerated fianchetto, Breyer variation\0"
+	"Rossolimo variation\0"
+	"Semi-Tarrasch\0"
+	"exchange, Spassky variation\0"
+	"Venezolana opening\0"
+	"Capablanca variation\0"
+	"old Steinitz defence\0"
+	"English, Kramnik-Shirov counterattack\0"
+	"modern, Schmid variation\0"
+	"classical, Hanham variation\0"
+	"5.Bf4\0"
+	"Petrov three knights game\0"
+	"closed, Chigorin, Rauzer attack\0"
+	"Vienna variation\0"
+	"Pelikan, Chelyabinsk variation\0"
+	"Lolli variation\0"
+	"Gurgenidze variation\0"
+	"Russian, Alekhine (Hungarian) variation\0"
+	"modern Steinitz defence, siesta variation\0"
+	"Hillbilly attack\0"
+	"Mikenas-Carls, Kevitz variation\0"
+	"wing gambit, Marshall variation\0"
+	"Nimzovich (Jaenisch) variation\0"
+	"Tolush-Geller gambit\0"
+	"Philidor counter-gambit, del Rio attack\0"
+	"Allgaier, Thorold variation\0"
+	"dragon, classical, Stockholm attack\0"
+	"closed, Rossolimo defence\0"
+	"dragon, Yugoslav attack, 9.Bc4\0"
+	"Slav gambit\0"
+	"modern Scheveningen\0"
+	"Cozio defence\0"
+	"classical, 9...a6, 10.a4\0"
+	"QGA, 4.e3\0"
+	"dragon, classical, Richter variation\0"
+	"Tarrasch, Stoltz variation\0"
+	"Hall variation\0"
+	"Tarrasch, Prague variation, 7...Be7\0"
+	"Beefeater defence\0"
+	"Queen's pawn game, Chigorin variation\0"
+	"classical with ...a6 and 10...Bg4\0"
+	"exchange variation, Alapin gambit\0"
+	"bishop's gambit, Paulsen attack\0"
+	"QGA, Janowsky-Larsen variation\0"
+	"Staunton gambit, Staunton's line\0"
+	"Ekstrom variation\0"
+	"Maroczy variation\0"
+	"classical, Flohr variation\0"
+	"Lasker simul special\0"
+	"Saemisch, double fianchetto variation\0"
+	"Pelikan variation\0"
+	"symmetrical, Botvinnik system\0"
+	"Fajarowicz variation\0"
+	"stonewall with Nc3\0"
+	"Panov-Botvinnik, Herzog defence\0"
+	"classical, Tarrasch variation\0"
+	"5.Be2\0"
+	"French defence, Steiner variation\0"
+	"Simagin variation\0"
+	"Potter variation\0"
+	"closed, Zagoryansky variation\0"
+	"Falkbeer, 3...e4\0"
+	"Reti (Spielmann) variation\0"
+	"classical, Pollock variation\0"
+	"Tarrasch, Haberditz variation\0"
+	"Neo-Gruenfeld, 5.cd, main line\0"
+	"Uhlmann variation\0"
+	"closed, Ragozin-Petrosian (`Keres') variation\0"
+	"MacCutcheon, advance variation\0"
+	"Najdorf, Opovcensky variation\0"
+	"Ponziani counter-gambit, Cordel variation\0"
+	"Marshall, main line, Spassky variation\0"
+	"Bradley Beach variation\0"
+	"Najdorf, Byrne (English) attack\0"
+	"Flohr variation\0"
+	"classical with e4 and Nf3\0"
+	"Landau variation\0"
+	"Four pawns attack, dynamic line\0"
+	"Leningrad, main line\0"
+	"Bronstein gambit\0"
+	"Marshall, Kevitz variation\0"
+	"Richter-Rauzer, Larsen variation, 7.Qd2\0"
+	"Been-Koomen variation\0"
+	"centre-holding variation\0"
+	"Lopez opening\0"
+	"closed system (without ...d6)\0"
+	"Riumin variation\0"
+	"Outflank variation\0"
+	"Four pawns attack\0"
+	"Spassky variation, main line, 13.Bd3\0"
+	"Benoni defence\0"
+	"Kmoch variation\0"
+	"London defensive system\0"
+	"Vienna gambit, Steinitz variation\0"
+	"Evans gambit declined, Lange variation\0"
+	"orthodox, Aronin-Taimanov, Benko attack\0"
+	"bishop's gambit\0"
+	"Moeller, bayonet attack\0"
+	"Bird's defence deferred\0"
+	"closed, Botvinnik variation\0"
+	"classical variation, 6.O-O\0"
+	"Greco variation\0"
+	"4.e3, main line with 8...dc and 9...cd\0"
+	"fianchetto, Panno variation\0"
+	"Tarrasch, Botvinnik variation\0"
+	"exchange variation, 5.O-O\0"
+	"Neo-Gruenfeld, 5.cd\0"
+	"Pawn's gambit (Stamma gambit)\0"
+	"Max Lange attack, Rubinstein variation\0"
+	"closed, 9.h3\0"
+	"Lolli gambit (wild Muzio gambit)\0"
+	"Icelandic gambit\0"
+	"Smyslov, main line\0"
+	"Scheveningen, fianchetto variation\0"
+	"Muzio gambit, Holloway defence\0"
+	"King's pawn opening\0"
+	"Orthodox defence, Bd3 line, fianchetto variation\0"
+	"Mokele Mbembe (Buecker) variation\0"
+	"Panov-Botvinnik, Reifir (Spielmann) variation\0"
+	"Rosentreter gambit\0"
+	"dragon, classical attack\0"
+	"Bogo-Indian defence, Nimzovich variation\0"
+	"Botvinnik system\0"
+	"3.Nf3\0"
+	"closed, 5.Rb1\0"
+	"Three knights game\0"
+	"dragon, classical, Bernard defence\0"
+	"Najdorf, 7...Qb6\0"
+	"open Berlin defence, Showalter variation\0"
+	"Goering variation\0"
+	"classical, Stahlberg variation\0"
+	"Orthodox defence, Rubinstein attack, Gruenfeld variation\0"
+	"...b5 & ...d6\0"
+	"Rubinstein counter-gambit, 5.Be2\0"
+	"Krause attack\0"
+	"fianchetto, classical variation, 8.e4\0"
+	"Paulsen-Mieses variation\0"
+	"Allgaier, Urusov attack\0"
+	"Meitner variation\0"
+	"Semi-Tarrasch, Primitive Pillsbury variation\0"
+	"Winawer (Nimzovich) variation\0"
+	"open, Howell attack, Adam variation\0"
+	"Scotch, 4...exd4\0"
+	"Harrwitz attack\0"
+	"Saemisch attack\0"
+	"4.Nf3\0"
+	"Nuernberg variation\0"
+	"Hawk (Habichd) defence\0"
+	"Kieseritsky, Brentano (Campbell) defence\0"
+	"open, 8...Be6\0"
+	"Taimanov, American attack\0"
+	"Caro-Kann defensive system, Bogolyubov variation\0"
+	"exchange, positional line, 6.Qc2\0"
+	"dragon, Yugoslav attack, 12.h4\0"
+	"Smith-Morra gambit\0"
+	"Petrov's defence\0"
+	"Boleslavsky variation\0"
+	"closed, Balla variation\0"
+	"Allgaier gambit\0"
+	"Steinitz gambit\0"
+	"Geller's system\0"
+	"exchange, classical variation\0"
+	"Queen's Gambit\0"
+	"King's Indian attack, Spassky's variation\0"
+	"neo-Meran (Lundin variation)\0"
+	"Schlechter variation\0"
+	"Carrera (Basman) gambit\0"
+	"Saemisch, Botvinnik variation\0"
+	"Winawer, advance, poisoned pawn, Euwe-Gligoric variation\0"
+	"Damiano variation\0"
+	"Silberschmidt gambit\0"
+	"Steinitz gambit, Fraser-Minckwitz variation\0"
+	"5...Nd7\0"
+	"Falkbeer, Milner-Barry variation\0"
+	"Rubinstein counter-gambit Maroczy variation\0"
+	"Scandinavian defence, Gruenfeld variation\0"
+	"Richter-Rauzer, Richter attack\0"
+	"Tarrasch, Schlechter-Rubinstein system\0"
+	"Mikenas variation\0"
+	"4.e3, Gligoric system, Bronstein variation\0"
+	"accelerated fianchetto, Maroczy bind\0"
+	"orthodox, 7...Nbd7, main line\0"
+	"symmetrical, main line with d4\0"
+	"5.O-O\0"
+	"Queens Indian, Romanishin variation\0"
+	"Anderssen's opening\0"
+	"Richter-Veresov attack, Richter variation\0"
+	"Buerger variation\0"
+	"Caro-Masi defence\0"
+	"4.Bg5 Be7\0"
+	"4.e3, main line with 7...Nc6\0"
+	"Rousseau gambit\0"
+	"Orthodox defence, classical variation\0"
+	"Blumenfeld counter-gambit accepted\0"
+	"Blachly gambit\0"
+	"Four pawns attack, 6.Be2\0"
+	"Gedult attack\0"
+	"Orsini gambit\0"
+	"classical attack, close variation\0"
+	"four knights system\0"
+	"Tarrasch, Schlechter-Rubinstein system, Rey Ardid variation\0"
+	"Pillsbury attack\0"
+	"classical defence, 4.c3\0"
+	"Tarrasch, Eliskases variation\0"
+	"bishop's gambit, Greco variation\0"
+	"Steinitz defence deferred, Rubinstein variation\0"
+	"Saemisch, O'Kelly variation\0"
+	"Indian variation\0"
+	"3.g3\0"
+	"Torre attack, Wagner gambit\0"
+	"English, 1...Nf6 (Anglo-Indian defense)\0"
+	"Nimzovich defence, Bogolyubov variation\0"
+	"New York (London) defensive system\0"
+	"Winawer, Alekhine (Maroczy) gambit\0"
+	"Acton extension\0"
+	"Russian variation\0"
+	"wing gambit, Marienbad variation\0"
+	"Nimzovich defence, Wheeler gambit\0"
+	"Hanham, Krause variation\0"
+	"Nimzovich attack\0"
+	"Cambridge Springs defence\0"
+	"Steinitz, Boleslavsky variation\0"
+	"Velimirovic attack\0"
+	"Orthodox defence, Botvinnik variation\0"
+	"Cunningham, Bertin gambit\0"
+	"Hanham, Berger variation\0"
+	"two knights, Suttles variation\0"
+	"Steinitz attack\0"
+	"dragon, Yugoslav attack, 7...O-O\0"
+	"Neo-Catalan\0"
+	"Tayler opening\0"
+	"Alekhine defense, Borisenko-Furman variation\0"
+	"semi-Slav\0"
+	"open, 6.d4 b5\0"
+	"bishop's gambit, Boden defence\0"
+	"Saemisch, orthodox variation\0"
+	"Berlin defence, Mortimer trap\0"
+	"5...c6\0"
+	"Cozio defence deferred\0"
+	"compromised defence\0"
+	"three knights, Korchnoi variation\0"
+	"closed, Leonhardt variation\0"
+	"Evans gambit declined, 5.a4\0"
+	"dragon, Yugoslav attack, 9...Bd7\0"
+	"four pawns attack, Ilyin-Genevsky var.\0"
+	"Colle system\0"
+	"closed, Lutikov variation\0"
+	"classical, Svenonius variation\0"
+	"Orthodox defence, 7.Qc2 c5, 8.cd (Rubinstein)\0"
+	"Grand Prix attack\0"
+	"Kieseritsky, Salvio (Rosenthal) defence\0"
+	"closed defence\0"
+	"Evans counter-gambit\0"
+	"4.Bg5\0"
+	"classical defence, Benelux variation  \0"
+	"Ponziani counter-gambit\0"
+	"Cambridge Springs defence, 7.cd\0"
+	"English, Nimzovich variation\0"
+	"modern Scheveningen, main line\0"
+	"symmetrical, Botvinnik system reversed\0"
+	"Hanham, Delmar variation\0"
+	"Albin counter-gambit, Janowski variation\0"
+	"2.c3, Heidenfeld variation\0"
+	"Cambridge Springs defence, Rubinstein variation\0"
+	"Panov-Botvinnik, Czerniak variation\0"
+	"3.e4\0"
+	"symmetrical, Geller variation\0"
+	"Schallop defence\0"
+	"QGA, Smyslov variation\0"
+	"anti-Caro-Kann defence\0"
+	"Bird's defence\0"
+	"exchange, Larsen variation\0"
+	"semi-Slav, Noteboom variation\0"
+	"Mayet defence\0"
+	"normal variation\0"
+	"Haberditz variation\0"
+	"Fyfe gambit\0"
+	"Orthodox defence, Rubinstein attack (with Rc1)\0"
+	"Trajkovic counter-attack\0"
+	"classical, Botvinnik variation\0"
+	"stonewall, Botwinnik variation\0"
+	"classical, Tartakower variation\0"
+	"closed, 6.f4\0"
+	"Berlin defence, Minckwitz variation\0"
+	"Meran, Reynolds' variation\0"
+	"Averbakh, main line\0"
+	"Allgaier, Horny defence\0"
+	"Richter-Rauzer, Rauzer attack, 7...Be7 defence, 9...Nxd4\0"
+	"Winawer, advance, 6...Ne7\0"
+	"Scheveningen, Vitolins variation\0"
+	"Vitzhum attack\0"
+	"Berlin defence, hedgehog variation\0"
+	"dragon, Yugoslav attack\0"
+	"bishop's gambit, Fraser variation\0"
+	"Blumenfeld counter-gambit, Spielmann variation\0"
+	"Gruenfeld gambit accepted\0"
+	"l'Hermet variation\0"
+	"Russian variation with e4\0"
+	"Blackburne shilling gambit\0"
+	"Najdorf, Goteborg (Argentine) variation\0"
+	"fianchetto (Smyslov/Barnes) defence\0"
+	"Orthodox defence, classical, 13.d1b1 (Maroczy)\0"
+	"accelerated fianchetto, Simagin variation\0"
+	"closed, Sokolsky variation\0"
+	"Steinitz defence deferred, Boleslavsky variation\0"
+	"Reshevsky variation\0"
+	"Semi-Tarrasch, 7.Bd3\0"
+	"classical, Smyslov variation\0"
+	"Russian, Smyslov variation\0"
+	"closed, Suetin variation\0"
+	"old Steinitz defence, Nimzovich attack\0"
+	"Fritz gambit\0"
+	"Nimzovich-Rossolimo attack, Gurgenidze variation\0"
+	"Suechting variation\0"
+	"Collijn defence\0"
+	"Makogonov variation\0"
+	"MacCutcheon, Janowski variation\0"
+	"stonewall attack\0"
+	"Anglo-Gruenfeld defense\0"
+	"Soerensen defence\0"
+	"Woozle defence\0"
+	"Winawer, classical variation\0"
+	"open, Tartakower variation\0"
+	"Indian opening\0"
+	"Breyer gambit\0"
+	"Semi-Tarrasch defence, Pillsbury variation\0"
+	"Marienbad system\0"
+	"Orthodox defence, Rubinstein attack, Wolf variation\0"
+	"Scandinavian variation\0"
+	"advance, Milner-Barry gambit\0"
+	"Tarrasch, closed variation, main line\0"
+	"Lasker defence, Russian variation\0"
+	"Falkbeer variation\0"
+	"Patzer opening\0"
+	"Semi-Benoni (`blockade variation')\0"
+	"Yankovich variation\0"
+	"Amar gambit\0"
+	"King's Indian attack, Reti-Smyslov variation\0"
+	"Rosenthal variation\0"
+	"Smith-Morra gambit, Chicago defence\0"
+	"Kieseritsky, Neumann defence\0"
+	"6.Be2\0"
+	"fianchetto, 11...Re8\0"
+	"4.Bg5 Nbd7\0"
+	"Jaenisch gambit\0"
+	"closed, Chigorin, 12...c5d4\0"
+	"Petrosian system, main line\0"
+	"classical, Marshall attack\0"
+	"classical attack\0"
+	"Polish variation\0"
+	"Norwegian defence\0"
+	"Austrian attack\0"
+	"Halasz gambit\0"
+	"exchange, positional line\0"
+	"Falkbeer, Tartakower variation\0"
+	"Kieseritsky, Salvio defence, Cozio variation\0"
+	"Lolli gambit, Young variation\0"
+	"Yurdansky attack\0"
+	"Queens Indian formation\0"
+	"Soultanbeieff variation\0"
+	"Max Lange attack\0"
+	"classical, 6...a6\0"
+	"Ilyin-Genevsky variation\0"
+	"stonewall with Ba3\0"
+	"Scheveningen variation\0"
+	"closed, 9.d4\0"
+	"three knights, Euwe variation\0"
+	"Greco gambit\0"
+	"Charousek variation\0"
+	"closed, Chigorin, Yugoslav system\0"
+	"Dutch defence, Alekhine variation\0"
+	"2...Nf6\0"
+	"Clemenz (Mead's, Basman's or de Klerk's) opening\0"
+	"Kaufmann variation\0"
+	"MacDonnell double gambit\0"
+	"Winawer, fingerslip variation\0"
+	"closed, Bogolyubov variation\0"
+	"Labourdonnais-Loewenthal (Kalashnikov) variation\0"
+	"dragon, Yugoslav attack, 10.O-O-O\0"
+	"5.Bg2 Be7\0"
+	"Mikenas attack\0"
+	"King's Indian attack, Keres variation\0"
+	"Zaitsev system\0"
+	"Gloria variation\0"
+	"Franco-Indian (Keres) defence\0"
+	"Philidor variation\0"
+	"Winawer, Alekhine gambit\0"
+	"Tarrasch, von Hennig-Schara gambit\0"
+	"Tartakower attack\0"
+	"Orthodox defence, Pillsbury attack\0"
+	"QGD Slav accepted\0"
+	"modern, Panov variation\0"
+	"Behting variation\0"
+	"Richter-Rauzer, Rauzer attack, 7...a6 defence, 11.Bxf6\0"
+	"dragon, classical, Reti-Tartakower variation\0"
+	"Muzio gambit, From defence\0"
+	"Kieseritsky, Paulsen defence\0"
+	"fianchetto, Kavalek (Bronstein) variation\0"
+	"Mujannah opening\0"
+	"Napoleon's opening\0"
+	"MacCutcheon, Bernstein variation\0"
+	"classical without 9.O-O\0"
+	"Santasiere's folly\0"
+	"Four pawns attack, with Be2 and Nf3\0"
+	"modern, fianchetto variation\0"
+	"Kan, 5.Bd3\0"
+	"Tarrasch, Leningrad variation\0"
+	"Ulvestad variation\0"
+	"exchange, Alekhine variation\0"
+	"English, Nimzovich, Flohr variation\0"
+	"Smyslov defence\0"
+	"Dutch, Krejcik gambit\0"
+	"classical, h3 system\0"
+	"Pterodactyl defence\0"
+	"Steinitz defence deferred (Russian defence)\0"
+	"fianchetto with ...Nd7\0"
+	"Urusov gambit\0"
+	"Canal-Sokolsky (Nimzovich-Rossolimo, Moscow) attack\0"
+	"Sozin with ...a6 and ...b5\0"
+	"Canal (Venice) variation\0"
+	"4.e3, main line\0"
+	"Falkbeer, Alapin variation\0"
+	"Paleface attack\0"
+	"Neo-Gruenfeld, 6.cd Nxd5, 7.O-O c5, 8.dc\0"
+	"closed, 6...Nbd7\0"
+	"4.e3 Bf5\0"
+	"Bogolyubov variation\0"
+	"old Indian attack\0"
+	"two pawns' (Lasker's) attack\0"
+	"four pawns attack, 7.Be3\0"
+	"Richter-Rauzer\0"
+	"Fraser attack\0"
+	"Dutch, Manhattan (Alapin, Ulvestad) variation\0"
+	"two knights, 3...Bg4\0"
+	"Saemisch, 6...Nc6\0"
+	"exchange, chameleon variation\0"
+	"Tarrasch variation\0"
+	"Scheveningen, classical main line\0"
+	"4.e3 O-O\0"
+	"Najdorf, Poisoned pawn variation\0"
+	"Petrosian system, Keres variation\0"
+	"modern, Flohr variation\0"
+	"Italian four knights variation\0"
+	"Mestel variation\0"
+	"Quinteros variation\0"
+	"Kieseritsky, Brentano defence\0"
+	"Orthodox defence, classical, 13.de\0"
+	"Najdorf, 6...e6\0"
+	"Orthodox defence, Bd3 line, Janowski variation\0"
+	"Dutch, Lasker variation\0"
+	"Krejcik variation\0"
+	"Schlechter defence\0"
+	"Keene's defence\0"
+	"Berlin defence, Mortimer variation\0"
+	"Queen's Pawn\0"
+	"Italian variation\0"
+	"Caro variation\0"
+	"Hanham, Kmoch variation\0"
+	"Wilkes Barre (Traxler) variation\0"
+	"4.e3, Ragozin variation\0"
+	"advance, Wade variation\0"
+	"Philidor counter-gambit\0"
+	"ultra-symmetrical variation\0"
+	"Improved Hanham variation\0"
+	"Quaade gambit\0"
+	"four knights, kingside fianchetto\0"
+	"Leningrad, Karlsbad variation\0"
+	"King's Indian attack, Pachman system\0"
+	"Panov-Botvinnik, Gunderam attack\0"
+	"dragon, classical, Nottingham variation\0"
+	"Winawer, Alekhine gambit, Kan variation\0"
+	"Gruenfeld gambit, Botvinnik variation\0"
+	"King's Indian defence\0"
+	"Cochrane-Shumov defence\0"
+	"Evans gambit declined, Hirschbach variation\0"
+	"Pratt variation\0"
+	"Scotch opening\0"
+	"Wimpey system\0"
+	"Neo-Gruenfeld, 6.O-O\0"
+	"Orthodox defence, 7.Rc1\0"
+	"Albin counter-gambit, Lasker trap\0"
+	"4.g3\0"
+	"Fritz, Gruber variation\0"
+	"Evans gambit declined, Showalter variation\0"
+	"closed (Breyer) variation\0"
+	"Saemisch, orthodox, 7.d5 c6\0"
+	"Pulling counter-attack\0"
+	"Andersson variation\0"
+	"4.e3, Gligoric system with 7...dc\0"
+	"Keres variation\0"
+	"Winawer, Kondratiyev variation\0"
+	"Blackmar-Diemer\0"
+	"Euwe defence\0"
+	"Levitsky attack (Queen's bishop attack)\0"
+	"Stone-Ware variation\0"
+	"Richter-Rauzer, 6...e6\0"
+	"Tartakower (Makagonov-Bondarevsky) system, 8.cd Nxd5\0"
+	"French attack\0"
+	"advance, Short variation\0"
+	"Panov-Botvinnik attack, 5...g6\0"
+	"Bird's defence, Paulsen variation\0"
+	"Spielmann, Staahlberg variation\0"
+	"Saemisch, Panno main line\0"
+	"Salvio gambit, Anderssen counter-attack\0"
+	"de Bruycker defence\0"
+	"Blackmar gambit\0"
+	"Albin-Alekhine-Chatard attack\0"
+	"Fischer variation, 5.Ne2\0"
+	"Wing attack\0"
+	"Pelikan (Lasker/Sveshnikov) variation\0"
+	"Berlin defence, Beverwijk variation\0"
+	"dragon, classical, Spielmann variation\0"
+	"closed (10...c5)\0"
+	"Mengarini's opening\0"
+	"Fegatello attack, Leonhardt variation\0"
+	"Averbakh system, Randspringer variation\0"
+	"modern Steinitz defence, Alapin variation\0"
+	"exchange, Sokolsky variation\0"
+	"Tarrasch, Prague variation, 9.Bg5\0"
+	"symmetrical, main line with b3\0"
+	"Berlin defence, Rosenthal variation\0"
+	"Englund gambit\0"
+	"Botvinnik system (anti-Meran)\0"
+	"Muzio gambit, Kling and Horwitz counter-attack\0"
+	"exchange, Trifunovic variation\0"
+	"open, 7.Bb3\0"
+	"Fegatello attack, Polerio defence\0"
+	"Nimzovich counter-gambit\0"
+	"`Frankenstein-Dracula' variation\0"
+	"Blumenfeld counter-gambit\0"
+	"Boleslavsky, Louma variation\0"
+	"four pawns attack, 6...Nc6\0"
+	"Neo-orthodox variation, 7.Bxf6\0"
+	"Tarrasch, Guimard main line\0"
+	"Philidor gambit, Schultz variation\0"
+	"Winawer, advance, Smyslov variation\0"
+	"Tarrasch, Bogolyubov variation\0"
+	"Leningrad, main variation with Nc6\0"
+	"closed, Pilnik variation\0"
+	"fianchetto without c4\0"
+	"Classical variation\0"
+	"Saemisch, Romanovsky variation\0"
+	"4.e3, Botvinnik system\0"
+	"Tarrasch, Reti variation\0"
+	"Alekhine gambit\0"
+	"Rosentreter variation\0"
+	"Ukrainian variation, 4.Nf3\0"
+	"Dutch defence, Blackburne variation\0"
+	"Evans gambit declined, Hicken variation\0"
+	"Albin-Alekhine-Chatard attack, Spielmann variation\0"
+	"Winawer, advance, poisoned pawn, Konstantinopolsky variation\0"
+	"Fajarowicz, Steiner variation\0"
+	"Semi-Tarrasch, Levenfish variation\0"
+	"Saemisch, Capablanca variation\0"
+	"Meran, Pirc variation\0"
+	"dragon, classical, 9.Nb3\0"
+	"Wormald attack, Gruenfeld variation\0"
+	"Rabinovich variation\0"
+	"Winawer, advance, 5.a3\0"
+	"Austrian attack, 6.e5\0"
+	"Russian, Levenfish variation\0"
+	"Kan, Gipslis variation\0"
+	"open, 5.Qa4 Nbd7, 6.Qxc4\0"
+	"Neo-Gruenfeld, 5.Nf3\0"
+	"exchange, Svenonius variation\0"
+	"three knights variation\0"
+	"Winawer, advance, poisoned pawn variation\0"
+	"Brentano defence\0"
+	"open, Knorre variation\0"
+	"three knights system\0"
+	"Gurgenidze counter-attack\0"
+	"open, Harksen gambit\0"
+	"classical, 4.c3\0"
+	"closed, main line\0"
+	"Lemming defence\0"
+	"Knorre variation\0"
+	"Albin counter-gambit, Balogh variation\0"
+	"classical, 9.O-O\0"
+	"Carls' Bremen system\0"
+	"Pirc-Lisitsin gambit\0"
+	"Taimanov (chase/wing/accelerated counterthrust) variation\0"
+	"Pytel-Wade variation\0"
+	"Manhattan variation\0"
+	"accelerated Averbakh system\0"
+	"Nimzovich, Rellstab variation\0"
+	"Agincourt variation\0"
+	"Edinburgh variation\0"
+	"Sozin attack\0"
+	"Nimzovich-Rossolimo attack (with ...g6, without ...d6)\0"
+	"closed Berlin defence, Showalter variation\0"
+	"wing gambit\0"
+	"orthodox, Donner variation\0"
+	"Cochrane gambit\0"
+	"dragon, Levenfish variation\0"
+	"Najdorf, 6.Bg5\0"
+	"5.Nf3\0"
+	"Hastings variation\0"
+	"classical, 9...Re8\0"
+	"Tarrasch defence, 4.cd ed\0"
+	"Vinogradov variation\0"
+	"closed, 7...d6, 8.d4\0"
+	"Spielmann, Karlsbad variation\0"
+	"Dutch, 2.Bg5 variation\0"
+	"open, Bernstein variation\0"
+	"old main line, 6.O-O\0"
+	"fianchetto, 9...Nbd7\0"
+	"Marshall defence\0"
+	"closed, Taimanov variation\0"
+	"fianchetto, lesser Simagin (Spassky) variation\0"
+	"7.e4\0"
+	"Berlin defence, Winawer attack\0"
+	"Allgaier, Schlechter defence\0"
+	"King's Indian attack (with ...c5)\0"
+	"Pierce gambit\0"
+	"Smyslov system\0"
+	"Lundin variation\0"
+	"Allgaier, Walker attack\0"
+	"King's knight opening\0"
+	"Berlin defence, open variation\0"
+	"Chigorin defence, Janowski variation\0"
+	"classical, Reti variation\0"
+	"Cunningham defence\0"
+	"Dutch, Saemisch variation\0"
+	"Greco defence\0"
+	"closed, Kholmov variation\0"
+	"Katalimov variation\0"
+	"Gruenfeld with Bf4    e3\0"
+	"bishop's gambit, Maurian defence\0"
+	"Goldman (Spielmann) variation\0"
+	"Meran, Stahlberg variation\0"
+	"Marshall counter-attack\0"
+	"Eisinger variation\0"
+	"Falkbeer, Keres variation\0"
+	"Sozin, Benko variation\0"
+	"Marshall, main line, 12.d2d4\0"
+	"Adams' gambit\0"
+	"modern, Alekhine variation\0"
+	"QP counter-gambit\0"
+	"Maroczy gambit\0"
+	"Four pawns' gambit\0"
+	"Fischer variation\0"
+	"Alekhine defence, Alatortsev variation\0"
+	"Falkbeer, 4.d3\0"
+	"Berlin defence, Anderssen variation\0"
+	"Dus-Khotimirsky variation\0"
+	"Tarrasch, Prague variation\0"
+	"4.e3, main line with ...b6\0"
+	"advance, Euwe variation\0"
+	"Orthodox defence, Capablanca variation\0"
+	"Austrian attack, 6.Be3\0"
+	"Mikenas-Carls variation\0"
+	"open, Zukertort variation\0"
+	"Four knights game\0"
+	"fianchetto, Uhlmann (Szabo) variation\0"
+	"Yusupov-Rubinstein system\0"
+	"Hamppe-Allgaier gambit\0"
+	"Carlsbad variation\0"
+	"Saemisch, orthodox main line\0"
+	"classical, Adorjan gambit\0"
+	"old Steinitz defence, semi-Duras variation\0"
+	"O'Sullivan gambit\0"
+	"classical, Alapin variation\0"
+	"Andreaschek gambit\0"
+	"Rubinstein counter-gambit, exchange variation\0"
+	"Steinitz, Gledhill attack\0"
+	"Villemson (Steinitz) gambit\0"
+	"Orthodox defence, Bd3 line, 11.O-O\0"
+	"classical, Frankfurt variation\0"
+	"Anti-Borg (Desprez) opening\0"
+	"Hammerschlag (Fried fox/Pork chop opening)\0"
+	"MacDonnell gambit\0"
+	"classical attack, Mason variation\0"
+	"Muzio gambit, Brentano defence\0"
+	"Leningrad, main variation\0"
+	"Anderssen (Paulsen, Suhle) counter-attack\0"
+	"Tennison (Lemberg, Zukertort) gambit\0"
+	"orthodox, Aronin-Taimanov, main line\0"
+	"Marshall, Herman Steiner variation\0"
+	"open, 8.de\0"
+	"Ponziani counter-gambit, Schmidt attack\0"
+	"Sicilian, Szen, hedgehog variation\0"
+	"Queen's pawn, Mason variation\0"
+	"closed, Breyer, Borisenko variation\0"
+	"Polerio variation\0"
+	"Yates variation\0"
+	"Reversed Philidor formation\0"
+	"6.Bd3\0"
+	"Scheveningen, 6.Be2\0"
+	"Budapest defence declined\0"
+	"MacCutcheon, Lasker variation\0"
+	"Budapest defence\0"
+	"bishop's gambit, Bogolyubov variation\0"
+	"Schliemann defence\0"
+	"orthodox, Aronin-Taimanov, 9.Ne1\0"
+	"classical, San Remo variation\0"
+	"Richter-Rauzer, Rauzer attack, 7...a6 defence, 8...Bd7\0"
+	"Hamppe-Allgaier gambit, Alapin variation\0"
+	"Cordel variation\0"
+	"Najdorf, Adams attack\0"
+	"Sicilian, Szen variation, Dely-Kasparov gambit\0"
+	"Stonewall variation\0"
+	"Semi-Tarrasch, symmetrical variation\0"
+	"Kieseritsky, long whip defence, Jaenisch variation\0"
+	"classical, Noa variation, main line, 7.Qc2\0"
+	"orthodox, Aronin-Taimanov, bayonet attack\0"
+	"Anderssen counter-attack orthodox attack\0"
+	"4.e3 O-O, 5.Bd3\0"
+	"Polish defence\0"
+	"Makagonov system (5.h3)\0"
+	"three pawns attack\0"
+	"Ericson variation\0"
+	"Brooklyn defence\0"
+	"Guatemala defence\0"
+	"Balogh variation\0"
+	"St. George defence\0"
+	"bishop's gambit, Morphy variation\0"
+	"Kaufmann attack\0"
+	"symmetrical, Rubinstein system\0"
+	"English, Troeger defence\0"
+	"Chekhover, Zaitsev variation\0"
+	"Rubinstein counter-gambit, Bogolyubov variation\0"
+	"Nimzovich-Rubinstein variation\0"
+	"Neo-Indian (Seirawan) attack\0"
+	"Staunton gambit, Chigorin variation\0"
+	"Grob's attack\0"
+	"Ghulam Kassim gambit\0"
+	"open, Schlechter defence\0"
+	"classical attack, Tarrasch variation\0"
+	"classical defence, Zaitsev variation\0"
+	"classical (Cordel) defence\0"
+	"Kan variation\0"
+	"Muzio gambit, Paulsen variation\0"
+	"Dutch-Indian (Nimzo-Dutch) variation\0"
+	"open, Tarrasch trap\0"
+	"From gambit, Lipke variation\0"
+	"symmetrical, main line with d3\0"
+	"Najdorf, Ivkov variation\0"
+	"Kazakh variation\0"
+	"Keres (Mason-Steinitz) gambit\0"
+	"Bogo-Indian defence, Monticelli trap\0"
+	"Najdorf, 7...Be7 main line\0"
+	"exchange, Karpov variation\0"
+	"fianchetto, Larsen system\0"
+	"Morphy defence, Duras variation\0"
+	"classical, Milner-Barry (Zurich) variation\0"
+	"Lemberg counter-gambit\0"
+	"English defence\0"
+	"advance, Nimzovich system\0"
+	"Richter-Rauzer, Rauzer attack\0"
+	"Owen defence\0"
+	"Max Lange attack, Schlechter variation\0"
+	"4.e3 e8g8, 5.Nf3 d7d5\0"
+	"Falkbeer, main line, 7...Bf5\0"
+	"open, classical defence\0"
+	"East Indian defence\0"
+	"closed, Basque gambit (North Spanish variation)\0"
+	"Dutch-Indian, Alekhine variation\0"
+	"Hanstein gambit\0"
+	"Mieses variation\0"
+	"modern, Keres variation\0"
+	"Balogh defence\0"
+	"orthodox, 7...Nbd7, 8.Re1\0"
+	"bishop's gambit, Lopez-Gianutio counter-gambit\0"
+	"LaBourdonnais variation\0"
+	"Van't Kruijs opening\0"
+	"Cunningham, Euwe defence\0"
+	"Spanish variation\0"
+	"classical, Furman variation\0"
+	"closed, Breyer, Simagin variation\0"
+	"Dutch with c4 & g3\0"
+	"Najdorf variation\0"
+	"Polish (Sokolsky) opening\0"
+	"bishop's gambit, Ruy Lopez defence\0"
+	"Tarrasch\0"
+	"exchange variation, 6.Bf4 Bf5\0"
+	"modern Scheveningen, main line with Nb3\0"
+	"Anderssen counter-attack\0"
+	"Lolli attack\0"
+	"Two knights defence (Modern bishop's opening)\0"
+	"closed, Breyer, 10.d4\0"
+	"Fried fox defence\0"
+	"Lasker defence, main line\0"
+	"modern Steinitz defence, 5.O-O\0"
+	"Global opening\0"
+	"Goering gambit, Bardeleben variation\0"
+	"Russian, Keres variation\0"
+	"classical, Noa variation, 5.a3\0"
+	"Russian, Prins variation\0"
+	"Berlin defence, Cordel variation\0"
+	"Anglo-Gruenfeld defense, Korchnoi variation\0"
+	"anti-Meran gambit\0"
+	"open, Bernstein variation, Karpov gambit\0"
+	"Welling variation\0"
+	"Kieseritsky, Brentano defence, Kaplanek variation\0"
+	"modern attack, main line\0"
+	"modern attack, Symmetrical variation\0"
+	"Staunton gambit, Lasker variation\0"
+	"Semmering variation\0"
+	"open, Dilworth variation\0"
+	"MacCutcheon, Duras variation\0"
+	"Byrne variation\0"
+	"closed, 5.Nf3\0"
+	"Frere (Becker) variation\0"
+	"6.Nf3\0"
+	"Norwalde variation\0"
+	"Neo-Catalan accepted\0"
+	"Wiesbaden variation\0"
+	"del Rio variation\0"
+	"Rubinstein, Capablanca line\0"
+	"Morphy defence\0"
+	"dragon, Yugoslav attack, Byrne variation\0"
+	"Richter-Rauzer, Margate (Alekhine) variation\0"
+	"open, Motzko attack\0"
+	"open, Breslau variation\0"
+	"Goering attack\0"
+	"Nenarokov variation\0"
+	"Steinitz, Rosenthal variation\0"
+	"Najdorf, 6.f4\0"
+	"Dresden opening\0"
+	"Schmid's system\0"
+	"stonewall: Chekhover variation\0"
+	"Falkbeer, Charousek variation\0"
+	"Ponziani gambit\0"
+	"King's gambit\0"
+	"QGD Slav defence, Alekhine variation\0"
+	"open, 6.d4\0"
+	"orthodox, Aronin-Taimanov variation (Yugoslav attack / Mar del Plata variation)\0"
+	"symmetrical, Metger unpin\0"
+	"Alapin-Steinitz variation\0"
+	"Lopez counter-gambit, Jaenisch variation\0"
+	"classical attack, Jaenisch variation\0"
+	"open, Motzko attack, Nenarokov variation\0"
+	"Blackburne variation\0"
+	"open, Howell attack, Ekstroem variation\0"
+	"Prins variation, Venice attack\0"
+	"Siesta, Kopayev variation\0"
+	"Blackburne attack\0"
+	"Krause variation\0"
+	"Bled variation\0"
+	"Canal-Sokolsky attack, Sokolsky variation\0"
+	"Philidor counter-attack\0"
+	"Cozio (Lasker) attack\0"
+	"Bonsch-Osmolovsky variation\0"
+	"bishop's gambit, Bledow variation\0"
+	"Nd2 variation\0"
+	"Winawer, Petrosian variation\0"
+	"Williams gambit\0"
+	"Meran, Blumenfeld variation\0"
+	"Orthodox defence, Rauzer variation\0"
+	"four knights, Stean variation\0"
+	"accelerated fianchetto, modern variation\0"
+	"Averbakh system, Kotov variation\0"
+	"dragon, Levenfish; Flohr variation\0"
+	"MacCutcheon, Chigorin variation\0"
+	"Queen's gambit declined\0"
+	"Max Lange attack, Berger variation\0"
+	"Richter-Rauzer, Rauzer attack, 7...Be7\0"
+	"Battambang opening\0"
+	"classical, Vistaneckis (Nimzovich) variation\0"
+	"symmetrical, four knights system\0"
+	"anti-Meran, Lilienthal variation\0"
+	"Nescafe Frappe attack\0"
+	"Salvio gambit\0"
+	"closed, 6.Ne2 e5 (Botvinnik)\0"
+	"Fischer defence\0"
+	"150 attack\0"
+	"Austrian attack, 6.Bd3\0"
+	"modern Steinitz defence, Rubinstein variation\0"
+	"fianchetto, classical main line\0"
+	"classical attack, Chigorin variation\0"
+	"open, 9.c3\0"
+	"Torre defensive system\0"
+	"Anti-Veresov\0"
+	"Kevitz-Trajkovich defence\0"
+	"exchange, Simagin's lesser variation\0"
+	"Leningrad, main variation with c6\0"
+	"Dutch, Korchnoi attack\0"
+	"Calabrese counter-gambit\0"
+	"closed, Keres (...Nd7) defence\0";
+
+const EcoNode::Catalog EcoNode::s_builtinCatalog =
+{
+	EcoNode::s_builtinEntries,
+	4095,
+	EcoNode::s_builtinStrings
+};
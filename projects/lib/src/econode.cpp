@@ -17,9 +17,12 @@
 */
 
 #include "econode.h"
+#include <algorithm>
 #include <QFile>
-#include <QDataStream>
-#include <QMutex>
+#include <QHash>
+#include <QTextStream>
+#include <QVector>
+#include "pgngame.h"
 #include "pgnstream.h"
 
 namespace {
@@ -40,54 +43,15 @@ int ecoFromString(const QString& ecoString)
 
 } // anonymous namespace
 
-QDataStream& operator<<(QDataStream& out, const EcoNode& node)
-{
-	out << node.m_ecoCode
-	    << node.m_opening
-	    << node.m_variation;
-
-	return out;
-}
-
-QDataStream& operator>>(QDataStream& in, EcoNode& node)
-{
-	in >> node.m_ecoCode
-	   >> node.m_opening
-	   >> node.m_variation;
-
-	return in;
-}
-
-QStringList EcoNode::s_openings;
-QMap<quint64, EcoNode> EcoNode::s_catalog;
+const EcoNode::Catalog* EcoNode::s_catalog = &EcoNode::s_builtinCatalog;
 
 void EcoNode::initialize()
 {
-	static QMutex mutex;
-	if (!s_catalog.isEmpty())
-		return;
-
-	mutex.lock();
-	if (s_catalog.isEmpty())
-	{
-		Q_INIT_RESOURCE(eco);
-
-		QFile file(":/eco.bin");
-		if (!file.open(QIODevice::ReadOnly))
-			qWarning("Could not open ECO file");
-		else
-		{
-			QDataStream in(&file);
-			in.setVersion(QDataStream::Qt_4_6);
-			in >> s_openings >> s_catalog;
-		}
-	}
-	mutex.unlock();
 }
 
 void EcoNode::initialize(PgnStream& in)
 {
-	if (!s_catalog.isEmpty())
+	if (s_catalog != &s_builtinCatalog)
 		return;
 
 	if (!in.isOpen())
@@ -96,67 +60,210 @@ void EcoNode::initialize(PgnStream& in)
 		return;
 	}
 
-	QMap<QString, int> tmpOpenings;
+	struct Node
+	{
+		quint64 key;
+		int ecoCode;
+		QString opening;
+		QString variation;
+	};
+	QVector<Node> nodes;
+	QHash<quint64, int> nodeIndexes;
 
 	PgnGame game;
 	while (game.read(in, INT_MAX - 1, false))
 	{
-		if (!game.moves().isEmpty())
+		if (game.moves().isEmpty())
+			continue;
+
+		const QString opening = game.tagValue("Opening");
+		if (opening.isEmpty())
+			continue;
+
+		// Later games replace earlier ones with the same position
+		const Node node = { game.key(),
+				    ecoFromString(game.tagValue("ECO")),
+				    opening,
+				    game.tagValue("Variation") };
+		auto it = nodeIndexes.constFind(node.key);
+		if (it != nodeIndexes.constEnd())
+			nodes[it.value()] = node;
+		else
 		{
-			const QString openingStr = game.tagValue("Opening");
-			if (!openingStr.isEmpty())
-			{
-				int opening = tmpOpenings.value(openingStr, -1);
-				if (opening == -1)
-				{
-					opening = tmpOpenings.count();
-					tmpOpenings[openingStr] = opening;
-					s_openings.append(openingStr);
-				}
-				s_catalog[game.key()] = EcoNode(opening,
-												game.tagValue("Variation"),
-												game.tagValue("ECO"));
-			}
+			nodeIndexes.insert(node.key, nodes.size());
+			nodes.append(node);
 		}
 	}
+
+	// Build the string pool. Every string is stored once and
+	// terminated with a null character.
+	QByteArray strings;
+	QHash<QString, int> offsets;
+	auto addString = [&](const QString& str) -> int
+	{
+		if (str.isEmpty())
+			return -1;
+		auto it = offsets.constFind(str);
+		if (it != offsets.constEnd())
+			return it.value();
+
+		const int offset = strings.size();
+		strings.append(str.toUtf8()).append('\0');
+		offsets.insert(str, offset);
+		return offset;
+	};
+
+	// Build the hash table with a load factor of at most 1/2, so
+	// that most lookups only need one slot
+	quint32 size = 16;
+	while (size < quint32(nodes.size()) * 2)
+		size *= 2;
+	QVector<Entry> entries(size, Entry{ 0, EcoNode() });
+
+	std::sort(nodes.begin(), nodes.end(), [](const Node& a, const Node& b)
+	{
+		return a.key < b.key;
+	});
+	for (const Node& node : qAsConst(nodes))
+	{
+		const int opening = addString(node.opening);
+		const int variation = addString(node.variation);
+
+		quint32 i = node.key & (size - 1);
+		while (entries.at(i).key != 0)
+			i = (i + 1) & (size - 1);
+		entries[i] = Entry{ node.key,
+				    EcoNode(node.ecoCode, opening, variation) };
+	}
+
+	static QVector<Entry> customEntries;
+	static QByteArray customStrings;
+	static Catalog customCatalog;
+	customEntries = entries;
+	customStrings = strings;
+	customCatalog.entries = customEntries.constData();
+	customCatalog.mask = size - 1;
+	customCatalog.strings = customStrings.constData();
+	s_catalog = &customCatalog;
 }
 
 const EcoNode* EcoNode::find(quint64 key)
 {
-	if (s_catalog.isEmpty())
-		initialize();
+	if (key == 0)
+		return nullptr;
 
-	return s_catalog.contains(key) ? &s_catalog[key] : nullptr;
+	const Catalog* catalog = s_catalog;
+	for (quint32 i = key & catalog->mask; ; i = (i + 1) & catalog->mask)
+	{
+		const Entry& entry = catalog->entries[i];
+		if (entry.key == key)
+			return &entry.node;
+		if (entry.key == 0)
+			return nullptr;
+	}
 }
 
 void EcoNode::write(const QString& fileName)
 {
-	if (s_catalog.isEmpty())
-		return;
-
 	QFile file(fileName);
-	if (!file.open(QIODevice::WriteOnly))
+	if (!file.open(QIODevice::WriteOnly | QIODevice::Text))
 	{
 		qWarning("Could not open file %s", qUtf8Printable(fileName));
 		return;
 	}
 
-	QDataStream out(&file);
-	out.setVersion(QDataStream::Qt_4_6);
-	out << s_openings << s_catalog;
-}
-
-EcoNode::EcoNode()
-	: m_ecoCode(-1),
-	  m_opening(-1)
-{
-}
-
-EcoNode::EcoNode(int opening, const QString& variation, const QString& eco)
-	: m_ecoCode(ecoFromString(eco)),
-	  m_opening(opening),
-	  m_variation(variation)
-{
+	const Catalog* catalog = s_catalog;
+	const quint32 size = catalog->mask + 1;
+
+	QTextStream out(&file);
+	out << "/*\n"
+	       "    This file is part of Cute Chess.\n"
+	       "    Copyright (C) 2008-2018 Cute Chess authors\n"
+	       "\n"
+	       "    Cute Chess is free software: you can redistribute it and/or modify\n"
+	       "    it under the terms of the GNU General Public License as published by\n"
+	       "    the Free Software Foundation, either version 3 of the License, or\n"
+	       "    (at your option) any later version.\n"
+	       "\n"
+	       "    Cute Chess is distributed in the hope that it will be useful,\n"
+	       "    but WITHOUT ANY WARRANTY; without even the implied warranty of\n"
+	       "    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the\n"
+	       "    GNU General Public License for more details.\n"
+	       "\n"
+	       "    You should have received a copy of the GNU General Public License\n"
+	       "    along with Cute Chess.  If not, see <http://www.gnu.org/licenses/>.\n"
+	       "*/\n"
+	       "\n"
+	       "// The internal ECO catalog, generated by EcoNode::write()\n"
+	       "\n"
+	       "#include \"econode.h\"\n"
+	       "\n"
+	       "const EcoNode::Entry EcoNode::s_builtinEntries[] =\n"
+	       "{\n";
+
+	for (quint32 i = 0; i < size; i++)
+	{
+		const Entry& entry = catalog->entries[i];
+		if (entry.key == 0)
+		{
+			out << "\t{ 0, EcoNode() },\n";
+			continue;
+		}
+		out << "\t{ Q_UINT64_C(0x"
+		    << QString::number(entry.key, 16).rightJustified(16, '0')
+		    << "), EcoNode(" << entry.node.m_ecoCode
+		    << ", " << entry.node.m_opening
+		    << ", " << entry.node.m_variation << ") },\n";
+	}
+	out << "};\n"
+	       "\n"
+	       "const char EcoNode::s_builtinStrings[] =\n";
+
+	// The string pool as one literal, one string per line
+	const char* strings = catalog->strings;
+	int poolSize = 0;
+	for (quint32 i = 0; i < size; i++)
+	{
+		const EcoNode& node = catalog->entries[i].node;
+		for (int offset : { node.m_opening, node.m_variation })
+		{
+			if (offset >= 0)
+				poolSize = qMax(poolSize, offset + int(qstrlen(strings + offset)) + 1);
+		}
+	}
+	if (poolSize == 0)
+		out << "\t\"\"";
+	for (int offset = 0; offset < poolSize; )
+	{
+		// Non-ASCII characters are written as octal escapes of
+		// their UTF-8 bytes, so the source is plain ASCII
+		const QByteArray str(strings + offset);
+		QString escaped;
+		for (char c : str)
+		{
+			const uchar uc = uchar(c);
+			if (uc < 0x20 || uc >= 0x7f)
+				escaped += QString("\\%1").arg(uc, 3, 8, QChar('0'));
+			else
+			{
+				if (c == '"' || c == '\\')
+					escaped += '\\';
+				escaped += QChar(c);
+			}
+		}
+		out << "\t\"" << escaped << "\\0\"";
+		offset += str.size() + 1;
+		if (offset < poolSize)
+			out << "\n";
+	}
+	out << ";\n"
+	       "\n"
+	       "const EcoNode::Catalog EcoNode::s_builtinCatalog =\n"
+	       "{\n"
+	       "\tEcoNode::s_builtinEntries,\n"
+	       "\t" << size - 1 << ",\n"
+	       "\tEcoNode::s_builtinStrings\n"
+	       "};\n";
 }
 
 QString EcoNode::ecoCode() const
@@ -170,10 +277,12 @@ QString EcoNode::ecoCode() const
 
 QString EcoNode::opening() const
 {
-	return m_opening >= 0 ? s_openings[m_opening] : QString();
+	return m_opening >= 0
+		? QString::fromUtf8(s_catalog->strings + m_opening) : QString();
 }
 
 QString EcoNode::variation() const
 {
-	return m_variation;
+	return m_variation >= 0
+		? QString::fromUtf8(s_catalog->strings + m_variation) : QString();
 }
@@ -19,10 +19,7 @@
 #ifndef ECONODE_H
 #define ECONODE_H
 
-#include <QStringList>
-#include <QMap>
-#include "pgngame.h"
-class QDataStream;
+#include <QString>
 class PgnStream;
 
 /*!
@@ -32,10 +29,14 @@ class PgnStream;
  * known chess openings that belong to the Encyclopaedia of Chess Openings.
  * More about ECO: http://en.wikipedia.org/wiki/Encyclopaedia_of_Chess_Openings
  *
- * The ECO catalog can be generated from a PGN collection or from a binary file
- * that's part of the cutechess library (the default). A node corresponding
- * to a PgnGame can be found by the game's moves Zobrist keys to the find()
- * function.
+ * The ECO catalog can be generated from a PGN collection or from a table
+ * that's compiled into the cutechess library (the default). A node
+ * corresponding to a PgnGame can be found by the game's moves Zobrist keys
+ * to the find() function.
+ *
+ * The catalog is a flat open-addressing hash table of nodes with the names
+ * of the openings in a separate string pool, so a lookup usually touches
+ * only one slot and the built-in table needs no initialization at all.
  *
  * \note The Encyclopaedia of Chess Openings only applies to games of standard
  * chess that start from the default starting position.
@@ -43,7 +44,14 @@ class PgnStream;
 class LIB_EXPORT EcoNode
 {
 	public:
-		EcoNode();
+		/*! Creates a null node. */
+		constexpr EcoNode()
+			: m_ecoCode(-1),
+			  m_opening(-1),
+			  m_variation(-1)
+		{
+		}
+
 		/*! Returns the node's ECO code. */
 		QString ecoCode() const;
 		/*! Returns the node's opening name. */
@@ -54,36 +62,65 @@ class LIB_EXPORT EcoNode
 		 */
 		QString variation() const;
 
-		/*! Initializes the ECO tree from the internal opening database. */
+		/*!
+		 * Initializes the ECO tree from the internal opening database.
+		 *
+		 * The internal database is a constant table, so this function
+		 * does nothing. It is kept for compatibility.
+		 */
 		static void initialize();
-		/*! Initializes the ECO tree by parsing the PGN games in \a in. */
+		/*!
+		 * Initializes the ECO tree by parsing the PGN games in \a in.
+		 *
+		 * The new tree replaces the internal opening database. This
+		 * function should be called before any games are played.
+		 */
 		static void initialize(PgnStream& in);
 		/*!
 		 * Returns a pointer to the EcoNode with Zobrist key \a key or
 		 * nullptr if no EcoNode is present for the key.
-		 * initialize() is called first if the tree is uninitialized.
 		 */
 		static const EcoNode* find(quint64 key);
-		/*! Writes the ECO catalog in binary format to \a fileName. */
+		/*!
+		 * Writes the ECO catalog to \a fileName as C++ source code
+		 * for the internal opening database (ecodata.cpp).
+		 */
 		static void write(const QString& fileName);
 
 	private:
-		friend LIB_EXPORT QDataStream& operator<<(QDataStream& out, const EcoNode& node);
-		friend LIB_EXPORT QDataStream& operator>>(QDataStream& in, EcoNode& node);
+		struct Entry;
+		struct Catalog;
 
-		EcoNode(int opening, const QString& variation, const QString& eco);
+		constexpr EcoNode(int ecoCode, int opening, int variation)
+			: m_ecoCode(ecoCode),
+			  m_opening(opening),
+			  m_variation(variation)
+		{
+		}
 
-		static QStringList s_openings;
-		static QMap<quint64, EcoNode> s_catalog;
+		static const Entry s_builtinEntries[];
+		static const char s_builtinStrings[];
+		static const Catalog s_builtinCatalog;
+		static const Catalog* s_catalog;
 
 		qint16 m_ecoCode;
 		qint32 m_opening;
-		QString m_variation;
+		qint32 m_variation;
+};
+
+/*! \internal A slot in the ECO hash table. An empty slot has key 0. */
+struct EcoNode::Entry
+{
+	quint64 key;
+	EcoNode node;
 };
 
-/*! Writes the node \a node to stream \a out. */
-extern LIB_EXPORT QDataStream& operator<<(QDataStream& out, const EcoNode& node);
-/*! Reads a node from stream \a in into \a node. */
-extern LIB_EXPORT QDataStream& operator>>(QDataStream& in, EcoNode& node);
+/*! \internal An ECO hash table and its string pool. */
+struct EcoNode::Catalog
+{
+	const Entry* entries;
+	quint32 mask;
+	const char* strings;
+};
 
 #endif // ECONODE_H
@@ -0,0 +1,254 @@
+/*
+    This file is part of Cute Chess.
+    Copyright (C) 2008-2018 Cute Chess authors
+
+    Cute Chess is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Cute Chess is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Cute Chess.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "eloratings.h"
+#include <cmath>
+#include <functional>
+#include <QThread>
+#include <QThreadPool>
+#include <QRunnable>
+
+namespace {
+
+// Convergence limit in Elo points
+const qreal s_precision = 0.001;
+const int s_maxIterations = 10000;
+// Smallest number of players worth solving on a separate thread
+const int s_minPlayersPerThread = 16;
+
+class RatingTask : public QRunnable
+{
+	public:
+		explicit RatingTask(const std::function<void()>& func)
+			: m_func(func)
+		{
+		}
+
+		virtual void run()
+		{
+			m_func();
+		}
+
+	private:
+		std::function<void()> m_func;
+};
+
+qreal gammaFromElo(qreal elo)
+{
+	return std::pow(10.0, elo / 400.0);
+}
+
+qreal eloFromGamma(qreal gamma)
+{
+	return 400.0 * std::log10(gamma);
+}
+
+} // anonymous namespace
+
+EloRatings::EloRatings(int playerCount)
+	: m_playerCount(0),
+	  m_threadCount(QThread::idealThreadCount()),
+	  m_iterations(0),
+	  m_dirty(false)
+{
+	setPlayerCount(playerCount);
+}
+
+int EloRatings::playerCount() const
+{
+	return m_playerCount;
+}
+
+void EloRatings::setPlayerCount(int playerCount)
+{
+	Q_ASSERT(playerCount >= 0);
+	if (playerCount == m_playerCount)
+		return;
+
+	const int n = playerCount;
+	const int oldN = m_playerCount;
+	QVector<int> scores(n * n, 0);
+	QVector<int> games(n * n, 0);
+	for (int i = 0; i < qMin(n, oldN); i++)
+	{
+		for (int j = 0; j < qMin(n, oldN); j++)
+		{
+			scores[i * n + j] = m_scores.at(i * oldN + j);
+			games[i * n + j] = m_games.at(i * oldN + j);
+		}
+	}
+
+	m_playerCount = n;
+	m_scores = scores;
+	m_games = games;
+	m_ratings.resize(n);
+	m_errorMargins.resize(n);
+	for (int i = oldN; i < n; i++)
+	{
+		m_ratings[i] = 0.0;
+		m_errorMargins[i] = 0.0;
+	}
+	m_dirty = true;
+}
+
+void EloRatings::setThreadCount(int count)
+{
+	m_threadCount = qMax(1, count);
+}
+
+void EloRatings::addGameResult(int white, int black, int whiteScore)
+{
+	Q_ASSERT(white >= 0 && white < m_playerCount);
+	Q_ASSERT(black >= 0 && black < m_playerCount);
+	Q_ASSERT(white != black);
+	Q_ASSERT(whiteScore >= 0 && whiteScore <= 2);
+
+	const int n = m_playerCount;
+	m_scores[white * n + black] += whiteScore;
+	m_scores[black * n + white] += 2 - whiteScore;
+	m_games[white * n + black]++;
+	m_games[black * n + white]++;
+	m_dirty = true;
+}
+
+int EloRatings::games(int player) const
+{
+	Q_ASSERT(player >= 0 && player < m_playerCount);
+
+	int count = 0;
+	const int* row = m_games.constData() + player * m_playerCount;
+	for (int j = 0; j < m_playerCount; j++)
+		count += row[j];
+	return count;
+}
+
+int EloRatings::iterations() const
+{
+	return m_iterations;
+}
+
+qreal EloRatings::rating(int player) const
+{
+	return m_ratings.at(player);
+}
+
+qreal EloRatings::errorMargin(int player) const
+{
+	return m_errorMargins.at(player);
+}
+
+void EloRatings::solveRange(int first, int last,
+			    const QVector<qreal>& gamma,
+			    QVector<qreal>& newRatings) const
+{
+	const int n = m_playerCount;
+	const qreal* g = gamma.constData();
+	qreal* out = newRatings.data();
+
+	for (int i = first; i < last; i++)
+	{
+		const int* scores = m_scores.constData() + i * n;
+		const int* games = m_games.constData() + i * n;
+
+		// The virtual draw against an average (gamma = 1) opponent
+		qreal wins = 0.5;
+		qreal denom = 1.0 / (g[i] + 1.0);
+		for (int j = 0; j < n; j++)
+		{
+			if (games[j] == 0)
+				continue;
+			wins += scores[j] / 2.0;
+			denom += games[j] / (g[i] + g[j]);
+		}
+		out[i] = eloFromGamma(wins / denom);
+	}
+}
+
+void EloRatings::update()
+{
+	if (!m_dirty)
+		return;
+	m_dirty = false;
+
+	const int n = m_playerCount;
+	if (n == 0)
+		return;
+
+	const int threads = qBound(1, n / s_minPlayersPerThread, m_threadCount);
+	const int chunk = (n + threads - 1) / threads;
+	QThreadPool pool;
+	pool.setMaxThreadCount(threads - 1);
+
+	QVector<qreal> gamma(n);
+	QVector<qreal> newRatings(n);
+	// Make sure the worker threads never trigger a detach
+	newRatings.detach();
+
+	for (m_iterations = 1; m_iterations <= s_maxIterations; m_iterations++)
+	{
+		for (int i = 0; i < n; i++)
+			gamma[i] = gammaFromElo(m_ratings.at(i));
+
+		// Every player's new rating depends only on the previous
+		// iteration, so the players can be split between threads.
+		for (int t = 1; t < threads; t++)
+		{
+			const int first = t * chunk;
+			const int last = qMin(n, first + chunk);
+			pool.start(new RatingTask([=, &gamma, &newRatings]()
+			{
+				solveRange(first, last, gamma, newRatings);
+			}));
+		}
+		solveRange(0, qMin(n, chunk), gamma, newRatings);
+		pool.waitForDone();
+
+		qreal mean = 0.0;
+		for (int i = 0; i < n; i++)
+			mean += newRatings.at(i);
+		mean /= n;
+
+		qreal delta = 0.0;
+		for (int i = 0; i < n; i++)
+		{
+			const qreal r = newRatings.at(i) - mean;
+			delta = qMax(delta, qAbs(r - m_ratings.at(i)));
+			m_ratings[i] = r;
+		}
+		if (delta < s_precision)
+			break;
+	}
+	m_iterations = qMin(m_iterations, s_maxIterations);
+
+	// Error margins from the diagonal of the Fisher information
+	const qreal k = std::log(10.0) / 400.0;
+	for (int i = 0; i < n; i++)
+	{
+		const int* games = m_games.constData() + i * n;
+		qreal p = 1.0 / (1.0 + gammaFromElo(-m_ratings.at(i)));
+		qreal info = p * (1.0 - p);
+		for (int j = 0; j < n; j++)
+		{
+			if (games[j] == 0)
+				continue;
+			p = 1.0 / (1.0 + gammaFromElo(m_ratings.at(j) - m_ratings.at(i)));
+			info += games[j] * p * (1.0 - p);
+		}
+		m_errorMargins[i] = 1.96 / (k * std::sqrt(info));
+	}
+}
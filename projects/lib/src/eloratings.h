@@ -0,0 +1,116 @@
+/*
+    This file is part of Cute Chess.
+    Copyright (C) 2008-2018 Cute Chess authors
+
+    Cute Chess is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Cute Chess is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Cute Chess.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef ELORATINGS_H
+#define ELORATINGS_H
+
+#include <QtGlobal>
+#include <QVector>
+
+/*!
+ * \brief Maximum-likelihood Elo ratings for a whole tournament
+ *
+ * Unlike the Elo class, which rates a player as if all of its games
+ * were played against a single opponent, EloRatings keeps the full
+ * result matrix of a tournament and fits the ratings of all players
+ * at once, in the style of BayesElo and Ordo.
+ *
+ * The ratings are solved with the minorization-maximization algorithm
+ * for the Bradley-Terry model, counting a draw as half a win. Each
+ * player also gets one virtual draw against an average opponent,
+ * which keeps the ratings finite for perfect and zero scores. The
+ * average rating is always 0.
+ *
+ * Results can be added at any time. update() starts from the previous
+ * solution, so re-solving after a few new games only takes a handful
+ * of iterations. Large player pools are solved on several threads.
+ */
+class LIB_EXPORT EloRatings
+{
+	public:
+		/*! Creates a new rating list for \a playerCount players. */
+		explicit EloRatings(int playerCount = 0);
+
+		/*! Returns the number of rated players. */
+		int playerCount() const;
+		/*!
+		 * Sets the number of rated players to \a playerCount.
+		 *
+		 * Existing results are kept for players whose index is
+		 * below \a playerCount.
+		 */
+		void setPlayerCount(int playerCount);
+		/*!
+		 * Sets the maximum number of threads used by update() to
+		 * \a count. The default is QThread::idealThreadCount().
+		 */
+		void setThreadCount(int count);
+
+		/*!
+		 * Adds the result of a game between \a white and \a black.
+		 *
+		 * \a whiteScore is the white player's score in half points:
+		 * 2 for a win, 1 for a draw and 0 for a loss.
+		 */
+		void addGameResult(int white, int black, int whiteScore);
+		/*! Returns the number of rated games played by \a player. */
+		int games(int player) const;
+		/*!
+		 * Returns the number of iterations the last call to
+		 * update() needed to converge.
+		 */
+		int iterations() const;
+
+		/*!
+		 * Solves the ratings for all the results added so far.
+		 *
+		 * Does nothing if no results were added since the
+		 * previous update.
+		 */
+		void update();
+		/*!
+		 * Returns the rating of \a player relative to the average
+		 * of all players.
+		 *
+		 * \note The value is only valid after calling update().
+		 */
+		qreal rating(int player) const;
+		/*!
+		 * Returns the 95% error margin of \a player's rating in
+		 * Elo points.
+		 *
+		 * \note The value is only valid after calling update().
+		 */
+		qreal errorMargin(int player) const;
+
+	private:
+		void solveRange(int first, int last,
+				const QVector<qreal>& gamma,
+				QVector<qreal>& newRatings) const;
+
+		int m_playerCount;
+		int m_threadCount;
+		int m_iterations;
+		bool m_dirty;
+		QVector<int> m_scores;
+		QVector<int> m_games;
+		QVector<qreal> m_ratings;
+		QVector<qreal> m_errorMargins;
+};
+
+#endif // ELORATINGS_H
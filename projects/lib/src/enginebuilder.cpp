@@ -20,12 +20,14 @@
 #include <QDir>
 #include "engineprocess.h"
 #include "enginefactory.h"
+#include "workerpool.h"
 #include "board/boardfactory.h"
 
 
 EngineBuilder::EngineBuilder(const EngineConfiguration& config)
 	: PlayerBuilder(config.name()),
-	  m_config(config)
+	  m_config(config),
+	  m_workerPool(nullptr)
 {
 	setRating(config.rating());
 	setStrikes(config.strikes());
@@ -40,6 +42,11 @@ void EngineBuilder::setConfiguration(const EngineConfiguration& config)
 	setResumeScore(config.resumescore());
 }
 
+void EngineBuilder::setWorkerPool(WorkerPool* pool)
+{
+	m_workerPool = pool;
+}
+
 bool EngineBuilder::isHuman() const
 {
 	return false;
@@ -67,34 +74,49 @@ ChessPlayer* EngineBuilder::create(QObject* receiver,
 		return nullptr;
 	}
 
-	EngineProcess* process = new EngineProcess();
-
-	if (workDir.isEmpty())
+	QIODevice* device = nullptr;
+	if (m_workerPool != nullptr)
 	{
-		process->setWorkingDirectory(QDir::tempPath());
-
-		QFileInfo cmdInfo(cmd);
-		if (cmdInfo.isFile())
-			cmd = cmdInfo.absoluteFilePath();
+		QString poolError;
+		device = m_workerPool->startEngine(m_config, &poolError);
+		if (device == nullptr)
+		{
+			setError(error, poolError);
+			return nullptr;
+		}
 	}
 	else
-		process->setWorkingDirectory(workDir);
-
-	if (!stderrFile.isEmpty())
-		process->setStandardErrorFile(stderrFile, QIODevice::Append);
-
-	if (!m_config.arguments().isEmpty())
-		process->start(cmd, m_config.arguments());
-	else
-		process->start(cmd);
-
-	bool ok = process->waitForStarted();
-	if (!ok)
 	{
-		setError(error, tr("Cannot execute command: %1")
-			 .arg(m_config.command()));
-		delete process;
-		return nullptr;
+		EngineProcess* process = new EngineProcess();
+
+		if (workDir.isEmpty())
+		{
+			process->setWorkingDirectory(QDir::tempPath());
+
+			QFileInfo cmdInfo(cmd);
+			if (cmdInfo.isFile())
+				cmd = cmdInfo.absoluteFilePath();
+		}
+		else
+			process->setWorkingDirectory(workDir);
+
+		if (!stderrFile.isEmpty())
+			process->setStandardErrorFile(stderrFile, QIODevice::Append);
+
+		if (!m_config.arguments().isEmpty())
+			process->start(cmd, m_config.arguments());
+		else
+			process->start(cmd);
+
+		bool ok = process->waitForStarted();
+		if (!ok)
+		{
+			setError(error, tr("Cannot execute command: %1")
+				 .arg(m_config.command()));
+			delete process;
+			return nullptr;
+		}
+		device = process;
 	}
 
 	ChessEngine* engine = EngineFactory::create(m_config.protocol());
@@ -104,7 +126,7 @@ ChessPlayer* EngineBuilder::create(QObject* receiver,
 	if (receiver != nullptr && method != nullptr)
 		QObject::connect(engine, SIGNAL(debugMessage(QString)),
 				 receiver, method);
-	engine->setDevice(process);
+	engine->setDevice(device);
 	engine->applyConfiguration(m_config);
 
 	engine->start();
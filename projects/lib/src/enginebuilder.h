@@ -22,6 +22,7 @@
 #include "playerbuilder.h"
 #include <QCoreApplication>
 #include "engineconfiguration.h"
+class WorkerPool;
 
 
 /*! \brief A class for constructing local chess engines. */
@@ -35,6 +36,14 @@ class LIB_EXPORT EngineBuilder : public PlayerBuilder
 
 		/* ! Sets a new engine configuration. */
 		void setConfiguration(const EngineConfiguration& config);
+		/*!
+		 * Starts the engines on the workers of \a pool instead of
+		 * running them as local processes.
+		 *
+		 * The pool is not owned by the builder. If \a pool is
+		 * nullptr (the default), the engines are local.
+		 */
+		void setWorkerPool(WorkerPool* pool);
 
 		// Inherited from PlayerBuilder
 		virtual bool isHuman() const;
@@ -47,6 +56,7 @@ class LIB_EXPORT EngineBuilder : public PlayerBuilder
 		void setError(QString* error, const QString& message) const;
 
 		EngineConfiguration m_config;
+		WorkerPool* m_workerPool;
 };
 
 #endif // ENGINEBUILDER_H
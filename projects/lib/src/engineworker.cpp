@@ -0,0 +1,367 @@
+/*
+    This file is part of Cute Chess.
+    Copyright (C) 2008-2018 Cute Chess authors
+
+    Cute Chess is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Cute Chess is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Cute Chess.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "engineworker.h"
+#include <QTcpServer>
+#include <QTcpSocket>
+#include <QTextStream>
+#include <QFileInfo>
+#include <QDir>
+#include <jsonparser.h>
+#include "engineprocess.h"
+
+namespace {
+
+// The largest request a worker accepts
+const qint64 s_maxRequestSize = 1024 * 1024;
+
+// Compares the secrets in constant time, so that the time it takes
+// doesn't tell how much of the secret was guessed right
+bool secretsMatch(const QByteArray& a, const QByteArray& b)
+{
+	if (a.isEmpty() || a.size() != b.size())
+		return false;
+
+	char diff = 0;
+	for (int i = 0; i < a.size(); i++)
+		diff |= a.at(i) ^ b.at(i);
+	return diff == 0;
+}
+
+} // anonymous namespace
+
+class EngineSession : public QObject
+{
+	Q_OBJECT
+
+	public:
+		EngineSession(QTcpSocket* socket, EngineWorker* worker);
+		virtual ~EngineSession();
+
+	signals:
+		void engineStarted();
+		void engineStopped();
+
+	private slots:
+		void onSocketReadyRead();
+		void onSocketDisconnected();
+		void onEngineReadyRead();
+		void onEngineFinished();
+
+	private:
+		bool readRequest(QVariantMap* request);
+		void handleRequest(const QVariantMap& request);
+		void reply(const QString& message);
+
+		EngineWorker* m_worker;
+		QTcpSocket* m_socket;
+		EngineProcess* m_process;
+		qint64 m_requestSize;
+};
+
+EngineSession::EngineSession(QTcpSocket* socket, EngineWorker* worker)
+	: QObject(worker),
+	  m_worker(worker),
+	  m_socket(socket),
+	  m_process(nullptr),
+	  m_requestSize(-1)
+{
+	m_socket->setParent(this);
+	connect(m_socket, SIGNAL(readyRead()),
+		this, SLOT(onSocketReadyRead()));
+	connect(m_socket, SIGNAL(disconnected()),
+		this, SLOT(onSocketDisconnected()));
+}
+
+EngineSession::~EngineSession()
+{
+	if (m_process == nullptr)
+		return;
+
+	m_process->disconnect(this);
+	m_process->kill();
+	m_process->waitForFinished(1000);
+	delete m_process;
+	emit engineStopped();
+}
+
+void EngineSession::reply(const QString& message)
+{
+	m_socket->write(message.toUtf8() + '\n');
+}
+
+bool EngineSession::readRequest(QVariantMap* request)
+{
+	if (m_requestSize < 0)
+	{
+		if (!m_socket->canReadLine())
+			return false;
+
+		bool ok = false;
+		m_requestSize = m_socket->readLine().trimmed().toLongLong(&ok);
+		if (!ok || m_requestSize <= 0 || m_requestSize > s_maxRequestSize)
+		{
+			m_requestSize = 0;
+			reply("error Invalid request");
+			m_socket->disconnectFromHost();
+			return false;
+		}
+	}
+
+	if (m_socket->bytesAvailable() < m_requestSize)
+		return false;
+
+	QTextStream stream(m_socket->read(m_requestSize));
+	JsonParser parser(stream);
+	*request = parser.parse().toMap();
+	if (parser.hasError() || request->isEmpty())
+	{
+		reply("error Invalid request");
+		m_socket->disconnectFromHost();
+		return false;
+	}
+
+	return true;
+}
+
+void EngineSession::handleRequest(const QVariantMap& request)
+{
+	if (!secretsMatch(request.value("secret").toString().toUtf8(),
+			  m_worker->secret().toUtf8()))
+	{
+		qWarning("Unauthorized request from %s",
+			 qUtf8Printable(m_socket->peerAddress().toString()));
+		reply("error Unauthorized");
+		m_socket->disconnectFromHost();
+		return;
+	}
+
+	if (request.contains("ping"))
+	{
+		reply("ok");
+		m_socket->disconnectFromHost();
+		return;
+	}
+
+	if (m_worker->slotCount() > 0
+	&&  m_worker->engineCount() >= m_worker->slotCount())
+	{
+		reply("error busy");
+		m_socket->disconnectFromHost();
+		return;
+	}
+
+	// Only the worker's own engines can be started
+	const QString name = request.value("engine").toString();
+	EngineConfiguration config;
+	bool found = false;
+	const auto engines = m_worker->engines();
+	for (const EngineConfiguration& engine : engines)
+	{
+		if (engine.name() == name)
+		{
+			config = engine;
+			found = true;
+			break;
+		}
+	}
+	if (!found)
+	{
+		reply(QString("error Unknown engine: %1").arg(name));
+		m_socket->disconnectFromHost();
+		return;
+	}
+
+	QString cmd = config.command().trimmed();
+	const QStringList args = config.arguments();
+	const QString workDir = config.workingDirectory();
+	const QString stderrFile = config.stderrFile();
+
+	if (cmd.isEmpty())
+	{
+		reply("error Empty engine command");
+		m_socket->disconnectFromHost();
+		return;
+	}
+
+	m_process = new EngineProcess();
+	if (workDir.isEmpty())
+	{
+		m_process->setWorkingDirectory(QDir::tempPath());
+
+		QFileInfo cmdInfo(cmd);
+		if (cmdInfo.isFile())
+			cmd = cmdInfo.absoluteFilePath();
+	}
+	else
+		m_process->setWorkingDirectory(workDir);
+
+	if (!stderrFile.isEmpty())
+		m_process->setStandardErrorFile(stderrFile, QIODevice::Append);
+
+	if (!args.isEmpty())
+		m_process->start(cmd, args);
+	else
+		m_process->start(cmd);
+
+	if (!m_process->waitForStarted())
+	{
+		delete m_process;
+		m_process = nullptr;
+
+		reply(QString("error Cannot execute command: %1").arg(cmd));
+		m_socket->disconnectFromHost();
+		return;
+	}
+
+	connect(m_process, SIGNAL(readyRead()),
+		this, SLOT(onEngineReadyRead()));
+	connect(m_process, SIGNAL(readChannelFinished()),
+		this, SLOT(onEngineFinished()));
+	emit engineStarted();
+	reply("ok");
+
+	// Input that was sent right after the request
+	if (m_socket->bytesAvailable() > 0)
+		m_process->write(m_socket->readAll());
+}
+
+void EngineSession::onSocketReadyRead()
+{
+	if (m_process != nullptr)
+	{
+		m_process->write(m_socket->readAll());
+		return;
+	}
+	if (m_requestSize == 0)
+		return;
+
+	QVariantMap request;
+	if (readRequest(&request))
+		handleRequest(request);
+}
+
+void EngineSession::onSocketDisconnected()
+{
+	deleteLater();
+}
+
+void EngineSession::onEngineReadyRead()
+{
+	m_socket->write(m_process->readAll());
+}
+
+void EngineSession::onEngineFinished()
+{
+	m_socket->write(m_process->readAll());
+	m_socket->disconnectFromHost();
+}
+
+
+EngineWorker::EngineWorker(QObject* parent)
+	: QObject(parent),
+	  m_server(new QTcpServer(this)),
+	  m_slotCount(0),
+	  m_engineCount(0)
+{
+	connect(m_server, SIGNAL(newConnection()),
+		this, SLOT(onNewConnection()));
+}
+
+EngineWorker::~EngineWorker()
+{
+	// Kill the engines while the worker can still count them
+	qDeleteAll(findChildren<EngineSession*>(QString(),
+						Qt::FindDirectChildrenOnly));
+}
+
+bool EngineWorker::listen(quint16 port, const QHostAddress& address)
+{
+	return m_server->listen(address, port);
+}
+
+quint16 EngineWorker::port() const
+{
+	return m_server->serverPort();
+}
+
+QString EngineWorker::errorString() const
+{
+	return m_server->errorString();
+}
+
+QString EngineWorker::secret() const
+{
+	return m_secret;
+}
+
+void EngineWorker::setSecret(const QString& secret)
+{
+	m_secret = secret;
+}
+
+QList<EngineConfiguration> EngineWorker::engines() const
+{
+	return m_engines;
+}
+
+void EngineWorker::setEngines(const QList<EngineConfiguration>& engines)
+{
+	m_engines = engines;
+}
+
+int EngineWorker::slotCount() const
+{
+	return m_slotCount;
+}
+
+void EngineWorker::setSlotCount(int count)
+{
+	m_slotCount = qMax(0, count);
+}
+
+int EngineWorker::engineCount() const
+{
+	return m_engineCount;
+}
+
+void EngineWorker::onNewConnection()
+{
+	while (m_server->hasPendingConnections())
+	{
+		QTcpSocket* socket = m_server->nextPendingConnection();
+		EngineSession* session = new EngineSession(socket, this);
+
+		connect(session, SIGNAL(engineStarted()),
+			this, SLOT(onEngineStarted()));
+		connect(session, SIGNAL(engineStopped()),
+			this, SLOT(onEngineStopped()));
+	}
+}
+
+void EngineWorker::onEngineStarted()
+{
+	m_engineCount++;
+}
+
+void EngineWorker::onEngineStopped()
+{
+	m_engineCount--;
+}
+
+#include "engineworker.moc"
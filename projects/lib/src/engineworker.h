@@ -0,0 +1,116 @@
+/*
+    This file is part of Cute Chess.
+    Copyright (C) 2008-2018 Cute Chess authors
+
+    Cute Chess is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Cute Chess is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Cute Chess.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef ENGINEWORKER_H
+#define ENGINEWORKER_H
+
+#include <QObject>
+#include <QList>
+#include <QHostAddress>
+#include "engineconfiguration.h"
+class QTcpServer;
+
+
+/*!
+ * \brief A server that runs chess engines for a remote coordinator
+ *
+ * EngineWorker is the worker's side of distributed matches. It
+ * listens on a TCP port and starts an engine process for every
+ * incoming connection. After the engine has started, everything
+ * written to the connection goes to the engine's standard input and
+ * everything the engine writes to its standard output goes back to
+ * the connection. The engine is killed when the connection is closed,
+ * and the connection is closed when the engine exits.
+ *
+ * A connection starts with a request: the size of the request in
+ * bytes on its own line, followed by a JSON object with the keys
+ * "secret" and "engine". The secret must match the worker's secret,
+ * and the engine is the name of one of the worker's own engines (see
+ * setEngines()). The command line, working directory and other
+ * settings of the engine are never taken from the request. A request
+ * with the key "ping" instead of "engine" only checks that the worker
+ * is alive. The worker replies with a single line that is either "ok"
+ * or "error" followed by a description of the error.
+ *
+ * \sa WorkerPool
+ */
+class LIB_EXPORT EngineWorker : public QObject
+{
+	Q_OBJECT
+
+	public:
+		/*! Creates a new worker. */
+		explicit EngineWorker(QObject* parent = nullptr);
+		/*! Destroys the worker and kills all of its engines. */
+		virtual ~EngineWorker();
+
+		/*!
+		 * Starts listening for connections on \a address and \a port.
+		 *
+		 * By default only connections from the same computer are
+		 * accepted. If \a port is 0, a free port is chosen
+		 * automatically. Returns false on failure.
+		 */
+		bool listen(quint16 port = 0,
+			    const QHostAddress& address = QHostAddress::LocalHost);
+		/*! Returns the port the worker is listening on. */
+		quint16 port() const;
+		/*! Returns a description of the last error. */
+		QString errorString() const;
+
+		/*!
+		 * Returns the shared secret that every request must
+		 * contain.
+		 */
+		QString secret() const;
+		/*!
+		 * Sets the shared secret to \a secret.
+		 *
+		 * All requests are refused until a non-empty secret is set.
+		 */
+		void setSecret(const QString& secret);
+
+		/*! Returns the engines that clients can start. */
+		QList<EngineConfiguration> engines() const;
+		/*! Sets the engines that clients can start to \a engines. */
+		void setEngines(const QList<EngineConfiguration>& engines);
+
+		/*!
+		 * Returns the maximum number of engines that may run at
+		 * the same time. The default is 0 (no limit).
+		 */
+		int slotCount() const;
+		/*! Sets the maximum number of engines to \a count. */
+		void setSlotCount(int count);
+		/*! Returns the number of running engines. */
+		int engineCount() const;
+
+	private slots:
+		void onNewConnection();
+		void onEngineStarted();
+		void onEngineStopped();
+
+	private:
+		QTcpServer* m_server;
+		QString m_secret;
+		QList<EngineConfiguration> m_engines;
+		int m_slotCount;
+		int m_engineCount;
+};
+
+#endif // ENGINEWORKER_H
@@ -20,6 +20,12 @@
 #include "board/board.h"
 #include "moveevaluation.h"
 
+namespace {
+
+const int s_maxTbCacheSize = 1024;
+
+} // anonymous namespace
+
 GameAdjudicator::GameAdjudicator()
 	: m_drawMoveNum(0),
 	  m_drawMoveCount(0),
@@ -29,6 +35,10 @@ GameAdjudicator::GameAdjudicator()
 	  m_resignScore(0),
 	  m_maxGameLength(0),
 	  m_tbEnabled(false),
+	  m_tbDrawOnly(false),
+	  m_tbAsync(false),
+	  m_tbProbeCount(0),
+	  m_tbCacheHitCount(0),
 	  m_tcecAdjudication(false)
 {
 	m_resignScoreCount[0] = 0;
@@ -72,6 +82,16 @@ void GameAdjudicator::setTablebaseAdjudication(bool enable, bool drawOnly)
 	m_tbDrawOnly = drawOnly; 
 }
 
+void GameAdjudicator::setAsyncTablebaseProbes(bool enable)
+{
+	m_tbAsync = enable;
+}
+
+bool GameAdjudicator::asyncTablebaseProbes() const
+{
+	return m_tbAsync;
+}
+
 void GameAdjudicator::setTcecAdjudication(bool enable)
 {
 	m_tcecAdjudication = enable;
@@ -84,26 +104,9 @@ void GameAdjudicator::addEval(const Chess::Board* board, const MoveEvaluation& e
 	// Tablebase adjudication
 	if (m_tbEnabled)
 	{
-		m_result = board->tablebaseResult();
-		
-		if (!m_tbDrawOnly)
-		{
-			if (!m_result.isNone())
-			{
-				return;
-			}
-		}
-		else
-		{
-			if (m_result.isDraw())
-			{
-				return;
-			}
-			else
-			{
-				m_result = Chess::Result();
-			}
-		}
+		m_result = tablebaseAdjudication(tablebaseResult(board, !m_tbAsync));
+		if (!m_result.isNone())
+			return;
 	}
 
 	// Moves forced by the user (eg. from opening book or played by user)
@@ -273,3 +276,81 @@ int GameAdjudicator::resignClock(const Chess::Board* board, const MoveEvaluation
 
 	return count;
 }
+
+int GameAdjudicator::tablebaseProbeCount() const
+{
+	return m_tbProbeCount;
+}
+
+int GameAdjudicator::tablebaseCacheHitCount() const
+{
+	return m_tbCacheHitCount;
+}
+
+bool GameAdjudicator::startTablebaseProbe(const Chess::Board* board)
+{
+	if (!m_tbEnabled || !m_tbAsync || !board->tablebaseAvailable())
+		return false;
+
+	const quint64 key = board->key();
+	if (m_tbCache.contains(key) || m_tbPending.contains(key))
+		return false;
+
+	m_tbPending.insert(key);
+	m_tbProbeCount++;
+	return true;
+}
+
+Chess::Result GameAdjudicator::addTablebaseResult(quint64 key,
+						  const Chess::Result& result)
+{
+	m_tbPending.remove(key);
+	cacheTablebaseResult(key, result);
+
+	return tablebaseAdjudication(result);
+}
+
+Chess::Result GameAdjudicator::tablebaseResult(const Chess::Board* board,
+					       bool probe)
+{
+	if (!board->tablebaseAvailable())
+		return Chess::Result();
+
+	const quint64 key = board->key();
+	auto it = m_tbCache.constFind(key);
+	if (it != m_tbCache.constEnd())
+	{
+		m_tbCacheHitCount++;
+		return it.value();
+	}
+	if (!probe)
+		return Chess::Result();
+
+	m_tbProbeCount++;
+	const Chess::Result result(board->tablebaseResult());
+	cacheTablebaseResult(key, result);
+
+	return result;
+}
+
+void GameAdjudicator::cacheTablebaseResult(quint64 key,
+					   const Chess::Result& result)
+{
+	// A position can only repeat before the next irreversible move, so
+	// the halfmove clock is higher every time it's reached. Draws and
+	// failed probes stay the same when the clock grows, but wins can
+	// turn into draws by the 50-move rule and aren't cached.
+	if (result.isNone() || result.isDraw())
+	{
+		if (m_tbCache.size() >= s_maxTbCacheSize)
+			m_tbCache.clear();
+		m_tbCache.insert(key, result);
+	}
+}
+
+Chess::Result GameAdjudicator::tablebaseAdjudication(const Chess::Result& result) const
+{
+	if (result.isNone() || (m_tbDrawOnly && !result.isDraw()))
+		return Chess::Result();
+	return result;
+}
@@ -19,6 +19,8 @@
 #ifndef GAMEADJUDICATOR_H
 #define GAMEADJUDICATOR_H
 
+#include <QHash>
+#include <QSet>
 #include "board/result.h"
 namespace Chess { class Board; }
 class MoveEvaluation;
@@ -28,6 +30,9 @@ class MoveEvaluation;
  *
  * The GameAdjudicator class can be used to adjudicate chess games when
  * the probability of a specific result is high enough.
+ *
+ * A game adjudicator keeps a cache of tablebase results, so it should
+ * be used for one game only. Copying an unused adjudicator is cheap.
  */
 class LIB_EXPORT GameAdjudicator
 {
@@ -72,6 +77,18 @@ class LIB_EXPORT GameAdjudicator
 		 * latest position is found in the tablebases.
 		 */
 		void setTablebaseAdjudication(bool enable, bool drawOnly);
+		/*!
+		 * Sets asynchronous tablebase probes to \a enable.
+		 *
+		 * If \a enable is true, addEval() only uses tablebase
+		 * results that are already known. The game starts the
+		 * probes suggested by startTablebaseProbe() in the
+		 * background and passes their results to
+		 * addTablebaseResult(). The default is false.
+		 */
+		void setAsyncTablebaseProbes(bool enable);
+		/*! Returns true if tablebase probes are asynchronous. */
+		bool asyncTablebaseProbes() const;
 		/*!
 		 * Sets TCEC adjudication to \a enable.
 		 *
@@ -99,6 +116,24 @@ class LIB_EXPORT GameAdjudicator
 		 * game can't be adjudicated yet, a null result is returned.
 		 */
 		Chess::Result result() const;
+		/*!
+		 * Returns true if the position on \a board should be probed
+		 * in the background for tablebase adjudication.
+		 *
+		 * The position is then expected to get a result with
+		 * addTablebaseResult(), and it isn't suggested again
+		 * before that.
+		 */
+		bool startTablebaseProbe(const Chess::Board* board);
+		/*!
+		 * Adds the tablebase \a result of the position with
+		 * zobrist key \a key.
+		 *
+		 * Returns the adjudication result, which is null if
+		 * \a result can't be used to adjudicate the game.
+		 */
+		Chess::Result addTablebaseResult(quint64 key,
+						 const Chess::Result& result);
 		/*!
 		 * Returns the number of plies left until draw rule adjudication.
 		 */
@@ -107,8 +142,22 @@ class LIB_EXPORT GameAdjudicator
 		 * Returns the number of plies left until resign rule adjudication.
 		 */
 		int resignClock(const Chess::Board* board, const MoveEvaluation& eval) const;
+		/*!
+		 * Returns the number of tablebase probes made for
+		 * adjudication.
+		 */
+		int tablebaseProbeCount() const;
+		/*!
+		 * Returns the number of times a tablebase result was found
+		 * in the cache instead of probing the tablebases.
+		 */
+		int tablebaseCacheHitCount() const;
 
 	private:
+		Chess::Result tablebaseResult(const Chess::Board* board, bool probe);
+		void cacheTablebaseResult(quint64 key, const Chess::Result& result);
+		Chess::Result tablebaseAdjudication(const Chess::Result& result) const;
+
 		int m_drawMoveNum;
 		int m_drawMoveCount;
 		int m_drawScore;
@@ -119,6 +168,11 @@ class LIB_EXPORT GameAdjudicator
 		int m_maxGameLength;
 		bool m_tbEnabled;
 		bool m_tbDrawOnly;
+		bool m_tbAsync;
+		int m_tbProbeCount;
+		int m_tbCacheHitCount;
+		QHash<quint64, Chess::Result> m_tbCache;
+		QSet<quint64> m_tbPending;
 		Chess::Result m_result;
 		int m_resignWinnerScoreCount[2];
 		bool m_tcecAdjudication;
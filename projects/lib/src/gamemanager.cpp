@@ -334,6 +334,7 @@ GameManager::GameManager(QObject* parent)
 	: QObject(parent),
 	  m_finishing(false),
 	  m_concurrency(1),
+	  m_queueWindow(0),
 	  m_activeQueuedGameCount(0)
 {
 }
@@ -353,6 +354,16 @@ void GameManager::setConcurrency(int concurrency)
 	m_concurrency = concurrency;
 }
 
+int GameManager::queueWindow() const
+{
+	return m_queueWindow;
+}
+
+void GameManager::setQueueWindow(int size)
+{
+	m_queueWindow = qMax(0, size);
+}
+
 void GameManager::cleanupIdleThreads()
 {
 	QList<GameThread*>::iterator it = m_activeThreads.begin();
@@ -413,14 +424,15 @@ void GameManager::newGame(ChessGame* game,
 			  const PlayerBuilder* white,
 			  const PlayerBuilder* black,
 			  StartMode startMode,
-			  CleanupMode cleanupMode)
+			  CleanupMode cleanupMode,
+			  int priority)
 {
 	Q_ASSERT(game != nullptr);
 	Q_ASSERT(white != nullptr);
 	Q_ASSERT(black != nullptr);
 	Q_ASSERT(game->parent() == nullptr);
 
-	GameEntry entry = { game, white, black, startMode, cleanupMode };
+	GameEntry entry = { game, white, black, startMode, cleanupMode, priority };
 	if (!white->isHuman() && black->isHuman())
 		game->setBoardShouldBeFlipped(true);
 
@@ -434,6 +446,20 @@ void GameManager::newGame(ChessGame* game,
 	startQueuedGame();
 }
 
+bool GameManager::removeQueuedGame(ChessGame* game)
+{
+	for (int i = 0; i < m_gameEntries.size(); i++)
+	{
+		if (m_gameEntries.at(i).game == game)
+		{
+			m_gameEntries.removeAt(i);
+			return true;
+		}
+	}
+
+	return false;
+}
+
 void GameManager::onThreadQuit()
 {
 	GameThread* thread = qobject_cast<GameThread*>(QObject::sender());
@@ -551,18 +577,70 @@ void GameManager::startGame(const GameEntry& entry)
 	gameThread->newGame(entry.game);
 }
 
+bool GameManager::hasIdleThread(const PlayerBuilder* white,
+				const PlayerBuilder* black) const
+{
+	for (GameThread* thread : qAsConst(m_activeThreads))
+	{
+		if (!thread->isReady())
+			continue;
+
+		GameInitializer* tmp = thread->initializer();
+		if ((tmp->whiteBuilder() == white && tmp->blackBuilder() == black)
+		||  (tmp->whiteBuilder() == black && tmp->blackBuilder() == white))
+			return true;
+	}
+
+	return false;
+}
+
+int GameManager::nextQueuedGame() const
+{
+	if (m_queueWindow <= 0)
+		return 0;
+
+	// Only look at the games that fit in the window so that the
+	// games are still started roughly in the order they were added.
+	const int count = qMin(m_gameEntries.size(),
+			       m_concurrency + m_queueWindow);
+	int best = 0;
+	int bestPriority = m_gameEntries.first().priority;
+	bool bestIdle = hasIdleThread(m_gameEntries.first().white,
+				      m_gameEntries.first().black);
+
+	for (int i = 1; i < count; i++)
+	{
+		const GameEntry& entry = m_gameEntries.at(i);
+		if (entry.priority < bestPriority)
+			continue;
+		if (entry.priority == bestPriority && bestIdle)
+			continue;
+
+		const bool idle = hasIdleThread(entry.white, entry.black);
+		if (entry.priority > bestPriority || idle)
+		{
+			best = i;
+			bestPriority = entry.priority;
+			bestIdle = idle;
+		}
+	}
+
+	return best;
+}
+
 void GameManager::startQueuedGame()
 {
-	if (m_activeQueuedGameCount >= m_concurrency)
-		return;
-	if (m_gameEntries.isEmpty())
+	if (m_activeQueuedGameCount < m_concurrency
+	&&  !m_gameEntries.isEmpty())
 	{
-		emit ready();
+		m_activeQueuedGameCount++;
+		startGame(m_gameEntries.takeAt(nextQueuedGame()));
 		return;
 	}
 
-	m_activeQueuedGameCount++;
-	startGame(m_gameEntries.takeFirst());
+	const int freeSlots = qMax(0, m_concurrency - m_activeQueuedGameCount);
+	if (m_gameEntries.size() < freeSlots + m_queueWindow)
+		emit ready();
 }
 
 #include "gamemanager.moc"
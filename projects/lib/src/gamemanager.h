@@ -97,6 +97,25 @@ class LIB_EXPORT GameManager : public QObject
 		 * \sa concurrency()
 		 */
 		void setConcurrency(int concurrency);
+		/*!
+		 * Returns the number of games that are kept waiting in the
+		 * queue in addition to the running games.
+		 *
+		 * \sa setQueueWindow()
+		 */
+		int queueWindow() const;
+		/*!
+		 * Sets the scheduling window to \a size games.
+		 *
+		 * With a window of zero (the default) queued games are
+		 * started strictly in the order they were added. With a
+		 * larger window the ready() signal is emitted until \a size
+		 * games are waiting, and a freed game slot starts the queued
+		 * game that suits it best: games with a higher priority come
+		 * first, then games whose players are already running in
+		 * an idle thread, and finally the game that was added first.
+		 */
+		void setQueueWindow(int size);
 
 		/*!
 		 * Cleans up and deletes all idle game threads
@@ -134,6 +153,9 @@ class LIB_EXPORT GameManager : public QObject
 		 * \a cleanupMode determines whether the players and their builder
 		 * objects are destroyed or reused after the game.
 		 *
+		 * \a priority is used to choose between queued games when the
+		 * queue window is larger than zero.
+		 *
 		 * If the game cannot be started because one or both of the players
 		 * can't be initialized, \a game will emit the startFailed() signal.
 		 *
@@ -144,7 +166,16 @@ class LIB_EXPORT GameManager : public QObject
 			     const PlayerBuilder* white,
 			     const PlayerBuilder* black,
 			     StartMode startMode = StartImmediately,
-			     CleanupMode cleanupMode = DeletePlayers);
+			     CleanupMode cleanupMode = DeletePlayers,
+			     int priority = 0);
+		/*!
+		 * Removes \a game from the queue.
+		 *
+		 * Returns true if the game was waiting in the queue; the
+		 * caller then owns \a game again. Returns false if the game
+		 * was already started or was never added.
+		 */
+		bool removeQueuedGame(ChessGame* game);
 
 	public slots:
 		/*!
@@ -167,7 +198,7 @@ class LIB_EXPORT GameManager : public QObject
 		/*!
 		 * This signal is emitted after a game has started
 		 * or after a game has ended, if there are free
-		 * game slots.
+		 * game slots or the queue window is not full.
 		 *
 		 * \note The signal is NOT emitted if a newly freed
 		 * game slot can be used by a game that was waiting in
@@ -196,16 +227,21 @@ class LIB_EXPORT GameManager : public QObject
 			const PlayerBuilder* black;
 			StartMode startMode;
 			CleanupMode cleanupMode;
+			int priority;
 		};
 
 		GameThread* getThread(const PlayerBuilder* white,
 				      const PlayerBuilder* black);
 		void startGame(const GameEntry& entry);
+		bool hasIdleThread(const PlayerBuilder* white,
+				   const PlayerBuilder* black) const;
+		int nextQueuedGame() const;
 		void startQueuedGame();
 		void cleanup();
 
 		bool m_finishing;
 		int m_concurrency;
+		int m_queueWindow;
 		int m_activeQueuedGameCount;
 		QList< QPointer<GameThread> > m_threads;
 		QList<GameThread*> m_activeThreads;
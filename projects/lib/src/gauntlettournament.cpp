@@ -91,6 +91,8 @@ TournamentPair* GauntletTournament::nextPair(int gameNumber)
 {
 	if (gameNumber >= finalGameCount())
 		return nullptr;
+	if (usesPairSprt())
+		return nextUnfinishedPair();
 	if (gameNumber % gamesPerEncounter() != 0)
 		return currentPair();
 
@@ -106,6 +108,48 @@ TournamentPair* GauntletTournament::nextPair(int gameNumber)
 	return pair(white, black);
 }
 
+TournamentPair* GauntletTournament::nextUnfinishedPair()
+{
+	// Finish the current encounter unless the pair has dropped out
+	TournamentPair* current = currentPair();
+	if (current != nullptr
+	&&  current->gamesStarted() % gamesPerEncounter() != 0
+	&&  !isPairFinished(current))
+		return current;
+
+	for (int i = 1; i < playerCount(); i++)
+	{
+		if (m_opponent >= playerCount())
+		{
+			m_opponent = 1;
+			setCurrentRound(currentRound() + 1);
+		}
+
+		TournamentPair* next = pair(0, m_opponent++);
+		if (!isPairFinished(next))
+			return next;
+	}
+
+	return nullptr;
+}
+
+QVariantMap GauntletTournament::pairingState() const
+{
+	QVariantMap state;
+	state["opponent"] = m_opponent;
+	return state;
+}
+
+bool GauntletTournament::restorePairingState(const QVariantMap& state)
+{
+	const int opponent = state.value("opponent", -1).toInt();
+	if (opponent < 1 || opponent > playerCount())
+		return false;
+
+	m_opponent = opponent;
+	return true;
+}
+
 bool GauntletTournament::hasGauntletRatingsOrder() const
 {
 	return true;
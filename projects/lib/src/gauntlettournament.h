@@ -50,8 +50,12 @@ class LIB_EXPORT GauntletTournament : public Tournament
 		virtual int gamesPerCycle() const;
 		virtual TournamentPair* nextPair(int gameNumber);
 		virtual bool hasGauntletRatingsOrder() const;
+		virtual QVariantMap pairingState() const;
+		virtual bool restorePairingState(const QVariantMap& state);
 
 	private:
+		TournamentPair* nextUnfinishedPair();
+
 		int m_opponent;
 };
 
@@ -18,11 +18,14 @@
 
 #include "mersenne.h"
 #include <QMutex>
+#include <QDataStream>
+#include <algorithm>
 
 namespace {
 
 int s_index = 0;
 quint32 s_mt[624];
+QMutex s_mutex;
 
 void generateNumbers()
 {
@@ -48,8 +51,7 @@ void Mersenne::initialize(quint32 seed)
 
 quint32 Mersenne::random()
 {
-	static QMutex mutex;
-	mutex.lock();
+	s_mutex.lock();
 
 	if (s_index == 0)
 		generateNumbers();
@@ -61,7 +63,39 @@ quint32 Mersenne::random()
 	y ^= y >> 18;
 
 	s_index = (s_index + 1) % 624;
-	mutex.unlock();
+	s_mutex.unlock();
 
 	return y;
 }
+
+QByteArray Mersenne::state()
+{
+	QMutexLocker locker(&s_mutex);
+
+	QByteArray data;
+	QDataStream stream(&data, QIODevice::WriteOnly);
+	stream << qint32(s_index);
+	for (int i = 0; i < 624; i++)
+		stream << s_mt[i];
+
+	return data;
+}
+
+bool Mersenne::setState(const QByteArray& state)
+{
+	QDataStream stream(state);
+	qint32 index;
+	quint32 mt[624];
+
+	stream >> index;
+	for (int i = 0; i < 624; i++)
+		stream >> mt[i];
+	if (stream.status() != QDataStream::Ok || index < 0 || index >= 624)
+		return false;
+
+	QMutexLocker locker(&s_mutex);
+	s_index = index;
+	std::copy(mt, mt + 624, s_mt);
+
+	return true;
+}
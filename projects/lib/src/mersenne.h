@@ -19,7 +19,7 @@
 #ifndef MERSENNE_H
 #define MERSENNE_H
 
-#include <QtGlobal>
+#include <QByteArray>
 
 /*!
  * \brief A "Mersenne Twister" pseudorandom number generator
@@ -40,6 +40,19 @@ class LIB_EXPORT Mersenne
 		 * This function is thread-safe.
 		 */
 		static quint32 random();
+		/*!
+		 * Returns the internal state of the PRNG.
+		 *
+		 * Restoring the state with setState() continues the
+		 * sequence of numbers from the same point.
+		 */
+		static QByteArray state();
+		/*!
+		 * Restores the internal state of the PRNG to \a state.
+		 *
+		 * Returns false if \a state is invalid.
+		 */
+		static bool setState(const QByteArray& state);
 
 	private:
 		Mersenne();
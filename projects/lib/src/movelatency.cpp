@@ -0,0 +1,233 @@
+/*
+    This file is part of Cute Chess.
+    Copyright (C) 2008-2018 Cute Chess authors
+
+    Cute Chess is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Cute Chess is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Cute Chess.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "movelatency.h"
+#include <algorithm>
+#include <QElapsedTimer>
+#include <QVariantList>
+
+namespace {
+
+int bucketIndex(qint64 ns)
+{
+	int i = 0;
+	for (qint64 us = ns / 1000;
+	     us > 0 && i < MoveLatency::Histogram::BucketCount - 1; us >>= 1)
+		i++;
+	return i;
+}
+
+struct LatencyClock
+{
+	LatencyClock() { timer.start(); }
+	QElapsedTimer timer;
+};
+
+} // anonymous namespace
+
+MoveLatency::Histogram::Histogram()
+	: m_count(0),
+	  m_total(0),
+	  m_max(0)
+{
+	std::fill(m_buckets, m_buckets + BucketCount, 0);
+}
+
+void MoveLatency::Histogram::add(qint64 ns)
+{
+	ns = qMax(ns, Q_INT64_C(0));
+
+	m_buckets[bucketIndex(ns)]++;
+	m_count++;
+	m_total += ns;
+	m_max = qMax(m_max, ns);
+}
+
+void MoveLatency::Histogram::merge(const Histogram& other)
+{
+	for (int i = 0; i < BucketCount; i++)
+		m_buckets[i] += other.m_buckets[i];
+	m_count += other.m_count;
+	m_total += other.m_total;
+	m_max = qMax(m_max, other.m_max);
+}
+
+int MoveLatency::Histogram::count() const
+{
+	return m_count;
+}
+
+qint64 MoveLatency::Histogram::mean() const
+{
+	if (m_count == 0)
+		return 0;
+	return m_total / m_count;
+}
+
+qint64 MoveLatency::Histogram::max() const
+{
+	return m_max;
+}
+
+qint64 MoveLatency::Histogram::percentile(double p) const
+{
+	if (m_count == 0)
+		return 0;
+
+	const qint64 rank = qMax(qint64(p * m_count + 0.5), Q_INT64_C(1));
+	qint64 count = 0;
+	for (int i = 0; i < BucketCount - 1; i++)
+	{
+		count += m_buckets[i];
+		if (count >= rank)
+			return qMin((Q_INT64_C(1) << i) * 1000, m_max);
+	}
+	return m_max;
+}
+
+int MoveLatency::Histogram::bucket(int i) const
+{
+	Q_ASSERT(i >= 0 && i < BucketCount);
+	return m_buckets[i];
+}
+
+QVariantMap MoveLatency::Histogram::toVariantMap() const
+{
+	QVariantMap map;
+	map.insert("count", m_count);
+	map.insert("meanUs", mean() / 1000);
+	map.insert("p50Us", percentile(0.5) / 1000);
+	map.insert("p90Us", percentile(0.9) / 1000);
+	map.insert("p99Us", percentile(0.99) / 1000);
+	map.insert("maxUs", m_max / 1000);
+	map.insert("totalNs", m_total);
+	map.insert("maxNs", m_max);
+
+	int size = BucketCount;
+	while (size > 0 && m_buckets[size - 1] == 0)
+		size--;
+	QVariantList buckets;
+	for (int i = 0; i < size; i++)
+		buckets << m_buckets[i];
+	map.insert("buckets", buckets);
+
+	return map;
+}
+
+MoveLatency::Histogram MoveLatency::Histogram::fromVariantMap(const QVariantMap& map)
+{
+	Histogram histogram;
+	const QVariantList buckets = map.value("buckets").toList();
+	for (int i = 0; i < buckets.size() && i < BucketCount; i++)
+	{
+		histogram.m_buckets[i] = buckets.at(i).toInt();
+		histogram.m_count += histogram.m_buckets[i];
+	}
+
+	// Older maps only have the rounded times in microseconds
+	if (map.contains("totalNs"))
+	{
+		histogram.m_total = map.value("totalNs").toLongLong();
+		histogram.m_max = map.value("maxNs").toLongLong();
+	}
+	else
+	{
+		histogram.m_total = map.value("meanUs").toLongLong() * 1000
+				    * histogram.m_count;
+		histogram.m_max = map.value("maxUs").toLongLong() * 1000;
+	}
+
+	return histogram;
+}
+
+
+qint64 MoveLatency::timestamp()
+{
+	static const LatencyClock s_clock;
+	return s_clock.timer.nsecsElapsed();
+}
+
+QString MoveLatency::stageName(Stage stage)
+{
+	switch (stage)
+	{
+	case Validate:
+		return "validate";
+	case Notify:
+		return "notify";
+	case Go:
+		return "go";
+	case Total:
+		return "total";
+	case Result:
+		return "result";
+	case LiveUpdate:
+		return "liveUpdate";
+	default:
+		return QString();
+	}
+}
+
+MoveLatency::MoveLatency()
+{
+}
+
+bool MoveLatency::isEmpty() const
+{
+	for (const Histogram& histogram : m_histograms)
+	{
+		if (histogram.count() > 0)
+			return false;
+	}
+	return true;
+}
+
+void MoveLatency::add(Stage stage, qint64 ns)
+{
+	Q_ASSERT(stage >= 0 && stage < StageCount);
+	m_histograms[stage].add(ns);
+}
+
+void MoveLatency::merge(const MoveLatency& other)
+{
+	for (int i = 0; i < StageCount; i++)
+		m_histograms[i].merge(other.m_histograms[i]);
+}
+
+const MoveLatency::Histogram& MoveLatency::histogram(Stage stage) const
+{
+	Q_ASSERT(stage >= 0 && stage < StageCount);
+	return m_histograms[stage];
+}
+
+QVariantMap MoveLatency::toVariantMap() const
+{
+	QVariantMap map;
+	for (int i = 0; i < StageCount; i++)
+		map.insert(stageName(Stage(i)), m_histograms[i].toVariantMap());
+	return map;
+}
+
+MoveLatency MoveLatency::fromVariantMap(const QVariantMap& map)
+{
+	MoveLatency latency;
+	for (int i = 0; i < StageCount; i++)
+		latency.m_histograms[i] = Histogram::fromVariantMap(
+			map.value(stageName(Stage(i))).toMap());
+	return latency;
+}
@@ -0,0 +1,158 @@
+/*
+    This file is part of Cute Chess.
+    Copyright (C) 2008-2018 Cute Chess authors
+
+    Cute Chess is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Cute Chess is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Cute Chess.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef MOVELATENCY_H
+#define MOVELATENCY_H
+
+#include <QVariantMap>
+#include <QtGlobal>
+
+/*!
+ * \brief Histograms of the time the manager spends on each move
+ *
+ * MoveLatency measures how long it takes from receiving a player's
+ * move to sending the "go" command to the opponent, split into the
+ * stages of ChessGame's move handling. The times are real time, so
+ * they include the delivery of queued signals and any other work done
+ * by the game's thread in between.
+ *
+ * The histograms use power-of-two buckets: bucket 0 counts the times
+ * under 1 microsecond, and bucket \e i the times from 2^(i-1) to 2^i
+ * microseconds. The last bucket also counts all the longer times.
+ *
+ * \sa ChessGame::moveLatency()
+ * \sa TournamentPlayer::moveLatency()
+ */
+class LIB_EXPORT MoveLatency
+{
+	public:
+		/*! A stage of the manager's move handling. */
+		enum Stage
+		{
+			/*! From receiving the move to validating it. */
+			Validate,
+			/*! Sending the move to the opponent. */
+			Notify,
+			/*!
+			 * From notifying the opponent to sending it the
+			 * position and the "go" command.
+			 */
+			Go,
+			/*! From receiving the move to sending "go". */
+			Total,
+			/*!
+			 * Detecting the result by the rules before "go"
+			 * and adjudicating the game after it.
+			 */
+			Result,
+			/*! Updating the live output files after "go". */
+			LiveUpdate,
+			StageCount	//!< The number of stages
+		};
+
+		/*! \brief A latency histogram of one stage */
+		class LIB_EXPORT Histogram
+		{
+			public:
+				/*! The number of buckets. */
+				static const int BucketCount = 24;
+
+				/*! Creates a new empty histogram. */
+				Histogram();
+
+				/*! Adds a time of \a ns nanoseconds. */
+				void add(qint64 ns);
+				/*! Adds the times in \a other to this histogram. */
+				void merge(const Histogram& other);
+
+				/*! Returns the number of times. */
+				int count() const;
+				/*! Returns the mean time in nanoseconds. */
+				qint64 mean() const;
+				/*! Returns the longest time in nanoseconds. */
+				qint64 max() const;
+				/*!
+				 * Returns an upper bound for the \a p quantile
+				 * (0 to 1) in nanoseconds.
+				 */
+				qint64 percentile(double p) const;
+				/*! Returns the count in bucket \a i. */
+				int bucket(int i) const;
+
+				/*!
+				 * Returns the histogram as a map with the count,
+				 * the mean, 50th, 90th and 99th percentiles and
+				 * the maximum in microseconds, and the bucket
+				 * counts without the trailing empty buckets.
+				 *
+				 * The exact total and maximum are included in
+				 * nanoseconds, so that fromVariantMap() can
+				 * restore the histogram.
+				 */
+				QVariantMap toVariantMap() const;
+				/*!
+				 * Returns a histogram restored from \a map,
+				 * which was created by toVariantMap().
+				 */
+				static Histogram fromVariantMap(const QVariantMap& map);
+
+			private:
+				int m_buckets[BucketCount];
+				int m_count;
+				qint64 m_total;
+				qint64 m_max;
+		};
+
+		/*!
+		 * Returns a monotonic timestamp in nanoseconds.
+		 *
+		 * The timestamps of all threads use the same reference,
+		 * so they can be compared with each other.
+		 */
+		static qint64 timestamp();
+		/*! Returns the name of \a stage used in the variant maps. */
+		static QString stageName(Stage stage);
+
+		/*! Creates a new empty MoveLatency object. */
+		MoveLatency();
+
+		/*! Returns true if no moves have been measured. */
+		bool isEmpty() const;
+		/*! Adds a time of \a ns nanoseconds for \a stage. */
+		void add(Stage stage, qint64 ns);
+		/*! Adds the times in \a other to this object. */
+		void merge(const MoveLatency& other);
+		/*! Returns the histogram of \a stage. */
+		const Histogram& histogram(Stage stage) const;
+
+		/*!
+		 * Returns the histograms as a map from stage names to
+		 * Histogram::toVariantMap() maps.
+		 */
+		QVariantMap toVariantMap() const;
+		/*!
+		 * Returns a MoveLatency object restored from \a map,
+		 * which was created by toVariantMap().
+		 */
+		static MoveLatency fromVariantMap(const QVariantMap& map);
+
+	private:
+		Histogram m_histograms[StageCount];
+};
+
+#endif // MOVELATENCY_H
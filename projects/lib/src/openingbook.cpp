@@ -17,22 +17,158 @@
 */
 
 #include "openingbook.h"
+#include <algorithm>
+#include <limits>
 #include <QString>
 #include <QFile>
+#include <QFileInfo>
+#include <QDateTime>
 #include <QDataStream>
+#include <QHash>
+#include <QMutex>
+#include <QWeakPointer>
 #include <QtDebug>
 #include "pgngame.h"
 #include "pgnstream.h"
 #include "mersenne.h"
 
 
+/*
+ * A read-only mapping of a book file.
+ *
+ * The mappings are kept in a process-wide registry so that all books
+ * that read the same file share one mapping. After a book has been
+ * read, lookups only read the mapped memory and need no locking.
+ */
+class OpeningBook::MappedFile
+{
+	public:
+		static QSharedPointer<const MappedFile> open(const QString& fileName);
+		~MappedFile();
+
+		const uchar* data() const;
+		qint64 size() const;
+
+	private:
+		MappedFile();
+
+		QFile m_file;
+		QDateTime m_lastModified;
+		const uchar* m_data;
+		qint64 m_size;
+};
+
+OpeningBook::MappedFile::MappedFile()
+	: m_data(nullptr),
+	  m_size(0)
+{
+}
+
+OpeningBook::MappedFile::~MappedFile()
+{
+	if (m_data != nullptr)
+		m_file.unmap(const_cast<uchar*>(m_data));
+}
+
+QSharedPointer<const OpeningBook::MappedFile>
+OpeningBook::MappedFile::open(const QString& fileName)
+{
+	static QMutex mutex;
+	static QHash<QString, QWeakPointer<const MappedFile>> files;
+
+	const QFileInfo info(fileName);
+	const QString path(info.canonicalFilePath());
+	if (path.isEmpty())
+		return QSharedPointer<const MappedFile>();
+
+	QMutexLocker locker(&mutex);
+
+	// A file that changed since it was mapped is mapped again
+	QSharedPointer<const MappedFile> file(files.value(path).toStrongRef());
+	if (!file.isNull()
+	&&  file->m_size == info.size()
+	&&  file->m_lastModified == info.lastModified())
+		return file;
+
+	QSharedPointer<MappedFile> newFile(new MappedFile);
+	newFile->m_file.setFileName(path);
+	if (!newFile->m_file.open(QIODevice::ReadOnly))
+		return QSharedPointer<const MappedFile>();
+
+	newFile->m_size = newFile->m_file.size();
+	newFile->m_lastModified = info.lastModified();
+	if (newFile->m_size > 0)
+	{
+		newFile->m_data = newFile->m_file.map(0, newFile->m_size);
+		if (newFile->m_data == nullptr)
+			return QSharedPointer<const MappedFile>();
+	}
+
+	// Forget the mappings that are no longer used
+	for (auto it = files.begin(); it != files.end(); )
+	{
+		if (it.value().isNull())
+			it = files.erase(it);
+		else
+			++it;
+	}
+
+	files[path] = newFile;
+	return newFile;
+}
+
+const uchar* OpeningBook::MappedFile::data() const
+{
+	return m_data;
+}
+
+qint64 OpeningBook::MappedFile::size() const
+{
+	return m_size;
+}
+
+
+namespace {
+
+/*
+ * Returns an iterator to a random entry in [begin, end) where entries
+ * with a higher weight are more likely to be selected, or \a end if
+ * the entries have no weight.
+ */
+template <typename Iterator, typename WeightFunc>
+Iterator pickWeighted(Iterator begin, Iterator end, WeightFunc weight)
+{
+	// Calculate the total weight of all available moves
+	int totalWeight = 0;
+	for (Iterator it = begin; it != end; ++it)
+		totalWeight += weight(*it);
+	if (totalWeight <= 0)
+		return end;
+
+	// Pick a move randomly, with the highest-weighted move having
+	// the highest probability of getting picked.
+	int pick = Mersenne::random() % totalWeight;
+	int currentWeight = 0;
+	for (Iterator it = begin; it != end; ++it)
+	{
+		currentWeight += weight(*it);
+		if (currentWeight > pick)
+			return it;
+	}
+
+	return end;
+}
+
+} // anonymous namespace
+
 QDataStream& operator>>(QDataStream& in, OpeningBook* book)
 {
 	while (in.status() == QDataStream::Ok)
 	{
 		quint64 key;
 		OpeningBook::Entry entry = book->readEntry(in, &key);
-		book->addEntry(entry, key);
+		if (in.status() == QDataStream::Ok)
+			book->addEntry(entry, key);
 	}
 
 	return in;
@@ -40,15 +176,20 @@ QDataStream& operator>>(QDataStream& in, OpeningBook* book)
 
 QDataStream& operator<<(QDataStream& out, const OpeningBook* book)
 {
-	OpeningBook::Map::const_iterator it;
-	for (it = book->m_map.constBegin(); it != book->m_map.constEnd(); ++it)
-		book->writeEntry(it, out);
+	book->sortRecords();
+	for (const OpeningBook::Record& record : qAsConst(book->m_records))
+	{
+		const OpeningBook::Entry entry =
+			{ Chess::GenericMove::fromBits(record.move), record.weight };
+		book->writeEntry(record.key, entry, out);
+	}
 
 	return out;
 }
 
 OpeningBook::OpeningBook(AccessMode mode)
-	: m_mode(mode)
+	: m_mode(mode),
+	  m_unsorted(0)
 {
 }
 
@@ -59,6 +200,7 @@ OpeningBook::~OpeningBook()
 bool OpeningBook::read(const QString& filename)
 {
 	m_filename = filename;
+	m_mappedFile.clear();
 	QFile file(filename);
 	if (!file.open(QIODevice::ReadOnly))
 		return false;
@@ -72,12 +214,27 @@ bool OpeningBook::read(const QString& filename)
 
 	if (m_mode == Disk)
 		return true;
+	if (m_mode == Mapped)
+	{
+		m_mappedFile = MappedFile::open(filename);
+		if (m_mappedFile.isNull())
+		{
+			qWarning("Could not map book file %s",
+				 qUtf8Printable(filename));
+			return false;
+		}
+		return true;
+	}
 
-	m_map.clear();
+	m_records.clear();
+	m_records.reserve(int(qMin(file.size() / entrySize(),
+				   qint64(std::numeric_limits<int>::max()))));
 	QDataStream in(&file);
 	in >> this;
+	sortRecords();
+	m_records.squeeze();
 
-	return !m_map.isEmpty();
+	return !m_records.isEmpty();
 }
 
 bool OpeningBook::write(const QString& filename) const
@@ -94,19 +251,60 @@ bool OpeningBook::write(const QString& filename) const
 
 void OpeningBook::addEntry(const Entry& entry, quint64 key)
 {
-	Map::iterator it = m_map.find(key);
-	while (it != m_map.end() && it.key() == key)
+	// The entries are sorted and merged when they're needed,
+	// so that adding many entries stays fast
+	m_records.append({ key, entry.move.toBits(), entry.weight });
+	m_unsorted.storeRelease(1);
+}
+
+void OpeningBook::sortRecords() const
+{
+	// Lookups only take the lock if entries were added after
+	// the last sort
+	static QMutex mutex;
+	QMutexLocker locker(&mutex);
+	if (!m_unsorted.loadAcquire())
+		return;
+
+	std::sort(m_records.begin(), m_records.end(),
+		  [](const Record& a, const Record& b)
 	{
-		Entry& tmp = it.value();
-		if (tmp.move == entry.move)
-		{
-			tmp.weight += entry.weight;
-			return;
-		}
-		++it;
+		return a.key < b.key || (a.key == b.key && a.move < b.move);
+	});
+
+	// Entries with the same key and move are merged
+	int count = 0;
+	for (int i = 0; i < m_records.size(); i++)
+	{
+		const Record& record = m_records.at(i);
+		if (count > 0
+		&&  m_records.at(count - 1).key == record.key
+		&&  m_records.at(count - 1).move == record.move)
+			m_records[count - 1].weight += record.weight;
+		else
+			m_records[count++] = record;
 	}
-	
-	m_map.insert(key, entry);
+	m_records.resize(count);
+
+	m_unsorted.storeRelease(0);
+}
+
+const OpeningBook::Record* OpeningBook::findRecords(quint64 key,
+						    const Record** end) const
+{
+	if (m_unsorted.loadAcquire())
+		sortRecords();
+
+	auto range = std::equal_range(m_records.constBegin(),
+				      m_records.constEnd(),
+				      Record{ key, 0, 0 },
+				      [](const Record& a, const Record& b)
+	{
+		return a.key < b.key;
+	});
+
+	*end = range.second;
+	return range.first;
 }
 
 int OpeningBook::import(const PgnGame& pgn, int maxMoves)
@@ -218,40 +416,133 @@ QList<OpeningBook::Entry> OpeningBook::entriesFromDisk(quint64 key) const
 	return entries;
 }
 
+QList<OpeningBook::Entry> OpeningBook::entriesFromMap(quint64 key) const
+{
+	QList<Entry> entries;
+	if (m_mappedFile.isNull())
+		return entries;
+
+	const uchar* data = m_mappedFile->data();
+	const qint64 step = entrySize();
+	const qint64 n = m_mappedFile->size() / step;
+	auto keyAt = [=](qint64 index)
+	{
+		quint64 entryKey = 0;
+		entryFromData(data + index * step, &entryKey);
+		return entryKey;
+	};
+
+	// Interpolation search. Zobrist keys are evenly distributed, so
+	// the position of a key can be estimated from its value. After a
+	// few estimates the search falls back to bisection, which bounds
+	// the number of probes if the keys are unevenly distributed.
+	qint64 first = 0;
+	qint64 last = n - 1;
+	qint64 match = -1;
+	int estimates = 0;
+	while (first <= last)
+	{
+		const quint64 firstKey = keyAt(first);
+		const quint64 lastKey = keyAt(last);
+		if (key < firstKey || key > lastKey)
+			break;
+
+		qint64 middle = first + (last - first) / 2;
+		if (estimates < 4 && lastKey > firstKey)
+		{
+			estimates++;
+			const double fraction = double(key - firstKey)
+					      / double(lastKey - firstKey);
+			middle = qBound(first,
+					first + qint64(fraction * double(last - first)),
+					last);
+		}
+
+		const quint64 middleKey = keyAt(middle);
+		if (middleKey < key)
+			first = middle + 1;
+		else if (middleKey > key)
+			last = middle - 1;
+		else
+		{
+			match = middle;
+			break;
+		}
+	}
+	if (match == -1)
+		return entries;
+
+	// Entries with the same key are next to each other
+	first = match;
+	while (first > 0 && keyAt(first - 1) == key)
+		first--;
+	for (qint64 i = first; i < n; i++)
+	{
+		quint64 entryKey = 0;
+		const Entry entry = entryFromData(data + i * step, &entryKey);
+		if (entryKey != key)
+			break;
+		entries << entry;
+	}
+
+	return entries;
+}
+
 QList<OpeningBook::Entry> OpeningBook::entries(quint64 key) const
 {
-	if (m_mode == Ram)
-		return m_map.values(key);
-	return entriesFromDisk(key);
+	switch (m_mode)
+	{
+	case Ram:
+	{
+		QList<Entry> entries;
+		const Record* end = nullptr;
+		for (const Record* it = findRecords(key, &end); it != end; ++it)
+			entries << Entry{ Chess::GenericMove::fromBits(it->move),
+					  it->weight };
+		return entries;
+	}
+	case Mapped:
+		return entriesFromMap(key);
+	default:
+		return entriesFromDisk(key);
+	}
+}
+
+OpeningBook::Entry OpeningBook::entryFromData(const uchar* data,
+					      quint64* key) const
+{
+	const QByteArray bytes(QByteArray::fromRawData(
+		reinterpret_cast<const char*>(data), entrySize()));
+	QDataStream in(bytes);
+
+	return readEntry(in, key);
 }
 
 Chess::GenericMove OpeningBook::move(quint64 key) const
 {
-	Chess::GenericMove move;
-	
 	// There can be multiple entries/moves with the same key.
 	// We need to find them all to choose the best one
-	const auto entries = this->entries(key);
-	if (entries.isEmpty())
-		return move;
-	
-	// Calculate the total weight of all available moves
-	int totalWeight = 0;
-	for (const Entry& entry : entries)
-		totalWeight += entry.weight;
-	if (totalWeight <= 0)
-		return move;
-
-	// Pick a move randomly, with the highest-weighted move having
-	// the highest probability of getting picked.
-	int pick = Mersenne::random() % totalWeight;
-	int currentWeight = 0;
-	for (const Entry& entry : entries)
+	if (m_mode == Ram)
 	{
-		currentWeight += entry.weight;
-		if (currentWeight > pick)
-			return entry.move;
+		// The entries are picked in place without copying them
+		const Record* end = nullptr;
+		const Record* begin = findRecords(key, &end);
+		const Record* it = pickWeighted(begin, end, [](const Record& record)
+		{
+			return int(record.weight);
+		});
+		if (it == end)
+			return Chess::GenericMove();
+		return Chess::GenericMove::fromBits(it->move);
 	}
-	
-	return move;
+
+	const auto entries = this->entries(key);
+	auto it = pickWeighted(entries.constBegin(), entries.constEnd(),
+			       [](const Entry& entry)
+	{
+		return int(entry.weight);
+	});
+	if (it == entries.constEnd())
+		return Chess::GenericMove();
+	return it->move;
 }
@@ -20,7 +20,10 @@
 #define OPENING_BOOK_H
 
 #include <QtGlobal>
-#include <QMultiMap>
+#include <QAtomicInt>
+#include <QList>
+#include <QSharedPointer>
+#include <QVector>
 #include "board/genericmove.h"
 
 class QString;
@@ -32,7 +35,7 @@ class PgnStream;
 /*!
  * \brief A collection of opening moves for chess.
  *
- * OpeningBook is a container (binary tree) class for opening moves that
+ * OpeningBook is a container class for opening moves that
  * can be played by the GUI. When the game goes "out of book", control
  * of the game is transferred to the players.
  *
@@ -46,8 +49,17 @@ class LIB_EXPORT OpeningBook
 		/*! AccessMode defines how a book is accessed during play. */
 		enum AccessMode
 		{
-			Ram,	//!< Load the entire book to RAM
-			Disk	//!< Read moves directly from disk
+			/*!
+			 * Load the entire book to RAM. The entries are
+			 * kept in a compact array sorted by key.
+			 */
+			Ram,
+			Disk,	//!< Read moves directly from disk
+			/*!
+			 * Memory-map the book file. The mapping is
+			 * shared by all books that use the same file.
+			 */
+			Mapped
 		};
 
 		/*!
@@ -128,9 +140,6 @@ class LIB_EXPORT OpeningBook
 		friend LIB_EXPORT QDataStream& operator>>(QDataStream& in, OpeningBook* book);
 		friend LIB_EXPORT QDataStream& operator<<(QDataStream& out, const OpeningBook* book);
 
-		/*! The type of binary tree. */
-		typedef QMultiMap<quint64, Entry> Map;
-
 		/*! Returns the book format's internal entry size in bytes. */
 		virtual int entrySize() const = 0;
 
@@ -145,16 +154,43 @@ class LIB_EXPORT OpeningBook
 		 */
 		virtual Entry readEntry(QDataStream& in, quint64* key) const = 0;
 		
-		/*! Writes the key and entry pointed to by \a it, to \a out. */
-		virtual void writeEntry(const Map::const_iterator& it,
+		/*!
+		 * Reads a book entry from \a data, which holds entrySize()
+		 * bytes of the book file, and returns it.
+		 *
+		 * The implementation must set \a key to the hash that
+		 * belongs to the entry. The default implementation calls
+		 * readEntry() on a data stream.
+		 */
+		virtual Entry entryFromData(const uchar* data, quint64* key) const;
+
+		/*! Writes \a entry and its key \a key to \a out. */
+		virtual void writeEntry(quint64 key,
+					const Entry& entry,
 					QDataStream& out) const = 0;
 
 	private:
+		class MappedFile;
+
+		// An entry in RAM, with the move packed by
+		// Chess::GenericMove::toBits()
+		struct Record
+		{
+			quint64 key;
+			quint32 move;
+			quint16 weight;
+		};
+
+		void sortRecords() const;
+		const Record* findRecords(quint64 key, const Record** end) const;
 		QList<Entry> entriesFromDisk(quint64 key) const;
+		QList<Entry> entriesFromMap(quint64 key) const;
 
 		AccessMode m_mode;
 		QString m_filename;
-		Map m_map;
+		mutable QVector<Record> m_records;
+		mutable QAtomicInt m_unsorted;
+		QSharedPointer<const MappedFile> m_mappedFile;
 };
 
 /*!
@@ -17,8 +17,15 @@
 */
 
 #include "openingsuite.h"
+#include <cstring>
+#include <QDateTime>
 #include <QFile>
+#include <QFileInfo>
+#include <QHash>
+#include <QMutex>
 #include <QTextStream>
+#include <QThread>
+#include <QWeakPointer>
 #include "pgnstream.h"
 #include "epdrecord.h"
 #include "mersenne.h"
@@ -32,7 +39,11 @@ OpeningSuite::OpeningSuite(const QString& fen)
 	  m_fen(fen),
 	  m_file(nullptr),
 	  m_epdStream(nullptr),
-	  m_pgnStream(nullptr)
+	  m_pgnStream(nullptr),
+	  m_prefetchThread(nullptr),
+	  m_prefetchPlies(0),
+	  m_prefetchCount(0),
+	  m_prefetchStop(false)
 {
 }
 
@@ -48,12 +59,36 @@ OpeningSuite::OpeningSuite(const QString& fileName,
 	  m_fileName(fileName),
 	  m_file(nullptr),
 	  m_epdStream(nullptr),
-	  m_pgnStream(nullptr)
+	  m_pgnStream(nullptr),
+	  m_prefetchThread(nullptr),
+	  m_prefetchPlies(0),
+	  m_prefetchCount(0),
+	  m_prefetchStop(false)
 {
 }
 
+class OpeningSuite::PrefetchThread : public QThread
+{
+	public:
+		PrefetchThread(OpeningSuite* suite)
+			: m_suite(suite)
+		{
+		}
+
+	protected:
+		virtual void run()
+		{
+			m_suite->prefetch();
+		}
+
+	private:
+		OpeningSuite* m_suite;
+};
+
 OpeningSuite::~OpeningSuite()
 {
+	stopPrefetch();
+
 	if (m_epdStream != nullptr)
 	{
 		delete m_epdStream->device();
@@ -86,9 +121,11 @@ bool OpeningSuite::initialize()
 	if (!m_fen.isEmpty())
 		return true;
 
+	stopPrefetch();
 	m_gamesRead = 0;
 	m_gameIndex = 0;
 	m_filePositions.clear();
+	m_randomOrder.clear();
 
 	if (m_epdStream != nullptr)
 	{
@@ -114,50 +151,47 @@ bool OpeningSuite::initialize()
 
 	if (m_format == PgnFormat)
 		m_pgnStream = new PgnStream(m_file);
+	else if (m_format == EpdFormat)
+		m_epdStream = new QTextStream(m_file);
 
-	if (m_order == RandomOrder)
+	if (m_order == RandomOrder || m_startIndex > 0)
 	{
-		// Create a shuffled vector of file positions
-		for (;;)
+		m_filePositions = filePositions(m_fileName, m_format);
+		if (m_filePositions.isNull())
 		{
-			FilePosition pos;
-			if (m_format == EpdFormat)
-				pos = getEpdPos();
-			else if (m_format == PgnFormat)
-				pos = getPgnPos();
-
-			if (pos.pos == -1)
-				break;
-
-			int i = Mersenne::random() % (m_filePositions.size() + 1);
-			if (i == m_filePositions.size())
-				m_filePositions.append(pos);
-			else
-			{
-				m_filePositions.append(m_filePositions.at(i));
-				m_filePositions[i] = pos;
-			}
+			qWarning("Can't read opening suite %s",
+				 qUtf8Printable(m_fileName));
+			return false;
 		}
 	}
-	else if (m_order == SequentialOrder)
+
+	if (m_order == RandomOrder)
 	{
-		for (int i = 0; i < m_startIndex; i++)
+		// Create a shuffled order of the openings. The shuffle
+		// is done while counting up, so the order only depends on
+		// the random seed and the number of openings.
+		const int count = m_filePositions->size();
+		m_randomOrder.reserve(count);
+		for (int pos = 0; pos < count; pos++)
 		{
-			FilePosition pos;
-			if (m_format == EpdFormat)
-				pos = getEpdPos();
-			else if (m_format == PgnFormat)
-				pos = getPgnPos();
-
-			if (pos.pos == -1)
-				break;
+			int i = Mersenne::random() % (m_randomOrder.size() + 1);
+			if (i == m_randomOrder.size())
+				m_randomOrder.append(pos);
+			else
+			{
+				m_randomOrder.append(m_randomOrder.at(i));
+				m_randomOrder[i] = pos;
+			}
 		}
 	}
-
-	if (m_format == EpdFormat)
+	else if (m_order == SequentialOrder
+	     &&  m_startIndex > 0 && m_startIndex < m_filePositions->size())
 	{
-		m_file->reset();
-		m_epdStream = new QTextStream(m_file);
+		const FilePosition& pos = m_filePositions->at(m_startIndex);
+		if (m_format == EpdFormat)
+			m_epdStream->seek(pos.pos);
+		else if (m_format == PgnFormat)
+			m_pgnStream->seek(pos.pos, pos.lineNumber);
 	}
 
 	return true;
@@ -175,11 +209,102 @@ PgnGame OpeningSuite::nextGame(int maxPlies)
 	if (isNull())
 		return game;
 
+	if (m_prefetchThread != nullptr)
+	{
+		if (maxPlies == m_prefetchPlies)
+		{
+			QMutexLocker locker(&m_prefetchMutex);
+			while (m_prefetched.isEmpty())
+				m_prefetchNotEmpty.wait(&m_prefetchMutex);
+
+			game = m_prefetched.dequeue().game;
+			m_prefetchNotFull.wakeOne();
+			return game;
+		}
+
+		// The prefetched openings are too short or too long
+		const int count = m_prefetchCount;
+		stopPrefetch();
+		game = readGame(maxPlies);
+		startPrefetch(maxPlies, count);
+		return game;
+	}
+
+	return readGame(maxPlies);
+}
+
+void OpeningSuite::startPrefetch(int maxPlies, int count)
+{
+	Q_ASSERT(count > 0);
+
+	stopPrefetch();
+	if (isNull())
+		return;
+
+	m_prefetchPlies = maxPlies;
+	m_prefetchCount = count;
+	m_prefetchStop = false;
+	m_nextState = readerState();
+
+	m_prefetchThread = new PrefetchThread(this);
+	m_prefetchThread->start();
+}
+
+void OpeningSuite::stopPrefetch()
+{
+	if (m_prefetchThread == nullptr)
+		return;
+
+	m_prefetchMutex.lock();
+	m_prefetchStop = true;
+	m_prefetchNotFull.wakeOne();
+	m_prefetchMutex.unlock();
+
+	m_prefetchThread->wait();
+	delete m_prefetchThread;
+	m_prefetchThread = nullptr;
+
+	// Rewind to the first opening that wasn't returned
+	if (!m_prefetched.isEmpty())
+	{
+		restoreReaderState(m_prefetched.head().state);
+		m_prefetched.clear();
+	}
+}
+
+void OpeningSuite::prefetch()
+{
+	QMutexLocker locker(&m_prefetchMutex);
+
+	for (;;)
+	{
+		while (m_prefetched.size() >= m_prefetchCount && !m_prefetchStop)
+			m_prefetchNotFull.wait(&m_prefetchMutex);
+		if (m_prefetchStop)
+			break;
+
+		// The reader is only used by this thread while prefetching,
+		// so it can be used without holding the lock
+		const QVariantMap state(readerState());
+		m_nextState = state;
+		locker.unlock();
+
+		Prefetched opening{ readGame(m_prefetchPlies), state };
+
+		locker.relock();
+		m_prefetched.enqueue(opening);
+		m_prefetchNotEmpty.wakeOne();
+	}
+}
+
+PgnGame OpeningSuite::readGame(int maxPlies)
+{
+	PgnGame game;
 	FilePosition pos = { -1, -1 };
-	if (m_order == RandomOrder)
+	if (m_order == RandomOrder && !m_randomOrder.isEmpty())
 	{
-		pos = m_filePositions.at(m_gameIndex++);
-		if (m_gameIndex >= m_filePositions.size())
+		pos = m_filePositions->at(m_randomOrder.at(m_gameIndex++));
+		if (m_gameIndex >= m_randomOrder.size())
 			m_gameIndex = 0;
 	}
 
@@ -228,20 +353,207 @@ PgnGame OpeningSuite::nextGame(int maxPlies)
 	return game;
 }
 
-OpeningSuite::FilePosition OpeningSuite::getPgnPos()
+QVariantMap OpeningSuite::state() const
+{
+	if (m_prefetchThread != nullptr)
+	{
+		QMutexLocker locker(&m_prefetchMutex);
+		if (!m_prefetched.isEmpty())
+			return m_prefetched.head().state;
+		return m_nextState;
+	}
+
+	return readerState();
+}
+
+bool OpeningSuite::restoreState(const QVariantMap& state)
+{
+	if (m_prefetchThread == nullptr)
+		return restoreReaderState(state);
+
+	const int plies = m_prefetchPlies;
+	const int count = m_prefetchCount;
+	stopPrefetch();
+	const bool ok = restoreReaderState(state);
+	startPrefetch(plies, count);
+
+	return ok;
+}
+
+QVariantMap OpeningSuite::readerState() const
+{
+	QVariantMap state;
+	if (isNull())
+		return state;
+
+	state["gamesRead"] = m_gamesRead;
+	if (m_order == RandomOrder)
+	{
+		state["gameIndex"] = m_gameIndex;
+		state["gameCount"] = m_randomOrder.size();
+	}
+	else if (m_format == EpdFormat)
+		state["pos"] = m_epdStream->pos();
+	else if (m_format == PgnFormat)
+	{
+		state["pos"] = m_pgnStream->pos();
+		state["lineNumber"] = m_pgnStream->lineNumber();
+	}
+
+	return state;
+}
+
+bool OpeningSuite::restoreReaderState(const QVariantMap& state)
+{
+	if (isNull())
+		return state.isEmpty();
+	if (!state.contains("gamesRead"))
+		return false;
+
+	if (m_order == RandomOrder)
+	{
+		const int index = state.value("gameIndex", -1).toInt();
+		if (state.value("gameCount").toInt() != m_randomOrder.size()
+		||  index < 0 || index >= m_randomOrder.size())
+			return false;
+		m_gameIndex = index;
+	}
+	else
+	{
+		const qint64 pos = state.value("pos", -1).toLongLong();
+		if (pos < 0)
+			return false;
+
+		if (m_format == EpdFormat)
+		{
+			if (!m_epdStream->seek(pos))
+				return false;
+			m_epdStream->resetStatus();
+		}
+		else if (m_format == PgnFormat)
+		{
+			const qint64 lineNumber =
+				state.value("lineNumber", 1).toLongLong();
+			if (!m_pgnStream->seek(pos, lineNumber))
+				return false;
+		}
+	}
+
+	m_gamesRead = state.value("gamesRead").toInt();
+	return true;
+}
+
+QSharedPointer<const OpeningSuite::FilePositions>
+OpeningSuite::filePositions(const QString& fileName, Format format)
+{
+	struct CacheEntry
+	{
+		QWeakPointer<const FilePositions> positions;
+		qint64 size;
+		QDateTime lastModified;
+	};
+	static QMutex mutex;
+	static QHash<QString, CacheEntry> cache;
+
+	const QFileInfo info(fileName);
+	const QString key = QString("%1:%2")
+		.arg(int(format)).arg(info.canonicalFilePath());
+
+	// The scan is done while holding the lock, so that suites that
+	// start at the same time wait for one scan instead of each
+	// scanning the file
+	QMutexLocker locker(&mutex);
+
+	auto it = cache.find(key);
+	if (it != cache.end())
+	{
+		QSharedPointer<const FilePositions> positions(
+			it->positions.toStrongRef());
+		if (!positions.isNull()
+		&&  it->size == info.size()
+		&&  it->lastModified == info.lastModified())
+			return positions;
+		cache.erase(it);
+	}
+
+	QFile file(fileName);
+	if (!file.open(QIODevice::ReadOnly | QIODevice::Text))
+		return QSharedPointer<const FilePositions>();
+
+	QSharedPointer<const FilePositions> positions(new FilePositions(
+		(format == EpdFormat) ? scanEpdPositions(&file)
+				      : scanPgnPositions(&file)));
+	cache.insert(key, CacheEntry{ positions, info.size(), info.lastModified() });
+
+	return positions;
+}
+
+OpeningSuite::FilePositions OpeningSuite::scanPgnPositions(QFile* file)
+{
+	// PgnStream skips the movetext between the games without
+	// tokenizing it
+	FilePositions positions;
+	PgnStream stream(file);
+	for (;;)
+	{
+		const FilePosition pos = getPgnPos(&stream);
+		if (pos.pos == -1)
+			break;
+		positions.append(pos);
+	}
+
+	return positions;
+}
+
+OpeningSuite::FilePositions OpeningSuite::scanEpdPositions(QFile* file)
+{
+	// Every line begins a record
+	FilePositions positions;
+	const qint64 size = file->size();
+	const uchar* map = (size > 0) ? file->map(0, size) : nullptr;
+	if (map != nullptr)
+	{
+		const char* data = reinterpret_cast<const char*>(map);
+		const char* end = data + size;
+		const char* p = data;
+		while (p < end)
+		{
+			positions.append(FilePosition{ p - data, -1 });
+			p = static_cast<const char*>(memchr(p, '\n', end - p));
+			if (p == nullptr)
+				break;
+			p++;
+		}
+		file->unmap(const_cast<uchar*>(map));
+
+		return positions;
+	}
+
+	while (!file->atEnd())
+	{
+		const qint64 pos = file->pos();
+		if (file->readLine().isEmpty())
+			break;
+		positions.append(FilePosition{ pos, -1 });
+	}
+
+	return positions;
+}
+
+OpeningSuite::FilePosition OpeningSuite::getPgnPos(PgnStream* stream)
 {
 	FilePosition pos = { -1, -1 };
-	if (!m_pgnStream->nextGame())
+	if (!stream->nextGame())
 		return pos;
 
-	pos.pos = m_pgnStream->pos();
-	pos.lineNumber = m_pgnStream->lineNumber();
+	pos.pos = stream->pos();
+	pos.lineNumber = stream->lineNumber();
 
 	char c;
 	bool inTag = false;
 	bool inQuotes = false;
 
-	while ((c = m_pgnStream->readChar()) != 0)
+	while ((c = stream->readChar()) != 0)
 	{
 		if (!inTag)
 		{
@@ -249,7 +561,7 @@ OpeningSuite::FilePosition OpeningSuite::getPgnPos()
 				inTag = true;
 			else if (!isspace(c))
 			{
-				m_pgnStream->rewindChar();
+				stream->rewindChar();
 				break;
 			}
 
@@ -267,21 +579,3 @@ OpeningSuite::FilePosition OpeningSuite::getPgnPos()
 
 	return pos;
 }
-
-OpeningSuite::FilePosition OpeningSuite::getEpdPos()
-{
-	FilePosition pos = { m_file->pos(), -1 };
-
-	while (m_file->readLine().isEmpty())
-	{
-		if (m_file->atEnd())
-		{
-			pos.pos = -1;
-			break;
-		}
-		else
-			pos.pos = m_file->pos();
-	}
-
-	return pos;
-}
@@ -20,10 +20,16 @@
 #define OPENINGSUITE_H
 
 #include <QVector>
+#include <QVariantMap>
+#include <QSharedPointer>
+#include <QMutex>
+#include <QQueue>
+#include <QWaitCondition>
 #include "pgngame.h"
 class QString;
 class QFile;
 class QTextStream;
+class QThread;
 class PgnStream;
 
 /*!
@@ -91,11 +97,14 @@ class LIB_EXPORT OpeningSuite
 		/*!
 		 * Initializes the opening suite.
 		 *
-		 * If \a order is SequentialOrder, this function just opens
-		 * the opening suite file and gets ready to read data. If
-		 * \a order is RandomOrder, the file positions of all the
-		 * openings are parsed from the file, which could take some
-		 * time if the file is large.
+		 * If \a order is SequentialOrder and the start index is 0,
+		 * this function just opens the opening suite file and gets
+		 * ready to read data. Otherwise the file positions of all
+		 * the openings are needed. They are found with a quick scan
+		 * of the file and shared by all suites in the process that
+		 * use the same file, so the scan is done only once.
+		 *
+		 * Prefetching is stopped and must be started again.
 		 *
 		 * Returns true if successful; otherwise returns false.
 		 */
@@ -103,18 +112,77 @@ class LIB_EXPORT OpeningSuite
 		/*!
 		 * Reads a new opening from the suite and returns it.
 		 * A maximum of \a maxPlies plies (halfmoves) are read.
+		 *
+		 * If the suite is prefetching openings of \a maxPlies
+		 * plies, the next prefetched opening is returned.
 		 */
 		PgnGame nextGame(int maxPlies);
 
+		/*!
+		 * Starts reading up to \a count openings of at most
+		 * \a maxPlies plies ahead on a background thread, so that
+		 * nextGame() doesn't have to wait for file I/O or move
+		 * parsing.
+		 *
+		 * The openings are returned in the same order as without
+		 * prefetching, and state() still refers to the next
+		 * opening returned by nextGame().
+		 *
+		 * The suite must be initialized. Does nothing if the suite
+		 * is null.
+		 */
+		void startPrefetch(int maxPlies, int count = 8);
+		/*!
+		 * Stops prefetching openings.
+		 *
+		 * The openings that were read ahead are discarded and the
+		 * suite is rewound to the first of them.
+		 */
+		void stopPrefetch();
+
+		/*!
+		 * Returns the position of the suite, ie. the place of the
+		 * next opening in the file.
+		 *
+		 * Restoring the position with restoreState() continues
+		 * from the same opening without reading the openings
+		 * before it.
+		 */
+		QVariantMap state() const;
+		/*!
+		 * Restores the position of the suite to \a state.
+		 *
+		 * The suite must be initialized. Returns false if \a state
+		 * doesn't match the suite.
+		 */
+		bool restoreState(const QVariantMap& state);
+
 	private:
+		class PrefetchThread;
+		friend class PrefetchThread;
+
 		struct FilePosition
 		{
 			qint64 pos;
 			qint64 lineNumber;
 		};
+		struct Prefetched
+		{
+			PgnGame game;
+			QVariantMap state;
+		};
+		typedef QVector<FilePosition> FilePositions;
 
-		FilePosition getPgnPos();
-		FilePosition getEpdPos();
+		static QSharedPointer<const FilePositions> filePositions(
+			const QString& fileName, Format format);
+		static FilePositions scanPgnPositions(QFile* file);
+		static FilePositions scanEpdPositions(QFile* file);
+		static FilePosition getPgnPos(PgnStream* stream);
+
+		PgnGame readGame(int maxPlies);
+		QVariantMap readerState() const;
+		bool restoreReaderState(const QVariantMap& state);
+		void prefetch();
 
 		Format m_format;
 		Order m_order;
@@ -126,7 +194,18 @@ class LIB_EXPORT OpeningSuite
 		QFile* m_file;
 		QTextStream* m_epdStream;
 		PgnStream* m_pgnStream;
-		QVector<FilePosition> m_filePositions;
+		QSharedPointer<const FilePositions> m_filePositions;
+		QVector<int> m_randomOrder;
+
+		QThread* m_prefetchThread;
+		int m_prefetchPlies;
+		int m_prefetchCount;
+		bool m_prefetchStop;
+		QQueue<Prefetched> m_prefetched;
+		QVariantMap m_nextState;
+		mutable QMutex m_prefetchMutex;
+		QWaitCondition m_prefetchNotFull;
+		QWaitCondition m_prefetchNotEmpty;
 };
 
 #endif // OPENINGSUITE_H
@@ -19,50 +19,11 @@
 #include "pgngameentry.h"
 #include <cctype>
 #include <QDataStream>
-#include <QMap>
 #include "pgnstream.h"
 #include "pgngamefilter.h"
 
 namespace {
 
-int s_stringContains(const char* s1, const char* s2, int size)
-{
-	Q_ASSERT(s1 != nullptr);
-	Q_ASSERT(s2 != nullptr);
-	Q_ASSERT(size >= 0);
-
-	if (!*s2)
-		return 0;
-	if (size == 0)
-		return -1;
-
-	const char* s1_end = s1 + size;
-
-	while (s1 < s1_end)
-	{
-		if (toupper(*s1) == toupper(*s2))
-		{
-			const char* a = s1 + 1;
-			const char* b = s2 + 1;
-
-			while (*b && a < s1_end)
-			{
-				if (toupper(*a) != toupper(*b))
-					break;
-				a++;
-				b++;
-			}
-			if (!*b)
-				return b - s2;
-			if (a == s1_end)
-				return -1;
-		}
-		s1++;
-	}
-
-	return -1;
-}
-
 int s_stringToInt(const char *s, int size)
 {
 	int num = 0;
@@ -102,12 +63,21 @@ PgnGameEntry::PgnGameEntry()
 {
 }
 
+PgnGameEntry::PgnGameEntry(qint64 pos,
+			   qint64 lineNumber,
+			   const QByteArray& tagData)
+	: m_data(tagData),
+	  m_pos(pos),
+	  m_lineNumber(lineNumber)
+{
+}
+
 bool PgnGameEntry::match(const PgnGameFilter& filter) const
 {
 	const char* data = m_data.constData();
 
 	if (filter.type() == PgnGameFilter::FixedString)
-		return s_stringContains(data, filter.pattern(), m_data.size()) != -1;
+		return filter.m_patternMatcher.match(data, m_data.size()) != -1;
 
 	int whitePlayer = 0;
 
@@ -120,15 +90,15 @@ bool PgnGameEntry::match(const PgnGameFilter& filter) const
 		switch (type)
 		{
 		case EventTag:
-			if (s_stringContains(str, filter.event(), size) == -1)
+			if (filter.m_eventMatcher.match(str, size) == -1)
 				return false;
 			break;
 		case SiteTag:
-			if (s_stringContains(str, filter.site(), size) == -1)
+			if (filter.m_siteMatcher.match(str, size) == -1)
 				return false;
 			break;
 		case DateTag:
-			if (!filter.minDate().isNull() || !filter.maxDate().isNull())
+			if (filter.m_minDateKey != 0 || filter.m_maxDateKey != 0)
 			{
 				if (size < 10)
 					return false;
@@ -143,10 +113,14 @@ bool PgnGameEntry::match(const PgnGameFilter& filter) const
 				if (day == 0)
 					day = 1;
 
-				QDate date(year, month, day);
+				// Dates are compared as yyyymmdd numbers. An
+				// invalid date is earlier than any valid date.
+				int date = 0;
+				if (QDate::isValid(year, month, day))
+					date = year * 10000 + month * 100 + day;
 
-				if ((!filter.minDate().isNull() && date < filter.minDate())
-				||  (!filter.maxDate().isNull() && date > filter.maxDate()))
+				if ((filter.m_minDateKey != 0 && date < filter.m_minDateKey)
+				||  (filter.m_maxDateKey != 0 && date > filter.m_maxDateKey))
 					return false;
 			}
 			break;
@@ -167,9 +141,9 @@ bool PgnGameEntry::match(const PgnGameFilter& filter) const
 				int len2 = -1;
 
 				if (filter.playerSide() != Chess::Side::Black)
-					len1 = s_stringContains(str, filter.player(), size);
+					len1 = filter.m_playerMatcher.match(str, size);
 				if (filter.playerSide() != Chess::Side::White)
-					len2 = s_stringContains(str, filter.opponent(), size);
+					len2 = filter.m_opponentMatcher.match(str, size);
 
 				if (len1 == -1 && len2 == -1)
 					return false;
@@ -182,9 +156,9 @@ bool PgnGameEntry::match(const PgnGameFilter& filter) const
 				int len2 = -1;
 
 				if (filter.playerSide() != Chess::Side::White && whitePlayer != 1)
-					len1 = s_stringContains(str, filter.player(), size);
+					len1 = filter.m_playerMatcher.match(str, size);
 				if (filter.playerSide() != Chess::Side::Black && whitePlayer != 2)
-					len2 = s_stringContains(str, filter.opponent(), size);
+					len2 = filter.m_opponentMatcher.match(str, size);
 
 				if (len1 == -1 && len2 == -1)
 					return false;
@@ -277,10 +251,17 @@ bool PgnGameEntry::read(PgnStream& in)
 	m_lineNumber = in.lineNumber();
 	m_data.clear();
 
+	// Only the tags of the entry are kept, in TagType order
+	static const char* const tagNames[] =
+	{
+		"Event", "Site", "Date", "Round",
+		"White", "Black", "Result", "Variant"
+	};
+	QByteArray tags[8];
+
 	char c;
 	QByteArray tagName;
 	QByteArray tagValue;
-	QMap<QByteArray, QByteArray> tags;
 	bool haveTagName = false;
 	bool inTag = false;
 	bool inQuotes = false;
@@ -302,7 +283,14 @@ bool PgnGameEntry::read(PgnStream& in)
 
 		if ((c == ']' && !inQuotes) || c == '\n' || c == '\r')
 		{
-			tags[tagName] = tagValue;
+			for (int i = 0; i < 8; i++)
+			{
+				if (tagName == tagNames[i])
+				{
+					tags[i] = tagValue;
+					break;
+				}
+			}
 			tagName.clear();
 			tagValue.clear();
 			inTag = false;
@@ -324,14 +312,8 @@ bool PgnGameEntry::read(PgnStream& in)
 			tagValue += c;
 	}
 
-	addTag(tags["Event"]);
-	addTag(tags["Site"]);
-	addTag(tags["Date"]);
-	addTag(tags["Round"]);
-	addTag(tags["White"]);
-	addTag(tags["Black"]);
-	addTag(tags["Result"]);
-	addTag(tags["Variant"]);
+	for (const QByteArray& tag : tags)
+		addTag(tag);
 
 	return true;
 }
@@ -379,3 +361,8 @@ QString PgnGameEntry::tagValue(TagType type) const
 		return QString();
 	return m_data.mid(i + 1, size);
 }
+
+QByteArray PgnGameEntry::tagData() const
+{
+	return m_data;
+}
@@ -55,6 +55,13 @@ class LIB_EXPORT PgnGameEntry
 
 		/*! Creates a new empty PgnGameEntry object. */
 		PgnGameEntry();
+		/*!
+		 * Creates a new PgnGameEntry object for a game that begins
+		 * at \a pos and \a lineNumber, with the tags in \a tagData.
+		 *
+		 * \sa tagData()
+		 */
+		PgnGameEntry(qint64 pos, qint64 lineNumber, const QByteArray& tagData);
 
 		/*! Resets the entry to an empty default. */
 		void clear();
@@ -88,6 +95,11 @@ class LIB_EXPORT PgnGameEntry
 
 		/*! Returns the tag value corresponding to \a type. */
 		QString tagValue(TagType type) const;
+		/*!
+		 * Returns the tags of the entry in the compact format
+		 * that write() uses.
+		 */
+		QByteArray tagData() const;
 
 	private:
 		void addTag(const QByteArray& tagValue);
@@ -19,9 +19,74 @@
 #include "pgngamefilter.h"
 #include "pgngameentry.h"
 
+namespace {
+
+inline uchar foldCase(uchar c)
+{
+	return (c >= 'a' && c <= 'z') ? uchar(c - 'a' + 'A') : c;
+}
+
+} // anonymous namespace
+
+void PgnGameFilter::StringMatcher::setPattern(const QByteArray& pattern)
+{
+	// The pattern ends at the first null character
+	const int size = int(qstrnlen(pattern.constData(), uint(pattern.size())));
+
+	m_pattern.resize(size);
+	for (int i = 0; i < size; i++)
+		m_pattern[i] = char(foldCase(uchar(pattern.at(i))));
+
+	// Boyer-Moore-Horspool shifts for the case-folded characters.
+	// Shifts are capped at 255, which only makes long patterns
+	// advance more slowly.
+	const uchar maxShift = uchar(qBound(1, size, 255));
+	m_shift.fill(char(maxShift), 256);
+	for (int i = 0; i < size - 1; i++)
+	{
+		const int shift = qMin(size - 1 - i, 255);
+		const uchar c = uchar(m_pattern.at(i));
+		m_shift[c] = char(shift);
+		if (c >= 'A' && c <= 'Z')
+			m_shift[c - 'A' + 'a'] = char(shift);
+	}
+}
+
+int PgnGameFilter::StringMatcher::match(const char* data, int size) const
+{
+	const int n = m_pattern.size();
+	if (n == 0)
+		return 0;
+	if (size < n)
+		return -1;
+
+	const uchar* text = reinterpret_cast<const uchar*>(data);
+	const uchar* pattern = reinterpret_cast<const uchar*>(m_pattern.constData());
+	const uchar* shift = reinterpret_cast<const uchar*>(m_shift.constData());
+
+	for (int pos = 0; pos <= size - n; pos += shift[text[pos + n - 1]])
+	{
+		int i = n - 1;
+		while (i >= 0 && foldCase(text[pos + i]) == pattern[i])
+			i--;
+		if (i < 0)
+			return n;
+	}
+
+	return -1;
+}
+
+int PgnGameFilter::dateKey(const QDate& date)
+{
+	if (date.isNull())
+		return 0;
+	return date.year() * 10000 + date.month() * 100 + date.day();
+}
 
 PgnGameFilter::PgnGameFilter()
 	: m_type(Advanced),
+	  m_minDateKey(0),
+	  m_maxDateKey(0),
 	  m_minRound(0),
 	  m_maxRound(0),
 	  m_result(AnyResult),
@@ -32,48 +97,58 @@ PgnGameFilter::PgnGameFilter()
 PgnGameFilter::PgnGameFilter(const QString& pattern)
 	: m_type(FixedString),
 	  m_pattern(pattern.toLatin1()),
+	  m_minDateKey(0),
+	  m_maxDateKey(0),
 	  m_minRound(0),
 	  m_maxRound(0),
 	  m_result(AnyResult),
 	  m_resultInverted(false)
 {
+	m_patternMatcher.setPattern(m_pattern);
 }
 
 void PgnGameFilter::setPattern(const QString& pattern)
 {
 	m_type = FixedString;
 	m_pattern = pattern.toLatin1();
+	m_patternMatcher.setPattern(m_pattern);
 }
 
 void PgnGameFilter::setEvent(const QString& event)
 {
 	m_event = event.toLatin1();
+	m_eventMatcher.setPattern(m_event);
 }
 
 void PgnGameFilter::setSite(const QString& site)
 {
 	m_site = site.toLatin1();
+	m_siteMatcher.setPattern(m_site);
 }
 
 void PgnGameFilter::setPlayer(const QString& name, Chess::Side side)
 {
 	m_player = name.toLatin1();
+	m_playerMatcher.setPattern(m_player);
 	m_playerSide = side;
 }
 
 void PgnGameFilter::setOpponent(const QString& name)
 {
 	m_opponent = name.toLatin1();
+	m_opponentMatcher.setPattern(m_opponent);
 }
 
 void PgnGameFilter::setMinDate(const QDate& date)
 {
 	m_minDate = date;
+	m_minDateKey = dateKey(date);
 }
 
 void PgnGameFilter::setMaxDate(const QDate& date)
 {
 	m_maxDate = date;
+	m_maxDateKey = dateKey(date);
 }
 
 void PgnGameFilter::setMinRound(int round)
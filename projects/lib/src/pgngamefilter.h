@@ -148,15 +148,45 @@ class LIB_EXPORT PgnGameFilter
 		void setResultInverted(bool invert);
 
 	private:
+		friend class PgnGameEntry;
+
+		/*
+		 * A case-insensitive substring search that is prepared
+		 * once per filter instead of once per game.
+		 */
+		class StringMatcher
+		{
+			public:
+				void setPattern(const QByteArray& pattern);
+				/*
+				 * Returns the length of the pattern if
+				 * \a data contains it; otherwise returns -1.
+				 */
+				int match(const char* data, int size) const;
+
+			private:
+				QByteArray m_pattern;
+				QByteArray m_shift;
+		};
+
+		static int dateKey(const QDate& date);
+
 		Type m_type;
 		QByteArray m_pattern;
 		QByteArray m_event;
 		QByteArray m_site;
 		QByteArray m_player;
 		QByteArray m_opponent;
+		StringMatcher m_patternMatcher;
+		StringMatcher m_eventMatcher;
+		StringMatcher m_siteMatcher;
+		StringMatcher m_playerMatcher;
+		StringMatcher m_opponentMatcher;
 		Chess::Side m_playerSide;
 		QDate m_minDate;
 		QDate m_maxDate;
+		int m_minDateKey;
+		int m_maxDateKey;
 		int m_minRound;
 		int m_maxRound;
 		Result m_result;
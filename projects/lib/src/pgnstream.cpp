@@ -20,48 +20,118 @@
 #include <cctype>
 #include <cstring>
 #include <QIODevice>
+#include <QFile>
+#include <QtAlgorithms>
 #include "board/boardfactory.h"
 
+#if defined(__AVX2__)
+  #include <immintrin.h>
+  #define PGN_SCAN_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) \
+   || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+  #include <emmintrin.h>
+  #define PGN_SCAN_SSE2
+#endif
+
 namespace {
 
-void skipSection(PgnStream* in, char start)
+// The size of the blocks read from devices that can't be mapped
+const qint64 s_blockSize = 64 * 1024;
+
+/*
+ * Returns a pointer to the first character in [begin, end) that is
+ * one of the characters in \a chars, or \a end if there are none.
+ * The number of newlines before the returned position is added to
+ * \a newlines.
+ *
+ * \a chars can have at most 8 characters. The input is compared in
+ * 32 byte (AVX2) or 16 byte (SSE2) chunks when possible.
+ */
+const char* scan(const char* begin,
+		 const char* end,
+		 const char* chars,
+		 qint64* newlines)
 {
-	char end;
-	switch (start)
+	const int count = int(strlen(chars));
+	Q_ASSERT(count > 0 && count <= 8);
+	const char* p = begin;
+
+#if defined(PGN_SCAN_AVX2)
+	__m256i set[8];
+	for (int i = 0; i < count; i++)
+		set[i] = _mm256_set1_epi8(chars[i]);
+	const __m256i newline = _mm256_set1_epi8('\n');
+
+	for (; end - p >= 32; p += 32)
 	{
-	case '(':
-		end = ')';
-		break;
-	case '{':
-		end = '}';
-		break;
-	case ';':
-	case '%':
-		start = 0;
-		end = '\n';
-		break;
-	default:
-		return;
+		const __m256i v = _mm256_loadu_si256(
+			reinterpret_cast<const __m256i*>(p));
+		__m256i hit = _mm256_cmpeq_epi8(v, set[0]);
+		for (int i = 1; i < count; i++)
+			hit = _mm256_or_si256(hit, _mm256_cmpeq_epi8(v, set[i]));
+
+		const quint32 hits = quint32(_mm256_movemask_epi8(hit));
+		const quint32 lines = quint32(_mm256_movemask_epi8(
+			_mm256_cmpeq_epi8(v, newline)));
+		if (hits != 0)
+		{
+			const uint i = qCountTrailingZeroBits(hits);
+			*newlines += qPopulationCount(lines & ((1U << i) - 1));
+			return p + i;
+		}
+		*newlines += qPopulationCount(lines);
 	}
+#elif defined(PGN_SCAN_SSE2)
+	__m128i set[8];
+	for (int i = 0; i < count; i++)
+		set[i] = _mm_set1_epi8(chars[i]);
+	const __m128i newline = _mm_set1_epi8('\n');
 
-	int level = 1;
-	char c;
-	while ((c = in->readChar()) != 0)
+	for (; end - p >= 16; p += 16)
 	{
-		if (c == end && --level == 0)
-			break;
-		if (c == start)
-			level++;
+		const __m128i v = _mm_loadu_si128(
+			reinterpret_cast<const __m128i*>(p));
+		__m128i hit = _mm_cmpeq_epi8(v, set[0]);
+		for (int i = 1; i < count; i++)
+			hit = _mm_or_si128(hit, _mm_cmpeq_epi8(v, set[i]));
+
+		const quint32 hits = quint32(_mm_movemask_epi8(hit));
+		const quint32 lines = quint32(_mm_movemask_epi8(
+			_mm_cmpeq_epi8(v, newline)));
+		if (hits != 0)
+		{
+			const uint i = qCountTrailingZeroBits(hits);
+			*newlines += qPopulationCount(lines & ((1U << i) - 1));
+			return p + i;
+		}
+		*newlines += qPopulationCount(lines);
 	}
+#endif
+
+	// Scalar fallback and the tail of the input
+	for (; p < end; ++p)
+	{
+		if (memchr(chars, *p, count) != nullptr)
+			return p;
+		if (*p == '\n')
+			++*newlines;
+	}
+
+	return end;
 }
 
 } // anonymous namespace
 
 PgnStream::PgnStream(const QString& variant)
 	: m_board(nullptr),
-	  m_pos(0),
+	  m_data(nullptr),
+	  m_cur(nullptr),
+	  m_end(nullptr),
+	  m_dataPos(0),
+	  m_map(nullptr),
+	  m_skipCr(false),
+	  m_restoreTextMode(false),
 	  m_lineNumber(1),
-	  m_lastChar(0),
 	  m_tokenType(NoToken),
 	  m_device(nullptr),
 	  m_string(nullptr),
@@ -72,29 +142,51 @@ PgnStream::PgnStream(const QString& variant)
 }
 
 PgnStream::PgnStream(QIODevice* device, const QString& variant)
-	: m_board(nullptr)
+	: PgnStream(variant)
 {
-	setVariant(variant);
 	setDevice(device);
 }
 
 PgnStream::PgnStream(const QByteArray* string, const QString& variant)
-	: m_board(nullptr)
+	: PgnStream(variant)
 {
-	setVariant(variant);
 	setString(string);
 }
 
 PgnStream::~PgnStream()
 {
+	releaseDevice();
 	delete m_board;
 }
 
+void PgnStream::releaseDevice()
+{
+	// The device may have been destroyed already, in which case
+	// its memory map is gone too
+	if (m_devicePtr)
+	{
+		if (m_map != nullptr)
+			qobject_cast<QFile*>(m_devicePtr)->unmap(m_map);
+		if (m_restoreTextMode)
+			m_devicePtr->setTextModeEnabled(true);
+	}
+
+	m_devicePtr = nullptr;
+	m_map = nullptr;
+	m_skipCr = false;
+	m_restoreTextMode = false;
+	m_buffer.clear();
+}
+
 void PgnStream::reset()
 {
-	m_pos = 0;
+	releaseDevice();
+
+	m_data = nullptr;
+	m_cur = nullptr;
+	m_end = nullptr;
+	m_dataPos = 0;
 	m_lineNumber = 1;
-	m_lastChar = 0;
 	m_tokenString.clear();
 	m_tagName.clear();
 	m_tagValue.clear();
@@ -117,10 +209,40 @@ QIODevice* PgnStream::device() const
 
 void PgnStream::setDevice(QIODevice* device)
 {
-	Q_ASSERT(device != nullptr);
-
 	reset();
+	if (device == nullptr)
+		return;
+
 	m_device = device;
+	m_devicePtr = device;
+	m_skipCr = device->isTextModeEnabled();
+	m_dataPos = device->pos();
+
+	// Map the whole file if possible, so that the input doesn't have
+	// to be copied at all
+	QFile* file = qobject_cast<QFile*>(device);
+	if (file != nullptr && file->isOpen() && !file->isSequential())
+	{
+		const qint64 size = file->size();
+		if (size > 0 && m_dataPos <= size)
+			m_map = file->map(0, size);
+		if (m_map != nullptr)
+		{
+			m_data = reinterpret_cast<const char*>(m_map);
+			m_cur = m_data + m_dataPos;
+			m_end = m_data + size;
+			m_dataPos = 0;
+			return;
+		}
+	}
+
+	// The blocks are read in binary mode to keep the byte offsets
+	// right, and carriage returns are skipped by readChar()
+	if (m_skipCr)
+	{
+		device->setTextModeEnabled(false);
+		m_restoreTextMode = true;
+	}
 }
 
 const QByteArray* PgnStream::string() const
@@ -133,6 +255,9 @@ void PgnStream::setString(const QByteArray* string)
 	Q_ASSERT(string != nullptr);
 	reset();
 	m_string = string;
+	m_data = string->constData();
+	m_cur = m_data;
+	m_end = m_data + string->size();
 }
 
 QString PgnStream::variant() const
@@ -162,9 +287,7 @@ bool PgnStream::isOpen() const
 
 qint64 PgnStream::pos() const
 {
-	if (m_device)
-		return m_device->pos();
-	return m_pos;
+	return m_dataPos + (m_cur - m_data);
 }
 
 qint64 PgnStream::lineNumber() const
@@ -172,32 +295,28 @@ qint64 PgnStream::lineNumber() const
 	return m_lineNumber;
 }
 
-char PgnStream::readChar()
+bool PgnStream::readBlock()
 {
-	char c;
-	if (m_device)
-	{
-		if (!m_device->getChar(&m_lastChar))
-		{
-			m_status = ReadPastEnd;
-			return 0;
-		}
-		c = m_lastChar;
-	}
-	else if (m_string && m_pos < m_string->size())
-	{
-		c = m_string->at(m_pos++);
-	}
-	else
-	{
-		m_status = ReadPastEnd;
-		return 0;
-	}
+	if (m_device == nullptr || m_map != nullptr)
+		return false;
+
+	// The last character is kept at the start of the new block
+	// so that rewindChar() works across blocks
+	const qint64 pos = this->pos();
+	const char last = (m_cur != m_data) ? m_cur[-1] : 0;
 
-	if (c == '\n')
-		m_lineNumber++;
+	m_buffer.resize(s_blockSize + 1);
+	const qint64 n = m_device->read(m_buffer.data() + 1, s_blockSize);
+	if (n <= 0)
+		return false;
 
-	return c;
+	m_buffer[0] = last;
+	m_data = m_buffer.constData();
+	m_cur = m_data + 1;
+	m_end = m_cur + n;
+	m_dataPos = pos - 1;
+
+	return true;
 }
 
 void PgnStream::rewind()
@@ -208,20 +327,10 @@ void PgnStream::rewind()
 void PgnStream::rewindChar()
 {
 	Q_ASSERT(pos() > 0);
-
-	char c;
-	if (m_device)
-	{
-		c = m_lastChar;
-		m_device->ungetChar(m_lastChar);
-		m_lastChar = 0;
-	}
-	else if (m_string)
-		c = m_string->at(m_pos--);
-	else
+	if (m_cur == m_data)
 		return;
 
-	if (c == '\n')
+	if (*--m_cur == '\n')
 		m_lineNumber--;
 }
 
@@ -231,22 +340,35 @@ bool PgnStream::seek(qint64 pos, qint64 lineNumber)
 		return false;
 
 	bool ok = false;
-	if (m_device)
+	if (m_string || m_map != nullptr)
 	{
-		ok = m_device->seek(pos);
-		m_pos = 0;
+		ok = m_string ? pos < m_end - m_data : pos <= m_end - m_data;
+		if (ok)
+			m_cur = m_data + pos;
 	}
-	else if (m_string)
+	else if (m_device)
 	{
-		ok = pos < m_string->size();
-		m_pos = pos;
+		// Seeking inside the current block doesn't need a new read
+		if (m_data != nullptr && pos > m_dataPos
+		&&  pos <= m_dataPos + (m_end - m_data))
+		{
+			m_cur = m_data + (pos - m_dataPos);
+			ok = true;
+		}
+		else if (m_device->seek(pos))
+		{
+			ok = true;
+			m_data = nullptr;
+			m_cur = nullptr;
+			m_end = nullptr;
+			m_dataPos = pos;
+		}
 	}
 	if (!ok)
 		return false;
 
 	m_status = Ok;
 	m_lineNumber = lineNumber;
-	m_lastChar = 0;
 	m_phase = OutOfGame;
 
 	return true;
@@ -257,19 +379,80 @@ PgnStream::Status PgnStream::status() const
 	return m_status;
 }
 
-void PgnStream::parseUntil(const char* chars)
+char PgnStream::skipUntil(const char* chars, QByteArray* skipped)
 {
-	Q_ASSERT(chars != nullptr);
+	for (;;)
+	{
+		const char* p = scan(m_cur, m_end, chars, &m_lineNumber);
+		if (skipped != nullptr)
+			appendSpan(skipped, m_cur, p);
+		m_cur = p;
+
+		if (p != m_end)
+			return *p;
+		if (!readBlock())
+		{
+			m_status = ReadPastEnd;
+			return 0;
+		}
+	}
+}
 
+void PgnStream::appendSpan(QByteArray* str, const char* begin, const char* end) const
+{
+	if (!m_skipCr)
+	{
+		str->append(begin, int(end - begin));
+		return;
+	}
+
+	for (const char* p = begin; p != end; p++)
+	{
+		if (*p != '\r')
+			str->append(*p);
+	}
+}
+
+void PgnStream::skipSection(char start)
+{
+	char chars[3] = { 0, 0, 0 };
+	switch (start)
+	{
+	case '(':
+		chars[0] = '(';
+		chars[1] = ')';
+		break;
+	case '{':
+		chars[0] = '{';
+		chars[1] = '}';
+		break;
+	case ';':
+	case '%':
+		chars[0] = '\n';
+		break;
+	default:
+		return;
+	}
+
+	int level = 1;
 	char c;
-	while ((c = readChar()) != 0)
+	while (skipUntil(chars) != 0 && (c = readChar()) != 0)
 	{
-		if (strchr(chars, c))
+		if (c == chars[0] && chars[1] != 0)
+			level++;
+		else if (--level == 0)
 			break;
-		m_tokenString.append(c);
 	}
 }
 
+void PgnStream::parseUntil(const char* chars)
+{
+	Q_ASSERT(chars != nullptr);
+
+	if (skipUntil(chars, &m_tokenString) != 0)
+		readChar();
+}
+
 void PgnStream::parseTag()
 {
 	bool inQuotes = false;
@@ -335,25 +518,33 @@ void PgnStream::parseTag()
 void PgnStream::parseComment(char opBracket)
 {
 	int level = 1;
-	char clBracket = (opBracket == '(') ? ')' : '}';
+	const char chars[3] = { opBracket, (opBracket == '(') ? ')' : '}', 0 };
 
+	// Leading newlines are not part of the comment
 	char c;
-	while ((c = readChar()) != 0)
+	while ((c = readChar()) == '\n')
+		;
+	if (c == 0)
+		return;
+	rewindChar();
+
+	while (skipUntil(chars, &m_tokenString) != 0)
 	{
+		c = readChar();
 		if (c == opBracket)
 			level++;
-		else if (c == clBracket && --level <= 0)
+		else if (--level <= 0)
 			break;
-
-		if (c != '\n' || !m_tokenString.isEmpty())
-			m_tokenString.append(c);
+		m_tokenString.append(c);
 	}
 }
 
 bool PgnStream::nextGame()
 {
+	// Movetext and comments before the next game are skipped
+	// without tokenizing them
 	char c;
-	while ((c = readChar()) != 0)
+	while (skipUntil("[({;%") != 0 && (c = readChar()) != 0)
 	{
 		if (c == '[')
 		{
@@ -361,8 +552,7 @@ bool PgnStream::nextGame()
 			m_phase = InTags;
 			return true;
 		}
-		else
-			skipSection(this, c);
+		skipSection(c);
 	}
 
 	return false;
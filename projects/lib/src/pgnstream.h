@@ -21,7 +21,10 @@
 
 #include <QtGlobal>
 #include <QString>
+#include <QByteArray>
+#include <QPointer>
 class QIODevice;
+class QFile;
 namespace Chess { class Board; }
 
 
@@ -36,6 +39,14 @@ namespace Chess { class Board; }
  * be changed at any time, so it's possible to read PGN streams that
  * contain games of multiple variants.
  *
+ * The input is always parsed from a contiguous block of memory. A
+ * file device (QFile) is mapped into memory if possible, and other
+ * devices are read in large blocks. The position of the device is
+ * undefined while it's used by a PgnStream, and the device's own text
+ * mode is replaced by the stream's: carriage returns are skipped if
+ * the device was opened in QIODevice::Text mode. pos() and seek()
+ * always use byte offsets in the device.
+ *
  * \sa PgnGame
  * \sa OpeningBook
  */
@@ -104,7 +115,11 @@ class LIB_EXPORT PgnStream
 
 		/*! Returns the assigned device, or 0 if no device is in use. */
 		QIODevice* device() const;
-		/*! Sets the current device to \a device. */
+		/*!
+		 * Sets the current device to \a device.
+		 *
+		 * Reading starts from the device's current position.
+		 */
 		void setDevice(QIODevice* device);
 
 		/*! Returns the assigned string, or 0 if no string is in use. */
@@ -133,7 +148,7 @@ class LIB_EXPORT PgnStream
 		void reset();
 
 		/*! Reads one character and returns it. */
-		char readChar();
+		inline char readChar();
 		/*!
 		 * Rewinds the stream position by one character, which means that
 		 * the next time readChar() is called, nothing is read and the
@@ -203,11 +218,28 @@ class LIB_EXPORT PgnStream
 		void parseUntil(const char* chars);
 		void parseTag();
 		void parseComment(char opBracket);
+		void releaseDevice();
+		bool readBlock();
+		char skipUntil(const char* chars, QByteArray* skipped = nullptr);
+		void appendSpan(QByteArray* str,
+				const char* begin,
+				const char* end) const;
+		void skipSection(char start);
 
 		Chess::Board* m_board;
-		qint64 m_pos;
+		// The current span of input: the string, the mapped file or
+		// the last block read from the device
+		const char* m_data;
+		const char* m_cur;
+		const char* m_end;
+		// Stream position of the beginning of the span
+		qint64 m_dataPos;
+		QByteArray m_buffer;
+		QPointer<QIODevice> m_devicePtr;
+		uchar* m_map;
+		bool m_skipCr;
+		bool m_restoreTextMode;
 		qint64 m_lineNumber;
-		char m_lastChar;
 		QByteArray m_tokenString;
 		QByteArray m_tagName;
 		QByteArray m_tagValue;
@@ -218,4 +250,23 @@ class LIB_EXPORT PgnStream
 		Phase m_phase;
 };
 
+inline char PgnStream::readChar()
+{
+	for (;;)
+	{
+		if (m_cur == m_end && !readBlock())
+		{
+			m_status = ReadPastEnd;
+			return 0;
+		}
+
+		const char c = *m_cur++;
+		if (c == '\n')
+			m_lineNumber++;
+		else if (c == '\r' && m_skipCr)
+			continue;
+		return c;
+	}
+}
+
 #endif // PGNSTREAM_H
@@ -40,7 +40,9 @@ class LIB_EXPORT PolyglotBook: public OpeningBook
 		// Inherited from OpeningBook
 		virtual int entrySize() const;
 		virtual Entry readEntry(QDataStream& in, quint64* key) const;
-		virtual void writeEntry(const Map::const_iterator& it,
+		virtual Entry entryFromData(const uchar* data, quint64* key) const;
+		virtual void writeEntry(quint64 key,
+					const Entry& entry,
 					QDataStream& out) const;
 };
 
@@ -0,0 +1,484 @@
+/*
+    This file is part of Cute Chess.
+    Copyright (C) 2008-2018 Cute Chess authors
+
+    Cute Chess is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Cute Chess is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Cute Chess.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "positionindex.h"
+#include <algorithm>
+#include <queue>
+#include <QMap>
+#include <QSaveFile>
+#include <QTemporaryFile>
+#include <QtEndian>
+#include "pgngame.h"
+
+namespace {
+
+const quint32 s_magic = 0x49504343; // "CCPI"
+const quint32 s_version = 1;
+
+// First game, game count, key count, posting count, magic and version
+const qint64 s_trailerSize = 40;
+// Game number and move
+const qint64 s_postingSize = 8;
+// Key and number of the first posting
+const qint64 s_keySize = 16;
+// Number of bytes buffered before they're written to a file
+const int s_bufferSize = 64 * 1024;
+
+enum ResultCode
+{
+	NoResult,
+	WhiteWins,
+	BlackWins,
+	Draw
+};
+
+template <typename T>
+void put(QByteArray* data, T value)
+{
+	const T le = qToLittleEndian(value);
+	data->append(reinterpret_cast<const char*>(&le), sizeof(T));
+}
+
+template <typename T>
+T get(const uchar* data)
+{
+	return qFromLittleEndian<T>(data);
+}
+
+quint8 resultCode(const Chess::Result& result)
+{
+	if (result.isDraw())
+		return Draw;
+	if (result.winner() == Chess::Side::White)
+		return WhiteWins;
+	if (result.winner() == Chess::Side::Black)
+		return BlackWins;
+	return NoResult;
+}
+
+} // anonymous namespace
+
+PositionIndex::PositionIndex()
+	: m_data(nullptr),
+	  m_firstGame(0),
+	  m_gameCount(0),
+	  m_keyCount(0),
+	  m_postingCount(0)
+{
+}
+
+PositionIndex::~PositionIndex()
+{
+	close();
+}
+
+bool PositionIndex::open(const QString& fileName)
+{
+	close();
+
+	m_file.setFileName(fileName);
+	if (!m_file.open(QIODevice::ReadOnly))
+		return false;
+
+	const qint64 size = m_file.size();
+	if (size < s_trailerSize)
+	{
+		close();
+		return false;
+	}
+
+	m_data = m_file.map(0, size);
+	if (m_data == nullptr)
+	{
+		close();
+		return false;
+	}
+
+	const uchar* trailer = m_data + size - s_trailerSize;
+	const qint64 firstGame = get<qint64>(trailer);
+	const qint64 gameCount = get<qint64>(trailer + 8);
+	const qint64 keyCount = get<qint64>(trailer + 16);
+	const qint64 postingCount = get<qint64>(trailer + 24);
+
+	if (get<quint32>(trailer + 32) != s_magic
+	||  get<quint32>(trailer + 36) != s_version
+	||  firstGame < 0 || gameCount < 0 || keyCount < 0 || postingCount < 0
+	||  size != postingCount * s_postingSize + keyCount * s_keySize
+		    + gameCount + s_trailerSize)
+	{
+		close();
+		return false;
+	}
+
+	m_firstGame = firstGame;
+	m_gameCount = gameCount;
+	m_keyCount = keyCount;
+	m_postingCount = postingCount;
+
+	return true;
+}
+
+void PositionIndex::close()
+{
+	if (m_data != nullptr)
+		m_file.unmap(const_cast<uchar*>(m_data));
+	m_file.close();
+
+	m_data = nullptr;
+	m_firstGame = 0;
+	m_gameCount = 0;
+	m_keyCount = 0;
+	m_postingCount = 0;
+}
+
+bool PositionIndex::isOpen() const
+{
+	return m_data != nullptr;
+}
+
+int PositionIndex::firstGame() const
+{
+	return int(m_firstGame);
+}
+
+int PositionIndex::gameCount() const
+{
+	return int(m_gameCount);
+}
+
+void PositionIndex::find(quint64 key, QVector<Hit>* hits) const
+{
+	if (m_data == nullptr)
+		return;
+
+	const uchar* keys = m_data + m_postingCount * s_postingSize;
+	const uchar* results = keys + m_keyCount * s_keySize;
+
+	qint64 low = 0;
+	qint64 high = m_keyCount;
+	while (low < high)
+	{
+		const qint64 mid = low + (high - low) / 2;
+		if (get<quint64>(keys + mid * s_keySize) < key)
+			low = mid + 1;
+		else
+			high = mid;
+	}
+	if (low == m_keyCount || get<quint64>(keys + low * s_keySize) != key)
+		return;
+
+	const qint64 first = get<qint64>(keys + low * s_keySize + 8);
+	const qint64 last = (low + 1 < m_keyCount)
+		? get<qint64>(keys + (low + 1) * s_keySize + 8) : m_postingCount;
+	if (first < 0 || first > last || last > m_postingCount)
+		return;
+
+	for (qint64 i = first; i < last; i++)
+	{
+		const uchar* posting = m_data + i * s_postingSize;
+		Hit hit;
+		hit.game = get<quint32>(posting);
+		hit.move = get<quint32>(posting + 4);
+
+		const qint64 n = qint64(hit.game) - m_firstGame;
+		hit.result = (n >= 0 && n < m_gameCount) ? results[n] : quint8(NoResult);
+		hits->append(hit);
+	}
+}
+
+QVector<int> PositionIndex::games(quint64 key) const
+{
+	return games(QList<const PositionIndex*>() << this, key);
+}
+
+QVector<PositionIndex::MoveStats> PositionIndex::moveStats(quint64 key) const
+{
+	return moveStats(QList<const PositionIndex*>() << this, key);
+}
+
+QVector<int> PositionIndex::games(const QList<const PositionIndex*>& indexes,
+				  quint64 key)
+{
+	QVector<Hit> hits;
+	for (const PositionIndex* index : indexes)
+		index->find(key, &hits);
+
+	QVector<int> games;
+	games.reserve(hits.size());
+	for (const Hit& hit : qAsConst(hits))
+		games.append(int(hit.game));
+
+	std::sort(games.begin(), games.end());
+	games.erase(std::unique(games.begin(), games.end()), games.end());
+
+	return games;
+}
+
+QVector<PositionIndex::MoveStats> PositionIndex::moveStats(
+	const QList<const PositionIndex*>& indexes, quint64 key)
+{
+	QVector<Hit> hits;
+	for (const PositionIndex* index : indexes)
+		index->find(key, &hits);
+
+	// A game counts once for each move played from the position
+	std::sort(hits.begin(), hits.end(), [](const Hit& a, const Hit& b)
+	{
+		return a.game < b.game || (a.game == b.game && a.move < b.move);
+	});
+
+	QMap<quint32, MoveStats> map;
+	for (int i = 0; i < hits.size(); i++)
+	{
+		const Hit& hit = hits.at(i);
+		if (i > 0 && hits.at(i - 1).game == hit.game
+		&&  hits.at(i - 1).move == hit.move)
+			continue;
+
+		auto it = map.find(hit.move);
+		if (it == map.end())
+		{
+			const auto move = Chess::GenericMove::fromBits(hit.move);
+			it = map.insert(hit.move, MoveStats{move, 0, 0, 0, 0});
+		}
+
+		it->games++;
+		if (hit.result == WhiteWins)
+			it->whiteWins++;
+		else if (hit.result == BlackWins)
+			it->blackWins++;
+		else if (hit.result == Draw)
+			it->draws++;
+	}
+
+	QVector<MoveStats> stats;
+	stats.reserve(map.size());
+	for (const MoveStats& moveStat : qAsConst(map))
+		stats.append(moveStat);
+	std::stable_sort(stats.begin(), stats.end(),
+			 [](const MoveStats& a, const MoveStats& b)
+	{
+		return a.games > b.games;
+	});
+
+	return stats;
+}
+
+bool PositionIndexWriter::Posting::operator<(const Posting& other) const
+{
+	if (key != other.key)
+		return key < other.key;
+	if (game != other.game)
+		return game < other.game;
+	return move < other.move;
+}
+
+PositionIndexWriter::PositionIndexWriter(const QString& fileName,
+					 int firstGame,
+					 int gameCount,
+					 int runSize)
+	: m_fileName(fileName),
+	  m_firstGame(firstGame),
+	  m_runSize(qMax(1, runSize)),
+	  m_results(gameCount, char(NoResult)),
+	  m_ok(true)
+{
+}
+
+PositionIndexWriter::~PositionIndexWriter()
+{
+	qDeleteAll(m_runs);
+}
+
+void PositionIndexWriter::addGame(int gameNumber, const PgnGame& game)
+{
+	const QVector<PgnGame::MoveData>& moves = game.moves();
+	if (moves.isEmpty())
+		return;
+
+	QVector<Posting> postings;
+	postings.reserve(moves.size() + 1);
+	for (const PgnGame::MoveData& md : moves)
+		postings.append(Posting{md.key, quint32(gameNumber), md.move.toBits()});
+	// The final position
+	postings.append(Posting{game.key(), quint32(gameNumber), 0});
+
+	QMutexLocker locker(&m_mutex);
+
+	const qint64 n = gameNumber - m_firstGame;
+	if (n >= 0 && n < m_results.size())
+		m_results[int(n)] = char(resultCode(game.result()));
+
+	m_postings += postings;
+	if (m_postings.size() >= m_runSize)
+		m_ok = writeRun() && m_ok;
+}
+
+bool PositionIndexWriter::writeRun()
+{
+	std::sort(m_postings.begin(), m_postings.end());
+
+	QTemporaryFile* run = new QTemporaryFile;
+	m_runs.append(run);
+
+	const qint64 size = m_postings.size() * qint64(sizeof(Posting));
+	bool ok = run->open()
+		&& run->write(reinterpret_cast<const char*>(m_postings.constData()),
+			      size) == size;
+	m_postings.clear();
+
+	return ok;
+}
+
+bool PositionIndexWriter::finish()
+{
+	QMutexLocker locker(&m_mutex);
+
+	if (!m_postings.isEmpty())
+		m_ok = writeRun() && m_ok;
+	if (!m_ok)
+		return false;
+
+	// Buffered readers of the sorted runs
+	struct Run
+	{
+		QTemporaryFile* file;
+		QVector<Posting> buffer;
+		int pos;
+
+		bool next(Posting* posting)
+		{
+			if (pos == buffer.size())
+			{
+				buffer.resize(s_bufferSize / int(sizeof(Posting)));
+				const qint64 n = file->read(
+					reinterpret_cast<char*>(buffer.data()),
+					buffer.size() * qint64(sizeof(Posting)));
+				buffer.resize(int(qMax(qint64(0), n) / qint64(sizeof(Posting))));
+				pos = 0;
+				if (buffer.isEmpty())
+					return false;
+			}
+			*posting = buffer.at(pos++);
+			return true;
+		}
+	};
+	struct Head
+	{
+		Posting posting;
+		int run;
+
+		bool operator<(const Head& other) const
+		{
+			// The smallest posting is on top of the heap
+			return other.posting < posting;
+		}
+	};
+
+	QVector<Run> runs;
+	std::priority_queue<Head> heap;
+	for (QTemporaryFile* file : qAsConst(m_runs))
+	{
+		if (!file->seek(0))
+			return false;
+		runs.append(Run{file, QVector<Posting>(), 0});
+
+		Head head;
+		head.run = runs.size() - 1;
+		if (runs.last().next(&head.posting))
+			heap.push(head);
+	}
+
+	// The postings are written directly and the key table is
+	// collected in a temporary file, because the number of distinct
+	// keys isn't known in advance
+	QSaveFile out(m_fileName);
+	QTemporaryFile keys;
+	if (!out.open(QIODevice::WriteOnly) || !keys.open())
+		return false;
+
+	QByteArray postingData;
+	QByteArray keyData;
+	qint64 postingCount = 0;
+	qint64 keyCount = 0;
+	bool ok = true;
+
+	while (!heap.empty() && ok)
+	{
+		Head head = heap.top();
+		heap.pop();
+
+		if (keyCount == 0 || head.posting.key != get<quint64>(
+			reinterpret_cast<const uchar*>(keyData.constData()
+						       + keyData.size() - s_keySize)))
+		{
+			if (keyData.size() >= s_bufferSize)
+			{
+				// Keep the last key for the comparison above
+				const QByteArray last(keyData.right(int(s_keySize)));
+				ok = keys.write(keyData.constData(),
+						keyData.size() - s_keySize)
+				     == keyData.size() - s_keySize;
+				keyData = last;
+			}
+			put(&keyData, head.posting.key);
+			put(&keyData, postingCount);
+			keyCount++;
+		}
+
+		put(&postingData, head.posting.game);
+		put(&postingData, head.posting.move);
+		postingCount++;
+		if (postingData.size() >= s_bufferSize)
+		{
+			ok = ok && out.write(postingData) == postingData.size();
+			postingData.clear();
+		}
+
+		if (runs[head.run].next(&head.posting))
+			heap.push(head);
+	}
+
+	ok = ok
+	  && out.write(postingData) == postingData.size()
+	  && keys.write(keyData) == keyData.size()
+	  && keys.seek(0);
+
+	while (ok && !keys.atEnd())
+	{
+		const QByteArray data(keys.read(s_bufferSize));
+		ok = !data.isEmpty() && out.write(data) == data.size();
+	}
+
+	QByteArray trailer;
+	put(&trailer, m_firstGame);
+	put(&trailer, qint64(m_results.size()));
+	put(&trailer, keyCount);
+	put(&trailer, postingCount);
+	put(&trailer, s_magic);
+	put(&trailer, s_version);
+
+	ok = ok
+	  && out.write(m_results) == m_results.size()
+	  && out.write(trailer) == trailer.size();
+
+	qDeleteAll(m_runs);
+	m_runs.clear();
+
+	return ok && out.commit();
+}
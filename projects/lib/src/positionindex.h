@@ -0,0 +1,202 @@
+/*
+    This file is part of Cute Chess.
+    Copyright (C) 2008-2018 Cute Chess authors
+
+    Cute Chess is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Cute Chess is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Cute Chess.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef POSITIONINDEX_H
+#define POSITIONINDEX_H
+
+#include <QFile>
+#include <QList>
+#include <QMutex>
+#include <QVector>
+#include "board/genericmove.h"
+#include "board/result.h"
+class PgnGame;
+class QTemporaryFile;
+
+/*!
+ * \brief An index of the positions reached in a collection of games.
+ *
+ * PositionIndex maps the Zobrist keys of positions to the games that
+ * reach them and to the moves played from them. It answers questions
+ * like "which games reach this position" and "what was played here
+ * and how did it score" without reading the games.
+ *
+ * The index is a file with a sorted table of keys, each pointing to
+ * a block of postings (game number and move), followed by the results
+ * of the games. The file is memory-mapped for lookups.
+ *
+ * An index covers the games from firstGame() to
+ * firstGame() + gameCount() - 1, so a growing collection can be indexed
+ * in several parts.
+ *
+ * \sa PositionIndexWriter
+ */
+class LIB_EXPORT PositionIndex
+{
+	public:
+		/*! Statistics of a move played from a position. */
+		struct MoveStats
+		{
+			/*!
+			 * The move, or a null move for games that ended
+			 * in the position.
+			 */
+			Chess::GenericMove move;
+			/*! Number of games. */
+			int games;
+			/*! Number of games won by white. */
+			int whiteWins;
+			/*! Number of games won by black. */
+			int blackWins;
+			/*! Number of drawn games. */
+			int draws;
+		};
+
+		/*! Creates a new closed position index. */
+		PositionIndex();
+		/*! Closes the index. */
+		~PositionIndex();
+
+		/*!
+		 * Opens the index in \a fileName.
+		 * Returns true if successful.
+		 */
+		bool open(const QString& fileName);
+		/*! Closes the index. */
+		void close();
+		/*! Returns true if the index is open. */
+		bool isOpen() const;
+
+		/*! Returns the number of the first game in the index. */
+		int firstGame() const;
+		/*! Returns the number of games in the index. */
+		int gameCount() const;
+
+		/*!
+		 * Returns the numbers of the games that reach the position
+		 * with Zobrist key \a key, in ascending order.
+		 */
+		QVector<int> games(quint64 key) const;
+		/*!
+		 * Returns statistics of the moves played from the position
+		 * with Zobrist key \a key, the most popular move first.
+		 */
+		QVector<MoveStats> moveStats(quint64 key) const;
+
+		/*!
+		 * Returns the games that reach the position with Zobrist key
+		 * \a key in any of \a indexes.
+		 *
+		 * A game that is in several indexes is only returned once.
+		 */
+		static QVector<int> games(const QList<const PositionIndex*>& indexes,
+					  quint64 key);
+		/*!
+		 * Returns statistics of the moves played from the position
+		 * with Zobrist key \a key in any of \a indexes.
+		 *
+		 * A game that is in several indexes is only counted once.
+		 */
+		static QVector<MoveStats> moveStats(const QList<const PositionIndex*>& indexes,
+						    quint64 key);
+
+	private:
+		Q_DISABLE_COPY(PositionIndex)
+
+		struct Hit
+		{
+			quint32 game;
+			quint32 move;
+			quint8 result;
+		};
+
+		void find(quint64 key, QVector<Hit>* hits) const;
+
+		QFile m_file;
+		const uchar* m_data;
+		qint64 m_firstGame;
+		qint64 m_gameCount;
+		qint64 m_keyCount;
+		qint64 m_postingCount;
+};
+
+/*!
+ * \brief A writer of position index files.
+ *
+ * Games are added with addGame(), possibly from several threads, and
+ * the index is written by finish(). The postings are sorted in runs
+ * of limited size that are merged at the end, so indexing doesn't need
+ * memory for the whole collection.
+ *
+ * \sa PositionIndex
+ */
+class LIB_EXPORT PositionIndexWriter
+{
+	public:
+		/*!
+		 * Creates a new writer of index \a fileName for \a gameCount
+		 * games numbered from \a firstGame.
+		 *
+		 * At most \a runSize postings are kept in memory before
+		 * they are sorted into a temporary file.
+		 */
+		PositionIndexWriter(const QString& fileName,
+				    int firstGame,
+				    int gameCount,
+				    int runSize = 8 * 1024 * 1024);
+		/*! Destroys the writer and its temporary files. */
+		~PositionIndexWriter();
+
+		/*!
+		 * Adds the positions and moves of \a game as game number
+		 * \a gameNumber.
+		 *
+		 * This function is thread-safe.
+		 */
+		void addGame(int gameNumber, const PgnGame& game);
+		/*!
+		 * Writes the index file.
+		 * Returns true if successful.
+		 */
+		bool finish();
+
+	private:
+		Q_DISABLE_COPY(PositionIndexWriter)
+
+		struct Posting
+		{
+			quint64 key;
+			quint32 game;
+			quint32 move;
+
+			bool operator<(const Posting& other) const;
+		};
+
+		bool writeRun();
+
+		QString m_fileName;
+		qint64 m_firstGame;
+		int m_runSize;
+		QByteArray m_results;
+		QVector<Posting> m_postings;
+		QList<QTemporaryFile*> m_runs;
+		bool m_ok;
+		QMutex m_mutex;
+};
+
+#endif // POSITIONINDEX_H
@@ -67,6 +67,27 @@ TournamentPair* PyramidTournament::nextPair(int gameNumber)
 	return pair(white, black);
 }
 
+QVariantMap PyramidTournament::pairingState() const
+{
+	QVariantMap state;
+	state["pairNumber"] = m_pairNumber;
+	state["currentPlayer"] = m_currentPlayer;
+	return state;
+}
+
+bool PyramidTournament::restorePairingState(const QVariantMap& state)
+{
+	const int currentPlayer = state.value("currentPlayer", -1).toInt();
+	const int pairNumber = state.value("pairNumber", -1).toInt();
+	if (currentPlayer < 1 || currentPlayer >= playerCount()
+	||  pairNumber < 0 || pairNumber > currentPlayer)
+		return false;
+
+	m_currentPlayer = currentPlayer;
+	m_pairNumber = pairNumber;
+	return true;
+}
+
 int PyramidTournament::gamesPerRound() const
 {
 	// TODO: Implement for TCEC
@@ -228,3 +228,53 @@ TournamentPair* RoundRobinTournament::nextPair(int gameNumber)
 	else
 		return nextPair(gameNumber);
 }
+
+QVariantMap RoundRobinTournament::pairingState() const
+{
+	QVariantList topHalf;
+	for (int player : m_topHalf)
+		topHalf << player;
+	QVariantList bottomHalf;
+	for (int player : m_bottomHalf)
+		bottomHalf << player;
+
+	QVariantMap state;
+	state["pairNumber"] = m_pairNumber;
+	state["topHalf"] = topHalf;
+	state["bottomHalf"] = bottomHalf;
+	return state;
+}
+
+bool RoundRobinTournament::restorePairingState(const QVariantMap& state)
+{
+	const QVariantList topList = state.value("topHalf").toList();
+	const QVariantList bottomList = state.value("bottomHalf").toList();
+	const int pairNumber = state.value("pairNumber", -1).toInt();
+	if (topList.size() != m_topHalf.size()
+	||  bottomList.size() != m_bottomHalf.size()
+	||  pairNumber < 0 || pairNumber > m_topHalf.size())
+		return false;
+
+	// The tables must hold the same players in a different order
+	const int count = playerCount() + (playerCount() % 2);
+	QList<int> topHalf;
+	QList<int> bottomHalf;
+	QList<int> players;
+	for (const QVariant& value : topList)
+		topHalf << value.toInt();
+	for (const QVariant& value : bottomList)
+		bottomHalf << value.toInt();
+	players << topHalf << bottomHalf;
+	std::sort(players.begin(), players.end());
+	for (int i = 0; i < players.size(); i++)
+	{
+		if (players.at(i) < 0 || players.at(i) >= count
+		||  (i > 0 && players.at(i) == players.at(i - 1)))
+			return false;
+	}
+
+	m_pairNumber = pairNumber;
+	m_topHalf = topHalf;
+	m_bottomHalf = bottomHalf;
+	return true;
+}
@@ -47,6 +47,8 @@ class LIB_EXPORT RoundRobinTournament : public Tournament
 		virtual void initializePairing();
 		virtual int gamesPerCycle() const;
 		virtual TournamentPair* nextPair(int gameNumber);
+		virtual QVariantMap pairingState() const;
+		virtual bool restorePairingState(const QVariantMap& state);
 
 	private:
 		void initializePairing(QList<int>& bergerTable);
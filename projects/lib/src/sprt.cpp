@@ -135,10 +135,13 @@ Sprt::Sprt()
 	  m_elo1(0),
 	  m_alpha(0),
 	  m_beta(0),
+	  m_model(Trinomial),
 	  m_wins(0),
 	  m_losses(0),
 	  m_draws(0)
 {
+	for (int i = 0; i < 5; i++)
+		m_pairs[i] = 0;
 }
 
 bool Sprt::isNull() const
@@ -147,15 +150,35 @@ bool Sprt::isNull() const
 }
 
 void Sprt::initialize(double elo0, double elo1,
-		      double alpha, double beta)
+		      double alpha, double beta,
+		      Model model)
 {
 	m_elo0 = elo0;
 	m_elo1 = elo1;
 	m_alpha = alpha;
 	m_beta = beta;
+	m_model = model;
+}
+
+Sprt::Model Sprt::model() const
+{
+	return m_model;
+}
+
+int Sprt::pairCount(int halfPoints) const
+{
+	Q_ASSERT(halfPoints >= 0 && halfPoints <= 4);
+	return m_pairs[halfPoints];
 }
 
 Sprt::Status Sprt::status() const
+{
+	if (m_model == Pentanomial)
+		return pentanomialStatus();
+	return trinomialStatus();
+}
+
+Sprt::Status Sprt::trinomialStatus() const
 {
 	Status status = {
 		Continue,
@@ -203,3 +226,70 @@ void Sprt::addGameResult(GameResult result)
 	else if (result == Loss)
 		m_losses++;
 }
+
+void Sprt::addGamePairResult(GameResult first, GameResult second)
+{
+	if (first == NoResult || second == NoResult)
+		return;
+
+	addGameResult(first);
+	addGameResult(second);
+
+	const GameResult results[] = { first, second };
+	int halfPoints = 0;
+	for (GameResult result : results)
+	{
+		if (result == Win)
+			halfPoints += 2;
+		else if (result == Draw)
+			halfPoints += 1;
+	}
+	m_pairs[halfPoints]++;
+}
+
+Sprt::Status Sprt::pentanomialStatus() const
+{
+	Status status = {
+		Continue,
+		0.0,
+		0.0,
+		0.0
+	};
+
+	int count = 0;
+	double sum = 0.0;
+	for (int i = 0; i < 5; i++)
+	{
+		count += m_pairs[i];
+		sum += m_pairs[i] * (i / 4.0);
+	}
+	if (count <= 0)
+		return status;
+
+	// Mean and variance of the pair scores
+	const double mean = sum / count;
+	double variance = 0.0;
+	for (int i = 0; i < 5; i++)
+		variance += m_pairs[i] * std::pow(i / 4.0 - mean, 2.0);
+	variance /= count;
+	if (variance <= 0.0)
+		return status;
+
+	// Expected pair scores under H0 and H1
+	const double s0 = 1.0 / (1.0 + std::pow(10.0, -m_elo0 / 400.0));
+	const double s1 = 1.0 / (1.0 + std::pow(10.0, -m_elo1 / 400.0));
+
+	// Normal approximation of the Log-Likelihood Ratio
+	status.llr = count * (s1 - s0) * (2.0 * mean - s0 - s1)
+		     / (2.0 * variance);
+
+	status.lBound = std::log(m_beta / (1.0 - m_alpha));
+	status.uBound = std::log((1.0 - m_beta) / m_alpha);
+
+	if (status.llr > status.uBound)
+		status.result = AcceptH1;
+	else if (status.llr < status.lBound)
+		status.result = AcceptH0;
+
+	return status;
+}
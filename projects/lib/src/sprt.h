@@ -49,6 +49,23 @@ class LIB_EXPORT Sprt
 			Draw		//!< Game was drawn
 		};
 
+		/*! The statistical model of the test. */
+		enum Model
+		{
+			/*!
+			 * Each game is an independent win, loss or draw.
+			 * The Elo bounds are in BayesElo units.
+			 */
+			Trinomial,
+			/*!
+			 * Games are played in pairs with the same opening
+			 * and swapped colors, and the score of each pair
+			 * (0, 1/4, 1/2, 3/4 or 1) is one sample. The Elo
+			 * bounds are in logistic Elo units.
+			 */
+			Pentanomial
+		};
+
 		/*! The status of the test. */
 		struct Status
 		{
@@ -75,9 +92,14 @@ class LIB_EXPORT Sprt
 		 *
 		 * \a alpha is the maximum probability for a type I error and
 		 * \a beta for a type II error outside interval [elo0, elo1].
+		 *
+		 * \a model selects the statistical model of the results.
 		 */
 		void initialize(double elo0, double elo1,
-				double alpha, double beta);
+				double alpha, double beta,
+				Model model = Trinomial);
+		/*! Returns the statistical model of the test. */
+		Model model() const;
 		/*! Returns the current status of the test. */
 		Status status() const;
 		/*!
@@ -87,15 +109,36 @@ class LIB_EXPORT Sprt
 		 * check if H0 or H1 can be accepted.
 		 */
 		void addGameResult(GameResult result);
+		/*!
+		 * Updates the test with a pair of games played with the
+		 * same opening and swapped colors.
+		 *
+		 * \a first and \a second are the results of the two games
+		 * from the first player's point of view. The pair is
+		 * ignored if either game has no result. In the Trinomial
+		 * model this is the same as adding both results with
+		 * addGameResult().
+		 */
+		void addGamePairResult(GameResult first, GameResult second);
+		/*!
+		 * Returns the number of game pairs that ended with a total
+		 * score of \a halfPoints (0 to 4) for the first player.
+		 */
+		int pairCount(int halfPoints) const;
 
 	private:
+		Status trinomialStatus() const;
+		Status pentanomialStatus() const;
+
 		double m_elo0;
 		double m_elo1;
 		double m_alpha;
 		double m_beta;
+		Model m_model;
 		int m_wins;
 		int m_losses;
 		int m_draws;
+		int m_pairs[5];
 };
 
 #endif // SPRT_H
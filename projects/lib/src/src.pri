@@ -9,6 +9,7 @@ HEADERS += $$PWD/chessengine.h \
     $$PWD/pgnstream.h \
     $$PWD/pgngame.h \
     $$PWD/polyglotbook.h \
+    $$PWD/positionindex.h \
     $$PWD/timecontrol.h \
     $$PWD/uciengine.h \
     $$PWD/xboardengine.h \
@@ -42,12 +43,17 @@ HEADERS += $$PWD/chessengine.h \
     $$PWD/sprt.h \
     $$PWD/gameadjudicator.h \
     $$PWD/elo.h \
+    $$PWD/eloratings.h \
     $$PWD/knockouttournament.h \
     $$PWD/pyramidtournament.h \
     $$PWD/tournamentplayer.h \
     $$PWD/tournamentpair.h \
     $$PWD/worker.h \
-    $$PWD/graph_blossom.h
+    $$PWD/workerpool.h \
+    $$PWD/engineworker.h \
+    $$PWD/graph_blossom.h \
+    $$PWD/wheeltimer.h \
+    $$PWD/movelatency.h
 SOURCES += $$PWD/chessengine.cpp \
     $$PWD/chessgame.cpp \
     $$PWD/chessplayer.cpp \
@@ -56,6 +62,7 @@ SOURCES += $$PWD/chessengine.cpp \
     $$PWD/pgnstream.cpp \
     $$PWD/pgngame.cpp \
     $$PWD/polyglotbook.cpp \
+    $$PWD/positionindex.cpp \
     $$PWD/timecontrol.cpp \
     $$PWD/uciengine.cpp \
     $$PWD/xboardengine.cpp \
@@ -84,15 +91,21 @@ SOURCES += $$PWD/chessengine.cpp \
     $$PWD/epdrecord.cpp \
     $$PWD/openingsuite.cpp \
     $$PWD/econode.cpp \
+    $$PWD/ecodata.cpp \
     $$PWD/mersenne.cpp \
     $$PWD/sprt.cpp \
     $$PWD/gameadjudicator.cpp \
     $$PWD/elo.cpp \
+    $$PWD/eloratings.cpp \
     $$PWD/knockouttournament.cpp \
     $$PWD/pyramidtournament.cpp \
     $$PWD/tournamentplayer.cpp \
     $$PWD/tournamentpair.cpp \
-    $$PWD/worker.cpp
+    $$PWD/worker.cpp \
+    $$PWD/workerpool.cpp \
+    $$PWD/engineworker.cpp \
+    $$PWD/wheeltimer.cpp \
+    $$PWD/movelatency.cpp
 win32 { 
     HEADERS += $$PWD/engineprocess_win.h \
 	$$PWD/pipereader_win.h
@@ -91,8 +91,12 @@ QList< QPair<QString, QString> > SwissTournament::getPairings()
     return pList;
 }
 
-void SwissTournament::addResumeGameResult(int gameNumber, const QString &result)
+void SwissTournament::addResumeGameResult(int gameNumber,
+					  const QString& white,
+					  const QString& black,
+					  const QString& result)
 {
+    Tournament::addResumeGameResult(gameNumber, white, black, result);
     qWarning() << "Adding resumed game result: " << gameNumber << result;
     while (m_preRecordedResults.size() <= gameNumber)
         m_preRecordedResults.append(QString());
@@ -42,7 +42,10 @@ class LIB_EXPORT SwissTournament : public Tournament
 		virtual QString type() const;
 		virtual QList< QPair<QString, QString> > getPairings();
 
-		virtual void addResumeGameResult(int gameNumber, const QString &result) override;
+		virtual void addResumeGameResult(int gameNumber,
+						 const QString& white,
+						 const QString& black,
+						 const QString& result) override;
 
 	protected:
 		// Inherited from Tournament
@@ -22,6 +22,22 @@
 
 namespace {
 
+const qint64 s_nsPerMs = 1000000;
+
+qint64 msToNs(int ms)
+{
+	return qint64(ms) * s_nsPerMs;
+}
+
+int nsToMs(qint64 ns)
+{
+	// Round towards negative infinity, so that a clock that has
+	// run out doesn't show any time left
+	if (ns < 0)
+		return int((ns - s_nsPerMs + 1) / s_nsPerMs);
+	return int(ns / s_nsPerMs);
+}
+
 QString s_timeString(int ms)
 {
 	if (ms == 0 || ms % 60000 != 0)
@@ -202,11 +218,11 @@ void TimeControl::initialize()
 
 	if (m_timePerTc != 0)
 	{
-		m_timeLeft = m_timePerTc;
+		m_timeLeft = msToNs(m_timePerTc);
 		m_movesLeft = m_movesPerTc;
 	}
 	else if (m_timePerMove != 0)
-		m_timeLeft = m_timePerMove;
+		m_timeLeft = msToNs(m_timePerMove);
 }
 
 bool TimeControl::isInfinite() const
@@ -235,6 +251,11 @@ int TimeControl::timePerMove() const
 }
 
 int TimeControl::timeLeft() const
+{
+	return nsToMs(m_timeLeft);
+}
+
+qint64 TimeControl::timeLeftNs() const
 {
 	return m_timeLeft;
 }
@@ -289,6 +310,11 @@ void TimeControl::setTimePerMove(int timePerMove)
 }
 
 void TimeControl::setTimeLeft(int timeLeft)
+{
+	m_timeLeft = msToNs(timeLeft);
+}
+
+void TimeControl::setTimeLeftNs(qint64 timeLeft)
 {
 	m_timeLeft = timeLeft;
 }
@@ -322,30 +348,27 @@ void TimeControl::startTimer()
 	m_time.start();
 }
 
-void TimeControl::update(bool applyIncrement, int64_t overrideElapsedMs)
+void TimeControl::update(bool applyIncrement, qint64 overrideElapsedNs)
 {
-	/*
-	 * This will overflow after roughly 49 days however it's unlikely
-	 * we'll ever hit that limit.
-	 */
-	if (overrideElapsedMs >= 0)
-		m_lastMoveTime = overrideElapsedMs;
+	if (overrideElapsedNs >= 0)
+		m_lastMoveTime = overrideElapsedNs;
 	else if (m_time.isValid())
-		m_lastMoveTime = (int)m_time.elapsed();
+		m_lastMoveTime = m_time.nsecsElapsed();
 	else
 		m_lastMoveTime = 0;
 
-	if (!m_infinite && m_lastMoveTime > m_timeLeft + m_expiryMargin)
+	if (!m_infinite
+	&&  m_lastMoveTime > m_timeLeft + msToNs(m_expiryMargin))
 		m_expired = true;
 
 	if (m_timePerMove != 0)
 		setTimeLeft(m_timePerMove);
 	else
 	{
-	        int newTimeLeft = m_timeLeft - m_lastMoveTime;
+		qint64 newTimeLeft = m_timeLeft - m_lastMoveTime;
 		if (applyIncrement)
-			newTimeLeft += m_increment;
-		setTimeLeft(newTimeLeft);
+			newTimeLeft += msToNs(m_increment);
+		setTimeLeftNs(newTimeLeft);
 		
 		if (m_movesPerTc > 0)
 		{
@@ -355,13 +378,18 @@ void TimeControl::update(bool applyIncrement, int64_t overrideElapsedMs)
 			if (m_movesLeft == 0)
 			{
 				setMovesLeft(m_movesPerTc);
-				setTimeLeft(m_timePerTc + m_timeLeft);
+				setTimeLeftNs(msToNs(m_timePerTc) + m_timeLeft);
 			}
 		}
 	}
 }
 
 int TimeControl::lastMoveTime() const
+{
+	return nsToMs(m_lastMoveTime);
+}
+
+qint64 TimeControl::lastMoveTimeNs() const
 {
 	return m_lastMoveTime;
 }
@@ -372,9 +400,14 @@ bool TimeControl::expired() const
 }
 
 int TimeControl::activeTimeLeft() const
+{
+	return nsToMs(activeTimeLeftNs());
+}
+
+qint64 TimeControl::activeTimeLeftNs() const
 {
 	if (m_time.isValid())
-		return m_timeLeft - m_time.elapsed();
+		return m_timeLeft - m_time.nsecsElapsed();
 	return m_timeLeft;
 }
 
@@ -30,7 +30,9 @@ class QSettings;
  * TimeControl is used for telling the chess players how much time
  * they can spend thinking of their moves.
  *
- * \note All time handling is done in milliseconds.
+ * \note The settings of the time control are in milliseconds. The
+ * clock itself runs in nanoseconds, so rounding errors don't build up
+ * over a long game; the millisecond functions are rounded down.
  */
 class LIB_EXPORT TimeControl
 {
@@ -114,6 +116,8 @@ class LIB_EXPORT TimeControl
 
 		/*! Returns the time left in the time control. */
 		int timeLeft() const;
+		/*! Returns the time left in the time control in nanoseconds. */
+		qint64 timeLeftNs() const;
 
 		/*!
 		 * Returns the number of full moves left in the time control,
@@ -157,6 +161,8 @@ class LIB_EXPORT TimeControl
 		
 		/*! Sets the time left in the time control. */
 		void setTimeLeft(int timeLeft);
+		/*! Sets the time left in the time control in nanoseconds. */
+		void setTimeLeftNs(qint64 timeLeft);
 		
 		/*! Sets the number of full moves left in the time control. */
 		void setMovesLeft(int movesLeft);
@@ -180,11 +186,16 @@ class LIB_EXPORT TimeControl
 		 * \a applyIncrement is true. This is the default.
 		 * Set this value to false if no increment is necessary for
 		 * the current move, e.g. for a book move.
+		 *
+		 * If \a overrideElapsedNs is not negative, it's used as the
+		 * elapsed time in nanoseconds instead of the timer.
 		 */
-		void update(bool applyIncrement = true, int64_t overrideElapsedMs = -1);
+		void update(bool applyIncrement = true, qint64 overrideElapsedNs = -1);
 
 		/*! Returns the last elapsed move time. */
 		int lastMoveTime() const;
+		/*! Returns the last elapsed move time in nanoseconds. */
+		qint64 lastMoveTimeNs() const;
 
 		/*! Returns true if the allotted time has expired. */
 		bool expired() const;
@@ -197,6 +208,8 @@ class LIB_EXPORT TimeControl
 		 * state first to verify that it's in the thinking state.
 		 */
 		int activeTimeLeft() const;
+		/*! Returns the time left in an active clock in nanoseconds. */
+		qint64 activeTimeLeftNs() const;
 
 		/*! Reads time control settings from \a settings. */
 		void readSettings(QSettings* settings);
@@ -209,11 +222,11 @@ class LIB_EXPORT TimeControl
 		int m_timePerTc;
 		int m_timePerMove;
 		int m_increment;
-		int m_timeLeft;
+		qint64 m_timeLeft;
 		int m_movesLeft;
 		int m_plyLimit;
 		int m_nodeLimit;
-		int m_lastMoveTime;
+		qint64 m_lastMoveTime;
 		int m_expiryMargin;
 		bool m_expired;
 		bool m_infinite;
@@ -20,19 +20,63 @@
 #include <QFile>
 #include <QMultiMap>
 #include <QSet>
+#include <limits>
 #include "gamemanager.h"
 #include "playerbuilder.h"
 #include "enginebuilder.h"
 #include "board/boardfactory.h"
 #include "chessplayer.h"
+#include "chessengine.h"
 #include "chessgame.h"
+#include "workerpool.h"
 #include "pgnstream.h"
 #include "openingsuite.h"
 #include "openingbook.h"
 #include "sprt.h"
 #include "elo.h"
+#include "eloratings.h"
+#include "mersenne.h"
 #include <QFileInfo>
 
+namespace {
+
+// Moves are saved as "source,target,promotion" triplets
+QString movesToString(const QVector<Chess::Move>& moves)
+{
+	QStringList list;
+	for (const Chess::Move& move : moves)
+		list << QString("%1,%2,%3").arg(move.sourceSquare())
+					   .arg(move.targetSquare())
+					   .arg(move.promotion());
+	return list.join(' ');
+}
+
+bool movesFromString(const QString& str, QVector<Chess::Move>* moves)
+{
+	moves->clear();
+	const QStringList list = str.split(' ', QString::SkipEmptyParts);
+	for (const QString& item : list)
+	{
+		const QStringList values = item.split(',');
+		if (values.size() != 3)
+			return false;
+
+		int squares[3];
+		for (int i = 0; i < 3; i++)
+		{
+			bool ok = false;
+			squares[i] = values.at(i).toInt(&ok);
+			if (!ok || squares[i] < 0 || squares[i] > 0x3FF)
+				return false;
+		}
+		moves->append(Chess::Move(squares[0], squares[1], squares[2]));
+	}
+
+	return true;
+}
+
+} // anonymous namespace
+
 Tournament::Tournament(GameManager* gameManager, EngineManager* engineManager,
 					   QObject *parent)
 	: QObject(parent),
@@ -45,6 +89,7 @@ Tournament::Tournament(GameManager* gameManager, EngineManager* engineManager,
 	  m_finishedGameCount(0),
 	  m_savedGameCount(0),
 	  m_finalGameCount(0),
+	  m_cancelledGameCount(0),
 	  m_gamesPerEncounter(1),
 	  m_roundMultiplier(1),
 	  m_startDelay(0),
@@ -59,7 +104,10 @@ Tournament::Tournament(GameManager* gameManager, EngineManager* engineManager,
 	  m_bookOwnership(false),
 	  m_openingSuite(nullptr),
 	  m_sprt(new Sprt),
+	  m_pairSprt(false),
+	  m_ratings(new EloRatings),
 	  m_repetitionCounter(0),
+	  m_openingNumber(0),
 	  m_swapSides(true),
 	  m_pgnOutMode(PgnGame::Verbose),
 	  m_pair(nullptr),
@@ -67,6 +115,8 @@ Tournament::Tournament(GameManager* gameManager, EngineManager* engineManager,
 	  m_pgnFormat(true),
 	  m_jsonFormat(true),
 	  m_resumeGameNumber(0),
+	  m_resumeCheckpoints(false),
+	  m_checkpointGame(0),
 	  m_bergerSchedule(false),
 	  m_reloadEngines(false),
 	  m_strikes(0)
@@ -98,6 +148,8 @@ Tournament::~Tournament()
 
 	delete m_openingSuite;
 	delete m_sprt;
+	qDeleteAll(m_pairSprts);
+	delete m_ratings;
 
 	if (m_pgnFile.isOpen())
 		m_pgnFile.close();
@@ -186,6 +238,28 @@ Sprt* Tournament::sprt() const
 	return m_sprt;
 }
 
+bool Tournament::usesPairSprt() const
+{
+	return m_pairSprt;
+}
+
+const Sprt* Tournament::pairSprt(int player1, int player2) const
+{
+	for (auto it = m_pairSprts.constBegin(); it != m_pairSprts.constEnd(); ++it)
+	{
+		const TournamentPair* p = it.key();
+		if ((p->firstPlayer() == player1 && p->secondPlayer() == player2)
+		||  (p->firstPlayer() == player2 && p->secondPlayer() == player1))
+			return it.value();
+	}
+	return nullptr;
+}
+
+EloRatings* Tournament::ratings() const
+{
+	return m_ratings;
+}
+
 bool Tournament::swapSides() const
 {
 	return m_swapSides;
@@ -240,7 +314,7 @@ void Tournament::setCurrentRound(int round)
 
 int Tournament::gamesInProgress() const
 {
-	return m_nextGameNumber - m_finishedGameCount;
+	return m_nextGameNumber - m_finishedGameCount - m_cancelledGameCount;
 }
 
 void Tournament::setGamesPerEncounter(int count)
@@ -354,6 +428,11 @@ void Tournament::setBergerSchedule(bool enabled)
 	m_bergerSchedule = enabled;
 }
 
+void Tournament::setPairSprt(bool enabled)
+{
+	m_pairSprt = enabled;
+}
+
 void Tournament::setReloadEngines(bool enabled)
 {
 	m_reloadEngines = enabled;
@@ -365,8 +444,319 @@ void Tournament::setResume(int nextGameNumber)
 	m_resumeGameNumber = nextGameNumber;
 }
 
-void Tournament::addResumeGameResult(int gameNumber, const QString &result)
+void Tournament::addResumeGameResult(int gameNumber,
+				     const QString& white,
+				     const QString& black,
+				     const QString& result)
+{
+	m_resumeGames[gameNumber] = ResumeGame{ white, black, result };
+}
+
+void Tournament::applyResumeGames(int lastGame)
+{
+	QMap<QString, int> players;
+	for (int i = 0; i < m_players.size(); i++)
+		players[m_players.at(i).name()] = i;
+
+	// The results of the finished games go to the ratings, like
+	// the scores that the players get from the tournament file,
+	// and to the SPRT so that decided pairs stay decided
+	while (!m_resumeGames.isEmpty() && m_resumeGames.firstKey() < lastGame)
+	{
+		const int number = m_resumeGames.firstKey() + 1;
+		const ResumeGame game = m_resumeGames.take(number - 1);
+		const int white = players.value(game.white, -1);
+		const int black = players.value(game.black, -1);
+		const Chess::Result result(game.result);
+		if (white < 0 || black < 0 || result.isNone())
+			continue;
+
+		if (!m_sprt->isNull())
+		{
+			TournamentPair* gamePair = pair(white, black);
+			GameData data;
+			data.number = number;
+			data.whiteIndex = white;
+			data.blackIndex = black;
+			data.pairGame = m_resumePairGames[gamePair]++;
+			data.opening = 0;
+			updateSprt(&data, result);
+		}
+
+		if (result.isDraw())
+			m_ratings->addGameResult(white, black, 1);
+		else if (result.winner() == Chess::Side::White)
+			m_ratings->addGameResult(white, black, 2);
+		else if (result.winner() == Chess::Side::Black)
+			m_ratings->addGameResult(white, black, 0);
+	}
+}
+
+void Tournament::addResumeMoveLatency(const QString& playerName,
+				      const MoveLatency& latency)
+{
+	m_resumeMoveLatency[playerName].merge(latency);
+}
+
+void Tournament::setResumeCheckpoints(bool enabled)
+{
+	m_resumeCheckpoints = enabled;
+}
+
+QVariantMap Tournament::resumeCheckpoint() const
+{
+	if (!m_resumeCheckpoints)
+		return QVariantMap();
+
+	// The state before the first unfinished game
+	QVariantMap checkpoint;
+	if (m_checkpointGame < m_nextGameNumber)
+		checkpoint = m_checkpoints.value(m_checkpointGame + 1);
+	else
+		checkpoint = schedulerState();
+	if (checkpoint.isEmpty())
+		return checkpoint;
+
+	// The pair scores include only the games before the checkpoint
+	QStringList pairs;
+	const QStringList savedPairs = checkpoint.value("pairs").toStringList();
+	for (const QString& savedPair : savedPairs)
+	{
+		const QStringList values = savedPair.split(' ');
+		const int first = values.at(0).toInt();
+		const int second = values.at(1).toInt();
+		pairs << QString("%1 %2 %3").arg(savedPair)
+			.arg(m_checkpointScores.value(qMakePair(first, second)))
+			.arg(m_checkpointScores.value(qMakePair(second, first)));
+	}
+	checkpoint["pairs"] = pairs;
+
+	return checkpoint;
+}
+
+void Tournament::setResumeCheckpoint(const QVariantMap& checkpoint)
+{
+	m_resumeCheckpoint = checkpoint;
+}
+
+QVariantMap Tournament::pairingState() const
+{
+	return QVariantMap();
+}
+
+bool Tournament::restorePairingState(const QVariantMap& state)
+{
+	Q_UNUSED(state);
+	return false;
+}
+
+QVariantMap Tournament::schedulerState() const
+{
+	QVariantMap state;
+	const QVariantMap pairing(pairingState());
+	if (pairing.isEmpty())
+		return state;
+
+	state["gameNumber"] = m_nextGameNumber;
+	state["round"] = m_round;
+	state["finalGameCount"] = m_finalGameCount;
+	state["pairing"] = pairing;
+
+	// Each pair is saved as "player1 player2 gamesStarted originalOrder"
+	QStringList pairs;
+	for (auto it = m_pairs.constBegin(); it != m_pairs.constEnd(); ++it)
+	{
+		const TournamentPair* pair = it.value();
+		pairs << QString("%1 %2 %3 %4")
+			 .arg(it.key().first)
+			 .arg(it.key().second)
+			 .arg(pair->gamesStarted())
+			 .arg(int(pair->hasOriginalOrder()));
+	}
+	state["pairs"] = pairs;
+	if (m_pair != nullptr)
+		state["currentPair"] = QString("%1 %2")
+				       .arg(m_pair->firstPlayer())
+				       .arg(m_pair->secondPlayer());
+
+	state["repetitionCounter"] = m_repetitionCounter;
+	state["startFen"] = m_startFen;
+	state["openingMoves"] = movesToString(m_openingMoves);
+
+	QVariantList cycleOpenings;
+	for (const auto& opening : m_cycleOpenings)
+		cycleOpenings << QVariant(QStringList() << opening.second
+					     << movesToString(opening.first));
+	if (!cycleOpenings.isEmpty())
+		state["cycleOpenings"] = cycleOpenings;
+
+	QVariantList returnedOpenings;
+	for (const auto& opening : m_returnedOpenings)
+		returnedOpenings << QVariant(QStringList() << opening.second
+					     << movesToString(opening.first));
+	if (!returnedOpenings.isEmpty())
+		state["returnedOpenings"] = returnedOpenings;
+
+	if (m_openingSuite != nullptr)
+		state["openingSuite"] = m_openingSuite->state();
+	state["random"] = QString::fromLatin1(Mersenne::state().toBase64());
+
+	return state;
+}
+
+bool Tournament::restoreSchedulerState(const QVariantMap& state)
 {
+	const int gameNumber = state.value("gameNumber", -1).toInt();
+	if (gameNumber < 0 || gameNumber > m_resumeGameNumber)
+		return false;
+
+	struct SavedPair
+	{
+		int player1;
+		int player2;
+		int gamesStarted;
+		bool originalOrder;
+		int score1;
+		int score2;
+	};
+	QList<SavedPair> pairs;
+	const QStringList pairList = state.value("pairs").toStringList();
+	for (const QString& str : pairList)
+	{
+		const QStringList values = str.split(' ');
+		if (values.size() != 6)
+			return false;
+
+		SavedPair pair;
+		pair.player1 = values.at(0).toInt();
+		pair.player2 = values.at(1).toInt();
+		pair.gamesStarted = values.at(2).toInt();
+		pair.originalOrder = values.at(3).toInt() != 0;
+		pair.score1 = values.at(4).toInt();
+		pair.score2 = values.at(5).toInt();
+		pairs << pair;
+	}
+
+	QVector<Chess::Move> openingMoves;
+	if (!movesFromString(state.value("openingMoves").toString(),
+			     &openingMoves))
+		return false;
+
+	QVector<QPair<QVector<Chess::Move>, QString> > cycleOpenings;
+	const QVariantList cycleList = state.value("cycleOpenings").toList();
+	for (const QVariant& value : cycleList)
+	{
+		const QStringList opening = value.toStringList();
+		QVector<Chess::Move> moves;
+		if (opening.size() != 2
+		||  !movesFromString(opening.at(1), &moves))
+			return false;
+		cycleOpenings << qMakePair(moves, opening.at(0));
+	}
+	if (cycleOpenings.size() != m_cycleOpenings.size())
+		return false;
+
+	QList<QPair<QVector<Chess::Move>, QString> > returnedOpenings;
+	const QVariantList returnedList = state.value("returnedOpenings").toList();
+	for (const QVariant& value : returnedList)
+	{
+		const QStringList opening = value.toStringList();
+		QVector<Chess::Move> moves;
+		if (opening.size() != 2
+		||  !movesFromString(opening.at(1), &moves))
+			return false;
+		returnedOpenings << qMakePair(moves, opening.at(0));
+	}
+
+	const QByteArray random = QByteArray::fromBase64(
+		state.value("random").toString().toLatin1());
+	const QVariantMap suiteState = m_openingSuite != nullptr
+		? m_openingSuite->state() : QVariantMap();
+
+	if (!restorePairingState(state.value("pairing").toMap()))
+		return false;
+	if (m_openingSuite != nullptr
+	&&  !m_openingSuite->restoreState(state.value("openingSuite").toMap()))
+	{
+		initializePairing();
+		return false;
+	}
+	if (!Mersenne::setState(random))
+	{
+		initializePairing();
+		if (m_openingSuite != nullptr)
+			m_openingSuite->restoreState(suiteState);
+		return false;
+	}
+
+	// The games before the checkpoint count as finished and saved
+	m_nextGameNumber = gameNumber;
+	m_finishedGameCount = gameNumber;
+	m_savedGameCount = gameNumber;
+	m_round = state.value("round").toInt();
+	m_finalGameCount = qMax(m_finalGameCount,
+				state.value("finalGameCount").toInt());
+
+	for (const SavedPair& saved : qAsConst(pairs))
+	{
+		TournamentPair* pair = this->pair(saved.player1, saved.player2);
+		if (!saved.originalOrder)
+			pair->swapPlayers();
+		for (int i = 0; i < saved.gamesStarted; i++)
+			pair->addStartedGame();
+
+		if (pair->firstPlayer() == saved.player1)
+		{
+			pair->addFirstScore(saved.score1);
+			pair->addSecondScore(saved.score2);
+		}
+		else
+		{
+			pair->addFirstScore(saved.score2);
+			pair->addSecondScore(saved.score1);
+		}
+		m_checkpointScores[qMakePair(saved.player1, saved.player2)] = saved.score1;
+		m_checkpointScores[qMakePair(saved.player2, saved.player1)] = saved.score2;
+	}
+
+	m_pair = nullptr;
+	const QStringList currentPair =
+		state.value("currentPair").toString().split(' ');
+	if (currentPair.size() == 2)
+		m_pair = pair(currentPair.at(0).toInt(), currentPair.at(1).toInt());
+
+	m_repetitionCounter = state.value("repetitionCounter").toInt();
+	m_startFen = state.value("startFen").toString();
+	m_openingMoves = openingMoves;
+	m_cycleOpenings = cycleOpenings;
+	m_returnedOpenings = returnedOpenings;
+	m_openingGames.clear();
+
+	return true;
+}
+
+void Tournament::addCheckpointResult(int gameNumber,
+				     const CheckpointResult& result)
+{
+	if (!m_resumeCheckpoints)
+		return;
+
+	// The checkpoint moves forward over the finished games in
+	// game order, like the PGN output
+	m_checkpointResults[gameNumber] = result;
+	while (m_checkpointResults.contains(m_checkpointGame + 1))
+	{
+		const CheckpointResult finished =
+			m_checkpointResults.take(++m_checkpointGame);
+		m_checkpoints.remove(m_checkpointGame);
+		if (finished.whiteIndex < 0)
+			continue;
+
+		const int white = finished.whiteIndex;
+		const int black = finished.blackIndex;
+		m_checkpointScores[qMakePair(white, black)] += finished.whiteScore;
+		m_checkpointScores[qMakePair(black, white)] += finished.blackScore;
+	}
 }
 
 void Tournament::addPlayer(PlayerBuilder* builder,
@@ -478,6 +868,18 @@ bool Tournament::shouldWeStop(int white, int black, const TournamentPair* pair)
 	return false;
 }
 
+int Tournament::gamesPerPair() const
+{
+	return gamesPerEncounter() * roundMultiplier();
+}
+
+bool Tournament::isPairFinished(const TournamentPair* pair) const
+{
+	if (pair->gamesStarted() >= gamesPerPair())
+		return true;
+	return m_pairSprt && m_decidedPairs.contains(pair);
+}
+
 bool Tournament::areAllGamesFinished() const
 {
 	return m_finishedGameCount >= m_finalGameCount;
@@ -531,6 +933,9 @@ void Tournament::startGame(TournamentPair* pair)
 	game->setOpeningBook(white.book(), Chess::Side::White, white.bookDepth());
 	game->setOpeningBook(black.book(), Chess::Side::Black, black.bookDepth());
 
+	// Games that repeat an opening are started first so that
+	// opening pairs are played close together.
+	int priority = 0;
 	if (usesBerger)
 	{
 		QPair<QVector<Chess::Move>, QString>& cycleGame =
@@ -541,6 +946,7 @@ void Tournament::startGame(TournamentPair* pair)
 			game->setMoves(cycleGame.first);
 
 			game->generateOpening();
+			priority = 1;
 		}
 		else
 		{
@@ -570,16 +976,12 @@ void Tournament::startGame(TournamentPair* pair)
 			m_startFen.clear();
 			m_openingMoves.clear();
 			m_repetitionCounter++;
+			priority = 1;
 		}
 		else
 		{
 			m_repetitionCounter = 1;
-			if (m_openingSuite != nullptr)
-			{
-				if (!game->setMoves(m_openingSuite->nextGame(m_openingDepth)))
-					qWarning("The opening suite is incompatible with the "
-					"current chess variant");
-			}
+			startOpening(game);
 		}
 
 		game->generateOpening();
@@ -609,7 +1011,13 @@ void Tournament::startGame(TournamentPair* pair)
 	data->number = ++m_nextGameNumber;
 	data->whiteIndex = m_pair->firstPlayer();
 	data->blackIndex = m_pair->secondPlayer();
+	data->pairGame = m_pair->gamesStarted() - 1;
+	data->opening = usesBerger ? 0 : m_openingNumber;
+	data->startingFen = game->startingFen();
+	data->openingMoves = game->moves();
 	m_gameData[game] = data;
+	if (data->opening != 0)
+		m_openingGames[data->opening]++;
 
 	// Some tournament types may require more games than expected
 	if (m_nextGameNumber > m_finalGameCount)
@@ -629,7 +1037,8 @@ void Tournament::startGame(TournamentPair* pair)
 			       whiteBuilder,
 			       blackBuilder,
 			       GameManager::Enqueue,
-			       GameManager::ReusePlayers);
+			       GameManager::ReusePlayers,
+			       priority);
 }
 
 void Tournament::skipGame(TournamentPair* pair)
@@ -704,12 +1113,7 @@ void Tournament::skipGame(TournamentPair* pair)
 		else
 		{
 			m_repetitionCounter = 1;
-			if (m_openingSuite != nullptr)
-			{
-				if (!game->setMoves(m_openingSuite->nextGame(m_openingDepth)))
-					qWarning("The opening suite is incompatible with the "
-					"current chess variant");
-			}
+			startOpening(game);
 		}
 
 		game->generateOpening();
@@ -738,6 +1142,141 @@ void Tournament::skipGame(TournamentPair* pair)
 	delete game;
 }
 
+bool Tournament::isLostGame(const ChessGame* game) const
+{
+	if (game->result().type() != Chess::Result::Disconnection)
+		return false;
+
+	for (int i = 0; i < 2; i++)
+	{
+		auto engine = qobject_cast<const ChessEngine*>(
+			game->player(Chess::Side::Type(i)));
+		if (engine != nullptr && WorkerPool::isLostDevice(engine->device()))
+			return true;
+	}
+
+	return false;
+}
+
+void Tournament::replayGame(const ChessGame* oldGame, GameData* data)
+{
+	const TournamentPlayer& white = m_players[data->whiteIndex];
+	const TournamentPlayer& black = m_players[data->blackIndex];
+
+	Chess::Board* board = Chess::BoardFactory::create(m_variant);
+	Q_ASSERT(board != nullptr);
+	ChessGame* game = new ChessGame(board, new PgnGame());
+
+	connect(game, SIGNAL(started(ChessGame*)),
+		this, SLOT(onGameStarted(ChessGame*)));
+	connect(game, SIGNAL(finished(ChessGame*)),
+		this, SLOT(onGameFinished(ChessGame*)));
+
+	setTC(white, black, game, pair(data->whiteIndex, data->blackIndex));
+
+	game->setLiveOutput(m_livePgnOut, m_livePgnOutMode, m_pgnFormat, m_jsonFormat);
+	game->setOpeningBook(white.book(), Chess::Side::White, white.bookDepth());
+	game->setOpeningBook(black.book(), Chess::Side::Black, black.bookDepth());
+	game->setStartingFen(data->startingFen);
+	game->setMoves(data->openingMoves);
+
+	const PgnGame* oldPgn = oldGame->pgn();
+	game->pgn()->setEvent(oldPgn->event());
+	game->pgn()->setSite(oldPgn->site());
+	game->pgn()->setTag("Round", oldPgn->tagValue("Round"));
+
+	game->setStartDelay(m_startDelay);
+	game->setAdjudicator(m_adjudicator);
+	m_gameData[game] = data;
+
+	auto whiteBuilder = white.builder();
+	auto blackBuilder = black.builder();
+	onGameAboutToStart(game, whiteBuilder, blackBuilder);
+	connect(game, SIGNAL(startFailed(ChessGame*)),
+		this, SLOT(onGameStartFailed(ChessGame*)));
+	m_gameManager->newGame(game,
+			       whiteBuilder,
+			       blackBuilder,
+			       GameManager::Enqueue,
+			       GameManager::ReusePlayers,
+			       2);
+}
+
+void Tournament::startOpening(ChessGame* game)
+{
+	m_openingNumber++;
+
+	// The openings of played games can't be returned anymore
+	QSet<int> openings;
+	for (const GameData* data : qAsConst(m_gameData))
+		openings.insert(data->opening);
+	for (auto it = m_openingGames.begin(); it != m_openingGames.end(); )
+	{
+		if (openings.contains(it.key()))
+			++it;
+		else
+			it = m_openingGames.erase(it);
+	}
+
+	if (!m_returnedOpenings.isEmpty())
+	{
+		const auto opening = m_returnedOpenings.takeFirst();
+		game->setStartingFen(opening.second);
+		game->setMoves(opening.first);
+	}
+	else if (m_openingSuite != nullptr)
+	{
+		if (!game->setMoves(m_openingSuite->nextGame(m_openingDepth)))
+			qWarning("The opening suite is incompatible with the "
+			"current chess variant");
+	}
+}
+
+int Tournament::cancelQueuedGames(const TournamentPair* pair)
+{
+	int count = 0;
+	const auto games = m_gameData.keys();
+	for (ChessGame* game : games)
+	{
+		GameData* data = m_gameData.value(game);
+		if (pair != nullptr
+		&&  this->pair(data->whiteIndex, data->blackIndex) != pair)
+			continue;
+		if (!m_gameManager->removeQueuedGame(game))
+			continue;
+
+		m_cancelledGames.insert(data->number);
+		addCheckpointResult(data->number, { -1, -1, 0, 0 });
+
+		// An opening that none of the remaining games use goes back
+		// to be played by the next games, so the opening suite
+		// doesn't skip it and its repetitions stay together
+		if (data->opening != 0 && --m_openingGames[data->opening] == 0)
+		{
+			m_openingGames.remove(data->opening);
+			m_returnedOpenings.append(qMakePair(data->openingMoves,
+							    data->startingFen));
+			if (data->opening == m_openingNumber)
+			{
+				m_startFen.clear();
+				m_openingMoves.clear();
+			}
+		}
+		m_gameData.remove(game);
+		delete data;
+		delete game->pgn();
+		game->deleteLater();
+		count++;
+	}
+
+	if (count > 0)
+	{
+		m_cancelledGameCount += count;
+		flushPgnGames();
+	}
+	return count;
+}
+
 void Tournament::onGameAboutToStart(ChessGame *game,
 				    const PlayerBuilder* white,
 				    const PlayerBuilder* black)
@@ -768,6 +1307,10 @@ void Tournament::startNextGame()
 			stop();
 			return;
 		}
+		// The state that leads to the next game
+		if (m_resumeCheckpoints)
+			m_checkpoints[m_nextGameNumber + 1] = schedulerState();
+
 		TournamentPair* pair(nextPair(m_nextGameNumber));
 		needToStop = shouldWeStopTour();
 		qWarning () << "CAlling shouldWeStopTour" << needToStop;
@@ -804,6 +1347,7 @@ void Tournament::startNextGame()
 		}
 
 		skipGame(pair);
+		addCheckpointResult(m_nextGameNumber, { -1, -1, 0, 0 });
 		emit gameSkipped(m_nextGameNumber, iWhite, iBlack);
 		needToStop = true;
 	}
@@ -823,6 +1367,15 @@ bool Tournament::writePgn(PgnGame* pgn, int gameNumber)
 	Q_ASSERT(pgn != nullptr);
 	Q_ASSERT(gameNumber > 0);
 
+	if (m_pgnFile.fileName().isEmpty())
+		return true;
+
+	m_pgnGames[gameNumber] = *pgn;
+	return flushPgnGames();
+}
+
+bool Tournament::flushPgnGames()
+{
 	if (m_pgnFile.fileName().isEmpty())
 		return true;
 
@@ -846,9 +1399,17 @@ bool Tournament::writePgn(PgnGame* pgn, int gameNumber)
 	}
 
 	bool ok = true;
-	m_pgnGames[gameNumber] = *pgn;
-	while (m_pgnGames.contains(m_savedGameCount + 1))
+	for (;;)
 	{
+		// Cancelled games leave a gap in the game numbers
+		if (m_cancelledGames.remove(m_savedGameCount + 1))
+		{
+			m_savedGameCount++;
+			continue;
+		}
+		if (!m_pgnGames.contains(m_savedGameCount + 1))
+			break;
+
 		PgnGame tmp = m_pgnGames.take(++m_savedGameCount);
 		Chess::Result::Type type = tmp.result().type();
 		if (!m_pgnWriteUnfinishedGames
@@ -947,12 +1508,25 @@ void Tournament::onGameFinished(ChessGame* game)
 	PgnGame* pgn(game->pgn());
 	Chess::Result result(game->result());
 
+	// A game whose engines ran on a worker that went away is not
+	// the engines' fault, so it's played again from the beginning.
+	if (!m_stopping && isLostGame(game))
+	{
+		GameData* data = m_gameData.take(game);
+		qWarning("Game %d was interrupted by a lost worker, "
+			 "playing it again", data->number);
+		replayGame(game, data);
+
+		delete pgn;
+		game->deleteLater();
+		return;
+	}
+
 	m_finishedGameCount++;
 
 	Q_ASSERT(m_gameData.contains(game));
 	GameData* data = m_gameData.take(game);
 	int gameNumber = data->number;
-	Sprt::GameResult sprtResult = Sprt::NoResult;
 
 	int iWhite = data->whiteIndex;
 	int iBlack = data->blackIndex;
@@ -962,47 +1536,58 @@ void Tournament::onGameFinished(ChessGame* game)
 	const auto blackName = pgn->playerName(Chess::Side::Black);
 	if (!blackName.isEmpty())
 		m_players[iBlack].setName(blackName);
+	m_players[iWhite].addMoveLatency(game->moveLatency(Chess::Side::White));
+	m_players[iBlack].addMoveLatency(game->moveLatency(Chess::Side::Black));
 
+	CheckpointResult checkpointResult = { iWhite, iBlack, 0, 0 };
 	switch (result.winner())
 	{
 	case Chess::Side::White:
-		addScore(iWhite, 2);
+		checkpointResult.whiteScore = 2;
 		switch (result.type())
 		{
 		case Chess::Result::Disconnection:
 		case Chess::Result::StalledConnection:
-			addScore(iBlack, -1);
+			checkpointResult.blackScore = -1;
 			break;
 		default:
-			addScore(iBlack, 0);
 			break;
 		}
-		sprtResult = (iWhite == 0) ? Sprt::Win : Sprt::Loss;
+		addScore(iWhite, checkpointResult.whiteScore);
+		addScore(iBlack, checkpointResult.blackScore);
+		m_ratings->addGameResult(iWhite, iBlack, 2);
 		break;
 	case Chess::Side::Black:
-		addScore(iBlack, 2);
+		checkpointResult.blackScore = 2;
 		switch (result.type())
 		{
 		case Chess::Result::Disconnection:
 		case Chess::Result::StalledConnection:
-			addScore(iWhite, -1);
+			checkpointResult.whiteScore = -1;
 			break;
 		default:
-			addScore(iWhite, 0);
 			break;
 		}
-		sprtResult = (iBlack == 0) ? Sprt::Win : Sprt::Loss;
+		addScore(iBlack, checkpointResult.blackScore);
+		addScore(iWhite, checkpointResult.whiteScore);
+		m_ratings->addGameResult(iWhite, iBlack, 0);
 		break;
 	default:
 		if (result.isDraw())
 		{
+			checkpointResult.whiteScore = 1;
+			checkpointResult.blackScore = 1;
 			addScore(iWhite, 1);
 			addScore(iBlack, 1);
-			sprtResult = Sprt::Draw;
+			m_ratings->addGameResult(iWhite, iBlack, 1);
 		}
 		break;
 	}
 
+	// Games without a result are played again when resuming
+	if (!result.isNone())
+		addCheckpointResult(gameNumber, checkpointResult);
+
 	writeEpd(game);
 	writePgn(pgn, gameNumber);
 
@@ -1012,12 +1597,8 @@ void Tournament::onGameFinished(ChessGame* game)
 	if (!m_recover && crashed)
 		stop();
 
-	if (!m_sprt->isNull() && sprtResult != Sprt::NoResult)
-	{
-		m_sprt->addGameResult(sprtResult);
-		if (m_sprt->status().result != Sprt::Continue)
-			QMetaObject::invokeMethod(this, "stop", Qt::QueuedConnection);
-	}
+	if (!m_sprt->isNull())
+		updateSprt(data, result);
 
 	emit gameFinished(game, gameNumber, iWhite, iBlack);
 
@@ -1036,6 +1617,81 @@ void Tournament::onGameFinished(ChessGame* game)
 	game->deleteLater();
 }
 
+void Tournament::updateSprt(const GameData* data, const Chess::Result& result)
+{
+	TournamentPair* gamePair = pair(data->whiteIndex, data->blackIndex);
+
+	// A single test is from the first player's point of view. Per-pair
+	// tests are from the point of view of the player with the higher
+	// index, ie. the challenger in a gauntlet.
+	Sprt* test = m_sprt;
+	int player = 0;
+	if (m_pairSprt)
+	{
+		test = m_pairSprts.value(gamePair);
+		if (test == nullptr)
+		{
+			test = new Sprt(*m_sprt);
+			m_pairSprts[gamePair] = test;
+		}
+		player = qMax(data->whiteIndex, data->blackIndex);
+	}
+
+	Sprt::GameResult sprtResult = Sprt::NoResult;
+	if (result.isDraw())
+		sprtResult = Sprt::Draw;
+	else if (!result.winner().isNull())
+	{
+		const int winner = (result.winner() == Chess::Side::White)
+			? data->whiteIndex : data->blackIndex;
+		sprtResult = (winner == player) ? Sprt::Win : Sprt::Loss;
+	}
+
+	if (test->model() == Sprt::Pentanomial)
+	{
+		// Games 2n and 2n+1 of a pair share an opening with
+		// swapped colors
+		const QPair<TournamentPair*, int> key(gamePair, data->pairGame / 2);
+		if (!m_sprtPairResults.contains(key))
+		{
+			m_sprtPairResults[key] = sprtResult;
+			return;
+		}
+		test->addGamePairResult(m_sprtPairResults.take(key), sprtResult);
+	}
+	else if (sprtResult != Sprt::NoResult)
+		test->addGameResult(sprtResult);
+	else
+		return;
+
+	const Sprt::Result testResult = test->status().result;
+	if (testResult == Sprt::Continue)
+		return;
+
+	if (!m_pairSprt)
+	{
+		QMetaObject::invokeMethod(this, "stop", Qt::QueuedConnection);
+		return;
+	}
+	if (m_decidedPairs.contains(gamePair))
+		return;
+
+	// The pair drops out. Its unplayed games are removed from the
+	// schedule so that the free game slots go to the other pairs.
+	m_decidedPairs.insert(gamePair);
+	m_finalGameCount -= qMax(0, gamesPerPair() - gamePair->gamesStarted());
+	m_finalGameCount -= cancelQueuedGames(gamePair);
+	m_finalGameCount = qMax(m_finalGameCount,
+				m_nextGameNumber - m_cancelledGameCount);
+
+	const int challenger = qMax(data->whiteIndex, data->blackIndex);
+	const int opponent = qMin(data->whiteIndex, data->blackIndex);
+	qInfo("SPRT of %s vs %s finished: %s was accepted",
+	      qUtf8Printable(m_players.at(challenger).name()),
+	      qUtf8Printable(m_players.at(opponent).name()),
+	      testResult == Sprt::AcceptH1 ? "H1" : "H0");
+}
+
 void Tournament::onGameDestroyed(ChessGame* game)
 {
 	if (game != m_lastGame)
@@ -1076,24 +1732,65 @@ void Tournament::start()
 
 	m_gameData.clear();
 	m_pgnGames.clear();
+	m_cancelledGames.clear();
+	m_cancelledGameCount = 0;
+	m_sprtPairResults.clear();
+	qDeleteAll(m_pairSprts);
+	m_pairSprts.clear();
+	m_decidedPairs.clear();
+	m_checkpointGame = 0;
+	m_checkpoints.clear();
+	m_checkpointResults.clear();
+	m_checkpointScores.clear();
+	m_ratings->setPlayerCount(m_players.size());
+	for (TournamentPlayer& player : m_players)
+	{
+		if (m_resumeMoveLatency.contains(player.name()))
+			player.addMoveLatency(m_resumeMoveLatency.value(player.name()));
+	}
+	m_resumeMoveLatency.clear();
 	m_startFen.clear();
 	m_openingMoves.clear();
+	m_openingNumber = 0;
+	m_openingGames.clear();
+	m_returnedOpenings.clear();
 	const bool usesBerger = usesBergerSchedule();
 	if (usesBerger)
 		m_cycleOpenings.resize(gamesPerCycle());
 	else
 		m_cycleOpenings.clear();
 
+	if (!m_sprt->isNull() && m_sprt->model() == Sprt::Pentanomial
+	&&  (m_openingRepetitions != 2 || !m_swapSides))
+		qWarning("Pentanomial SPRT expects each opening to be played "
+			 "twice with swapped sides");
+
 	connect(m_gameManager, SIGNAL(ready()),
 		this, SLOT(startNextGame()));
 
 	initializePairing();
 	m_finalGameCount = gamesPerCycle() * gamesPerEncounter() * roundMultiplier();
 
+	// Read the openings ahead so that starting a game doesn't wait
+	// for the opening file
+	if (m_openingSuite != nullptr)
+		m_openingSuite->startPrefetch(m_openingDepth,
+					      qMax(8, m_gameManager->concurrency() * 2));
+
 	if (m_resumeGameNumber)
 	{
-		for(int nextGame = m_resumeGameNumber; nextGame; --nextGame)
+		// Jump to the checkpoint and skip only the games after it
+		if (!m_resumeCheckpoint.isEmpty()
+		&&  !restoreSchedulerState(m_resumeCheckpoint))
+			qWarning("The resume checkpoint doesn't match the "
+				 "tournament, skipping the finished games");
+
+		// The games are skipped as if each result was known before
+		// the next game was started
+		for (int nextGame = m_resumeGameNumber - m_nextGameNumber;
+		     nextGame > 0; --nextGame)
 		{
+			applyResumeGames(m_nextGameNumber);
 			TournamentPair* pair(nextPair(m_nextGameNumber));
 			if (!pair || !pair->isValid())
 			{
@@ -1107,7 +1804,11 @@ void Tournament::start()
 			}
 			skipGame(pair);
 		}
+		m_checkpointGame = m_nextGameNumber;
 	}
+	applyResumeGames(std::numeric_limits<int>::max());
+	m_resumeGames.clear();
+	m_resumePairGames.clear();
 	qWarning() << "START(): Starting next game";
 	startNextGame();
 	qWarning() << "START(): Hanging here";
@@ -1121,6 +1822,7 @@ void Tournament::stop()
 	disconnect(m_gameManager, SIGNAL(ready()),
 		   this, SLOT(startNextGame()));
 
+	cancelQueuedGames(nullptr);
 	if (m_gameData.isEmpty())
 	{
 		onFinished();
@@ -1133,11 +1835,43 @@ void Tournament::stop()
 		QMetaObject::invokeMethod(game, "stop", Qt::QueuedConnection);
 }
 
+QString Tournament::sprtString(const Sprt* test)
+{
+	Sprt::Status sprtStatus = test->status();
+	if (sprtStatus.llr == 0.0
+	&&  sprtStatus.lBound == 0.0
+	&&  sprtStatus.uBound == 0.0)
+		return QString();
+
+	QString sprtStr = QString("llr %1, lbound %2, ubound %3")
+		.arg(sprtStatus.llr, 0, 'g', 3)
+		.arg(sprtStatus.lBound, 0, 'g', 3)
+		.arg(sprtStatus.uBound, 0, 'g', 3);
+	if (test->model() == Sprt::Pentanomial)
+		sprtStr.append(QString(", ptnml %1 %2 %3 %4 %5")
+			.arg(test->pairCount(0))
+			.arg(test->pairCount(1))
+			.arg(test->pairCount(2))
+			.arg(test->pairCount(3))
+			.arg(test->pairCount(4)));
+	if (sprtStatus.result == Sprt::AcceptH0)
+		sprtStr.append(" - H0 was accepted");
+	else if (sprtStatus.result == Sprt::AcceptH1)
+		sprtStr.append(" - H1 was accepted");
+
+	return sprtStr;
+}
+
 QString Tournament::results() const
 {
 	QMultiMap<qreal, RankingData> ranking;
 	QString ret;
 
+	// With more than two players the ratings are fitted to the
+	// whole result matrix instead of each player's total score
+	if (playerCount() > 2)
+		m_ratings->update();
+
 	for (int i = 0; i < playerCount(); i++)
 	{
 		const TournamentPlayer& player(playerAt(i));
@@ -1157,6 +1891,11 @@ QString Tournament::results() const
 				     elo.drawRatio(),
 				     elo.errorMargin(),
 				     elo.diff() };
+		if (i < m_ratings->playerCount() && m_ratings->games(i) > 0)
+		{
+			data.errorMargin = m_ratings->errorMargin(i);
+			data.eloDiff = m_ratings->rating(i);
+		}
 		// Order players like this:
 		// 1. Gauntlet player (if any)
 		// 2. Players with finished games, sorted by point ratio
@@ -1196,21 +1935,62 @@ QString Tournament::results() const
 			.arg(data.draws * 100.0, 6, 'f', 1);
 	}
 
-	Sprt::Status sprtStatus = sprt()->status();
-	if (sprtStatus.llr != 0.0
-	||  sprtStatus.lBound != 0.0
-	||  sprtStatus.uBound != 0.0)
+	if (!m_pairSprt)
+	{
+		const QString sprtStr = sprtString(m_sprt);
+		if (!sprtStr.isEmpty())
+			ret += "\nSPRT: " + sprtStr;
+	}
+
+	for (auto it = m_pairSprts.constBegin(); it != m_pairSprts.constEnd(); ++it)
+	{
+		const TournamentPair* p = it.key();
+		const int challenger = qMax(p->firstPlayer(), p->secondPlayer());
+		const int opponent = qMin(p->firstPlayer(), p->secondPlayer());
+		const QString sprtStr = sprtString(it.value());
+		if (!sprtStr.isEmpty())
+			ret += QString("\nSPRT %1 vs %2: %3")
+				.arg(playerAt(challenger).name())
+				.arg(playerAt(opponent).name())
+				.arg(sprtStr);
+	}
+
+	return ret;
+}
+
+QString Tournament::moveLatencyReport() const
+{
+	QString ret = QString("%1 %2 %3 %4 %5 %6 %7 %8")
+		.arg("Name", -25)
+		.arg("Stage", -10)
+		.arg("Moves", 7)
+		.arg("Mean", 9)
+		.arg("50%", 9)
+		.arg("90%", 9)
+		.arg("99%", 9)
+		.arg("Max", 9);
+
+	for (int i = 0; i < playerCount(); i++)
 	{
-		QString sprtStr = QString("SPRT: llr %1, lbound %2, ubound %3")
-			.arg(sprtStatus.llr, 0, 'g', 3)
-			.arg(sprtStatus.lBound, 0, 'g', 3)
-			.arg(sprtStatus.uBound, 0, 'g', 3);
-		if (sprtStatus.result == Sprt::AcceptH0)
-			sprtStr.append(" - H0 was accepted");
-		else if (sprtStatus.result == Sprt::AcceptH1)
-			sprtStr.append(" - H1 was accepted");
-
-		ret += "\n" + sprtStr;
+		const TournamentPlayer& player(playerAt(i));
+		const MoveLatency& latency(player.moveLatency());
+		if (latency.isEmpty())
+			continue;
+
+		for (int j = 0; j < MoveLatency::StageCount; j++)
+		{
+			const MoveLatency::Stage stage = MoveLatency::Stage(j);
+			const MoveLatency::Histogram& histogram(latency.histogram(stage));
+			ret += QString("\n%1 %2 %3 %4 %5 %6 %7 %8")
+				.arg(j == 0 ? player.name() : QString(), -25)
+				.arg(MoveLatency::stageName(stage), -10)
+				.arg(histogram.count(), 7)
+				.arg(histogram.mean() / 1000, 9)
+				.arg(histogram.percentile(0.5) / 1000, 9)
+				.arg(histogram.percentile(0.9) / 1000, 9)
+				.arg(histogram.percentile(0.99) / 1000, 9)
+				.arg(histogram.max() / 1000, 9);
+		}
 	}
 
 	return ret;
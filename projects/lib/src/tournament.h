@@ -23,6 +23,8 @@
 #include <QList>
 #include <QVector>
 #include <QMap>
+#include <QSet>
+#include <QVariantMap>
 #include <QFile>
 #include <QTextStream>
 #include "board/move.h"
@@ -32,12 +34,13 @@
 #include "tournamentplayer.h"
 #include "tournamentpair.h"
 #include "enginemanager.h"
+#include "sprt.h"
 class GameManager;
 class PlayerBuilder;
 class ChessGame;
 class OpeningBook;
 class OpeningSuite;
-class Sprt;
+class EloRatings;
 
 /*!
  * \brief Base class for chess tournaments
@@ -125,6 +128,26 @@ class LIB_EXPORT Tournament : public QObject
 		 * stopping criterion.
 		 */
 		Sprt* sprt() const;
+		/*!
+		 * Returns true if every pair of players runs its own SPRT.
+		 *
+		 * \sa setPairSprt()
+		 */
+		bool usesPairSprt() const;
+		/*!
+		 * Returns the SPRT of the pair of \a player1 and \a player2,
+		 * or nullptr if the pair hasn't finished any games or
+		 * per-pair SPRTs are not used.
+		 */
+		const Sprt* pairSprt(int player1, int player2) const;
+		/*!
+		 * Returns the maximum-likelihood ratings of the players,
+		 * fitted to the results of all finished games.
+		 *
+		 * The ratings are updated incrementally by
+		 * EloRatings::update(), which results() calls.
+		 */
+		EloRatings* ratings() const;
 		/*! Returns true if the players swap sides in an encounter. */
 		bool swapSides() const;
 		/*! Returns true if the tournament wants Berger/Schurig scheduling. */
@@ -285,14 +308,79 @@ class LIB_EXPORT Tournament : public QObject
 		void setResume(int nextGameNumber);
 
 		/*!
-		 * Add game result for a resumed tournament
+		 * Adds the \a result of game \a gameNumber between players
+		 * \a white and \a black for a resumed tournament.
+		 *
+		 * The results are added to the ratings and the SPRT when
+		 * the tournament starts.
+		 */
+		virtual void addResumeGameResult(int gameNumber,
+						 const QString& white,
+						 const QString& black,
+						 const QString& result);
+		/*!
+		 * Adds the move \a latency of the finished games of player
+		 * \a playerName for a resumed tournament.
+		 *
+		 * The latency is added to the player's totals when the
+		 * tournament starts.
 		 */
-		virtual void addResumeGameResult(int gameNumber, const QString &result);
+		void addResumeMoveLatency(const QString& playerName,
+					  const MoveLatency& latency);
+		/*!
+		 * Sets checkpointing to \a enabled.
+		 *
+		 * If \a enabled is true, the tournament keeps a copy of its
+		 * scheduler state for each game in progress, so that
+		 * resumeCheckpoint() can be called after any game.
+		 * The default is false.
+		 */
+		void setResumeCheckpoints(bool enabled);
+		/*!
+		 * Returns a resume checkpoint of the tournament.
+		 *
+		 * The checkpoint is the state of the tournament right after
+		 * its longest run of finished games, starting from the first
+		 * game: the next game number, the pairing state, the opening
+		 * suite position, the state of the random number generator
+		 * and the scores of each pair. Passing it to
+		 * setResumeCheckpoint() resumes the tournament without
+		 * replaying the finished games.
+		 *
+		 * Returns an empty map if checkpoints are disabled or the
+		 * tournament type can't save its pairing state.
+		 */
+		QVariantMap resumeCheckpoint() const;
+		/*!
+		 * Resumes the tournament from \a checkpoint, a map returned
+		 * by resumeCheckpoint().
+		 *
+		 * The checkpoint is used by start() if the tournament
+		 * is resumed with setResume(). Games between the checkpoint
+		 * and the resumed game number are skipped normally. If the
+		 * checkpoint doesn't match the tournament, the finished
+		 * games are skipped one by one instead.
+		 */
+		void setResumeCheckpoint(const QVariantMap& checkpoint);
 
 		/*!
 		 * Sets the tournament to Berger/Schurig scheduling if \a enabled.
 		 */
 		void setBergerSchedule(bool enabled);
+		/*!
+		 * Sets per-pair SPRT mode to \a enabled.
+		 *
+		 * In per-pair mode every pair of players gets its own copy
+		 * of the sprt() test, from the point of view of the player
+		 * with the higher index. A pair whose test is decided stops
+		 * playing, and its unplayed games are removed from the
+		 * schedule so that the other pairs get the free game slots.
+		 * The tournament ends when every pair has finished.
+		 *
+		 * Only tournament types that check isPairFinished() in
+		 * nextPair() support this mode.
+		 */
+		void setPairSprt(bool enabled);
 		/*!
 		 * Reloads the local engines.json before game start if \a enabled.
 		 */
@@ -315,6 +403,13 @@ class LIB_EXPORT Tournament : public QObject
 		 * The default implementation works for most tournament types.
 		 */
 		virtual QString results() const;
+		/*!
+		 * Returns a table of the manager's move latency for each
+		 * player's moves in the finished games, in microseconds.
+		 *
+		 * \sa MoveLatency
+		 */
+		QString moveLatencyReport() const;
 
 	public slots:
 		/*! Starts the tournament. */
@@ -466,11 +561,38 @@ class LIB_EXPORT Tournament : public QObject
 		 * to do their own score tracking.
 		 */
 		virtual void addScore(int player, int score);
+		/*!
+		 * Returns the maximum number of games between two players,
+		 * ie. gamesPerEncounter() * roundMultiplier().
+		 */
+		int gamesPerPair() const;
+		/*!
+		 * Returns true if \a pair has started all of its games or,
+		 * in per-pair SPRT mode, if its test has been decided.
+		 */
+		bool isPairFinished(const TournamentPair* pair) const;
 		/*!
 		 * Returns true if all games in the tournament have finished;
 		 * otherwise returns false.
 		 */
 		virtual bool areAllGamesFinished() const;
+		/*!
+		 * Returns the state of the pairing algorithm, which can be
+		 * restored with restorePairingState().
+		 *
+		 * The default implementation returns an empty map, which
+		 * means that the pairing state can't be saved and that the
+		 * tournament doesn't support resume checkpoints.
+		 */
+		virtual QVariantMap pairingState() const;
+		/*!
+		 * Restores the state of the pairing algorithm to \a state.
+		 *
+		 * This member function is called after initializePairing().
+		 * Returns false if \a state is invalid. The default
+		 * implementation always returns false.
+		 */
+		virtual bool restorePairingState(const QVariantMap& state);
 		/*!
 		 * Returns true if Gauntlet ordering is used for the ratings
 		 * table (ie. first engine always at the top and the rest
@@ -502,6 +624,23 @@ class LIB_EXPORT Tournament : public QObject
 			int number;
 			int whiteIndex;
 			int blackIndex;
+			int pairGame;
+			int opening;
+			QString startingFen;
+			QVector<Chess::Move> openingMoves;
+		};
+		struct ResumeGame
+		{
+			QString white;
+			QString black;
+			QString result;
+		};
+		struct CheckpointResult
+		{
+			int whiteIndex;
+			int blackIndex;
+			int whiteScore;
+			int blackScore;
 		};
 		struct RankingData
 		{
@@ -513,6 +652,19 @@ class LIB_EXPORT Tournament : public QObject
 			qreal eloDiff;
 		};
 
+		void updateSprt(const GameData* data, const Chess::Result& result);
+		int cancelQueuedGames(const TournamentPair* pair);
+		void startOpening(ChessGame* game);
+		bool isLostGame(const ChessGame* game) const;
+		void replayGame(const ChessGame* oldGame, GameData* data);
+		bool flushPgnGames();
+		QVariantMap schedulerState() const;
+		bool restoreSchedulerState(const QVariantMap& state);
+		void applyResumeGames(int lastGame);
+		void addCheckpointResult(int gameNumber,
+					 const CheckpointResult& result);
+		static QString sprtString(const Sprt* test);
+
 		GameManager* m_gameManager;
 		EngineManager* m_engineManager;
 		ChessGame* m_lastGame;
@@ -525,6 +677,7 @@ class LIB_EXPORT Tournament : public QObject
 		int m_finishedGameCount;
 		int m_savedGameCount;
 		int m_finalGameCount;
+		int m_cancelledGameCount;
 		int m_gamesPerEncounter;
 		int m_roundMultiplier;
 		int m_startDelay;
@@ -540,18 +693,27 @@ class LIB_EXPORT Tournament : public QObject
 		GameAdjudicator m_adjudicator;
 		OpeningSuite* m_openingSuite;
 		Sprt* m_sprt;
+		bool m_pairSprt;
+		QMap<const TournamentPair*, Sprt*> m_pairSprts;
+		QSet<const TournamentPair*> m_decidedPairs;
+		QMap<QPair<TournamentPair*, int>, Sprt::GameResult> m_sprtPairResults;
+		EloRatings* m_ratings;
 		QFile m_pgnFile;
 		QTextStream m_pgnOut;
 		QFile m_epdFile;
 		QTextStream m_epdOut;
 		QString m_startFen;
 		int m_repetitionCounter;
+		int m_openingNumber;
+		QMap<int, int> m_openingGames;
+		QList<QPair<QVector<Chess::Move>, QString> > m_returnedOpenings;
 		int m_swapSides;
 		PgnGame::PgnMode m_pgnOutMode;
 		TournamentPair* m_pair;
 		QMap< QPair<int, int>, TournamentPair* > m_pairs;
 		QList<TournamentPlayer> m_players;
 		QMap<int, PgnGame> m_pgnGames;
+		QSet<int> m_cancelledGames;
 		QMap<ChessGame*, GameData*> m_gameData;
 		QVector<Chess::Move> m_openingMoves;
 		QString m_livePgnOut;
@@ -560,6 +722,15 @@ class LIB_EXPORT Tournament : public QObject
 		bool m_jsonFormat;
 		QString m_eventDate;
 		int m_resumeGameNumber;
+		QVariantMap m_resumeCheckpoint;
+		bool m_resumeCheckpoints;
+		int m_checkpointGame;
+		QMap<int, QVariantMap> m_checkpoints;
+		QMap<int, CheckpointResult> m_checkpointResults;
+		QMap<QPair<int, int>, int> m_checkpointScores;
+		QMap<QString, MoveLatency> m_resumeMoveLatency;
+		QMap<int, ResumeGame> m_resumeGames;
+		QMap<TournamentPair*, int> m_resumePairGames;
 		bool m_bergerSchedule;
 		QVector<QPair<QVector<Chess::Move>, QString> > m_cycleOpenings;
 		bool m_reloadEngines;
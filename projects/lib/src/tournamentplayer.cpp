@@ -123,3 +123,13 @@ int TournamentPlayer::gamesFinished() const
 {
 	return m_wins + m_draws + m_losses;
 }
+
+const MoveLatency& TournamentPlayer::moveLatency() const
+{
+	return m_moveLatency;
+}
+
+void TournamentPlayer::addMoveLatency(const MoveLatency& latency)
+{
+	m_moveLatency.merge(latency);
+}
@@ -21,6 +21,7 @@
 
 #include "playerbuilder.h"
 #include "timecontrol.h"
+#include "movelatency.h"
 
 class OpeningBook;
 
@@ -76,6 +77,13 @@ class LIB_EXPORT TournamentPlayer
 		 * in the tournament.
 		 */
 		int gamesFinished() const;
+		/*!
+		 * Returns the manager's move latency for the player's moves
+		 * in all the finished games of the tournament.
+		 */
+		const MoveLatency& moveLatency() const;
+		/*! Adds the move latency of a finished game. */
+		void addMoveLatency(const MoveLatency& latency);
 
 	private:
 		PlayerBuilder* m_builder;
@@ -86,6 +94,7 @@ class LIB_EXPORT TournamentPlayer
 		int m_draws;
 		int m_losses;
 		int m_crashes;
+		MoveLatency m_moveLatency;
 };
 
 #endif // TOURNAMENTPLAYER_H
@@ -263,7 +263,7 @@ void UciEngine::startThinking()
 	if (isCuteseal())
 	{
 		// give deadline for shouting TIMEOUT if the engine doesn't respond with bestmove
-		command = QString("cuteseal-deadline %1 ").arg(int64_t { myTc->timeLeft() + myTc->expiryMargin() } * 1000000);
+		command = QString("cuteseal-deadline %1 ").arg(myTc->timeLeftNs() + int64_t { myTc->expiryMargin() } * 1000000);
 	}
 
 	command += "go";
@@ -724,7 +724,7 @@ void UciEngine::parseLine(const QString& line)
 		else
 		{
 			int64_t deltaNs = (localCommandTimeNs - m_cutesealMoveStartNs);
-			emitMove(move, (deltaNs + 500000) / 1000000);
+			emitMove(move, deltaNs);
 		}
 	}
 	else if (command == "readyok")
@@ -877,36 +877,26 @@ QString UciEngine::directPv(const QVarLengthArray<QStringRef>& tokens)
 QString UciEngine::sanPv(const QVarLengthArray<QStringRef>& tokens)
 {
 	Chess::Board* board = this->board();
-	QString pv;
-	int movesMade = 0;
-
-	if (pondering() && !m_ponderMove.isNull())
-	{
+	const bool ponderMove = pondering() && !m_ponderMove.isNull();
+	if (ponderMove)
 		board->makeMove(m_ponderMove);
-		movesMade++;
-	}
 
+	QStringList moves;
+	moves.reserve(tokens.size());
 	for (auto token : tokens)
-	{
-		auto move = board->moveFromString(token.toString());
-		if (move.isNull())
-		{
-			qWarning("Illegal PV move %s from %s",
-				 qUtf8Printable(token.toString()),
-				 qUtf8Printable(name()));
-			break;
-		}
-		if (!pv.isEmpty())
-			pv += " ";
-		pv += board->moveString(move, Chess::Board::StandardAlgebraic);
-		board->makeMove(move);
-		movesMade++;
-	}
+		moves << token.toString();
 
-	for (int i = 0; i < movesMade; i++)
+	const QStringList sanMoves(board->moveStrings(
+		moves, Chess::Board::StandardAlgebraic));
+	if (sanMoves.size() < moves.size())
+		qWarning("Illegal PV move %s from %s",
+			 qUtf8Printable(moves.at(sanMoves.size())),
+			 qUtf8Printable(name()));
+
+	if (ponderMove)
 		board->undoMove();
 
-	return pv;
+	return sanMoves.join(' ');
 }
 
 void UciEngine::sendOption(const QString& name, const QVariant& value)
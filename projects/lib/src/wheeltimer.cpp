@@ -0,0 +1,421 @@
+/*
+    This file is part of Cute Chess.
+    Copyright (C) 2008-2018 Cute Chess authors
+
+    Cute Chess is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Cute Chess is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Cute Chess.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "wheeltimer.h"
+#include <algorithm>
+#include <QBasicTimer>
+#include <QElapsedTimer>
+#include <QEvent>
+#include <QThreadStorage>
+#include <QTimerEvent>
+#include <QtAlgorithms>
+
+
+/*
+ * A hierarchical timing wheel with a one-millisecond tick.
+ *
+ * Every level has 64 slots, and a slot on level N covers 64^N ticks,
+ * so the four levels cover about 4.6 hours. Longer timers are put in
+ * the last slot that the wheel can reach and moved down when the slot
+ * is cascaded. A timer is added to the lowest level that can hold its
+ * deadline and moved to lower levels when the wheel reaches the start
+ * of its slot. The occupied slots of each level are kept in a bitmap,
+ * so the next tick that needs any work is found without walking the
+ * slots, and the wheel's only Qt timer is set to that tick.
+ */
+class TimingWheel : public QObject
+{
+	public:
+		/*! Returns the timing wheel of the current thread. */
+		static TimingWheel* instance();
+
+		TimingWheel();
+		virtual ~TimingWheel();
+
+		/*! Returns the current time of the wheel. */
+		qint64 now() const;
+		/*! Adds \a timer to the wheel. */
+		void add(WheelTimer* timer);
+		/*! Removes \a timer from the wheel. */
+		void remove(WheelTimer* timer);
+
+	protected:
+		// Inherited from QObject
+		virtual void timerEvent(QTimerEvent* event);
+
+	private:
+		enum
+		{
+			SlotBits = 6,
+			SlotCount = 1 << SlotBits,
+			SlotMask = SlotCount - 1,
+			LevelCount = 4,
+			// The list of expired timers that are being fired
+			PendingSlot = LevelCount * SlotCount
+		};
+
+		void insert(WheelTimer* timer, qint64 minTick);
+		void link(WheelTimer* timer, int slot);
+		void unlink(WheelTimer* timer);
+		void cascade(int level);
+		qint64 nextTick() const;
+		void rearm();
+
+		QElapsedTimer m_clock;
+		QBasicTimer m_timer;
+		qint64 m_current;
+		qint64 m_wakeTick;
+		int m_count;
+		bool m_firing;
+		quint64 m_occupied[LevelCount];
+		WheelTimer* m_heads[PendingSlot + 1];
+		WheelTimer* m_tails[PendingSlot + 1];
+};
+
+TimingWheel* TimingWheel::instance()
+{
+	static QThreadStorage<TimingWheel*> s_wheels;
+	if (!s_wheels.hasLocalData())
+		s_wheels.setLocalData(new TimingWheel);
+	return s_wheels.localData();
+}
+
+TimingWheel::TimingWheel()
+	: m_current(0),
+	  m_wakeTick(-1),
+	  m_count(0),
+	  m_firing(false)
+{
+	m_clock.start();
+	std::fill(m_occupied, m_occupied + LevelCount, 0);
+	std::fill(m_heads, m_heads + PendingSlot + 1, nullptr);
+	std::fill(m_tails, m_tails + PendingSlot + 1, nullptr);
+}
+
+TimingWheel::~TimingWheel()
+{
+	m_timer.stop();
+
+	for (int slot = 0; slot <= PendingSlot; slot++)
+	{
+		WheelTimer* timer = m_heads[slot];
+		while (timer != nullptr)
+		{
+			WheelTimer* next = timer->m_next;
+			timer->m_wheel = nullptr;
+			timer->m_slot = -1;
+			timer->m_prev = nullptr;
+			timer->m_next = nullptr;
+			timer = next;
+		}
+	}
+}
+
+qint64 TimingWheel::now() const
+{
+	return m_clock.elapsed();
+}
+
+void TimingWheel::add(WheelTimer* timer)
+{
+	Q_ASSERT(timer->m_slot == -1);
+
+	// An empty wheel can skip the ticks that were missed while idle
+	if (m_count == 0)
+		m_current = qMax(m_current, now());
+
+	insert(timer, m_current + 1);
+	m_count++;
+
+	if (!m_firing)
+		rearm();
+}
+
+void TimingWheel::remove(WheelTimer* timer)
+{
+	if (timer->m_slot == -1)
+		return;
+
+	unlink(timer);
+	m_count--;
+}
+
+void TimingWheel::insert(WheelTimer* timer, qint64 minTick)
+{
+	const qint64 maxDelta = (Q_INT64_C(1) << (SlotBits * LevelCount)) - 1;
+	const qint64 delta = qMin(qMax(timer->m_deadline, minTick) - m_current,
+				  maxDelta);
+	const qint64 tick = m_current + delta;
+
+	int level = 0;
+	while (delta >> (SlotBits * (level + 1)) != 0)
+		level++;
+
+	const int index = int(tick >> (SlotBits * level)) & SlotMask;
+	link(timer, level * SlotCount + index);
+}
+
+void TimingWheel::link(WheelTimer* timer, int slot)
+{
+	timer->m_slot = slot;
+	timer->m_prev = m_tails[slot];
+	timer->m_next = nullptr;
+
+	if (m_tails[slot] != nullptr)
+		m_tails[slot]->m_next = timer;
+	else
+		m_heads[slot] = timer;
+	m_tails[slot] = timer;
+
+	if (slot != PendingSlot)
+		m_occupied[slot / SlotCount] |= Q_UINT64_C(1) << (slot & SlotMask);
+}
+
+void TimingWheel::unlink(WheelTimer* timer)
+{
+	const int slot = timer->m_slot;
+
+	if (timer->m_prev != nullptr)
+		timer->m_prev->m_next = timer->m_next;
+	else
+		m_heads[slot] = timer->m_next;
+	if (timer->m_next != nullptr)
+		timer->m_next->m_prev = timer->m_prev;
+	else
+		m_tails[slot] = timer->m_prev;
+
+	if (slot != PendingSlot && m_heads[slot] == nullptr)
+		m_occupied[slot / SlotCount] &= ~(Q_UINT64_C(1) << (slot & SlotMask));
+
+	timer->m_slot = -1;
+	timer->m_prev = nullptr;
+	timer->m_next = nullptr;
+}
+
+void TimingWheel::cascade(int level)
+{
+	const int index = int(m_current >> (SlotBits * level)) & SlotMask;
+	const int slot = level * SlotCount + index;
+
+	WheelTimer* timer = m_heads[slot];
+	m_heads[slot] = nullptr;
+	m_tails[slot] = nullptr;
+	m_occupied[level] &= ~(Q_UINT64_C(1) << index);
+
+	// The timers can expire on the current tick, which is fired
+	// right after the cascade
+	while (timer != nullptr)
+	{
+		WheelTimer* next = timer->m_next;
+		insert(timer, m_current);
+		timer = next;
+	}
+}
+
+qint64 TimingWheel::nextTick() const
+{
+	qint64 next = -1;
+
+	for (int level = 0; level < LevelCount; level++)
+	{
+		const quint64 bits = m_occupied[level];
+		if (bits == 0)
+			continue;
+
+		// Find the first occupied slot after the current one. A
+		// slot on a higher level needs work when the wheel reaches
+		// its start.
+		const int shift = SlotBits * level;
+		const qint64 block = (m_current >> shift) + 1;
+		const int start = int(block) & SlotMask;
+		const quint64 rotated = start == 0 ? bits
+			: (bits >> start) | (bits << (SlotCount - start));
+		const qint64 tick = (block + qCountTrailingZeroBits(rotated)) << shift;
+
+		if (next == -1 || tick < next)
+			next = tick;
+	}
+
+	return next;
+}
+
+void TimingWheel::rearm()
+{
+	const qint64 tick = nextTick();
+	if (tick == -1)
+	{
+		m_timer.stop();
+		m_wakeTick = -1;
+		return;
+	}
+	if (m_wakeTick != -1 && m_wakeTick <= tick)
+		return;
+
+	m_wakeTick = tick;
+	m_timer.start(int(qMax(tick - now(), Q_INT64_C(0))),
+		      Qt::PreciseTimer, this);
+}
+
+void TimingWheel::timerEvent(QTimerEvent* event)
+{
+	if (event->timerId() != m_timer.timerId())
+	{
+		QObject::timerEvent(event);
+		return;
+	}
+
+	m_timer.stop();
+	m_wakeTick = -1;
+	m_firing = true;
+
+	const qint64 time = now();
+	for (;;)
+	{
+		const qint64 tick = nextTick();
+		if (tick == -1 || tick > time)
+			break;
+
+		m_current = tick;
+		for (int level = 1; level < LevelCount; level++)
+		{
+			if ((tick & ((Q_INT64_C(1) << (SlotBits * level)) - 1)) != 0)
+				break;
+			cascade(level);
+		}
+
+		// Move the expired timers to the pending list, so that
+		// they can be stopped or restarted by the other timers'
+		// slots while they're being fired
+		const int slot = int(tick) & SlotMask;
+		WheelTimer* timer = m_heads[slot];
+		m_heads[slot] = nullptr;
+		m_tails[slot] = nullptr;
+		m_occupied[0] &= ~(Q_UINT64_C(1) << slot);
+		while (timer != nullptr)
+		{
+			WheelTimer* next = timer->m_next;
+			link(timer, PendingSlot);
+			timer = next;
+		}
+
+		while ((timer = m_heads[PendingSlot]) != nullptr)
+		{
+			unlink(timer);
+			m_count--;
+			timer->m_wheel = nullptr;
+			emit timer->timeout();
+		}
+	}
+
+	// No slot needs any work before the next tick
+	m_current = qMax(m_current, time);
+	m_firing = false;
+	rearm();
+}
+
+
+WheelTimer::WheelTimer(QObject* parent)
+	: QObject(parent),
+	  m_interval(0),
+	  m_resuming(false),
+	  m_wheel(nullptr),
+	  m_deadline(0),
+	  m_slot(-1),
+	  m_prev(nullptr),
+	  m_next(nullptr)
+{
+}
+
+WheelTimer::~WheelTimer()
+{
+	stop();
+}
+
+int WheelTimer::interval() const
+{
+	return m_interval;
+}
+
+void WheelTimer::setInterval(int msec)
+{
+	m_interval = msec;
+}
+
+bool WheelTimer::isActive() const
+{
+	return m_wheel != nullptr;
+}
+
+int WheelTimer::remainingTime() const
+{
+	if (m_wheel == nullptr)
+		return -1;
+	return int(qMax(m_deadline - m_wheel->now(), Q_INT64_C(0)));
+}
+
+bool WheelTimer::event(QEvent* event)
+{
+	// The wheels are per thread, so an active timer is started
+	// again in the new thread
+	if (event->type() == QEvent::ThreadChange && isActive())
+	{
+		const int msec = remainingTime();
+		stop();
+		m_resuming = true;
+		QMetaObject::invokeMethod(this, "resume", Qt::QueuedConnection,
+					  Q_ARG(int, msec));
+	}
+
+	return QObject::event(event);
+}
+
+void WheelTimer::start()
+{
+	schedule(m_interval);
+}
+
+void WheelTimer::start(int msec)
+{
+	m_interval = msec;
+	schedule(msec);
+}
+
+void WheelTimer::stop()
+{
+	m_resuming = false;
+	if (m_wheel == nullptr)
+		return;
+
+	m_wheel->remove(this);
+	m_wheel = nullptr;
+}
+
+void WheelTimer::resume(int msec)
+{
+	if (m_resuming)
+		schedule(msec);
+}
+
+void WheelTimer::schedule(int msec)
+{
+	stop();
+
+	m_wheel = TimingWheel::instance();
+	m_deadline = m_wheel->now() + qMax(msec, 0);
+	m_wheel->add(this);
+}
@@ -0,0 +1,101 @@
+/*
+    This file is part of Cute Chess.
+    Copyright (C) 2008-2018 Cute Chess authors
+
+    Cute Chess is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Cute Chess is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Cute Chess.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef WHEELTIMER_H
+#define WHEELTIMER_H
+
+#include <QObject>
+class TimingWheel;
+
+/*!
+ * \brief A single-shot timer driven by a per-thread timing wheel
+ *
+ * WheelTimer works like a single-shot QTimer, but it isn't registered
+ * with the event dispatcher. All the wheel timers of a thread share a
+ * hierarchical timing wheel that uses one Qt timer to wake up at the
+ * earliest deadline, so starting, restarting and stopping a timer are
+ * constant-time operations.
+ *
+ * This is meant for the clock, ping, idle and quit deadlines of the
+ * players, which are restarted very often (eg. on every line from an
+ * engine) and rarely expire. The resolution is one millisecond.
+ *
+ * A wheel timer must be started and stopped in the thread it lives
+ * in. If an active timer is moved to another thread, it's started
+ * again in the new thread with the remaining time.
+ */
+class LIB_EXPORT WheelTimer : public QObject
+{
+	Q_OBJECT
+
+	public:
+		/*! Creates a new inactive timer with a zero interval. */
+		explicit WheelTimer(QObject* parent = nullptr);
+		/*! Destroys the timer. */
+		virtual ~WheelTimer();
+
+		/*! Returns the timeout interval in milliseconds. */
+		int interval() const;
+		/*! Sets the timeout interval to \a msec milliseconds. */
+		void setInterval(int msec);
+		/*! Returns true if the timer is running. */
+		bool isActive() const;
+		/*!
+		 * Returns the time left until the timeout in milliseconds,
+		 * or -1 if the timer is inactive.
+		 */
+		int remainingTime() const;
+
+		// Inherited from QObject
+		virtual bool event(QEvent* event);
+
+	public slots:
+		/*!
+		 * Starts or restarts the timer with the current interval.
+		 */
+		void start();
+		/*!
+		 * Sets the interval to \a msec milliseconds and starts or
+		 * restarts the timer.
+		 */
+		void start(int msec);
+		/*! Stops the timer. */
+		void stop();
+
+	signals:
+		/*! This signal is emitted when the timer times out. */
+		void timeout();
+
+	private slots:
+		void resume(int msec);
+
+	private:
+		friend class TimingWheel;
+
+		void schedule(int msec);
+
+		int m_interval;
+		bool m_resuming;
+		TimingWheel* m_wheel;
+		qint64 m_deadline;
+		int m_slot;
+		WheelTimer* m_prev;
+		WheelTimer* m_next;
+};
+
+#endif // WHEELTIMER_H
@@ -0,0 +1,577 @@
+/*
+    This file is part of Cute Chess.
+    Copyright (C) 2008-2018 Cute Chess authors
+
+    Cute Chess is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Cute Chess is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Cute Chess.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "workerpool.h"
+#include <QTcpSocket>
+#include <QTextStream>
+#include <QDateTime>
+#include <QPointer>
+#include <QTimer>
+#include <algorithm>
+#include <jsonserializer.h>
+#include "engineconfiguration.h"
+#include "wheeltimer.h"
+
+namespace {
+
+const int s_connectTimeout = 5000;
+const int s_startTimeout = 15000;
+const int s_pingTimeout = 3000;
+// Time before a worker that couldn't be reached is tried again
+const qint64 s_retryInterval = 30000;
+const char* s_lostProperty = "workerLost";
+const char* s_addressProperty = "workerAddress";
+
+QByteArray requestData(const QVariantMap& request)
+{
+	QString str;
+	QTextStream stream(&str);
+	JsonSerializer serializer(request);
+	serializer.serialize(stream);
+	stream.flush();
+
+	const QByteArray data(str.toUtf8());
+	return QByteArray::number(data.size()) + '\n' + data;
+}
+
+typedef void (QAbstractSocket::*SocketErrorSignal)(QAbstractSocket::SocketError);
+const SocketErrorSignal s_socketError = &QAbstractSocket::error;
+
+} // anonymous namespace
+
+/*
+ * The device of a remote engine. The engine is started by a chain of
+ * asynchronous steps: connect to a worker, send the request and wait
+ * for the reply, trying the next worker if a worker is down or busy.
+ * When the connection is closed, the worker is pinged before the read
+ * channel is finished, so that the device is marked as lost before the
+ * engine reports a crash.
+ */
+class WorkerConnection : public QIODevice
+{
+	public:
+		WorkerConnection(WorkerPool* pool,
+				 const QVariantMap& request,
+				 const QList<int>& workers);
+		virtual ~WorkerConnection();
+
+		// Inherited from QIODevice
+		virtual bool isSequential() const;
+		virtual qint64 bytesAvailable() const;
+		virtual bool canReadLine() const;
+		virtual void close();
+
+	protected:
+		// Inherited from QIODevice
+		virtual qint64 readData(char* data, qint64 maxSize);
+		virtual qint64 readLineData(char* data, qint64 maxSize);
+		virtual qint64 writeData(const char* data, qint64 size);
+
+	private:
+		enum State
+		{
+			Connecting,
+			Starting,
+			Running,
+			Checking,
+			Finished
+		};
+
+		QTcpSocket* newSocket();
+		void deleteSocket(QTcpSocket** socket);
+		bool selectNextWorker();
+		void releaseWorker();
+		void connectToWorker();
+		void connectToNextWorker();
+		void onConnected();
+		void onReadyRead();
+		void onSocketFinished();
+		void onWorkerDown(const QString& error);
+		void onPingReadyRead();
+		void onPingResult(bool alive);
+		void onTimeout();
+		void finish(const QString& error = QString());
+
+		QPointer<WorkerPool> m_pool;
+		QVariantMap m_request;
+		QList<int> m_workers;
+		WorkerPool::Worker m_worker;
+		int m_index;
+		bool m_counted;
+		State m_state;
+		QString m_error;
+		QTcpSocket* m_socket;
+		QTcpSocket* m_pingSocket;
+		WheelTimer* m_timer;
+		QByteArray m_writeBuffer;
+};
+
+WorkerConnection::WorkerConnection(WorkerPool* pool,
+				   const QVariantMap& request,
+				   const QList<int>& workers)
+	: m_pool(pool),
+	  m_request(request),
+	  m_workers(workers),
+	  m_index(-1),
+	  m_counted(false),
+	  m_state(Connecting),
+	  m_error(WorkerPool::tr("No workers available")),
+	  m_socket(nullptr),
+	  m_pingSocket(nullptr),
+	  m_timer(new WheelTimer(this))
+{
+	QObject::connect(m_timer, &WheelTimer::timeout, this, [=]()
+	{
+		onTimeout();
+	});
+
+	open(QIODevice::ReadWrite | QIODevice::Unbuffered);
+
+	// The worker is reserved right away so that the next engine goes
+	// to another worker, but errors are reported only after the caller
+	// has had a chance to connect to the device's signals
+	selectNextWorker();
+	QTimer::singleShot(0, this, [=]()
+	{
+		if (m_state == Connecting)
+			connectToWorker();
+	});
+}
+
+WorkerConnection::~WorkerConnection()
+{
+	releaseWorker();
+}
+
+bool WorkerConnection::isSequential() const
+{
+	return true;
+}
+
+qint64 WorkerConnection::bytesAvailable() const
+{
+	qint64 bytes = QIODevice::bytesAvailable();
+	if (m_socket != nullptr && m_state >= Running)
+		bytes += m_socket->bytesAvailable();
+	return bytes;
+}
+
+bool WorkerConnection::canReadLine() const
+{
+	if (m_socket != nullptr && m_state >= Running
+	&&  m_socket->canReadLine())
+		return true;
+	return QIODevice::canReadLine();
+}
+
+void WorkerConnection::close()
+{
+	m_timer->stop();
+	deleteSocket(&m_socket);
+	deleteSocket(&m_pingSocket);
+	m_state = Finished;
+
+	QIODevice::close();
+}
+
+qint64 WorkerConnection::readData(char* data, qint64 maxSize)
+{
+	if (m_socket == nullptr || m_state < Running)
+		return 0;
+	return m_socket->read(data, maxSize);
+}
+
+qint64 WorkerConnection::readLineData(char* data, qint64 maxSize)
+{
+	if (m_socket == nullptr || m_state < Running)
+		return 0;
+	return m_socket->readLine(data, maxSize);
+}
+
+qint64 WorkerConnection::writeData(const char* data, qint64 size)
+{
+	switch (m_state)
+	{
+	case Connecting:
+	case Starting:
+		// Sent when the engine has started
+		m_writeBuffer.append(data, int(size));
+		return size;
+	case Running:
+		return m_socket->write(data, size);
+	default:
+		return -1;
+	}
+}
+
+QTcpSocket* WorkerConnection::newSocket()
+{
+	QTcpSocket* socket = new QTcpSocket(this);
+	QObject::connect(socket, s_socketError, this, [=]()
+	{
+		if (socket == m_pingSocket)
+			onPingResult(false);
+		else if (m_state == Connecting || m_state == Starting)
+			onWorkerDown(socket->errorString());
+	});
+
+	return socket;
+}
+
+void WorkerConnection::deleteSocket(QTcpSocket** socket)
+{
+	if (*socket == nullptr)
+		return;
+
+	// This may be called from the socket's own signals
+	(*socket)->disconnect(this);
+	(*socket)->abort();
+	(*socket)->deleteLater();
+	*socket = nullptr;
+}
+
+bool WorkerConnection::selectNextWorker()
+{
+	releaseWorker();
+	if (m_workers.isEmpty() || !m_pool)
+		return false;
+
+	m_index = m_workers.takeFirst();
+	m_worker = m_pool->worker(m_index);
+	m_pool->addEngine(m_index);
+	m_counted = true;
+
+	return true;
+}
+
+void WorkerConnection::releaseWorker()
+{
+	if (m_counted && m_pool)
+		m_pool->releaseEngine(m_index);
+	m_counted = false;
+}
+
+void WorkerConnection::connectToWorker()
+{
+	deleteSocket(&m_socket);
+	m_state = Connecting;
+
+	m_socket = newSocket();
+	QObject::connect(m_socket, &QTcpSocket::connected, this, [=]()
+	{
+		onConnected();
+	});
+	QObject::connect(m_socket, &QIODevice::readyRead, this, [=]()
+	{
+		onReadyRead();
+	});
+	QObject::connect(m_socket, &QIODevice::readChannelFinished, this, [=]()
+	{
+		onSocketFinished();
+	});
+
+	m_timer->start(s_connectTimeout);
+	m_socket->connectToHost(m_worker.host, m_worker.port);
+}
+
+void WorkerConnection::connectToNextWorker()
+{
+	if (selectNextWorker())
+		connectToWorker();
+	else
+		finish(m_error);
+}
+
+void WorkerConnection::onConnected()
+{
+	m_state = Starting;
+	m_timer->start(s_startTimeout);
+	m_socket->write(requestData(m_request));
+}
+
+void WorkerConnection::onReadyRead()
+{
+	if (m_state == Running)
+	{
+		emit readyRead();
+		return;
+	}
+	if (m_state != Starting || !m_socket->canReadLine())
+		return;
+
+	m_timer->stop();
+	const QString reply(QString::fromUtf8(m_socket->readLine()).trimmed());
+	if (reply != "ok")
+	{
+		const QString error(reply.startsWith("error ") ? reply.mid(6) : reply);
+
+		// A busy worker refuses politely, other errors (eg. an
+		// unknown engine) are the same everywhere
+		if (error == "busy")
+		{
+			m_error = WorkerPool::tr("All workers are busy");
+			connectToNextWorker();
+		}
+		else
+		{
+			releaseWorker();
+			finish(error);
+		}
+		return;
+	}
+
+	m_state = Running;
+	setProperty(s_addressProperty, QString("%1:%2")
+		    .arg(m_worker.host).arg(m_worker.port));
+
+	if (!m_writeBuffer.isEmpty())
+	{
+		m_socket->write(m_writeBuffer);
+		m_writeBuffer.clear();
+	}
+	if (m_socket->bytesAvailable() > 0)
+		emit readyRead();
+}
+
+void WorkerConnection::onSocketFinished()
+{
+	if (m_state == Connecting || m_state == Starting)
+	{
+		onWorkerDown(m_socket->errorString());
+		return;
+	}
+	if (m_state != Running)
+		return;
+
+	// Check whether the engine exited or the worker went away
+	m_state = Checking;
+	m_pingSocket = newSocket();
+	QObject::connect(m_pingSocket, &QTcpSocket::connected, this, [=]()
+	{
+		QVariantMap request;
+		request["secret"] = m_request.value("secret");
+		request["ping"] = true;
+		m_pingSocket->write(requestData(request));
+	});
+	QObject::connect(m_pingSocket, &QIODevice::readyRead, this, [=]()
+	{
+		onPingReadyRead();
+	});
+	m_timer->start(s_pingTimeout);
+	m_pingSocket->connectToHost(m_worker.host, m_worker.port);
+}
+
+void WorkerConnection::onWorkerDown(const QString& error)
+{
+	m_timer->stop();
+	qWarning("Cannot connect to worker %s:%d: %s",
+		 qUtf8Printable(m_worker.host), m_worker.port,
+		 qUtf8Printable(error));
+
+	m_error = error;
+	if (m_pool)
+		m_pool->setWorkerDown(m_index);
+	connectToNextWorker();
+}
+
+void WorkerConnection::onPingReadyRead()
+{
+	if (!m_pingSocket->canReadLine())
+		return;
+	onPingResult(m_pingSocket->readLine().trimmed() == "ok");
+}
+
+void WorkerConnection::onPingResult(bool alive)
+{
+	if (m_state != Checking)
+		return;
+
+	m_timer->stop();
+	deleteSocket(&m_pingSocket);
+	if (!alive)
+	{
+		qWarning("Lost connection to worker %s:%d",
+			 qUtf8Printable(m_worker.host), m_worker.port);
+		setProperty(s_lostProperty, true);
+		if (m_pool)
+			m_pool->setWorkerDown(m_index);
+	}
+
+	finish();
+}
+
+void WorkerConnection::onTimeout()
+{
+	switch (m_state)
+	{
+	case Connecting:
+	case Starting:
+		onWorkerDown(WorkerPool::tr("Connection timed out"));
+		break;
+	case Checking:
+		onPingResult(false);
+		break;
+	default:
+		break;
+	}
+}
+
+void WorkerConnection::finish(const QString& error)
+{
+	m_state = Finished;
+	m_timer->stop();
+	m_writeBuffer.clear();
+	if (!error.isEmpty())
+	{
+		deleteSocket(&m_socket);
+		qWarning("Cannot start engine %s on a worker: %s",
+			 qUtf8Printable(m_request.value("engine").toString()),
+			 qUtf8Printable(error));
+		setErrorString(error);
+	}
+
+	emit readChannelFinished();
+}
+
+
+WorkerPool::WorkerPool(QObject* parent)
+	: QObject(parent)
+{
+}
+
+void WorkerPool::addWorker(const QString& host, quint16 port)
+{
+	QMutexLocker locker(&m_mutex);
+
+	Worker worker = { host, port, 0, 0 };
+	m_workers << worker;
+}
+
+bool WorkerPool::addWorker(const QString& address)
+{
+	const int i = address.lastIndexOf(':');
+	if (i <= 0)
+		return false;
+
+	bool ok = false;
+	const int port = address.mid(i + 1).toInt(&ok);
+	if (!ok || port <= 0 || port > 65535)
+		return false;
+
+	addWorker(address.left(i), quint16(port));
+	return true;
+}
+
+QString WorkerPool::secret() const
+{
+	QMutexLocker locker(&m_mutex);
+	return m_secret;
+}
+
+void WorkerPool::setSecret(const QString& secret)
+{
+	QMutexLocker locker(&m_mutex);
+	m_secret = secret;
+}
+
+int WorkerPool::workerCount() const
+{
+	QMutexLocker locker(&m_mutex);
+	return m_workers.size();
+}
+
+QList<int> WorkerPool::availableWorkers()
+{
+	QMutexLocker locker(&m_mutex);
+
+	const qint64 now = QDateTime::currentMSecsSinceEpoch();
+	QList<int> indexes;
+	for (int i = 0; i < m_workers.size(); i++)
+		indexes << i;
+
+	// The least loaded workers first. Workers that couldn't be
+	// reached recently are only tried if all the others fail.
+	std::stable_sort(indexes.begin(), indexes.end(), [=](int a, int b)
+	{
+		const Worker& wa = m_workers.at(a);
+		const Worker& wb = m_workers.at(b);
+		const bool downA = wa.retryTime > now;
+		const bool downB = wb.retryTime > now;
+		if (downA != downB)
+			return downB;
+		return wa.engineCount < wb.engineCount;
+	});
+	return indexes;
+}
+
+WorkerPool::Worker WorkerPool::worker(int index) const
+{
+	QMutexLocker locker(&m_mutex);
+	return m_workers.at(index);
+}
+
+void WorkerPool::setWorkerDown(int index)
+{
+	QMutexLocker locker(&m_mutex);
+	m_workers[index].retryTime = QDateTime::currentMSecsSinceEpoch()
+				     + s_retryInterval;
+}
+
+void WorkerPool::addEngine(int index)
+{
+	QMutexLocker locker(&m_mutex);
+	m_workers[index].engineCount++;
+}
+
+void WorkerPool::releaseEngine(int index)
+{
+	QMutexLocker locker(&m_mutex);
+	m_workers[index].engineCount--;
+}
+
+QIODevice* WorkerPool::startEngine(const EngineConfiguration& config,
+				   QString* error)
+{
+	Q_ASSERT(error != nullptr);
+
+	const QList<int> workers = availableWorkers();
+	if (workers.isEmpty())
+	{
+		*error = tr("No workers available");
+		return nullptr;
+	}
+
+	// The worker starts its own engine with the same name
+	QVariantMap request;
+	request["secret"] = secret();
+	request["engine"] = config.name();
+
+	return new WorkerConnection(this, request, workers);
+}
+
+bool WorkerPool::isLostDevice(const QIODevice* device)
+{
+	return device != nullptr && device->property(s_lostProperty).toBool();
+}
+
+QString WorkerPool::workerAddress(const QIODevice* device)
+{
+	if (device == nullptr)
+		return QString();
+	return device->property(s_addressProperty).toString();
+}
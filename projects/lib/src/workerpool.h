@@ -0,0 +1,137 @@
+/*
+    This file is part of Cute Chess.
+    Copyright (C) 2008-2018 Cute Chess authors
+
+    Cute Chess is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Cute Chess is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Cute Chess.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef WORKERPOOL_H
+#define WORKERPOOL_H
+
+#include <QObject>
+#include <QVector>
+#include <QMutex>
+class QIODevice;
+class EngineConfiguration;
+
+
+/*!
+ * \brief A pool of remote workers that run chess engines
+ *
+ * WorkerPool is the coordinator's side of distributed matches. Each
+ * worker is a cutechess-cli process in worker mode (see EngineWorker)
+ * that listens on a TCP port and starts its own engines on request.
+ * The pool opens one connection per engine, and the connection is
+ * used as the engine's I/O device instead of a local process. The
+ * games, clocks, adjudication and output all stay on the coordinator.
+ *
+ * New engines are started on the worker with the fewest running
+ * engines. A worker that can't be reached is skipped for a while.
+ *
+ * The connections are made asynchronously, so a slow or unreachable
+ * worker never blocks the game thread. Until a worker has started the
+ * engine, whatever is written to the device is buffered. If no worker
+ * can start the engine, the device's read channel is finished with
+ * an error, like a local engine process that couldn't be started.
+ *
+ * When the connection to an engine is closed, the pool checks that
+ * the worker is still alive. If it isn't, the device is marked as
+ * lost (see isLostDevice()) so that the interrupted game can be played
+ * again instead of being scored as a disconnection.
+ *
+ * startEngine() is thread-safe, so the pool can be shared by all the
+ * game threads of a GameManager.
+ *
+ * \sa EngineBuilder::setWorkerPool()
+ */
+class LIB_EXPORT WorkerPool : public QObject
+{
+	Q_OBJECT
+
+	public:
+		/*! Creates a new empty worker pool. */
+		explicit WorkerPool(QObject* parent = nullptr);
+
+		/*! Adds the worker listening on \a host : \a port. */
+		void addWorker(const QString& host, quint16 port);
+		/*!
+		 * Adds a worker from \a address in "host:port" format.
+		 *
+		 * Returns false if \a address is invalid.
+		 */
+		bool addWorker(const QString& address);
+		/*! Returns the number of workers in the pool. */
+		int workerCount() const;
+
+		/*! Returns the shared secret that is sent to the workers. */
+		QString secret() const;
+		/*!
+		 * Sets the shared secret to \a secret. It must match the
+		 * secret of the workers.
+		 *
+		 * \sa EngineWorker::setSecret()
+		 */
+		void setSecret(const QString& secret);
+
+		/*!
+		 * Starts the engine described by \a config on a worker.
+		 *
+		 * Only the name of \a config is sent to the worker, which
+		 * starts its own engine with the same name.
+		 *
+		 * Returns an open device for the engine's standard input
+		 * and output, or nullptr if the pool has no workers, in
+		 * which case \a error is set. The engine is started in the
+		 * background; the device can be written to right away. The
+		 * caller takes ownership of the device, which lives in the
+		 * calling thread.
+		 */
+		QIODevice* startEngine(const EngineConfiguration& config,
+				       QString* error);
+
+		/*!
+		 * Returns true if \a device was closed because its worker
+		 * went away.
+		 */
+		static bool isLostDevice(const QIODevice* device);
+		/*!
+		 * Returns the "host:port" address of the worker that runs
+		 * the engine of \a device, or an empty string if the engine
+		 * hasn't been started.
+		 */
+		static QString workerAddress(const QIODevice* device);
+
+	private:
+		friend class WorkerConnection;
+
+		struct Worker
+		{
+			QString host;
+			quint16 port;
+			int engineCount;
+			qint64 retryTime;
+		};
+
+		QList<int> availableWorkers();
+		Worker worker(int index) const;
+		void setWorkerDown(int index);
+		void addEngine(int index);
+		void releaseEngine(int index);
+
+		mutable QMutex m_mutex;
+		QString m_secret;
+		QVector<Worker> m_workers;
+};
+
+#endif // WORKERPOOL_H
@@ -245,8 +245,8 @@ void XboardEngine::sendTimeLeft()
 		return;
 	}
 
-	int csLeft = timeControl()->timeLeft() / 10;
-	int ocsLeft = opponent()->timeControl()->timeLeft() / 10;
+	int csLeft = int(timeControl()->timeLeftNs() / 10000000);
+	int ocsLeft = int(opponent()->timeControl()->timeLeftNs() / 10000000);
 
 	if (csLeft < 0)
 		csLeft = 0;
@@ -17,6 +17,9 @@ class tst_Board: public QObject
 		
 		void moveStrings_data() const;
 		void moveStrings();
+
+		void pvStrings_data() const;
+		void pvStrings();
 		
 		void results_data() const;
 		void results();
@@ -52,6 +55,46 @@ void tst_Board::setVariant(const QString& variant)
 	QVERIFY(m_board != 0);
 }
 
+static int countPieces(const Chess::Board* board)
+{
+	int count = 0;
+	for (int file = 0; file < board->width(); file++)
+	{
+		for (int rank = 0; rank < board->height(); rank++)
+		{
+			if (board->pieceAt(Chess::Square(file, rank)).isValid())
+				count++;
+		}
+	}
+
+	return count;
+}
+
+static bool materialCountsMatch(const Chess::Board* board)
+{
+	QMap<QPair<int, int>, int> counts;
+	for (int file = 0; file < board->width(); file++)
+	{
+		for (int rank = 0; rank < board->height(); rank++)
+		{
+			const Chess::Piece piece(board->pieceAt(Chess::Square(file, rank)));
+			if (piece.isValid())
+				counts[qMakePair(int(piece.side()), piece.type())]++;
+		}
+	}
+
+	int total = 0;
+	for (auto it = counts.constBegin(); it != counts.constEnd(); ++it)
+	{
+		const Chess::Side side(Chess::Side::Type(it.key().first));
+		if (board->materialCount(side, it.key().second) != it.value())
+			return false;
+		total += it.value();
+	}
+
+	return total == board->pieceCount();
+}
+
 static quint64 perftVal(Chess::Board* board, int depth)
 {
 	quint64 nodeCount = 0;
@@ -555,6 +598,7 @@ void tst_Board::moveStrings()
 
 	setVariant(variant);
 	QVERIFY(m_board->setFenString(startfen));
+	const quint64 materialKey = m_board->materialKey();
 
 	const auto moveList = moves.split(' ', QString::SkipEmptyParts);
 	for (const auto& moveStr : moveList)
@@ -562,6 +606,8 @@ void tst_Board::moveStrings()
 		Chess::Move move = m_board->moveFromString(moveStr);
 		QVERIFY(m_board->isLegalMove(move));
 		m_board->makeMove(move);
+		QCOMPARE(m_board->pieceCount(), countPieces(m_board));
+		QVERIFY(materialCountsMatch(m_board));
 	}
 	QCOMPARE(m_board->fenString(), endfen);
 
@@ -570,11 +616,75 @@ void tst_Board::moveStrings()
 		for (int i = 0; i < moveList.size(); i++)
 			m_board->undoMove();
 		QCOMPARE(m_board->fenString(), startfen);
+		QCOMPARE(m_board->pieceCount(), countPieces(m_board));
+		QVERIFY(materialCountsMatch(m_board));
+		QCOMPARE(m_board->materialKey(), materialKey);
 	}
 	else
 		QCOMPARE(m_board->fenString(), endfen);
 }
 
+void tst_Board::pvStrings_data() const
+{
+	QTest::addColumn<QString>("fen");
+	QTest::addColumn<QString>("pv");
+	QTest::addColumn<QString>("san");
+	QTest::addColumn<QString>("lan");
+
+	const QString startFen =
+		"rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1";
+
+	QTest::newRow("lan")
+		<< startFen
+		<< "e2e4 e7e5 g1f3 b8c6 f1b5 a7a6"
+		<< "e4 e5 Nf3 Nc6 Bb5 a6"
+		<< "e2e4 e7e5 g1f3 b8c6 f1b5 a7a6";
+	QTest::newRow("mixed notation")
+		<< startFen
+		<< "e4 e7e5  Nf3"
+		<< "e4 e5 Nf3"
+		<< "e2e4 e7e5 g1f3";
+	QTest::newRow("illegal move")
+		<< startFen
+		<< "e2e4 e2e4 d7d5"
+		<< "e4"
+		<< "e2e4";
+	QTest::newRow("disambiguation and check")
+		<< "4k3/8/8/8/8/8/4K3/R6R w - - 0 1"
+		<< "a1d1 e8f7 d1d7"
+		<< "Rad1 Kf7 Rd7+"
+		<< "a1d1 e8f7 d1d7";
+}
+
+void tst_Board::pvStrings()
+{
+	QFETCH(QString, fen);
+	QFETCH(QString, pv);
+	QFETCH(QString, san);
+	QFETCH(QString, lan);
+
+	setVariant("standard");
+	QVERIFY(m_board->setFenString(fen));
+
+	QCOMPARE(m_board->sanStringForPv(pv, Chess::Board::StandardAlgebraic), san);
+	QCOMPARE(m_board->sanStringForPv(san, Chess::Board::LongAlgebraic), lan);
+	QCOMPARE(m_board->fenString(), fen);
+
+	QVector<Chess::Move> moves;
+	const auto moveList = lan.split(' ');
+	for (const auto& moveStr : moveList)
+	{
+		moves << m_board->moveFromString(moveStr);
+		m_board->makeMove(moves.last());
+	}
+	for (int i = 0; i < moves.size(); i++)
+		m_board->undoMove();
+
+	QCOMPARE(m_board->moveStrings(moves, Chess::Board::StandardAlgebraic),
+		 san.split(' '));
+	QCOMPARE(m_board->fenString(), fen);
+}
+
 void tst_Board::results_data() const
 {
 	QTest::addColumn<QString>("variant");
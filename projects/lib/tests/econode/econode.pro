@@ -0,0 +1,4 @@
+include(../tests.pri)
+
+TARGET = tst_econode
+SOURCES += tst_econode.cpp
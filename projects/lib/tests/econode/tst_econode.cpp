@@ -0,0 +1,86 @@
+#include <QtTest/QtTest>
+#include <econode.h>
+#include <pgnstream.h>
+#include <board/standardboard.h>
+
+class tst_EcoNode: public QObject
+{
+	Q_OBJECT
+
+	private slots:
+		void builtin_data() const;
+		void builtin();
+		void custom();
+
+	private:
+		quint64 key(const QString& moves) const;
+};
+
+quint64 tst_EcoNode::key(const QString& moves) const
+{
+	Chess::StandardBoard board;
+	board.initialize();
+	board.setFenString(board.defaultFenString());
+	for (const QString& move : moves.split(' ', QString::SkipEmptyParts))
+		board.makeMove(board.moveFromString(move));
+
+	return board.key();
+}
+
+void tst_EcoNode::builtin_data() const
+{
+	QTest::addColumn<QString>("moves");
+	QTest::addColumn<QString>("ecoCode");
+	QTest::addColumn<QString>("opening");
+
+	QTest::newRow("polish")
+		<< "b4" << "A00" << "Polish (Sokolsky) opening";
+	QTest::newRow("sicilian")
+		<< "e4 c5" << "B20" << "Sicilian defence";
+	QTest::newRow("ruy lopez")
+		<< "e4 e5 Nf3 Nc6 Bb5" << "C60" << "Ruy Lopez (Spanish opening)";
+}
+
+void tst_EcoNode::builtin()
+{
+	QFETCH(QString, moves);
+	QFETCH(QString, ecoCode);
+	QFETCH(QString, opening);
+
+	const EcoNode* node = EcoNode::find(key(moves));
+	QVERIFY(node != nullptr);
+	QCOMPARE(node->ecoCode(), ecoCode);
+	QCOMPARE(node->opening(), opening);
+	QVERIFY(node->variation().isEmpty());
+
+	QVERIFY(EcoNode::find(key("a4 h5 a5 h4")) == nullptr);
+}
+
+void tst_EcoNode::custom()
+{
+	QByteArray pgn(
+		"[ECO \"A00\"]\n[Opening \"Rook pawn\"]\n[Variation \"Short\"]\n\n"
+		"1. h4 *\n\n"
+		"[ECO \"A01\"]\n[Opening \"Rook pawn\"]\n\n"
+		"1. h4 h5 *\n\n");
+	PgnStream stream(&pgn);
+	EcoNode::initialize(stream);
+
+	const EcoNode* node = EcoNode::find(key("h4"));
+	QVERIFY(node != nullptr);
+	QCOMPARE(node->ecoCode(), QString("A00"));
+	QCOMPARE(node->opening(), QString("Rook pawn"));
+	QCOMPARE(node->variation(), QString("Short"));
+
+	node = EcoNode::find(key("h4 h5"));
+	QVERIFY(node != nullptr);
+	QCOMPARE(node->ecoCode(), QString("A01"));
+	QCOMPARE(node->opening(), QString("Rook pawn"));
+	QVERIFY(node->variation().isEmpty());
+
+	// The custom catalog replaces the built-in one
+	QVERIFY(EcoNode::find(key("e4 c5")) == nullptr);
+}
+
+QTEST_MAIN(tst_EcoNode)
+#include "tst_econode.moc"
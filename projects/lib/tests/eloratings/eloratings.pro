@@ -0,0 +1,4 @@
+include(../tests.pri)
+
+TARGET = tst_eloratings
+SOURCES += tst_eloratings.cpp
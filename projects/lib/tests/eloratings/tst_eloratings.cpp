@@ -0,0 +1,103 @@
+#include <QtTest/QtTest>
+#include <eloratings.h>
+
+
+class tst_EloRatings: public QObject
+{
+	Q_OBJECT
+
+	private slots:
+		void ratings();
+		void incremental();
+		void threads();
+
+	private:
+		bool fuzzyCompare(double val1, double val2);
+		void addGames(EloRatings& ratings, int white, int black,
+			      int wins, int losses, int draws);
+};
+
+
+bool tst_EloRatings::fuzzyCompare(double val1, double val2)
+{
+	double delta = 0.1;
+	return (val1 - delta <= val2 && val1 + delta >= val2);
+}
+
+void tst_EloRatings::addGames(EloRatings& ratings, int white, int black,
+			      int wins, int losses, int draws)
+{
+	for (int i = 0; i < wins; i++)
+		ratings.addGameResult(white, black, 2);
+	for (int i = 0; i < losses; i++)
+		ratings.addGameResult(white, black, 0);
+	for (int i = 0; i < draws; i++)
+		ratings.addGameResult(white, black, 1);
+}
+
+void tst_EloRatings::ratings()
+{
+	EloRatings ratings(3);
+	addGames(ratings, 0, 1, 30, 10, 20);
+	addGames(ratings, 1, 2, 25, 15, 30);
+	addGames(ratings, 0, 2, 40, 5, 15);
+	ratings.update();
+
+	QCOMPARE(ratings.games(0), 120);
+	QVERIFY(fuzzyCompare(ratings.rating(0), 114.84));
+	QVERIFY(fuzzyCompare(ratings.rating(1), -24.85));
+	QVERIFY(fuzzyCompare(ratings.rating(2), -89.99));
+	QVERIFY(fuzzyCompare(ratings.errorMargin(0), 69.75));
+	QVERIFY(fuzzyCompare(ratings.errorMargin(1), 62.20));
+	QVERIFY(fuzzyCompare(ratings.errorMargin(2), 64.43));
+}
+
+void tst_EloRatings::incremental()
+{
+	EloRatings ratings(2);
+	addGames(ratings, 0, 1, 15, 5, 10);
+	ratings.update();
+	const int firstIterations = ratings.iterations();
+
+	addGames(ratings, 1, 0, 5, 15, 10);
+	ratings.update();
+
+	// The previous solution is a good starting point
+	QVERIFY(ratings.iterations() <= firstIterations);
+	QVERIFY(fuzzyCompare(ratings.rating(0), 59.65));
+	QVERIFY(fuzzyCompare(ratings.rating(1), -59.65));
+	QVERIFY(fuzzyCompare(ratings.errorMargin(0), 92.31));
+}
+
+void tst_EloRatings::threads()
+{
+	const int players = 64;
+	EloRatings single(players);
+	EloRatings multi(players);
+	single.setThreadCount(1);
+	multi.setThreadCount(4);
+
+	for (int i = 0; i < players; i++)
+	{
+		for (int j = i + 1; j < players; j++)
+		{
+			const int score = (i * 7 + j * 3) % 3;
+			single.addGameResult(i, j, score);
+			multi.addGameResult(i, j, score);
+			single.addGameResult(j, i, 2 - score / 2);
+			multi.addGameResult(j, i, 2 - score / 2);
+		}
+	}
+	single.update();
+	multi.update();
+
+	QCOMPARE(multi.iterations(), single.iterations());
+	for (int i = 0; i < players; i++)
+	{
+		QVERIFY(fuzzyCompare(multi.rating(i), single.rating(i)));
+		QVERIFY(fuzzyCompare(multi.errorMargin(i), single.errorMargin(i)));
+	}
+}
+
+QTEST_MAIN(tst_EloRatings)
+#include "tst_eloratings.moc"
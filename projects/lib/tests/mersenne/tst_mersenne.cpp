@@ -8,6 +8,7 @@ class tst_Mersenne: public QObject
 	private slots:
 		void numbers_data();
 		void numbers();
+		void state();
 };
 
 void tst_Mersenne::numbers_data()
@@ -37,6 +38,24 @@ void tst_Mersenne::numbers()
 	QCOMPARE(Mersenne::random(), random1);
 	QCOMPARE(Mersenne::random(), random2);
 }
+void tst_Mersenne::state()
+{
+	Mersenne::initialize(12345);
+	for (int i = 0; i < 1000; i++)
+		Mersenne::random();
+
+	const QByteArray state(Mersenne::state());
+	QVector<quint32> numbers;
+	for (int i = 0; i < 1000; i++)
+		numbers << Mersenne::random();
+
+	QVERIFY(Mersenne::setState(state));
+	for (int i = 0; i < 1000; i++)
+		QCOMPARE(Mersenne::random(), numbers.at(i));
+
+	QVERIFY(!Mersenne::setState(QByteArray()));
+	QVERIFY(!Mersenne::setState(state.left(100)));
+}
 
 
 QTEST_MAIN(tst_Mersenne)
@@ -0,0 +1,4 @@
+include(../tests.pri)
+
+TARGET = tst_movelatency
+SOURCES += tst_movelatency.cpp
@@ -0,0 +1,123 @@
+#include <QtTest/QtTest>
+#include <movelatency.h>
+
+class tst_MoveLatency: public QObject
+{
+	Q_OBJECT
+
+	private slots:
+		void buckets();
+		void statistics();
+		void merge();
+		void variantMap();
+		void fromVariantMap();
+		void timestamp();
+};
+
+void tst_MoveLatency::buckets()
+{
+	MoveLatency::Histogram histogram;
+	histogram.add(999);		// under 1 us
+	histogram.add(1000);		// 1 us
+	histogram.add(3999);		// 3 us
+	histogram.add(4000);		// 4 us
+	histogram.add(-5);		// clock skew
+	histogram.add(Q_INT64_C(3600000000000));
+
+	QCOMPARE(histogram.bucket(0), 2);
+	QCOMPARE(histogram.bucket(1), 1);
+	QCOMPARE(histogram.bucket(2), 1);
+	QCOMPARE(histogram.bucket(3), 1);
+	QCOMPARE(histogram.bucket(MoveLatency::Histogram::BucketCount - 1), 1);
+	QCOMPARE(histogram.count(), 6);
+}
+
+void tst_MoveLatency::statistics()
+{
+	MoveLatency::Histogram histogram;
+	QCOMPARE(histogram.mean(), Q_INT64_C(0));
+	QCOMPARE(histogram.percentile(0.5), Q_INT64_C(0));
+
+	// 90 fast moves and 10 slow ones
+	for (int i = 0; i < 90; i++)
+		histogram.add(Q_INT64_C(20000));
+	for (int i = 0; i < 10; i++)
+		histogram.add(Q_INT64_C(3000000));
+
+	QCOMPARE(histogram.count(), 100);
+	QCOMPARE(histogram.mean(), Q_INT64_C(318000));
+	QCOMPARE(histogram.max(), Q_INT64_C(3000000));
+	QCOMPARE(histogram.percentile(0.5), Q_INT64_C(32000));
+	QCOMPARE(histogram.percentile(0.9), Q_INT64_C(32000));
+	QCOMPARE(histogram.percentile(0.99), Q_INT64_C(3000000));
+}
+
+void tst_MoveLatency::merge()
+{
+	MoveLatency first;
+	MoveLatency second;
+	QVERIFY(first.isEmpty());
+
+	first.add(MoveLatency::Validate, 5000);
+	second.add(MoveLatency::Validate, 9000);
+	second.add(MoveLatency::Go, 100000);
+	first.merge(second);
+
+	QVERIFY(!first.isEmpty());
+	QCOMPARE(first.histogram(MoveLatency::Validate).count(), 2);
+	QCOMPARE(first.histogram(MoveLatency::Validate).mean(), Q_INT64_C(7000));
+	QCOMPARE(first.histogram(MoveLatency::Go).max(), Q_INT64_C(100000));
+	QCOMPARE(first.histogram(MoveLatency::Notify).count(), 0);
+}
+
+void tst_MoveLatency::variantMap()
+{
+	MoveLatency latency;
+	latency.add(MoveLatency::Total, 5000);
+	latency.add(MoveLatency::Total, 7000);
+
+	const QVariantMap map(latency.toVariantMap());
+	QCOMPARE(map.size(), int(MoveLatency::StageCount));
+
+	const QVariantMap total(map.value("total").toMap());
+	QCOMPARE(total.value("count").toInt(), 2);
+	QCOMPARE(total.value("meanUs").toLongLong(), Q_INT64_C(6));
+	QCOMPARE(total.value("maxUs").toLongLong(), Q_INT64_C(7));
+	QCOMPARE(total.value("buckets").toList(),
+		 QVariantList() << 0 << 0 << 0 << 2);
+
+	const QVariantMap notify(map.value("notify").toMap());
+	QCOMPARE(notify.value("count").toInt(), 0);
+	QVERIFY(notify.value("buckets").toList().isEmpty());
+}
+
+void tst_MoveLatency::fromVariantMap()
+{
+	MoveLatency latency;
+	latency.add(MoveLatency::Validate, 1500);
+	latency.add(MoveLatency::Validate, 2500);
+	latency.add(MoveLatency::Go, 70000);
+
+	const MoveLatency restored(
+		MoveLatency::fromVariantMap(latency.toVariantMap()));
+	for (int i = 0; i < MoveLatency::StageCount; i++)
+	{
+		const MoveLatency::Stage stage = MoveLatency::Stage(i);
+		const MoveLatency::Histogram& histogram(restored.histogram(stage));
+		QCOMPARE(histogram.count(), latency.histogram(stage).count());
+		QCOMPARE(histogram.mean(), latency.histogram(stage).mean());
+		QCOMPARE(histogram.max(), latency.histogram(stage).max());
+		for (int j = 0; j < MoveLatency::Histogram::BucketCount; j++)
+			QCOMPARE(histogram.bucket(j), latency.histogram(stage).bucket(j));
+	}
+}
+
+void tst_MoveLatency::timestamp()
+{
+	const qint64 first = MoveLatency::timestamp();
+	QTest::qSleep(5);
+	QVERIFY(MoveLatency::timestamp() - first >= Q_INT64_C(5000000));
+}
+
+QTEST_MAIN(tst_MoveLatency)
+#include "tst_movelatency.moc"
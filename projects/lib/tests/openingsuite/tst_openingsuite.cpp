@@ -0,0 +1,140 @@
+#include <QtTest/QtTest>
+#include <openingsuite.h>
+#include <mersenne.h>
+
+class tst_OpeningSuite: public QObject
+{
+	Q_OBJECT
+
+	private slots:
+		void initTestCase();
+
+		void order_data() const;
+		void order();
+		void startIndex();
+		void state_data() const;
+		void state();
+
+	private:
+		QStringList readOpenings(OpeningSuite* suite, int count) const;
+
+		QTemporaryDir m_dir;
+		QString m_fileName;
+		QStringList m_fens;
+};
+
+void tst_OpeningSuite::initTestCase()
+{
+	QVERIFY(m_dir.isValid());
+	m_fileName = m_dir.path() + "/openings.epd";
+
+	QFile file(m_fileName);
+	QVERIFY(file.open(QIODevice::WriteOnly | QIODevice::Text));
+
+	// Positions with a king on every square of the first rank
+	QTextStream out(&file);
+	for (int i = 0; i < 8; i++)
+	{
+		QString rank("K");
+		if (i > 0)
+			rank.prepend(QString::number(i));
+		if (i < 7)
+			rank.append(QString::number(7 - i));
+
+		for (const QString& side : { "w", "b" })
+		{
+			const QString fen = QString("k7/8/8/8/8/8/8/%1 %2 - -")
+				.arg(rank).arg(side);
+			out << fen << "\n";
+			m_fens << fen;
+		}
+	}
+}
+
+QStringList tst_OpeningSuite::readOpenings(OpeningSuite* suite, int count) const
+{
+	QStringList openings;
+	for (int i = 0; i < count; i++)
+		openings << suite->nextGame(10).startingFenString();
+
+	return openings;
+}
+
+void tst_OpeningSuite::order_data() const
+{
+	QTest::addColumn<int>("order");
+
+	QTest::newRow("sequential") << int(OpeningSuite::SequentialOrder);
+	QTest::newRow("random") << int(OpeningSuite::RandomOrder);
+}
+
+void tst_OpeningSuite::order()
+{
+	QFETCH(int, order);
+
+	// Read past the end of the suite to check the rewinding
+	const int count = m_fens.size() * 2 + 3;
+
+	Mersenne::initialize(1);
+	OpeningSuite suite(m_fileName, OpeningSuite::EpdFormat,
+			   OpeningSuite::Order(order));
+	QVERIFY(suite.initialize());
+	const QStringList expected(readOpenings(&suite, count));
+	QCOMPARE(expected.toSet().size(), m_fens.size());
+
+	Mersenne::initialize(1);
+	OpeningSuite prefetching(m_fileName, OpeningSuite::EpdFormat,
+				 OpeningSuite::Order(order));
+	QVERIFY(prefetching.initialize());
+	prefetching.startPrefetch(10, 3);
+	QCOMPARE(readOpenings(&prefetching, count), expected);
+}
+
+void tst_OpeningSuite::startIndex()
+{
+	OpeningSuite suite(m_fileName, OpeningSuite::EpdFormat,
+			   OpeningSuite::SequentialOrder, 5);
+	QVERIFY(suite.initialize());
+
+	OpeningSuite first(m_fileName, OpeningSuite::EpdFormat);
+	QVERIFY(first.initialize());
+	const QStringList openings(readOpenings(&first, m_fens.size()));
+
+	QCOMPARE(readOpenings(&suite, 3), openings.mid(5, 3));
+}
+
+void tst_OpeningSuite::state_data() const
+{
+	order_data();
+}
+
+void tst_OpeningSuite::state()
+{
+	QFETCH(int, order);
+
+	Mersenne::initialize(2);
+	OpeningSuite suite(m_fileName, OpeningSuite::EpdFormat,
+			   OpeningSuite::Order(order));
+	QVERIFY(suite.initialize());
+	suite.startPrefetch(10, 4);
+
+	readOpenings(&suite, 3);
+	const QVariantMap state(suite.state());
+	const QStringList expected(readOpenings(&suite, 5));
+
+	// The prefetched openings are not skipped
+	Mersenne::initialize(2);
+	OpeningSuite restored(m_fileName, OpeningSuite::EpdFormat,
+			      OpeningSuite::Order(order));
+	QVERIFY(restored.initialize());
+	QVERIFY(restored.restoreState(state));
+	QCOMPARE(readOpenings(&restored, 5), expected);
+
+	// Stopping rewinds to the first opening that wasn't returned
+	QVERIFY(suite.restoreState(state));
+	suite.stopPrefetch();
+	QCOMPARE(readOpenings(&suite, 5), expected);
+}
+
+QTEST_MAIN(tst_OpeningSuite)
+#include "tst_openingsuite.moc"
@@ -0,0 +1,4 @@
+include(../tests.pri)
+
+TARGET = tst_pgngamefilter
+SOURCES += tst_pgngamefilter.cpp
@@ -0,0 +1,91 @@
+#include <QtTest/QtTest>
+#include <pgngameentry.h>
+#include <pgngamefilter.h>
+#include <pgnstream.h>
+
+Q_DECLARE_METATYPE(PgnGameFilter)
+
+class tst_PgnGameFilter: public QObject
+{
+	Q_OBJECT
+
+	private slots:
+		void match_data() const;
+		void match();
+};
+
+namespace {
+
+const char* s_game =
+	"[Event \"Computer Chess Championship\"]\n"
+	"[Site \"Internet\"]\n"
+	"[Date \"2018.02.28\"]\n"
+	"[Round \"12\"]\n"
+	"[White \"Stockfish\"]\n"
+	"[Black \"Komodo\"]\n"
+	"[Result \"1-0\"]\n\n"
+	"1. e4 e5 1-0\n\n";
+
+} // anonymous namespace
+
+void tst_PgnGameFilter::match_data() const
+{
+	QTest::addColumn<PgnGameFilter>("filter");
+	QTest::addColumn<bool>("expected");
+
+	QTest::newRow("empty") << PgnGameFilter() << true;
+	QTest::newRow("fixed string") << PgnGameFilter("stockFISH") << true;
+	QTest::newRow("fixed string suffix") << PgnGameFilter("modo") << true;
+	QTest::newRow("fixed string mismatch") << PgnGameFilter("houdini") << false;
+	QTest::newRow("fixed string too long")
+		<< PgnGameFilter(QString(300, 'a')) << false;
+
+	PgnGameFilter filter;
+	filter.setEvent("championship");
+	filter.setSite("INTERNET");
+	QTest::newRow("event and site") << filter << true;
+	filter.setSite("Moscow");
+	QTest::newRow("site mismatch") << filter << false;
+
+	filter = PgnGameFilter();
+	filter.setPlayer("komodo", Chess::Side::Black);
+	filter.setOpponent("stock");
+	QTest::newRow("player as black") << filter << true;
+	filter.setPlayer("komodo", Chess::Side::White);
+	QTest::newRow("player as white") << filter << false;
+	filter.setPlayer("komodo", Chess::Side::NoSide);
+	filter.setResult(PgnGameFilter::FirstPlayerLoses);
+	QTest::newRow("player loses") << filter << true;
+	filter.setResult(PgnGameFilter::FirstPlayerWins);
+	QTest::newRow("player wins") << filter << false;
+
+	filter = PgnGameFilter();
+	filter.setMinDate(QDate(2018, 2, 28));
+	filter.setMaxDate(QDate(2018, 3, 1));
+	QTest::newRow("date range") << filter << true;
+	filter.setMinDate(QDate(2018, 3, 1));
+	QTest::newRow("date before range") << filter << false;
+
+	filter = PgnGameFilter();
+	filter.setMinRound(10);
+	filter.setMaxRound(12);
+	QTest::newRow("round range") << filter << true;
+	filter.setMaxRound(11);
+	QTest::newRow("round after range") << filter << false;
+}
+
+void tst_PgnGameFilter::match()
+{
+	QFETCH(PgnGameFilter, filter);
+	QFETCH(bool, expected);
+
+	const QByteArray data(s_game);
+	PgnStream stream(&data);
+	PgnGameEntry entry;
+	QVERIFY(entry.read(stream));
+
+	QCOMPARE(entry.match(filter), expected);
+}
+
+QTEST_MAIN(tst_PgnGameFilter)
+#include "tst_pgngamefilter.moc"
@@ -0,0 +1,187 @@
+#include <QtTest/QtTest>
+#include <pgnstream.h>
+#include <pgngameentry.h>
+
+namespace {
+
+const char* s_game =
+	"[Event \"Test\"]\n"
+	"[Site \"?\"]\n"
+	"[White \"Engine A\"]\n"
+	"[Black \"Engine B\"]\n"
+	"[Result \"1-0\"]\n"
+	"\n"
+	"1. e4 {+0.30/20 5s, a comment that is longer than one chunk of "
+	"the scanner\nand spans two lines} e5 (1... c5 {Sicilian} (1... e6))\n"
+	"2. Nf3 $1 ; a line comment\n"
+	"% an escaped line\n"
+	"Nc6 {nested {braces}} 3. Bb5 1-0\n"
+	"\n";
+
+} // anonymous namespace
+
+class tst_PgnStream: public QObject
+{
+	Q_OBJECT
+
+	private slots:
+		void tokens_data() const;
+		void tokens();
+		void devices_data() const;
+		void devices();
+		void seek();
+
+	private:
+		QStringList readTokens(PgnStream& stream) const;
+		QByteArray games(int count, bool crlf) const;
+};
+
+QStringList tst_PgnStream::readTokens(PgnStream& stream) const
+{
+	QStringList tokens;
+	while (stream.nextGame())
+	{
+		PgnStream::TokenType type;
+		while ((type = stream.readNext()) != PgnStream::NoToken)
+		{
+			tokens << QString("%1:%2").arg(int(type))
+				.arg(QString::fromLatin1(stream.tokenString()));
+		}
+		tokens << QString("line %1").arg(stream.lineNumber());
+	}
+
+	return tokens;
+}
+
+QByteArray tst_PgnStream::games(int count, bool crlf) const
+{
+	QByteArray data;
+	for (int i = 0; i < count; i++)
+		data += s_game;
+	if (crlf)
+		data.replace("\n", "\r\n");
+	return data;
+}
+
+void tst_PgnStream::tokens_data() const
+{
+	QTest::addColumn<QByteArray>("pgn");
+	QTest::addColumn<QStringList>("tokens");
+
+	QStringList tokens;
+	tokens << "3:Event \"Test\""
+	       << "3:Site \"?\""
+	       << "3:White \"Engine A\""
+	       << "3:Black \"Engine B\""
+	       << "3:Result \"1-0\""
+	       << "2:1"
+	       << "1:e4"
+	       << "4:+0.30/20 5s, a comment that is longer than one chunk "
+		  "of the scanner\nand spans two lines"
+	       << "1:e5"
+	       << "4:1... c5 {Sicilian} (1... e6)"
+	       << "2:2"
+	       << "1:Nf3"
+	       << "6:1"
+	       << "5: a line comment"
+	       << "1:Nc6"
+	       << "4:nested {braces}"
+	       << "2:3"
+	       << "1:Bb5"
+	       << "7:1-0"
+	       << "line 12";
+	QTest::newRow("game") << QByteArray(s_game) << tokens;
+
+	QTest::newRow("comments before tags")
+		<< QByteArray("{ [not a tag] } (1. e4 [no]) ; [no]\n"
+			      "% [no]\n[Event \"Test\"]")
+		<< (QStringList() << "3:Event \"Test\"" << "line 3");
+	QTest::newRow("empty") << QByteArray() << QStringList();
+}
+
+void tst_PgnStream::tokens()
+{
+	QFETCH(QByteArray, pgn);
+	QFETCH(QStringList, tokens);
+
+	PgnStream stream(&pgn);
+	QCOMPARE(readTokens(stream), tokens);
+	QCOMPARE(stream.status(), PgnStream::ReadPastEnd);
+}
+
+void tst_PgnStream::devices_data() const
+{
+	QTest::addColumn<QByteArray>("pgn");
+
+	// Larger than one block of a buffered device
+	QTest::newRow("lf") << games(500, false);
+	QTest::newRow("crlf") << games(500, true);
+}
+
+void tst_PgnStream::devices()
+{
+	QFETCH(QByteArray, pgn);
+
+	// The reference is a string without carriage returns
+	QByteArray lf(pgn);
+	lf.replace("\r\n", "\n");
+	PgnStream stringStream(&lf);
+	const QStringList expected(readTokens(stringStream));
+	QCOMPARE(expected.size(), 500 * 20);
+
+	// A mapped file
+	QTemporaryFile tmp;
+	QVERIFY(tmp.open());
+	QCOMPARE(tmp.write(pgn), qint64(pgn.size()));
+	tmp.close();
+
+	QFile file(tmp.fileName());
+	QVERIFY(file.open(QIODevice::ReadOnly | QIODevice::Text));
+	PgnStream fileStream(&file);
+	QCOMPARE(readTokens(fileStream), expected);
+
+	// A device that is read in blocks
+	QBuffer buffer(&pgn);
+	QVERIFY(buffer.open(QIODevice::ReadOnly | QIODevice::Text));
+	PgnStream bufferStream(&buffer);
+	QCOMPARE(readTokens(bufferStream), expected);
+
+	// The device's text mode is restored when it's released
+	bufferStream.reset();
+	QVERIFY(buffer.isTextModeEnabled());
+}
+
+void tst_PgnStream::seek()
+{
+	QByteArray pgn(games(500, true));
+	QBuffer buffer(&pgn);
+	QVERIFY(buffer.open(QIODevice::ReadOnly | QIODevice::Text));
+	PgnStream stream(&buffer);
+
+	QList<PgnGameEntry> entries;
+	PgnGameEntry entry;
+	while (entry.read(stream))
+		entries << entry;
+	QCOMPARE(entries.size(), 500);
+
+	// The positions are byte offsets in the device
+	const qint64 gameSize = games(1, true).size();
+	for (int i = 0; i < entries.size(); i++)
+	{
+		QCOMPARE(entries.at(i).pos(), i * gameSize);
+		QCOMPARE(entries.at(i).lineNumber(), qint64(i * 12 + 1));
+	}
+
+	for (int i : { 499, 0, 250, 251 })
+	{
+		QVERIFY(stream.seek(entries.at(i).pos(),
+				    entries.at(i).lineNumber()));
+		QVERIFY(entry.read(stream));
+		QCOMPARE(entry.pos(), entries.at(i).pos());
+		QCOMPARE(entry.tagValue(PgnGameEntry::WhiteTag),
+			 QString("Engine A"));
+	}
+}
+
+QTEST_MAIN(tst_PgnStream)
+#include "tst_pgnstream.moc"
@@ -1,7 +1,12 @@
 #include <QtTest/QtTest>
 #include <QMap>
+#include <QMultiMap>
+#include <QTemporaryDir>
 #include <polyglotbook.h>
 #include <board/standardboard.h>
+#ifdef Q_OS_LINUX
+#include <unistd.h>
+#endif
 
 class tst_PolyglotBook: public QObject
 {
@@ -10,8 +15,12 @@ class tst_PolyglotBook: public QObject
 	private slots:
 		void initialValues();
 		void startPos();
+		void probe_data() const;
+		void probe();
+		void memory();
 
 	private:
+		static qint64 residentBytes();
 		QMap<QString,quint16> entries(const OpeningBook* book,
 					      Chess::Board* board) const;
 };
@@ -72,6 +81,131 @@ void tst_PolyglotBook::startPos()
 
 	entries = this->entries(&book, &board);
 	QCOMPARE(entries, expect);
+
+	// Same test with two books sharing a memory-mapped file
+	book = PolyglotBook(OpeningBook::Mapped);
+	QVERIFY(book.read("book_small.bin"));
+	auto book2 = PolyglotBook(OpeningBook::Mapped);
+	QVERIFY(book2.read("book_small.bin"));
+
+	entries = this->entries(&book, &board);
+	QCOMPARE(entries, expect);
+	entries = this->entries(&book2, &board);
+	QCOMPARE(entries, expect);
+
+	// Other positions are found like in RAM mode
+	auto ramBook = PolyglotBook(OpeningBook::Ram);
+	QVERIFY(ramBook.read("book_small.bin"));
+	const QStringList moves = QStringList() << "e4" << "e5" << "Nf3";
+	for (const QString& move : moves)
+	{
+		board.makeMove(board.moveFromString(move));
+		QCOMPARE(this->entries(&book, &board),
+			 this->entries(&ramBook, &board));
+	}
+}
+
+void tst_PolyglotBook::probe_data() const
+{
+	QTest::addColumn<int>("mode");
+
+	QTest::newRow("ram") << int(OpeningBook::Ram);
+	QTest::newRow("disk") << int(OpeningBook::Disk);
+	QTest::newRow("mapped") << int(OpeningBook::Mapped);
+}
+
+void tst_PolyglotBook::probe()
+{
+	QFETCH(int, mode);
+
+	auto book = PolyglotBook(OpeningBook::AccessMode(mode));
+	QVERIFY(book.read("book_small.bin"));
+
+	// Keys of book positions and of positions missing from the book
+	QVector<quint64> keys;
+	Chess::StandardBoard board;
+	board.initialize();
+	board.setFenString(board.defaultFenString());
+	const QStringList moves = QStringList()
+		<< "e4" << "c5" << "Nf3" << "d6" << "d4" << "cxd4" << "Nxd4";
+	for (const QString& move : moves)
+	{
+		keys << board.key() << ~board.key();
+		board.makeMove(board.moveFromString(move));
+	}
+
+	int count = 0;
+	QBENCHMARK
+	{
+		for (quint64 key : qAsConst(keys))
+			count += book.entries(key).size();
+	}
+	QVERIFY(count > 0);
+}
+
+qint64 tst_PolyglotBook::residentBytes()
+{
+#ifdef Q_OS_LINUX
+	QFile file("/proc/self/statm");
+	if (!file.open(QIODevice::ReadOnly))
+		return -1;
+
+	const QList<QByteArray> fields = file.readAll().split(' ');
+	if (fields.size() < 2)
+		return -1;
+	return fields.at(1).toLongLong() * sysconf(_SC_PAGESIZE);
+#else
+	return -1;
+#endif
+}
+
+void tst_PolyglotBook::memory()
+{
+	if (residentBytes() < 0)
+		QSKIP("The resident memory size is not available");
+
+	// A book big enough for the memory use to dwarf the noise
+	QTemporaryDir dir;
+	QVERIFY(dir.isValid());
+	const QString fileName(dir.filePath("book_large.bin"));
+	const int count = 500000;
+	QVector<quint64> keys;
+	keys.reserve(count);
+	{
+		QFile file(fileName);
+		QVERIFY(file.open(QIODevice::WriteOnly));
+		QDataStream out(&file);
+
+		// Every entry is e2e4 with a different key
+		quint64 key = 0;
+		for (int i = 0; i < count; i++)
+		{
+			key += Q_UINT64_C(0x9e3779b97f4a7c15) >> 20;
+			keys << key;
+			out << key << quint16(796) << quint16(1) << quint32(0);
+		}
+	}
+
+	// The sorted record array of RAM mode
+	qint64 bytes = residentBytes();
+	auto book = PolyglotBook(OpeningBook::Ram);
+	QVERIFY(book.read(fileName));
+	const qint64 recordBytes = residentBytes() - bytes;
+
+	// The QMultiMap that RAM mode used before
+	bytes = residentBytes();
+	QMultiMap<quint64, OpeningBook::Entry> map;
+	for (quint64 key : qAsConst(keys))
+	{
+		for (const OpeningBook::Entry& entry : book.entries(key))
+			map.insert(key, entry);
+	}
+	const qint64 mapBytes = residentBytes() - bytes;
+
+	qInfo("%d entries: %lld bytes in records, %lld bytes in a map",
+	      count, recordBytes, mapBytes);
+	QCOMPARE(map.size(), count);
+	QVERIFY(recordBytes < mapBytes);
 }
 
 QTEST_MAIN(tst_PolyglotBook)
@@ -0,0 +1,194 @@
+#include <QtTest/QtTest>
+#include <positionindex.h>
+#include <pgngame.h>
+#include <pgnstream.h>
+#include <board/standardboard.h>
+
+class tst_PositionIndex: public QObject
+{
+	Q_OBJECT
+
+	private slots:
+		void initialValues();
+		void search_data() const;
+		void search();
+		void segments();
+
+	private:
+		QList<PgnGame> readGames(const QByteArray& pgn) const;
+		bool writeIndex(const QString& fileName,
+				int firstGame,
+				const QList<PgnGame>& games,
+				int runSize) const;
+		quint64 key(const QStringList& moves) const;
+		QStringList stats(const QVector<PositionIndex::MoveStats>& stats,
+				  const QStringList& moves) const;
+};
+
+namespace {
+
+const char* s_games =
+	"[Result \"1-0\"]\n\n1. e4 e5 2. Nf3 1-0\n\n"
+	"[Result \"0-1\"]\n\n1. e4 c5 0-1\n\n"
+	"[Result \"1/2-1/2\"]\n\n1. d4 d5 2. c4 1/2-1/2\n\n"
+	"[Result \"*\"]\n\n1. e4 e5 2. Nf3 Nc6 3. Ng1 Nb8 4. Nf3 *\n\n";
+
+} // anonymous namespace
+
+QList<PgnGame> tst_PositionIndex::readGames(const QByteArray& pgn) const
+{
+	QList<PgnGame> games;
+	PgnStream stream(&pgn);
+
+	PgnGame game;
+	while (game.read(stream))
+	{
+		games << game;
+		game.clear();
+	}
+
+	return games;
+}
+
+bool tst_PositionIndex::writeIndex(const QString& fileName,
+				   int firstGame,
+				   const QList<PgnGame>& games,
+				   int runSize) const
+{
+	PositionIndexWriter writer(fileName, firstGame, games.size(), runSize);
+	for (int i = 0; i < games.size(); i++)
+		writer.addGame(firstGame + i, games.at(i));
+
+	return writer.finish();
+}
+
+quint64 tst_PositionIndex::key(const QStringList& moves) const
+{
+	Chess::StandardBoard board;
+	board.initialize();
+	board.setFenString(board.defaultFenString());
+	for (const QString& move : moves)
+		board.makeMove(board.moveFromString(move));
+
+	return board.key();
+}
+
+QStringList tst_PositionIndex::stats(const QVector<PositionIndex::MoveStats>& stats,
+				     const QStringList& moves) const
+{
+	Chess::StandardBoard board;
+	board.initialize();
+	board.setFenString(board.defaultFenString());
+	for (const QString& move : moves)
+		board.makeMove(board.moveFromString(move));
+
+	QStringList ret;
+	for (const PositionIndex::MoveStats& s : stats)
+	{
+		QString san("-");
+		if (!s.move.isNull())
+		{
+			auto move = board.moveFromGenericMove(s.move);
+			san = board.moveString(move, Chess::Board::StandardAlgebraic);
+		}
+		ret << QString("%1 %2 +%3 -%4 =%5").arg(san).arg(s.games)
+			.arg(s.whiteWins).arg(s.blackWins).arg(s.draws);
+	}
+
+	return ret;
+}
+
+void tst_PositionIndex::initialValues()
+{
+	PositionIndex index;
+	QVERIFY(!index.isOpen());
+	QVERIFY(!index.open("foo.idx"));
+	QVERIFY(index.games(1234).isEmpty());
+	QVERIFY(index.moveStats(1234).isEmpty());
+}
+
+void tst_PositionIndex::search_data() const
+{
+	QTest::addColumn<int>("runSize");
+
+	QTest::newRow("one run") << 1000;
+	QTest::newRow("merged runs") << 3;
+}
+
+void tst_PositionIndex::search()
+{
+	QFETCH(int, runSize);
+
+	QTemporaryDir dir;
+	QVERIFY(dir.isValid());
+	const QString fileName(dir.path() + "/positions.idx");
+
+	const QList<PgnGame> games(readGames(s_games));
+	QCOMPARE(games.size(), 4);
+	QVERIFY(writeIndex(fileName, 0, games, runSize));
+
+	PositionIndex index;
+	QVERIFY(index.open(fileName));
+	QCOMPARE(index.firstGame(), 0);
+	QCOMPARE(index.gameCount(), 4);
+
+	// The starting position
+	QStringList moves;
+	QCOMPARE(index.games(key(moves)), QVector<int>() << 0 << 1 << 2 << 3);
+	QCOMPARE(stats(index.moveStats(key(moves)), moves),
+		 QStringList() << "e4 3 +1 -1 =0" << "d4 1 +0 -0 =1");
+
+	// Game 3 reaches the position twice but is counted once
+	moves << "e4" << "e5";
+	QCOMPARE(index.games(key(moves)), QVector<int>() << 0 << 3);
+	QCOMPARE(stats(index.moveStats(key(moves)), moves),
+		 QStringList() << "Nf3 2 +1 -0 =0");
+
+	// Game 0 and game 3 end in this position
+	moves << "Nf3";
+	QCOMPARE(index.games(key(moves)), QVector<int>() << 0 << 3);
+	QCOMPARE(stats(index.moveStats(key(moves)), moves),
+		 QStringList() << "- 2 +1 -0 =0" << "Nc6 1 +0 -0 =0");
+
+	// The final position of game 2
+	moves = QStringList() << "d4" << "d5" << "c4";
+	QCOMPARE(index.games(key(moves)), QVector<int>() << 2);
+	QCOMPARE(stats(index.moveStats(key(moves)), moves),
+		 QStringList() << "- 1 +0 -0 =1");
+
+	moves = QStringList() << "h4";
+	QVERIFY(index.games(key(moves)).isEmpty());
+	QVERIFY(index.moveStats(key(moves)).isEmpty());
+}
+
+void tst_PositionIndex::segments()
+{
+	QTemporaryDir dir;
+	QVERIFY(dir.isValid());
+
+	// The second part begins with the last game of the first part,
+	// like when games are appended to an indexed database
+	const QList<PgnGame> games(readGames(s_games));
+	const QList<PgnGame> newGames(readGames(
+		QByteArray("[Result \"*\"]\n\n1. e4 e5 2. Nf3 Nc6 3. Ng1 Nb8 4. Nf3 *\n\n"
+			   "[Result \"1-0\"]\n\n1. e4 e6 1-0\n\n")));
+	QVERIFY(writeIndex(dir.path() + "/0.idx", 0, games, 1000));
+	QVERIFY(writeIndex(dir.path() + "/3.idx", 3, newGames, 1000));
+
+	PositionIndex first;
+	PositionIndex second;
+	QVERIFY(first.open(dir.path() + "/0.idx"));
+	QVERIFY(second.open(dir.path() + "/3.idx"));
+	QCOMPARE(second.firstGame(), 3);
+	QCOMPARE(second.gameCount(), 2);
+
+	const QList<const PositionIndex*> indexes{ &first, &second };
+	QStringList moves;
+	QCOMPARE(PositionIndex::games(indexes, key(moves)),
+		 QVector<int>() << 0 << 1 << 2 << 3 << 4);
+	QCOMPARE(stats(PositionIndex::moveStats(indexes, key(moves)), moves),
+		 QStringList() << "e4 4 +2 -1 =0" << "d4 1 +0 -0 =1");
+}
+
+QTEST_MAIN(tst_PositionIndex)
+#include "tst_positionindex.moc"
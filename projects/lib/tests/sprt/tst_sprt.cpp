@@ -9,6 +9,8 @@ class tst_Sprt: public QObject
 	private slots:
 		void sprt_data() const;
 		void sprt();
+		void pentanomial_data() const;
+		void pentanomial();
 
 	private:
 		bool fuzzyCompare(double val1, double val2);
@@ -100,5 +102,73 @@ void tst_Sprt::sprt()
 	QVERIFY(fuzzyCompare(status.uBound, ubound));
 }
 
+void tst_Sprt::pentanomial_data() const
+{
+	QTest::addColumn<double>("elo0");
+	QTest::addColumn<double>("elo1");
+	QTest::addColumn<double>("alpha");
+	QTest::addColumn<double>("beta");
+	QTest::addColumn<QList<int> >("pairs");
+	QTest::addColumn<double>("llr");
+	QTest::addColumn<int>("result");
+
+	QTest::newRow("continue")
+		<< 0.0
+		<< 5.0
+		<< 0.05
+		<< 0.05
+		<< (QList<int>() << 10 << 100 << 300 << 120 << 15)
+		<< 1.09
+		<< int(Sprt::Continue);
+
+	QTest::newRow("h0")
+		<< 0.0
+		<< 5.0
+		<< 0.05
+		<< 0.05
+		<< (QList<int>() << 20 << 150 << 300 << 90 << 10)
+		<< -4.15
+		<< int(Sprt::AcceptH0);
+}
+
+void tst_Sprt::pentanomial()
+{
+	QFETCH(double, elo0);
+	QFETCH(double, elo1);
+	QFETCH(double, alpha);
+	QFETCH(double, beta);
+	QFETCH(QList<int>, pairs);
+	QFETCH(double, llr);
+	QFETCH(int, result);
+
+	// Game pairs for each total score from 0 to 2 points
+	const Sprt::GameResult games[5][2] = {
+		{ Sprt::Loss, Sprt::Loss },
+		{ Sprt::Draw, Sprt::Loss },
+		{ Sprt::Win, Sprt::Loss },
+		{ Sprt::Win, Sprt::Draw },
+		{ Sprt::Win, Sprt::Win }
+	};
+
+	Sprt sprt;
+	sprt.initialize(elo0, elo1, alpha, beta, Sprt::Pentanomial);
+
+	for (int i = 0; i < 5; i++)
+	{
+		for (int j = 0; j < pairs.at(i); j++)
+			sprt.addGamePairResult(games[i][0], games[i][1]);
+		QCOMPARE(sprt.pairCount(i), pairs.at(i));
+	}
+
+	// Pairs with an unfinished game are ignored
+	sprt.addGamePairResult(Sprt::Win, Sprt::NoResult);
+
+	Sprt::Status status = sprt.status();
+	QVERIFY(fuzzyCompare(status.llr, llr));
+	QVERIFY(fuzzyCompare(status.lBound, -2.94));
+	QVERIFY(fuzzyCompare(status.uBound, 2.94));
+	QCOMPARE(int(status.result), result);
+}
+
 QTEST_MAIN(tst_Sprt)
 #include "tst_sprt.moc"
@@ -2,6 +2,58 @@
 #include <board/standardboard.h>
 #include <board/syzygytablebase.h>
 
+namespace {
+
+const char* s_probeFens[] =
+{
+	"7k/8/8/8/5KP1/8/8/8 w - - 0 1",
+	"7k/8/8/6P1/5K2/8/8/8 w - - 0 1",
+	"8/2k5/8/6N1/5K2/1r6/8/8 w - - 0 1",
+	"1n6/8/8/8/8/8/6R1/2K1k3 w - - 0 1",
+	"2B5/8/8/8/8/2K2k2/6p1/8 b - - 0 1",
+	"8/B7/8/8/8/2K2k2/6p1/8 b - - 0 1",
+	"2K4N/8/8/8/7p/5k2/8/8 w - - 0 1",
+	"K5Q1/8/8/8/5bb1/6k1/8/8 b - - 0 72"
+};
+
+class ProbeTask : public QRunnable
+{
+	public:
+		ProbeTask(int probeCount, QStringList* results)
+			: m_probeCount(probeCount),
+			  m_results(results)
+		{
+		}
+
+		virtual void run()
+		{
+			QList<Chess::StandardBoard*> boards;
+			for (const char* fen : s_probeFens)
+			{
+				auto board = new Chess::StandardBoard;
+				board->initialize();
+				board->setFenString(fen);
+				boards << board;
+			}
+
+			for (int i = 0; i < m_probeCount; i++)
+			{
+				const int j = i % boards.size();
+				const QString result(
+					boards.at(j)->tablebaseResult().toShortString());
+				if (m_results != nullptr)
+					m_results->append(result);
+			}
+			qDeleteAll(boards);
+		}
+
+	private:
+		int m_probeCount;
+		QStringList* m_results;
+};
+
+} // anonymous namespace
+
 
 class tst_Tb: public QObject
 {
@@ -14,6 +66,9 @@ class tst_Tb: public QObject
 		
 		void positions_data() const;
 		void positions();
+		void concurrentProbes();
+		void probe_data() const;
+		void probe();
 		
 		void cleanupTestCase();
 		
@@ -112,5 +167,54 @@ void tst_Tb::positions()
 	QCOMPARE(int(tbDtz), dtz);
 }
 
+void tst_Tb::concurrentProbes()
+{
+	const int probeCount = int(sizeof(s_probeFens) / sizeof(s_probeFens[0])) * 50;
+	QStringList expected;
+	ProbeTask(probeCount, &expected).run();
+
+	QThreadPool pool;
+	pool.setMaxThreadCount(8);
+	QVector<QStringList> results(8);
+	for (QStringList& result : results)
+	{
+		auto task = new ProbeTask(probeCount, &result);
+		pool.start(task);
+	}
+	pool.waitForDone();
+
+	for (const QStringList& result : qAsConst(results))
+		QCOMPARE(result, expected);
+}
+
+void tst_Tb::probe_data() const
+{
+	QTest::addColumn<int>("threads");
+
+	QTest::newRow("1 thread") << 1;
+	QTest::newRow("2 threads") << 2;
+	QTest::newRow("4 threads") << 4;
+	QTest::newRow("8 threads") << 8;
+	QTest::newRow("32 threads") << 32;
+}
+
+void tst_Tb::probe()
+{
+	QFETCH(int, threads);
+
+	// Every thread does the same number of probes, so the probes per
+	// second are threads * probeCount / time
+	const int probeCount = 2000;
+	QThreadPool pool;
+	pool.setMaxThreadCount(threads);
+
+	QBENCHMARK
+	{
+		for (int i = 0; i < threads; i++)
+			pool.start(new ProbeTask(probeCount, nullptr));
+		pool.waitForDone();
+	}
+}
+
 QTEST_MAIN(tst_Tb)
 #include "tst_tb.moc"
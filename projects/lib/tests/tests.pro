@@ -1,5 +1,5 @@
 TEMPLATE = subdirs
-SUBDIRS = chessboard tb sprt mersenne tournamentplayer tournamentpair polyglotbook graph_blossom
+SUBDIRS = chessboard tb sprt eloratings mersenne tournamentplayer tournamentpair polyglotbook graph_blossom workerpool pgnstream positionindex pgngamefilter openingsuite econode timecontrol wheeltimer movelatency
 win32 {
     SUBDIRS += pipereader
 }
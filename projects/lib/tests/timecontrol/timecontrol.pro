@@ -0,0 +1,4 @@
+include(../tests.pri)
+
+TARGET = tst_timecontrol
+SOURCES += tst_timecontrol.cpp
@@ -0,0 +1,111 @@
+#include <QtTest/QtTest>
+#include <timecontrol.h>
+
+class tst_TimeControl: public QObject
+{
+	Q_OBJECT
+
+	private slots:
+		void drift_data() const;
+		void drift();
+		void roundingDown();
+		void expiry();
+		void timer();
+};
+
+void tst_TimeControl::drift_data() const
+{
+	QTest::addColumn<QString>("tc");
+	QTest::addColumn<int>("moves");
+	QTest::addColumn<qint64>("moveTime");
+	QTest::addColumn<qint64>("timeLeft");
+
+	// 300 moves of 200.3456 ms with a 0.5 s increment
+	QTest::newRow("increment")
+		<< "60+0.5" << 300 << Q_INT64_C(200345600)
+		<< Q_INT64_C(60000000000) + 300 * (Q_INT64_C(500000000) - Q_INT64_C(200345600));
+	// Three repeating time controls of 40 moves of 0.9999 ms
+	QTest::newRow("moves per tc")
+		<< "40/10" << 120 << Q_INT64_C(999900)
+		<< Q_INT64_C(40000000000) - 120 * Q_INT64_C(999900);
+	// Sub-millisecond moves, which a millisecond clock would miss
+	QTest::newRow("bullet")
+		<< "1+0.01" << 1000 << Q_INT64_C(10700)
+		<< Q_INT64_C(1000000000) + 1000 * (Q_INT64_C(10000000) - Q_INT64_C(10700));
+}
+
+void tst_TimeControl::drift()
+{
+	QFETCH(QString, tc);
+	QFETCH(int, moves);
+	QFETCH(qint64, moveTime);
+	QFETCH(qint64, timeLeft);
+
+	TimeControl timeControl(tc);
+	QVERIFY(timeControl.isValid());
+	timeControl.initialize();
+
+	for (int i = 0; i < moves; i++)
+	{
+		timeControl.update(true, moveTime);
+		QCOMPARE(timeControl.lastMoveTimeNs(), moveTime);
+	}
+
+	QCOMPARE(timeControl.timeLeftNs(), timeLeft);
+	QCOMPARE(timeControl.timeLeft(), int(timeLeft / 1000000));
+	QVERIFY(!timeControl.expired());
+}
+
+void tst_TimeControl::roundingDown()
+{
+	TimeControl tc("1");
+	tc.initialize();
+
+	tc.update(false, Q_INT64_C(400000));
+	QCOMPARE(tc.lastMoveTime(), 0);
+	QCOMPARE(tc.timeLeftNs(), Q_INT64_C(999600000));
+	QCOMPARE(tc.timeLeft(), 999);
+
+	// A clock that has run out never shows time left
+	tc.setTimeLeftNs(Q_INT64_C(-400000));
+	QCOMPARE(tc.timeLeft(), -1);
+	tc.setTimeLeftNs(Q_INT64_C(-1000000));
+	QCOMPARE(tc.timeLeft(), -1);
+
+	tc.setTimeLeft(250);
+	QCOMPARE(tc.timeLeftNs(), Q_INT64_C(250000000));
+}
+
+void tst_TimeControl::expiry()
+{
+	TimeControl tc("1");
+	tc.setExpiryMargin(5);
+	tc.initialize();
+
+	tc.update(false, Q_INT64_C(1005000000));
+	QVERIFY(!tc.expired());
+
+	// Going over the margin by a fraction of a millisecond is enough
+	tc.initialize();
+	tc.update(false, Q_INT64_C(1005000001));
+	QVERIFY(tc.expired());
+}
+
+void tst_TimeControl::timer()
+{
+	TimeControl tc("10");
+	tc.initialize();
+	QCOMPARE(tc.activeTimeLeftNs(), Q_INT64_C(10000000000));
+
+	tc.startTimer();
+	QTest::qSleep(20);
+	QVERIFY(tc.activeTimeLeftNs() <= Q_INT64_C(9980000000));
+	tc.update(false);
+
+	QVERIFY(tc.lastMoveTimeNs() >= Q_INT64_C(20000000));
+	QCOMPARE(tc.lastMoveTime(), int(tc.lastMoveTimeNs() / 1000000));
+	QCOMPARE(tc.timeLeftNs(), Q_INT64_C(10000000000) - tc.lastMoveTimeNs());
+}
+
+QTEST_MAIN(tst_TimeControl)
+#include "tst_timecontrol.moc"
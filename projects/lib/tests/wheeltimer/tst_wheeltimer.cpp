@@ -0,0 +1,160 @@
+#include <QtTest/QtTest>
+#include <wheeltimer.h>
+
+class tst_WheelTimer: public QObject
+{
+	Q_OBJECT
+
+	private slots:
+		void timeout();
+		void order();
+		void restart();
+		void stop();
+		void stopFromSlot();
+		void longInterval();
+		void thread();
+};
+
+void tst_WheelTimer::timeout()
+{
+	WheelTimer timer;
+	QSignalSpy spy(&timer, SIGNAL(timeout()));
+	QElapsedTimer elapsed;
+
+	QVERIFY(!timer.isActive());
+	QCOMPARE(timer.remainingTime(), -1);
+
+	elapsed.start();
+	timer.start(50);
+	QVERIFY(timer.isActive());
+	QVERIFY(timer.remainingTime() <= 50);
+
+	QVERIFY(spy.wait(1000));
+	QVERIFY(elapsed.elapsed() >= 49);
+	QVERIFY(!timer.isActive());
+
+	// Single shot
+	QTest::qWait(100);
+	QCOMPARE(spy.count(), 1);
+}
+
+void tst_WheelTimer::order()
+{
+	// Intervals on different levels of the wheel
+	const QList<int> intervals = { 300, 5, 70, 0, 130, 65, 1 };
+	QList<int> fired;
+	QList<WheelTimer*> timers;
+
+	for (int interval : intervals)
+	{
+		WheelTimer* timer = new WheelTimer(this);
+		connect(timer, &WheelTimer::timeout, [&fired, interval]()
+		{
+			fired << interval;
+		});
+		timer->start(interval);
+		timers << timer;
+	}
+
+	QList<int> expected(intervals);
+	std::sort(expected.begin(), expected.end());
+	QTRY_COMPARE_WITH_TIMEOUT(fired, expected, 2000);
+	qDeleteAll(timers);
+}
+
+void tst_WheelTimer::restart()
+{
+	WheelTimer timer;
+	timer.setInterval(300);
+	QSignalSpy spy(&timer, SIGNAL(timeout()));
+	QElapsedTimer elapsed;
+	elapsed.start();
+
+	// Restarting postpones the timeout, like an idle timer
+	for (int i = 0; i < 5; i++)
+	{
+		timer.start();
+		QTest::qWait(50);
+		QCOMPARE(spy.count(), 0);
+	}
+
+	QVERIFY(spy.wait(1000));
+	QVERIFY(elapsed.elapsed() >= 549);
+	QCOMPARE(timer.interval(), 300);
+}
+
+void tst_WheelTimer::stop()
+{
+	WheelTimer timer;
+	QSignalSpy spy(&timer, SIGNAL(timeout()));
+
+	timer.start(20);
+	timer.stop();
+	QVERIFY(!timer.isActive());
+	QTest::qWait(100);
+	QCOMPARE(spy.count(), 0);
+
+	// A deleted timer is removed from the wheel
+	WheelTimer* deleted = new WheelTimer;
+	deleted->start(10);
+	delete deleted;
+	timer.start(30);
+	QVERIFY(spy.wait(1000));
+}
+
+void tst_WheelTimer::stopFromSlot()
+{
+	// Timers that expire on the same tick can stop each other
+	WheelTimer first;
+	WheelTimer second;
+	QSignalSpy spy(&second, SIGNAL(timeout()));
+	connect(&first, &WheelTimer::timeout, &second, &WheelTimer::stop);
+	connect(&first, &WheelTimer::timeout, [&first]()
+	{
+		first.start(1000);
+	});
+
+	first.start(20);
+	second.start(20);
+	QTRY_VERIFY_WITH_TIMEOUT(first.remainingTime() > 500, 1000);
+	QVERIFY(!second.isActive());
+	QTest::qWait(50);
+	QCOMPARE(spy.count(), 0);
+	first.stop();
+}
+
+void tst_WheelTimer::longInterval()
+{
+	WheelTimer timer;
+	timer.start(3 * 3600 * 1000);
+	QVERIFY(timer.isActive());
+	QVERIFY(timer.remainingTime() > 3 * 3600 * 1000 - 1000);
+
+	// A short timer doesn't wait for the long one
+	WheelTimer shortTimer;
+	QSignalSpy spy(&shortTimer, SIGNAL(timeout()));
+	shortTimer.start(10);
+	QVERIFY(spy.wait(1000));
+	QVERIFY(timer.isActive());
+}
+
+void tst_WheelTimer::thread()
+{
+	QThread thread;
+	thread.start();
+
+	WheelTimer* timer = new WheelTimer;
+	connect(&thread, SIGNAL(finished()), timer, SLOT(deleteLater()));
+	QSignalSpy spy(timer, SIGNAL(timeout()));
+	timer->start(50);
+	timer->moveToThread(&thread);
+
+	// The timer is started again in the new thread
+	QTRY_COMPARE_WITH_TIMEOUT(spy.count(), 1, 1000);
+
+	thread.quit();
+	QVERIFY(thread.wait(1000));
+}
+
+QTEST_MAIN(tst_WheelTimer)
+#include "tst_wheeltimer.moc"
@@ -0,0 +1,4 @@
+include(../tests.pri)
+
+TARGET = tst_wheeltimer
+SOURCES += tst_wheeltimer.cpp
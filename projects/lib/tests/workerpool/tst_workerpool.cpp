@@ -0,0 +1,311 @@
+#include <QtTest/QtTest>
+#include <workerpool.h>
+#include <engineworker.h>
+#include <engineconfiguration.h>
+
+
+// Runs an EngineWorker with its own event loop, like a separate process
+class WorkerThread : public QThread
+{
+	public:
+		WorkerThread()
+			: m_port(0)
+		{
+		}
+
+		quint16 port() const
+		{
+			return m_port;
+		}
+
+		void startWorker()
+		{
+			start();
+			m_ready.acquire();
+		}
+
+		void stopWorker()
+		{
+			quit();
+			wait();
+		}
+
+	protected:
+		virtual void run()
+		{
+			QList<EngineConfiguration> engines;
+			engines << engine("cat", "cat")
+				<< engine("true", "true")
+				<< engine("bad", "/nonexistent/engine");
+
+			EngineWorker worker;
+			worker.setSecret("secret");
+			worker.setEngines(engines);
+			worker.listen();
+			m_port = worker.port();
+			m_ready.release();
+
+			exec();
+		}
+
+	private:
+		static EngineConfiguration engine(const QString& name,
+						  const QString& command)
+		{
+			EngineConfiguration config;
+			config.setName(name);
+			config.setCommand(command);
+			return config;
+		}
+
+		quint16 m_port;
+		QSemaphore m_ready;
+};
+
+class tst_WorkerPool: public QObject
+{
+	Q_OBJECT
+
+	private slots:
+		void initTestCase();
+		void init();
+		void cleanup();
+
+		void addWorker_data() const;
+		void addWorker();
+		void echo();
+		void balance();
+		void badCommand();
+		void unknownEngine();
+		void badSecret();
+		void engineExit();
+		void lostWorker();
+		void noWorker();
+
+	private:
+		EngineConfiguration config(const QString& name) const;
+		bool readLine(QIODevice* device, QByteArray* line) const;
+		bool waitForFinished(QIODevice* device) const;
+		QString address(const WorkerThread* worker) const;
+
+		WorkerThread* m_workers[2];
+		WorkerPool* m_pool;
+};
+
+EngineConfiguration tst_WorkerPool::config(const QString& name) const
+{
+	// The command is ignored: the worker runs its own engine
+	EngineConfiguration config;
+	config.setName(name);
+	config.setCommand("/nonexistent/local/engine");
+	return config;
+}
+
+bool tst_WorkerPool::readLine(QIODevice* device, QByteArray* line) const
+{
+	QSignalSpy finished(device, SIGNAL(readChannelFinished()));
+	for (int i = 0; i < 500 && !device->canReadLine(); i++)
+	{
+		if (!finished.isEmpty())
+			return false;
+		QTest::qWait(10);
+	}
+	if (!device->canReadLine())
+		return false;
+
+	*line = device->readLine();
+	return true;
+}
+
+bool tst_WorkerPool::waitForFinished(QIODevice* device) const
+{
+	QSignalSpy finished(device, SIGNAL(readChannelFinished()));
+	return finished.wait(5000);
+}
+
+QString tst_WorkerPool::address(const WorkerThread* worker) const
+{
+	return QString("127.0.0.1:%1").arg(worker->port());
+}
+
+void tst_WorkerPool::initTestCase()
+{
+#ifdef Q_OS_WIN32
+	QSKIP("The tests use Unix commands as engines");
+#endif
+}
+
+void tst_WorkerPool::init()
+{
+	m_pool = new WorkerPool;
+	m_pool->setSecret("secret");
+	for (int i = 0; i < 2; i++)
+	{
+		m_workers[i] = new WorkerThread;
+		m_workers[i]->startWorker();
+		m_pool->addWorker("127.0.0.1", m_workers[i]->port());
+	}
+}
+
+void tst_WorkerPool::cleanup()
+{
+	for (int i = 0; i < 2; i++)
+	{
+		m_workers[i]->stopWorker();
+		delete m_workers[i];
+	}
+	delete m_pool;
+}
+
+void tst_WorkerPool::addWorker_data() const
+{
+	QTest::addColumn<QString>("address");
+	QTest::addColumn<bool>("valid");
+
+	QTest::newRow("host") << "localhost:5000" << true;
+	QTest::newRow("ipv4") << "192.168.0.1:5000" << true;
+	QTest::newRow("no port") << "localhost" << false;
+	QTest::newRow("bad port") << "localhost:70000" << false;
+	QTest::newRow("no host") << ":5000" << false;
+}
+
+void tst_WorkerPool::addWorker()
+{
+	QFETCH(QString, address);
+	QFETCH(bool, valid);
+
+	const int count = m_pool->workerCount();
+	QCOMPARE(m_pool->addWorker(address), valid);
+	QCOMPARE(m_pool->workerCount(), count + (valid ? 1 : 0));
+}
+
+void tst_WorkerPool::echo()
+{
+	QString error;
+	QIODevice* device = m_pool->startEngine(config("cat"), &error);
+	QVERIFY2(device != nullptr, qUtf8Printable(error));
+
+	// Written before the engine has started
+	QByteArray line;
+	device->write("uci\n");
+	QVERIFY(readLine(device, &line));
+	QCOMPARE(line, QByteArray("uci\n"));
+
+	device->write("isready\n");
+	QVERIFY(readLine(device, &line));
+	QCOMPARE(line, QByteArray("isready\n"));
+
+	delete device;
+}
+
+void tst_WorkerPool::balance()
+{
+	QString error;
+	QIODevice* first = m_pool->startEngine(config("cat"), &error);
+	QIODevice* second = m_pool->startEngine(config("cat"), &error);
+	QVERIFY(first != nullptr);
+	QVERIFY(second != nullptr);
+
+	// The second engine goes to the idle worker
+	QTRY_VERIFY(!WorkerPool::workerAddress(first).isEmpty());
+	QTRY_VERIFY(!WorkerPool::workerAddress(second).isEmpty());
+	QVERIFY(WorkerPool::workerAddress(first)
+		!= WorkerPool::workerAddress(second));
+
+	delete first;
+	delete second;
+}
+
+void tst_WorkerPool::badCommand()
+{
+	QString error;
+	QIODevice* device = m_pool->startEngine(config("bad"), &error);
+	QVERIFY(device != nullptr);
+
+	QVERIFY(waitForFinished(device));
+	QVERIFY(device->errorString().startsWith("Cannot execute command"));
+	QVERIFY(!WorkerPool::isLostDevice(device));
+	delete device;
+}
+
+void tst_WorkerPool::unknownEngine()
+{
+	QString error;
+	QIODevice* device = m_pool->startEngine(config("sh"), &error);
+	QVERIFY(device != nullptr);
+
+	QVERIFY(waitForFinished(device));
+	QVERIFY(device->errorString().startsWith("Unknown engine"));
+	delete device;
+}
+
+void tst_WorkerPool::badSecret()
+{
+	m_pool->setSecret("guess");
+
+	QString error;
+	QIODevice* device = m_pool->startEngine(config("cat"), &error);
+	QVERIFY(device != nullptr);
+
+	QVERIFY(waitForFinished(device));
+	QCOMPARE(device->errorString(), QString("Unauthorized"));
+	delete device;
+}
+
+void tst_WorkerPool::engineExit()
+{
+	QString error;
+	QIODevice* device = m_pool->startEngine(config("true"), &error);
+	QVERIFY2(device != nullptr, qUtf8Printable(error));
+
+	QByteArray line;
+	QVERIFY(!readLine(device, &line));
+	QVERIFY(!WorkerPool::workerAddress(device).isEmpty());
+	QVERIFY(!WorkerPool::isLostDevice(device));
+
+	delete device;
+}
+
+void tst_WorkerPool::lostWorker()
+{
+	QString error;
+	QIODevice* device = m_pool->startEngine(config("cat"), &error);
+	QVERIFY2(device != nullptr, qUtf8Printable(error));
+	QTRY_VERIFY(!WorkerPool::workerAddress(device).isEmpty());
+
+	const QString lostAddress = WorkerPool::workerAddress(device);
+	WorkerThread* lost = m_workers[0];
+	if (address(lost) != lostAddress)
+		lost = m_workers[1];
+	lost->stopWorker();
+
+	QByteArray line;
+	QVERIFY(!readLine(device, &line));
+	QVERIFY(WorkerPool::isLostDevice(device));
+	delete device;
+
+	// New engines go to the worker that is still alive
+	for (int i = 0; i < 2; i++)
+	{
+		QIODevice* next = m_pool->startEngine(config("cat"), &error);
+		QVERIFY2(next != nullptr, qUtf8Printable(error));
+		QTRY_VERIFY(!WorkerPool::workerAddress(next).isEmpty());
+		QVERIFY(WorkerPool::workerAddress(next) != lostAddress);
+		delete next;
+	}
+
+	// Restart the worker so that cleanup() has something to stop
+	lost->startWorker();
+}
+
+void tst_WorkerPool::noWorker()
+{
+	WorkerPool pool;
+
+	QString error;
+	QVERIFY(pool.startEngine(config("cat"), &error) == nullptr);
+	QVERIFY(!error.isEmpty());
+}
+
+QTEST_MAIN(tst_WorkerPool)
+#include "tst_workerpool.moc"
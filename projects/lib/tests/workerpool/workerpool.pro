@@ -0,0 +1,4 @@
+include(../tests.pri)
+
+TARGET = tst_workerpool
+SOURCES += tst_workerpool.cpp